@@ -0,0 +1,76 @@
+﻿//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+using System;
+using System.Diagnostics;
+using Urho3DNet;
+
+namespace DemoApplication
+{
+    /// Measures dispatch of update event to many managed subscribers through VariantMap and through typed payload.
+    internal static class EventDispatchBenchmark
+    {
+        private const int NumReceivers = 500;
+        private const int NumFrames = 1000;
+        private static readonly StringHash BenchmarkEvent = new StringHash("EventDispatchBenchmark");
+
+        public static void Run(Context context)
+        {
+            float checksum = 0.0f;
+            Measure(context, "VariantMap", receiver => receiver.SubscribeToEvent(BenchmarkEvent,
+                args => checksum += args[E.Update.TimeStep].Float));
+            Measure(context, "Typed payload", receiver => receiver.SubscribeToEvent(BenchmarkEvent,
+                (StringHash e, in UpdateEventArgs args) => checksum += args.TimeStep));
+            Console.WriteLine($"Checksum: {checksum}");
+        }
+
+        private static void Measure(Context context, string name, Action<Node> subscribe)
+        {
+            var receivers = new Node[NumReceivers];
+            for (var i = 0; i < NumReceivers; ++i)
+            {
+                receivers[i] = new Node(context);
+                subscribe(receivers[i]);
+            }
+
+            using (var sender = new Node(context))
+            using (var eventData = new VariantMap())
+            {
+                eventData[E.Update.TimeStep] = 1.0f / 60.0f;
+
+                GC.Collect();
+                int collections = GC.CollectionCount(0);
+                var stopwatch = Stopwatch.StartNew();
+                for (var frame = 0; frame < NumFrames; ++frame)
+                    sender.SendEvent(BenchmarkEvent, eventData);
+                stopwatch.Stop();
+                collections = GC.CollectionCount(0) - collections;
+
+                double microseconds = stopwatch.Elapsed.TotalMilliseconds * 1000.0 / (NumFrames * (double)NumReceivers);
+                Console.WriteLine($"{name}: {microseconds:F3} us per handler call, {collections} gen0 collections");
+            }
+
+            foreach (Node receiver in receivers)
+                receiver.Dispose();
+        }
+    }
+}
@@ -95,9 +95,9 @@ namespace DemoApplication
             _light.Position = new Vector3(0, 2, -1);
             _light.LookAt(Vector3.Zero);
 
-            SubscribeToEvent(E.Update, args =>
+            SubscribeToEvent(E.Update, (StringHash e, in UpdateEventArgs args) =>
             {
-                float timestep = args[E.Update.TimeStep].Float;
+                float timestep = args.TimeStep;
                 Debug.Assert(this != null);
 
                 if (ImGui.Begin("Urho3D.NET"))
@@ -117,6 +117,12 @@ namespace DemoApplication
             Context.SetRuntimeApi(new CompiledScriptRuntimeApiImpl());
             using (var context = new Context())
             {
+                if (Array.IndexOf(args, "--benchmark-events") >= 0)
+                {
+                    EventDispatchBenchmark.Run(context);
+                    return;
+                }
+
                 using (var application = new DemoApplication(context))
                 {
                     Environment.ExitCode = application.Run();
@@ -0,0 +1,283 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include <Urho3D/Core/CoreEvents.h>
+#include <Urho3D/Core/Profiler.h>
+#include <Urho3D/Graphics/Camera.h>
+#include <Urho3D/Graphics/Light.h>
+#include <Urho3D/Graphics/Material.h>
+#include <Urho3D/Graphics/Model.h>
+#include <Urho3D/Graphics/Octree.h>
+#include <Urho3D/Graphics/Renderer.h>
+#include <Urho3D/Graphics/StaticModel.h>
+#include <Urho3D/Graphics/Zone.h>
+#include <Urho3D/Input/Input.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/Scene/Scene.h>
+#include <Urho3D/UI/Font.h>
+#include <Urho3D/UI/Text.h>
+#include <Urho3D/UI/UI.h>
+
+#include "ManyLights.h"
+
+#include <Urho3D/DebugNew.h>
+
+namespace
+{
+
+/// Size of the ground in world units.
+const float GROUND_SIZE = 200.0f;
+/// Range of the lights.
+const float LIGHT_RANGE = 6.0f;
+/// Radius of light orbits.
+const float LIGHT_ORBIT_RADIUS = 3.0f;
+
+}
+
+ManyLights::ManyLights(Context* context) :
+    Sample(context)
+{
+}
+
+void ManyLights::Start()
+{
+    // Execute base class startup
+    Sample::Start();
+
+    // Create the scene content
+    CreateScene();
+
+    // Create the UI content
+    CreateInstructions();
+
+    // Setup the viewport for displaying the scene
+    SetupViewport();
+
+    // Hook up to the frame update events
+    SubscribeToEvents();
+
+    // Set the mouse mode to use in the sample
+    Sample::InitMouseMode(MM_RELATIVE);
+}
+
+void ManyLights::CreateScene()
+{
+    auto* cache = GetSubsystem<ResourceCache>();
+
+    scene_ = new Scene(context_);
+
+    // Create the Octree component to the scene so that drawable objects can be rendered. Use default volume
+    // (-1000, -1000, -1000) to (1000, 1000, 1000)
+    scene_->CreateComponent<Octree>();
+
+    // Create a Zone with dim ambient light so the point lights dominate
+    Node* zoneNode = scene_->CreateChild("Zone");
+    auto* zone = zoneNode->CreateComponent<Zone>();
+    zone->SetBoundingBox(BoundingBox(-1000.0f, 1000.0f));
+    zone->SetAmbientColor(Color(0.05f, 0.05f, 0.05f));
+    zone->SetFogColor(Color(0.0f, 0.0f, 0.0f));
+    zone->SetFogStart(150.0f);
+    zone->SetFogEnd(250.0f);
+
+    // Create the ground
+    Node* planeNode = scene_->CreateChild("Plane");
+    planeNode->SetScale(Vector3(GROUND_SIZE, 1.0f, GROUND_SIZE));
+    auto* planeObject = planeNode->CreateComponent<StaticModel>();
+    planeObject->SetModel(cache->GetResource<Model>("Models/Plane.mdl"));
+    planeObject->SetMaterial(cache->GetResource<Material>("Materials/StoneTiled.xml"));
+
+    // Create a grid of boxes so that every light touches a few objects
+    for (int y = -20; y < 20; ++y)
+    {
+        for (int x = -20; x < 20; ++x)
+        {
+            Node* boxNode = scene_->CreateChild("Box");
+            boxNode->SetPosition(Vector3(x * 5.0f, 1.0f, y * 5.0f));
+            boxNode->SetScale(2.0f);
+            auto* boxObject = boxNode->CreateComponent<StaticModel>();
+            boxObject->SetModel(cache->GetResource<Model>("Models/Box.mdl"));
+            boxObject->SetMaterial(cache->GetResource<Material>("Materials/Stone.xml"));
+        }
+    }
+
+    CreateLights();
+
+    // Create the camera. Create it outside the scene so that we can clear the whole scene without affecting it
+    cameraNode_ = new Node(context_);
+    cameraNode_->SetPosition(Vector3(0.0f, 20.0f, -80.0f));
+    pitch_ = 15.0f;
+    cameraNode_->SetRotation(Quaternion(pitch_, yaw_, 0.0f));
+    auto* camera = cameraNode_->CreateComponent<Camera>();
+    camera->SetFarClip(300.0f);
+}
+
+void ManyLights::CreateLights()
+{
+    for (Node* lightNode : lightNodes_)
+        lightNode->Remove();
+    lightNodes_.clear();
+    lightPhases_.clear();
+    lightCenters_.clear();
+
+    // Use fixed seed so the benchmark is reproducible
+    SetRandomSeed(1);
+
+    const float halfSize = GROUND_SIZE * 0.5f - LIGHT_RANGE;
+    for (unsigned i = 0; i < numLights_; ++i)
+    {
+        const Vector3 center{ Random(-halfSize, halfSize), Random(0.5f, 3.0f), Random(-halfSize, halfSize) };
+
+        Node* lightNode = scene_->CreateChild("PointLight");
+        lightNode->SetPosition(center);
+        auto* light = lightNode->CreateComponent<Light>();
+        light->SetLightType(LIGHT_POINT);
+        light->SetRange(LIGHT_RANGE);
+        light->SetColor(Color(Random(0.2f, 1.0f), Random(0.2f, 1.0f), Random(0.2f, 1.0f)));
+
+        lightNodes_.push_back(SharedPtr<Node>(lightNode));
+        lightPhases_.push_back(Random(360.0f));
+        lightCenters_.push_back(center);
+    }
+}
+
+void ManyLights::CreateInstructions()
+{
+    auto* cache = GetSubsystem<ResourceCache>();
+    auto* ui = GetSubsystem<UI>();
+
+    // Construct new Text object and font to use
+    instructionText_ = ui->GetRoot()->CreateChild<Text>();
+    instructionText_->SetFont(cache->GetResource<Font>("Fonts/Anonymous Pro.ttf"), 15);
+    // The text has multiple rows. Center them in relation to each other
+    instructionText_->SetTextAlignment(HA_CENTER);
+
+    // Position the text relative to the screen center
+    instructionText_->SetHorizontalAlignment(HA_CENTER);
+    instructionText_->SetVerticalAlignment(VA_CENTER);
+    instructionText_->SetPosition(0, ui->GetRoot()->GetHeight() / 4);
+
+    UpdateInstructions();
+}
+
+void ManyLights::UpdateInstructions()
+{
+    instructionText_->SetText(Format(
+        "Use WASD keys and mouse/touch to move\n"
+        "Space to toggle light animation\n"
+        "+/- to change number of lights: {}", numLights_));
+}
+
+void ManyLights::SetupViewport()
+{
+    auto* renderer = GetSubsystem<Renderer>();
+
+    // Set up a viewport to the Renderer subsystem so that the 3D scene can be seen
+    SharedPtr<Viewport> viewport(new Viewport(context_, scene_, cameraNode_->GetComponent<Camera>()));
+    renderer->SetViewport(0, viewport);
+}
+
+void ManyLights::SubscribeToEvents()
+{
+    // Subscribe HandleUpdate() function for processing update events
+    SubscribeToEvent(E_UPDATE, URHO3D_HANDLER(ManyLights, HandleUpdate));
+}
+
+void ManyLights::MoveCamera(float timeStep)
+{
+    // Do not move if the UI has a focused element (the console)
+    if (GetSubsystem<UI>()->GetFocusElement())
+        return;
+
+    auto* input = GetSubsystem<Input>();
+
+    // Movement speed as world units per second
+    const float MOVE_SPEED = 20.0f;
+    // Mouse sensitivity as degrees per pixel
+    const float MOUSE_SENSITIVITY = 0.1f;
+
+    // Use this frame's mouse motion to adjust camera node yaw and pitch. Clamp the pitch between -90 and 90 degrees
+    IntVector2 mouseMove = input->GetMouseMove();
+    yaw_ += MOUSE_SENSITIVITY * mouseMove.x_;
+    pitch_ += MOUSE_SENSITIVITY * mouseMove.y_;
+    pitch_ = Clamp(pitch_, -90.0f, 90.0f);
+
+    // Construct new orientation for the camera scene node from yaw and pitch. Roll is fixed to zero
+    cameraNode_->SetRotation(Quaternion(pitch_, yaw_, 0.0f));
+
+    // Read WASD keys and move the camera scene node to the corresponding direction if they are pressed
+    if (input->GetKeyDown(KEY_W))
+        cameraNode_->Translate(Vector3::FORWARD * MOVE_SPEED * timeStep);
+    if (input->GetKeyDown(KEY_S))
+        cameraNode_->Translate(Vector3::BACK * MOVE_SPEED * timeStep);
+    if (input->GetKeyDown(KEY_A))
+        cameraNode_->Translate(Vector3::LEFT * MOVE_SPEED * timeStep);
+    if (input->GetKeyDown(KEY_D))
+        cameraNode_->Translate(Vector3::RIGHT * MOVE_SPEED * timeStep);
+}
+
+void ManyLights::AnimateLights(float timeStep)
+{
+    URHO3D_PROFILE("AnimateLights");
+
+    const float ORBIT_SPEED = 45.0f;
+
+    for (unsigned i = 0; i < lightNodes_.size(); ++i)
+    {
+        lightPhases_[i] += ORBIT_SPEED * timeStep;
+        const Vector3 offset{ Cos(lightPhases_[i]), 0.0f, Sin(lightPhases_[i]) };
+        lightNodes_[i]->SetPosition(lightCenters_[i] + offset * LIGHT_ORBIT_RADIUS);
+    }
+}
+
+void ManyLights::HandleUpdate(StringHash eventType, VariantMap& eventData)
+{
+    using namespace Update;
+
+    // Take the frame time step, which is stored as a float
+    float timeStep = eventData[P_TIMESTEP].GetFloat();
+
+    // Toggle animation with space
+    auto* input = GetSubsystem<Input>();
+    if (input->GetKeyPress(KEY_SPACE))
+        animate_ = !animate_;
+
+    // Change number of lights
+    if (input->GetKeyPress(KEY_KP_PLUS) || input->GetKeyPress(KEY_EQUALS))
+    {
+        numLights_ = ea::min(numLights_ * 2, 8192u);
+        CreateLights();
+        UpdateInstructions();
+    }
+    if (input->GetKeyPress(KEY_KP_MINUS) || input->GetKeyPress(KEY_MINUS))
+    {
+        numLights_ = ea::max(numLights_ / 2, 16u);
+        CreateLights();
+        UpdateInstructions();
+    }
+
+    // Move the camera, scale movement with time step
+    MoveCamera(timeStep);
+
+    // Animate lights if enabled
+    if (animate_)
+        AnimateLights(timeStep);
+}
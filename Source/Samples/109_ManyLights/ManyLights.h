@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "Sample.h"
+
+namespace Urho3D
+{
+
+class Node;
+class Scene;
+class Text;
+
+}
+
+/// Many lights example.
+/// This sample demonstrates:
+///     - Creating a scene with hundreds of small point lights
+///     - Benchmarking light culling and per-light processing of the render pipeline
+///     - Using the profiler to measure the time taken to process the lights
+class ManyLights : public Sample
+{
+    URHO3D_OBJECT(ManyLights, Sample);
+
+public:
+    /// Construct.
+    explicit ManyLights(Context* context);
+
+    /// Setup after engine initialization and before running the main loop.
+    void Start() override;
+
+protected:
+    /// Return XML patch instructions for screen joystick layout for a specific sample app, if any.
+    ea::string GetScreenJoystickPatchString() const override { return
+        "<patch>"
+        "    <remove sel=\"/element/element[./attribute[@name='Name' and @value='Button1']]/attribute[@name='Is Visible']\" />"
+        "    <replace sel=\"/element/element[./attribute[@name='Name' and @value='Button1']]/element[./attribute[@name='Name' and @value='Label']]/attribute[@name='Text']/@value\">Animation</replace>"
+        "    <add sel=\"/element/element[./attribute[@name='Name' and @value='Button1']]\">"
+        "        <element type=\"Text\">"
+        "            <attribute name=\"Name\" value=\"KeyBinding\" />"
+        "            <attribute name=\"Text\" value=\"SPACE\" />"
+        "        </element>"
+        "    </add>"
+        "</patch>";
+    }
+
+private:
+    /// Construct the scene content.
+    void CreateScene();
+    /// Create lights in the scene.
+    void CreateLights();
+    /// Construct an instruction text to the UI.
+    void CreateInstructions();
+    /// Update instruction text.
+    void UpdateInstructions();
+    /// Set up a viewport for displaying the scene.
+    void SetupViewport();
+    /// Subscribe to application-wide logic update events.
+    void SubscribeToEvents();
+    /// Read input and move the camera.
+    void MoveCamera(float timeStep);
+    /// Animate the lights.
+    void AnimateLights(float timeStep);
+    /// Handle the logic update event.
+    void HandleUpdate(StringHash eventType, VariantMap& eventData);
+
+    /// Light scene nodes.
+    ea::vector<SharedPtr<Node>> lightNodes_;
+    /// Light orbit phases.
+    ea::vector<float> lightPhases_;
+    /// Light orbit centers.
+    ea::vector<Vector3> lightCenters_;
+    /// Instruction text.
+    Text* instructionText_{};
+    /// Number of lights.
+    unsigned numLights_{ 512 };
+    /// Animation flag.
+    bool animate_{ true };
+};
@@ -129,6 +129,7 @@
 #include "107_HelloRmlUI/HelloRmlUI.h"
 #endif
 #include "108_RenderingShowcase/RenderingShowcase.h"
+#include "109_ManyLights/ManyLights.h"
 #include "Rotator.h"
 
 #include "SamplesManager.h"
@@ -319,6 +320,7 @@ void SamplesManager::Start()
     RegisterSample<HelloRmlUI>();
 #endif
     RegisterSample<RenderingShowcase>();
+    RegisterSample<ManyLights>();
 
     if (!startSample_.empty())
         StartSample(startSample_);
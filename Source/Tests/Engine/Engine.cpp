@@ -22,6 +22,12 @@
 
 #include "../CommonUtils.h"
 
+#include <Urho3D/Core/CoreEvents.h>
+#include <Urho3D/Core/WorkQueue.h>
+#include <Urho3D/Engine/Engine.h>
+
+#include <atomic>
+
 TEST_CASE("Engine started multiple times in same process")
 {
     {
@@ -32,3 +38,103 @@ TEST_CASE("Engine started multiple times in same process")
         auto context = Tests::CreateCompleteTestContext();
     }
 }
+
+TEST_CASE("Pipelined work queued at extraction boundary is completed in the same frame")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto engine = context->GetSubsystem<Engine>();
+    engine->SetPipelinedFrame(false);
+    engine->SetMaxFps(0);
+
+    std::atomic<unsigned> numExecuted{};
+    engine->SubscribeToEvent(E_RENDEREXTRACT, [&](StringHash, VariantMap&)
+    {
+        for (unsigned i = 0; i < 16; ++i)
+            engine->AddPipelinedWork([&](unsigned) { ++numExecuted; });
+    });
+
+    engine->RunFrame();
+    CHECK(numExecuted == 16);
+    CHECK(context->GetSubsystem<WorkQueue>()->IsCompleted(PIPELINED_WORK_PRIORITY));
+
+    engine->RunFrame();
+    CHECK(numExecuted == 32);
+}
+
+TEST_CASE("Pipelined work is completed in the next frame before the next extraction")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto engine = context->GetSubsystem<Engine>();
+    auto workQueue = context->GetSubsystem<WorkQueue>();
+    engine->SetPipelinedFrame(true);
+    engine->SetMaxFps(0);
+
+    std::atomic<unsigned> numExecuted{};
+    unsigned numQueued{};
+    ea::vector<unsigned> numExecutedOnUpdate;
+    engine->SubscribeToEvent(E_UPDATE, [&](StringHash, VariantMap&)
+    {
+        numExecutedOnUpdate.push_back(numExecuted);
+        CHECK(workQueue->IsCompleted(PIPELINED_WORK_PRIORITY));
+    });
+    engine->SubscribeToEvent(E_RENDEREXTRACT, [&](StringHash, VariantMap&)
+    {
+        // Work is not waited for by the end of the frame
+        for (unsigned i = 0; i < 16; ++i)
+            engine->AddPipelinedWork([&](unsigned) { ++numExecuted; });
+        numQueued += 16;
+    });
+
+    for (unsigned i = 0; i < 3; ++i)
+        engine->RunFrame();
+
+    REQUIRE(numExecutedOnUpdate.size() == 3);
+    CHECK(numExecutedOnUpdate[0] == 0);
+    CHECK(numExecutedOnUpdate[1] == 16);
+    CHECK(numExecutedOnUpdate[2] == 32);
+
+    engine->CompletePipelinedWork();
+    CHECK(numExecuted == numQueued);
+}
+
+TEST_CASE("Frame limiter executes queued work while waiting for frame deadline")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto engine = context->GetSubsystem<Engine>();
+    auto workQueue = context->GetSubsystem<WorkQueue>();
+    engine->SetMaxFps(100);
+    CHECK_FALSE(engine->GetFrameLimiterSlackWork());
+    engine->SetFrameLimiterSlackWork(true);
+
+    std::atomic<unsigned> numExecuted{};
+    for (unsigned i = 0; i < 4; ++i)
+        workQueue->AddWorkItem([&](unsigned) { ++numExecuted; }, 0);
+
+    // Items may be taken by worker threads as well, but the queue is drained before the frame ends
+    engine->RunFrame();
+    CHECK_FALSE(workQueue->ExecuteQueuedItem());
+
+    workQueue->Complete(0);
+    CHECK(numExecuted == 4);
+}
+
+TEST_CASE("Main thread executes only queued work items within priority limit")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    // Use queue without worker threads, so items are executed only explicitly
+    auto workQueue = MakeShared<WorkQueue>(context);
+
+    unsigned lowPriorityExecuted{};
+    unsigned highPriorityExecuted{};
+    workQueue->AddWorkItem([&](unsigned) { ++highPriorityExecuted; }, 10);
+    workQueue->AddWorkItem([&](unsigned) { ++lowPriorityExecuted; }, SLACK_WORK_MAX_PRIORITY);
+
+    CHECK(workQueue->ExecuteQueuedItem(SLACK_WORK_MAX_PRIORITY));
+    CHECK(lowPriorityExecuted == 1);
+    CHECK_FALSE(workQueue->ExecuteQueuedItem(SLACK_WORK_MAX_PRIORITY));
+    CHECK(highPriorityExecuted == 0);
+
+    CHECK(workQueue->ExecuteQueuedItem());
+    CHECK(highPriorityExecuted == 1);
+    CHECK_FALSE(workQueue->ExecuteQueuedItem());
+}
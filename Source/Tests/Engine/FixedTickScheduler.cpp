@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Core/CoreEvents.h>
+#include <Urho3D/Engine/Engine.h>
+#include <Urho3D/Engine/FixedTickScheduler.h>
+#ifdef URHO3D_PHYSICS
+#include <Urho3D/Physics/PhysicsWorld.h>
+#include <Urho3D/Scene/Scene.h>
+#endif
+
+TEST_CASE("Fixed tick scheduler runs frames with constant timestep on tick grid")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto scheduler = MakeShared<FixedTickScheduler>(context);
+    scheduler->SetTickRate(200);
+    scheduler->SetCatchUpMode(TickCatchUpMode::Burst);
+
+    ea::vector<float> timeSteps;
+    scheduler->SubscribeToEvent(E_UPDATE, [&](StringHash, VariantMap& eventData)
+    {
+        timeSteps.push_back(eventData[Update::P_TIMESTEP].GetFloat());
+    });
+
+    const long long startTime = FixedTickScheduler::GetMonotonicTime();
+    unsigned numTicks = 0;
+    while (numTicks < 10)
+        numTicks += scheduler->Step();
+    const long long elapsed = FixedTickScheduler::GetMonotonicTime() - startTime;
+
+    // First tick runs immediately, the others wait for their deadlines
+    CHECK(elapsed >= 9 * 5000000LL);
+    REQUIRE(timeSteps.size() == 10);
+    for (float timeStep : timeSteps)
+        CHECK(timeStep == Catch::Approx(0.005f));
+
+    const FixedTickStatistics stats = scheduler->GetStatistics();
+    CHECK(stats.numTicks_ == 10);
+    CHECK(stats.durationMax_ >= stats.durationP50_);
+    CHECK(stats.latenessMax_ >= stats.latenessP50_);
+}
+
+#ifdef URHO3D_PHYSICS
+TEST_CASE("Fixed tick scheduler configures physics world to single step per tick")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto scene = MakeShared<Scene>(context);
+    auto physicsWorld = scene->CreateComponent<PhysicsWorld>();
+
+    auto scheduler = MakeShared<FixedTickScheduler>(context);
+    scheduler->SetTickRate(30);
+    scheduler->SetupPhysicsWorld(physicsWorld);
+
+    CHECK(physicsWorld->GetFps() == 30);
+    CHECK(physicsWorld->GetMaxSubSteps() == -1);
+}
+#endif
@@ -0,0 +1,147 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Core/Context.h>
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/Core/WorkQueue.h>
+#include <Urho3D/Engine/PluginStateMigration.h>
+#include <Urho3D/Graphics/Material.h>
+#include <Urho3D/Resource/ResourceCache.h>
+#include <Urho3D/Scene/Scene.h>
+#include <Urho3D/Scene/SmoothedTransform.h>
+
+namespace
+{
+
+/// Component of a type provided by plugin.
+class PluginComponent : public Component
+{
+    URHO3D_OBJECT(PluginComponent, Component);
+
+public:
+    explicit PluginComponent(Context* context) : Component(context) {}
+
+    static void RegisterObject(Context* context)
+    {
+        context->RegisterFactory<PluginComponent>();
+        URHO3D_ATTRIBUTE("Is Enabled", bool, enabled_, true, AM_DEFAULT);
+        URHO3D_ATTRIBUTE("Value", unsigned, value_, 0, AM_DEFAULT);
+        URHO3D_ATTRIBUTE("Name", ea::string, name_, EMPTY_STRING, AM_DEFAULT);
+        URHO3D_MIXED_ACCESSOR_ATTRIBUTE("Material", GetMaterialAttr, SetMaterialAttr, ResourceRef,
+            ResourceRef(Material::GetTypeStatic()), AM_DEFAULT);
+    }
+
+    void SetMaterialAttr(const ResourceRef& value)
+    {
+        auto cache = GetSubsystem<ResourceCache>();
+        material_ = cache->GetResource<Material>(value.name_);
+    }
+
+    ResourceRef GetMaterialAttr() const
+    {
+        return GetResourceRef(material_, Material::GetTypeStatic());
+    }
+
+    unsigned value_{};
+    ea::string name_;
+    SharedPtr<Material> material_;
+};
+
+}
+
+TEST_CASE("PluginStateMigration restores plugin components in place")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    PluginComponent::RegisterObject(context);
+
+    // Make sure there are worker threads, resources must be loaded in main thread anyway
+    auto workQueue = context->GetSubsystem<WorkQueue>();
+    if (workQueue->GetNumThreads() == 0)
+        workQueue->CreateThreads(2);
+
+    auto cache = context->GetSubsystem<ResourceCache>();
+    auto material = MakeShared<Material>(context);
+    material->SetName("Materials/PluginComponent.xml");
+    cache->AddManualResource(material);
+
+    const unsigned numNodes = 100;
+    auto scene = MakeShared<Scene>(context);
+    ea::vector<SharedPtr<Component>> otherComponents;
+    ea::vector<ea::pair<unsigned, unsigned>> expectedComponents;
+    for (unsigned i = 0; i < numNodes; ++i)
+    {
+        Node* node = scene->CreateChild(Format("Node {}", i));
+        otherComponents.emplace_back(node->CreateComponent<SmoothedTransform>());
+
+        auto component = node->CreateComponent<PluginComponent>();
+        component->value_ = i;
+        component->name_ = Format("Component {}", i);
+        component->SetEnabled(i % 2 == 0);
+        component->material_ = material;
+        expectedComponents.emplace_back(component->GetID(), i);
+
+        if (i % 3 == 0)
+        {
+            auto localComponent = node->CreateComponent<PluginComponent>(LOCAL);
+            localComponent->value_ = numNodes + i;
+            expectedComponents.emplace_back(localComponent->GetID(), numNodes + i);
+            otherComponents.emplace_back(node->CreateComponent<SmoothedTransform>());
+        }
+    }
+
+    // Save state and unload plugin types
+    PluginStateMigration migration(context);
+    migration.Save({ scene }, { PluginComponent::GetTypeStatic() });
+    CHECK(migration.GetStats().numComponents_ == expectedComponents.size());
+    ea::vector<PluginComponent*> remainingComponents;
+    scene->GetComponents(remainingComponents, true);
+    CHECK(remainingComponents.empty());
+    for (Component* component : otherComponents)
+        CHECK(component->GetNode() != nullptr);
+
+    context->RemoveFactory(PluginComponent::GetTypeStatic());
+    context->RemoveAllAttributes(PluginComponent::GetTypeStatic());
+    PluginComponent::RegisterObject(context);
+
+    // Restore state, other components are not touched
+    CHECK(migration.Restore() == expectedComponents.size());
+    CHECK(migration.IsEmpty());
+    for (const auto& [id, value] : expectedComponents)
+    {
+        auto component = scene->GetComponent(id)->Cast<PluginComponent>();
+        REQUIRE(component);
+        CHECK(component->value_ == value);
+        if (value < numNodes)
+        {
+            CHECK(component->name_ == Format("Component {}", value));
+            CHECK(component->IsEnabled() == (value % 2 == 0));
+            CHECK(component->material_ == material);
+            CHECK(component->GetNode()->GetComponentIndex(component) == 1);
+        }
+        else
+            CHECK(component->GetNode()->GetComponentIndex(component) == 2);
+    }
+    for (Component* component : otherComponents)
+        CHECK(component->GetNode() != nullptr);
+}
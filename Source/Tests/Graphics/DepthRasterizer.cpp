@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Graphics/DepthRasterizer.h>
+
+namespace
+{
+
+const int width = 8;
+const int height = 8;
+
+/// Quad covering left half of the viewport at given depth, clockwise in screen space.
+void DrawHalfScreenQuad(DepthRasterizer& rasterizer, float depth, bool clockwise)
+{
+    const Vector3 positions[4]{
+        { -1.0f, 1.0f, depth }, { 0.0f, 1.0f, depth }, { 0.0f, -1.0f, depth }, { -1.0f, -1.0f, depth } };
+    const unsigned short clockwiseIndices[6]{ 0, 1, 2, 0, 2, 3 };
+    const unsigned short counterClockwiseIndices[6]{ 0, 2, 1, 0, 3, 2 };
+
+    DepthRasterizerBatch batch;
+    batch.vertexData_ = reinterpret_cast<const unsigned char*>(positions);
+    batch.vertexCount_ = 4;
+    batch.vertexSize_ = sizeof(Vector3);
+    batch.indexData_ = reinterpret_cast<const unsigned char*>(clockwise ? clockwiseIndices : counterClockwiseIndices);
+    batch.indexDataCount_ = 6;
+    batch.indexSize_ = sizeof(unsigned short);
+    batch.drawCount_ = 6;
+    rasterizer.DrawTriangles(Matrix4::IDENTITY, batch);
+}
+
+}
+
+TEST_CASE("DepthRasterizer writes depth of front-facing triangles")
+{
+    ea::vector<float> depthBuffer(width * height);
+
+    DepthRasterizer rasterizer;
+    rasterizer.SetTarget(depthBuffer.data(), width, height);
+    DepthRasterizerState state;
+    state.viewport_ = { 0, 0, width, height };
+    rasterizer.SetState(state);
+    rasterizer.Clear(state.viewport_, 1.0f);
+
+    DrawHalfScreenQuad(rasterizer, 0.5f, true);
+    DrawHalfScreenQuad(rasterizer, 0.25f, false);
+    DrawHalfScreenQuad(rasterizer, 0.75f, true);
+
+    // Each pixel is covered exactly once, back faces are culled, farther quad is rejected
+    CHECK(rasterizer.GetNumTriangles() == 6);
+    CHECK(rasterizer.GetNumPixelsPassed() == width * height / 2);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+            CHECK(depthBuffer[y * width + x] == (x < width / 2 ? 0.5f : 1.0f));
+    }
+}
+
+TEST_CASE("DepthRasterizer clips triangles against near plane and scissor")
+{
+    ea::vector<float> depthBuffer(width * height);
+
+    DepthRasterizer rasterizer;
+    rasterizer.SetTarget(depthBuffer.data(), width, height);
+    DepthRasterizerState state;
+    state.viewport_ = { 0, 0, width, height };
+    state.cullMode_ = CULL_NONE;
+    state.scissorTest_ = true;
+    state.scissorRect_ = { 0, 0, width, height / 2 };
+    rasterizer.SetState(state);
+    rasterizer.Clear(state.viewport_, 1.0f);
+
+    // Triangle crossing near plane: only part with non-negative depth is drawn
+    rasterizer.DrawTriangle({ -1.0f, -1.0f, -1.0f, 1.0f }, { 1.0f, -1.0f, -1.0f, 1.0f }, { 0.0f, 1.0f, 1.0f, 1.0f });
+    CHECK(rasterizer.GetNumPixelsPassed() > 0);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            const float depth = depthBuffer[y * width + x];
+            CHECK(depth >= 0.0f);
+            if (y >= height / 2)
+                CHECK(depth == 1.0f);
+        }
+    }
+}
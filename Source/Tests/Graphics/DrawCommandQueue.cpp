@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Graphics/DrawCommandQueue.h>
+#include <Urho3D/Graphics/ShaderProgramLayout.h>
+
+namespace
+{
+
+class TestShaderProgramLayout : public ShaderProgramLayout
+{
+public:
+    TestShaderProgramLayout()
+    {
+        AddConstantBuffer(SP_CAMERA, 16);
+        AddConstantBufferParameter("CameraValue", SP_CAMERA, 0, 16);
+        AddConstantBuffer(SP_OBJECT, 16);
+        AddConstantBufferParameter("ObjectValue", SP_OBJECT, 0, 16);
+        RecalculateLayoutHash();
+    }
+};
+
+void RecordDraw(DrawCommandQueue& queue, const Vector4& cameraValue, const Vector4& objectValue)
+{
+    if (queue.BeginShaderParameterGroup(SP_CAMERA, true))
+    {
+        queue.AddShaderParameter("CameraValue", cameraValue);
+        queue.CommitShaderParameterGroup(SP_CAMERA);
+    }
+    if (queue.BeginShaderParameterGroup(SP_OBJECT, true))
+    {
+        queue.AddShaderParameter("ObjectValue", objectValue);
+        queue.CommitShaderParameterGroup(SP_OBJECT);
+    }
+    queue.Draw(0, 3);
+}
+
+}
+
+TEST_CASE("DrawCommandQueue deduplicates identical constant buffer blocks")
+{
+    auto layout = MakeShared<TestShaderProgramLayout>();
+    auto queue = MakeShared<DrawCommandQueue>(nullptr);
+    queue->Reset(true, 16);
+    queue->SetShaderProgramLayout(layout);
+    REQUIRE(queue->GetUseConstantBuffers());
+
+    // Identical camera blocks are reused, object blocks are never deduplicated
+    RecordDraw(*queue, Vector4::ONE, Vector4::ONE);
+    RecordDraw(*queue, Vector4::ONE, Vector4::ONE);
+    RecordDraw(*queue, Vector4::ONE, Vector4::ZERO);
+    CHECK(queue->GetNumDrawCommands() == 3);
+    CHECK(queue->GetNumDeduplicatedBlocks() == 2);
+
+    // Different camera block is kept
+    RecordDraw(*queue, Vector4::ZERO, Vector4::ONE);
+    CHECK(queue->GetNumDeduplicatedBlocks() == 2);
+
+    // Appended queue keeps its own statistics, its camera block is identical to one of this queue
+    auto otherQueue = MakeShared<DrawCommandQueue>(nullptr);
+    otherQueue->Reset(true, 16);
+    otherQueue->SetShaderProgramLayout(layout);
+    RecordDraw(*otherQueue, Vector4::ONE, Vector4::ONE);
+    RecordDraw(*otherQueue, Vector4::ONE, Vector4::ONE);
+    CHECK(otherQueue->GetNumDeduplicatedBlocks() == 1);
+
+    queue->Append(*otherQueue);
+    CHECK(queue->GetNumDrawCommands() == 6);
+    CHECK(queue->GetNumDeduplicatedBlocks() == 4);
+
+    queue->Reset(true, 16);
+    CHECK(queue->GetNumDeduplicatedBlocks() == 0);
+}
@@ -0,0 +1,133 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Graphics/HierarchicalLOD.h>
+#include <Urho3D/Graphics/Model.h>
+#include <Urho3D/Graphics/Octree.h>
+#include <Urho3D/Graphics/StaticModel.h>
+#include <Urho3D/Scene/Scene.h>
+
+namespace
+{
+
+/// Create unit cube model.
+SharedPtr<Model> CreateCubeModel(Context* context)
+{
+    GeometryLODView lod;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+        ModelVertex vertex{};
+        vertex.SetPosition({ i & 1 ? 0.5f : -0.5f, i & 2 ? 0.5f : -0.5f, i & 4 ? 0.5f : -0.5f });
+        lod.vertices_.push_back(vertex);
+    }
+    lod.indices_ = {
+        0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6, 0, 1, 5, 0, 5, 4,
+        2, 6, 7, 2, 7, 3, 0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5 };
+
+    GeometryView geometry;
+    geometry.lods_.push_back(lod);
+
+    ModelVertexFormat vertexFormat;
+    vertexFormat.position_ = TYPE_VECTOR3;
+
+    auto modelView = MakeShared<ModelView>(context);
+    modelView->SetVertexFormat(vertexFormat);
+    modelView->SetGeometries({ geometry });
+    return modelView->ExportModel();
+}
+
+}
+
+TEST_CASE("Hierarchical LOD replaces distant static models with proxy")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto scene = MakeShared<Scene>(context);
+    scene->CreateComponent<Octree>();
+
+    const SharedPtr<Model> cubeModel = CreateCubeModel(context);
+    ea::vector<StaticModel*> sourceModels;
+    for (unsigned i = 0; i < 10; ++i)
+    {
+        Node* node = scene->CreateChild("Cube");
+        node->SetPosition({ 5.0f + i * 2.0f, 0.5f, 5.0f });
+        auto staticModel = node->CreateComponent<StaticModel>();
+        staticModel->SetModel(cubeModel);
+        sourceModels.push_back(staticModel);
+    }
+
+    HierarchicalLODSettings settings;
+    settings.clusterSize_ = 100.0f;
+    settings.simplificationCellSize_ = 0.0f;
+    settings.proxyDistance_ = 50.0f;
+
+    auto builder = MakeShared<HierarchicalLODBuilder>(context);
+    REQUIRE(builder->Build(scene, settings) == 1);
+
+    auto group = scene->GetComponent<HierarchicalLODGroup>(true);
+    REQUIRE(group);
+    CHECK(group->GetNumSourceDrawables() == 10);
+
+    auto proxyModel = group->GetNode()->GetComponent<StaticModel>();
+    REQUIRE(proxyModel);
+    CHECK(proxyModel->GetModel()->GetNumGeometries() == 1);
+    CHECK(proxyModel->GetWorldBoundingBox().Size().Equals({ 19.0f, 1.0f, 1.0f }));
+
+    // Source models are visible nearby
+    group->UpdateLOD({ 10.0f, 0.0f, 10.0f });
+    CHECK_FALSE(group->IsProxyActive());
+    CHECK_FALSE(proxyModel->GetOctant());
+    for (StaticModel* staticModel : sourceModels)
+        CHECK(staticModel->GetOctant());
+
+    // Proxy is used far away
+    group->UpdateLOD({ 10.0f, 0.0f, 200.0f });
+    CHECK(group->IsProxyActive());
+    CHECK(proxyModel->GetOctant());
+    for (StaticModel* staticModel : sourceModels)
+        CHECK_FALSE(staticModel->GetOctant());
+
+    // Everything is restored when group is removed
+    group->Remove();
+    CHECK(proxyModel->GetOctant());
+    for (StaticModel* staticModel : sourceModels)
+        CHECK(staticModel->GetOctant());
+}
+
+TEST_CASE("Hierarchical LOD simplification merges vertices in cell")
+{
+    GeometryLODView lod;
+    for (const Vector3& position : { Vector3{ 0.1f, 0.1f, 0.1f }, Vector3{ 0.2f, 0.2f, 0.2f }, Vector3{ 1.5f, 0.1f, 0.1f },
+        Vector3{ 0.1f, 1.5f, 0.1f } })
+    {
+        ModelVertex vertex{};
+        vertex.SetPosition(position);
+        lod.vertices_.push_back(vertex);
+    }
+    lod.indices_ = { 0, 1, 2, 0, 2, 3 };
+
+    HierarchicalLODBuilder::SimplifyGeometry(lod, 1.0f);
+    CHECK(lod.vertices_.size() == 3);
+    CHECK(lod.indices_.size() == 3);
+    CHECK(lod.vertices_[0].GetPosition().Equals({ 0.15f, 0.15f, 0.15f }));
+}
@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Graphics/Camera.h>
+#include <Urho3D/Graphics/Geometry.h>
+#include <Urho3D/Graphics/Impostor.h>
+#include <Urho3D/Graphics/Material.h>
+#include <Urho3D/Graphics/Model.h>
+#include <Urho3D/Graphics/ModelView.h>
+#include <Urho3D/Graphics/Octree.h>
+#include <Urho3D/RenderPipeline/BatchCompositor.h>
+#include <Urho3D/Resource/Image.h>
+#include <Urho3D/Scene/Scene.h>
+
+namespace
+{
+
+/// Create unit cube model with given number of identical geometries.
+SharedPtr<Model> CreateCubeModel(Context* context, unsigned numGeometries = 1)
+{
+    GeometryLODView lod;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+        ModelVertex vertex{};
+        vertex.SetPosition({ i & 1 ? 0.5f : -0.5f, i & 2 ? 0.5f : -0.5f, i & 4 ? 0.5f : -0.5f });
+        lod.vertices_.push_back(vertex);
+    }
+    lod.indices_ = {
+        0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6, 0, 1, 5, 0, 5, 4,
+        2, 6, 7, 2, 7, 3, 0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5 };
+
+    GeometryView geometry;
+    geometry.lods_.push_back(lod);
+
+    ModelVertexFormat vertexFormat;
+    vertexFormat.position_ = TYPE_VECTOR3;
+    vertexFormat.uv_[0] = TYPE_VECTOR2;
+
+    auto modelView = MakeShared<ModelView>(context);
+    modelView->SetVertexFormat(vertexFormat);
+    modelView->SetGeometries(ea::vector<GeometryView>(numGeometries, geometry));
+    return modelView->ExportModel();
+}
+
+/// Collect batches of drawable for view like render pipeline does.
+ea::vector<PipelineBatch> CollectBatches(Drawable* drawable, const FrameInfo& frameInfo)
+{
+    drawable->UpdateBatches(frameInfo);
+
+    ea::vector<PipelineBatch> batches;
+    for (unsigned i = 0; i < drawable->GetBatches().size(); ++i)
+    {
+        PipelineBatch batch{ drawable, i };
+        if (batch.geometry_)
+            batches.push_back(batch);
+    }
+    return batches;
+}
+
+}
+
+TEST_CASE("Octahedral mapping of impostor frames is invertible")
+{
+    for (bool hemisphere : { false, true })
+    {
+        for (const Vector2 coords : { Vector2(0.5f, 0.5f), Vector2(0.2f, 0.7f), Vector2(0.9f, 0.4f), Vector2(0.6f, 0.1f) })
+        {
+            const Vector3 direction = ImpostorBaker::OctahedralToDirection(coords, hemisphere);
+            CHECK(direction.Length() == Catch::Approx(1.0f));
+            CHECK(ImpostorBaker::DirectionToOctahedral(direction, hemisphere).Equals(coords, 0.0001f));
+        }
+    }
+
+    // Middle frame of odd-sized atlas faces straight up
+    CHECK(ImpostorBaker::GetFrameDirection({ 2, 2 }, 5, true).Equals(Vector3::UP));
+    CHECK(ImpostorBaker::GetFrameDirection({ 2, 2 }, 5, false).Equals(Vector3::UP));
+}
+
+TEST_CASE("Impostor baker renders model views into atlas frames")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    const SharedPtr<Model> cubeModel = CreateCubeModel(context);
+
+    ImpostorBakeSettings settings;
+    settings.framesPerSide_ = 3;
+    settings.frameSize_ = 16;
+    settings.hemisphere_ = false;
+
+    auto baker = MakeShared<ImpostorBaker>(context);
+    ImpostorBakeResult result;
+    REQUIRE(baker->Bake(cubeModel, {}, settings, result));
+
+    REQUIRE(result.atlas_);
+    CHECK(result.atlas_->GetWidth() == 48);
+    CHECK(result.atlas_->GetHeight() == 48);
+    CHECK(result.center_.Equals(Vector3::ZERO));
+    CHECK(result.radius_ == Catch::Approx(Sqrt(0.75f)));
+
+    // Cube covers center of each frame and never covers frame corners
+    for (int y = 0; y < 3; ++y)
+    {
+        for (int x = 0; x < 3; ++x)
+        {
+            CHECK(result.atlas_->GetPixel(x * 16 + 8, y * 16 + 8).Equals(Color::WHITE));
+            CHECK(result.atlas_->GetPixel(x * 16, y * 16).a_ == 0.0f);
+        }
+    }
+}
+
+TEST_CASE("Impostor batches stay valid for view updated before another view")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    const SharedPtr<Model> model = CreateCubeModel(context, 2);
+    auto modelMaterial0 = MakeShared<Material>(context);
+    auto modelMaterial1 = MakeShared<Material>(context);
+    auto impostorMaterial = MakeShared<Material>(context);
+    auto impostorGeometry = MakeShared<Geometry>(context);
+
+    auto scene = MakeShared<Scene>(context);
+    scene->CreateComponent<Octree>();
+
+    Node* node = scene->CreateChild("Impostor");
+    auto impostor = node->CreateComponent<Impostor>();
+    impostor->SetModel(model);
+    impostor->SetMaterial(0, modelMaterial0);
+    impostor->SetMaterial(1, modelMaterial1);
+    impostor->SetImpostorGeometry(impostorGeometry);
+    impostor->SetImpostorMaterial(impostorMaterial);
+    impostor->SetImpostorDistance(50.0f);
+
+    Node* nearCameraNode = scene->CreateChild("Near Camera");
+    nearCameraNode->SetPosition({ 0.0f, 0.0f, -10.0f });
+    FrameInfo nearFrameInfo;
+    nearFrameInfo.camera_ = nearCameraNode->CreateComponent<Camera>();
+
+    Node* farCameraNode = scene->CreateChild("Far Camera");
+    farCameraNode->SetPosition({ 0.0f, 0.0f, -100.0f });
+    FrameInfo farFrameInfo;
+    farFrameInfo.camera_ = farCameraNode->CreateComponent<Camera>();
+
+    // All views are updated before any view is rendered
+    const ea::vector<PipelineBatch> nearBatches = CollectBatches(impostor, nearFrameInfo);
+    const ea::vector<PipelineBatch> farBatches = CollectBatches(impostor, farFrameInfo);
+    CHECK(impostor->IsImpostorActive());
+
+    REQUIRE(nearBatches.size() == 2);
+    CHECK(nearBatches[0].geometry_ == model->GetGeometry(0, 0));
+    CHECK(nearBatches[0].material_ == modelMaterial0);
+    CHECK(nearBatches[1].geometry_ == model->GetGeometry(1, 0));
+    CHECK(nearBatches[1].material_ == modelMaterial1);
+
+    REQUIRE(farBatches.size() == 1);
+    CHECK(farBatches[0].geometry_ == impostorGeometry);
+    CHECK(farBatches[0].material_ == impostorMaterial);
+
+    // Source batches referenced by near view are still there when it is rendered
+    REQUIRE(impostor->GetBatches().size() == 2);
+    for (const PipelineBatch& batch : nearBatches)
+        CHECK(batch.GetSourceBatch().worldTransform_ == &node->GetWorldTransform());
+
+    // Model is used for occlusion and raycasts regardless of the last view
+    CHECK(impostor->GetLodGeometry(1, M_MAX_UNSIGNED) == model->GetGeometry(1, 0));
+    CHECK(impostor->GetNumOccluderTriangles() == 24);
+    CHECK(impostor->GetMaterial(0) == modelMaterial0);
+
+    // Model batches are restored when view is close again
+    const ea::vector<PipelineBatch> nearBatchesAgain = CollectBatches(impostor, nearFrameInfo);
+    CHECK_FALSE(impostor->IsImpostorActive());
+    REQUIRE(nearBatchesAgain.size() == 2);
+    CHECK(nearBatchesAgain[0].geometry_ == model->GetGeometry(0, 0));
+    CHECK(nearBatchesAgain[0].material_ == modelMaterial0);
+    CHECK(nearBatchesAgain[1].geometry_ == model->GetGeometry(1, 0));
+}
@@ -0,0 +1,130 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR rhs
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR rhsWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR rhs DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Graphics/Light.h>
+#include <Urho3D/Graphics/Octree.h>
+#include <Urho3D/Graphics/OctreeQuery.h>
+#include <Urho3D/Graphics/Zone.h>
+#include <Urho3D/Scene/Scene.h>
+
+#include <EASTL/sort.h>
+#include <EASTL/unique_ptr.h>
+
+TEST_CASE("Batched octree queries return same drawables as individual queries")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto scene = MakeShared<Scene>(context);
+    auto octree = scene->CreateComponent<Octree>();
+
+    SetRandomSeed(1);
+    for (unsigned i = 0; i < 500; ++i)
+    {
+        Node* node = scene->CreateChild("Light");
+        node->SetPosition({ Random(-500.0f, 500.0f), Random(-50.0f, 50.0f), Random(-500.0f, 500.0f) });
+        auto light = node->CreateComponent<Light>();
+        light->SetLightType(LIGHT_POINT);
+        light->SetRange(Random(1.0f, 20.0f));
+    }
+    octree->Update(FrameInfo{});
+
+    // Use more queries than fit into one batch
+    const unsigned numQueries = Octree::MaxBatchedQueries + 8;
+    ea::vector<ea::vector<Drawable*>> expectedResults(numQueries);
+    ea::vector<ea::vector<Drawable*>> actualResults(numQueries);
+    ea::vector<ea::unique_ptr<SphereOctreeQuery>> queries;
+    ea::vector<OctreeQuery*> queryPointers;
+    for (unsigned i = 0; i < numQueries; ++i)
+    {
+        const Sphere sphere{ Vector3{ Random(-500.0f, 500.0f), 0.0f, Random(-500.0f, 500.0f) }, Random(10.0f, 100.0f) };
+        SphereOctreeQuery query(expectedResults[i], sphere, DRAWABLE_LIGHT);
+        octree->GetDrawables(query);
+        queries.push_back(ea::make_unique<SphereOctreeQuery>(actualResults[i], sphere, DRAWABLE_LIGHT));
+    }
+    for (const auto& query : queries)
+        queryPointers.push_back(query.get());
+
+    octree->GetDrawables(queryPointers);
+
+    unsigned numFound = 0;
+    for (unsigned i = 0; i < numQueries; ++i)
+    {
+        ea::sort(expectedResults[i].begin(), expectedResults[i].end());
+        ea::sort(actualResults[i].begin(), actualResults[i].end());
+        CHECK(expectedResults[i] == actualResults[i]);
+        numFound += expectedResults[i].size();
+    }
+    CHECK(numFound > 0);
+}
+
+TEST_CASE("Zone lookup grid returns zones of highest priority")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto scene = MakeShared<Scene>(context);
+    auto octree = scene->CreateComponent<Octree>();
+
+    SetRandomSeed(1);
+    ea::vector<Zone*> zones;
+    for (unsigned i = 0; i < 200; ++i)
+    {
+        Node* node = scene->CreateChild("Zone");
+        node->SetPosition({ Random(-500.0f, 500.0f), Random(-50.0f, 50.0f), Random(-500.0f, 500.0f) });
+        node->SetRotation(Quaternion(Random(0.0f, 360.0f), Vector3::UP));
+        auto zone = node->CreateComponent<Zone>();
+        const Vector3 halfSize{ Random(5.0f, 50.0f), Random(5.0f, 50.0f), Random(5.0f, 50.0f) };
+        zone->SetBoundingBox(BoundingBox(-halfSize, halfSize));
+        zone->SetPriority(static_cast<int>(i));
+        zones.push_back(zone);
+    }
+    octree->Update(FrameInfo{});
+    REQUIRE(octree->GetZoneLookupIndex().GetNumGridCells() > 0);
+
+    unsigned numFound = 0;
+    for (unsigned i = 0; i < 1000; ++i)
+    {
+        const Vector3 position{ Random(-600.0f, 600.0f), Random(-60.0f, 60.0f), Random(-600.0f, 600.0f) };
+
+        Zone* expectedZone = nullptr;
+        for (Zone* zone : zones)
+        {
+            if (zone->IsInside(position) && (!expectedZone || zone->GetPriority() > expectedZone->GetPriority()))
+                expectedZone = zone;
+        }
+
+        const CachedDrawableZone cachedZone = octree->QueryZone(position, M_MAX_UNSIGNED);
+        if (expectedZone)
+        {
+            CHECK(cachedZone.zone_ == expectedZone);
+            ++numFound;
+        }
+        else
+            CHECK(!zones.contains(cachedZone.zone_));
+
+        // Zone should not change while position is within cache distance
+        const float cacheDistance = Sqrt(cachedZone.cacheInvalidationDistanceSquared_);
+        const Vector3 offset = Vector3(Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f)).Normalized();
+        const Vector3 nearbyPosition = position + offset * cacheDistance * 0.99f;
+        CHECK(octree->QueryZone(nearbyPosition, M_MAX_UNSIGNED).zone_ == cachedZone.zone_);
+    }
+    CHECK(numFound > 0);
+}
@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Graphics/ShaderParameterCollection.h>
+
+TEST_CASE("ShaderParameterCollection is appended in order")
+{
+    ShaderParameterCollection first;
+    first.AddParameter("A", 1.0f);
+    first.AddParameter("B", Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+
+    ShaderParameterCollection second;
+    second.AddParameter("C", Matrix3x4::IDENTITY);
+    second.AddParameter("D", 2.0f);
+
+    first.Append(second);
+    REQUIRE(first.Size() == 4);
+
+    ea::vector<StringHash> names;
+    ea::vector<Vector4> values;
+    first.ForEach(2, 4, [&](StringHash name, const auto* data, unsigned arraySize)
+    {
+        names.push_back(name);
+        values.push_back(Vector4(reinterpret_cast<const float*>(data)));
+    });
+
+    REQUIRE(names.size() == 2);
+    CHECK(names[0] == StringHash("C"));
+    CHECK(names[1] == StringHash("D"));
+    CHECK(values[0] == Vector4(1.0f, 0.0f, 0.0f, 0.0f));
+    CHECK(values[1] == Vector4(2.0f, 0.0f, 0.0f, 0.0f));
+}
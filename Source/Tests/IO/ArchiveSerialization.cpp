@@ -24,6 +24,7 @@
 #include <Urho3D/IO/BinaryArchive.h>
 #include <Urho3D/IO/MemoryBuffer.h>
 #include <Urho3D/Resource/JSONArchive.h>
+#include <Urho3D/Resource/JSONStreamArchive.h>
 #include <Urho3D/Resource/XMLArchive.h>
 
 #include <catch2/catch_amalgamated.hpp>
@@ -378,6 +379,18 @@ TEST_CASE("Test structure is serialized to archive")
         REQUIRE(objectFromJSON);
         REQUIRE(sourceObject == *objectFromJSON);
     }
+
+    SECTION("JSON stream archive")
+    {
+        auto jsonData = SaveTestStruct<JSONOutputArchive, JSONFile>(context, sourceObject);
+        REQUIRE(jsonData);
+
+        JSONStreamInputArchive archive{ context, jsonData->ToString() };
+        SerializationTestStruct objectFromJSON;
+        SerializeValue(archive, "SerializationTestStruct", objectFromJSON);
+        REQUIRE_FALSE(archive.HasError());
+        REQUIRE(sourceObject == objectFromJSON);
+    }
 }
 
 TEST_CASE("Test structure is serialized as part of the file")
@@ -419,3 +432,57 @@ TEST_CASE("Test structure is serialized as part of the file")
         REQUIRE(sourceObject == objectFromJSON);
     }
 }
+
+TEST_CASE("JSON stream archive reads nested blocks and skips unread elements")
+{
+    auto context = CreateTestContext();
+    const ea::string text = R"({
+        "skipped": { "a": [1, [2, 3], { "b": "}]" }], "c": {} },
+        "array": [ [1, 2, 3], [], [4, [5, 6]] ],
+        // Comment
+        "value": 7
+    })";
+
+    SECTION("Nested blocks")
+    {
+        JSONStreamInputArchive archive{ context, text };
+        auto root = archive.OpenUnorderedBlock("root");
+
+        unsigned value = 0;
+        SerializeValue(archive, "value", value);
+        CHECK(value == 7);
+
+        auto array = archive.OpenArrayBlock("array");
+        REQUIRE(array.GetSizeHint() == 3);
+        {
+            auto first = archive.OpenArrayBlock("first");
+            REQUIRE(first.GetSizeHint() == 3);
+            SerializeValue(archive, "value", value);
+            CHECK(value == 1);
+        }
+        {
+            auto second = archive.OpenArrayBlock("second");
+            CHECK(second.GetSizeHint() == 0);
+        }
+        {
+            auto third = archive.OpenArrayBlock("third");
+            REQUIRE(third.GetSizeHint() == 2);
+            SerializeValue(archive, "value", value);
+            CHECK(value == 4);
+            auto nested = archive.OpenArrayBlock("nested");
+            REQUIRE(nested.GetSizeHint() == 2);
+            SerializeValue(archive, "value", value);
+            SerializeValue(archive, "value", value);
+            CHECK(value == 6);
+        }
+        CHECK_FALSE(archive.HasError());
+    }
+
+    SECTION("Malformed nested block")
+    {
+        const ea::string malformedText = R"({ "value": 7, "skipped": { "a": [1, 2 } })";
+        JSONStreamInputArchive malformedArchive{ context, malformedText };
+        auto root = malformedArchive.OpenUnorderedBlock("root");
+        CHECK(malformedArchive.HasError());
+    }
+}
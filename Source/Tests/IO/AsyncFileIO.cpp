@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/IO/AsyncFileIO.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/Resource/JSONFile.h>
+#include <Urho3D/Resource/ResourceCache.h>
+
+TEST_CASE("AsyncFileIO reads file ranges")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto fileSystem = context->GetSubsystem<FileSystem>();
+    const ea::string fileName = fileSystem->GetTemporaryDir() + "Urho3DTestAsyncFileIO.bin";
+
+    ByteVector data(100000);
+    for (unsigned i = 0; i < data.size(); ++i)
+        data[i] = static_cast<unsigned char>(i * 13 + i / 256);
+
+    {
+        File dest(context, fileName, FILE_WRITE);
+        REQUIRE(dest.IsOpen());
+        dest.Write(data.data(), data.size());
+    }
+
+    for (const bool allowIOUring : { true, false })
+    {
+        // Queue depth is smaller than number of reads to exercise resubmission
+        AsyncFileIO asyncIO(4, allowIOUring);
+        if (!allowIOUring)
+            CHECK(asyncIO.GetBackend() != AsyncIOBackend::IOUring);
+
+        auto file = MakeShared<File>(context, fileName);
+        REQUIRE(file->IsOpen());
+        REQUIRE(AsyncFileIO::CanRead(*file));
+
+        const unsigned numChunks = 10;
+        const unsigned chunkSize = data.size() / numChunks;
+        ea::vector<ByteVector> chunks(numChunks, ByteVector(chunkSize));
+        ea::unordered_map<unsigned, unsigned> chunkIndices;
+        for (unsigned i = 0; i < numChunks; ++i)
+        {
+            const unsigned id = asyncIO.Read(file, i * chunkSize, chunks[i].data(), chunkSize);
+            REQUIRE(id != 0);
+            chunkIndices[id] = i;
+        }
+
+        // Read past the end of file is truncated
+        ByteVector tail(1000);
+        const unsigned tailId = asyncIO.Read(file, data.size() - 100, tail.data(), tail.size());
+        REQUIRE(tailId != 0);
+
+        ea::vector<AsyncReadResult> results;
+        while (asyncIO.GetNumPendingReads() > 0)
+            asyncIO.WaitCompleted(results);
+        asyncIO.PollCompleted(results);
+        REQUIRE(results.size() == numChunks + 1);
+
+        for (const AsyncReadResult& result : results)
+        {
+            if (result.id_ == tailId)
+            {
+                CHECK_FALSE(result.success_);
+                REQUIRE(result.bytesRead_ == 100);
+                CHECK(ea::equal(tail.begin(), tail.begin() + 100, data.end() - 100));
+                continue;
+            }
+
+            CHECK(result.success_);
+            CHECK(result.bytesRead_ == chunkSize);
+            const unsigned index = chunkIndices[result.id_];
+            CHECK(ea::equal(chunks[index].begin(), chunks[index].end(), data.begin() + index * chunkSize));
+        }
+    }
+
+    fileSystem->Delete(fileName);
+}
+
+TEST_CASE("Resources are loaded in background from asynchronously read files")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto fileSystem = context->GetSubsystem<FileSystem>();
+    auto cache = context->GetSubsystem<ResourceCache>();
+    const ea::string resourceDir = fileSystem->GetTemporaryDir() + "Urho3DTestBackgroundLoading/";
+    REQUIRE(fileSystem->CreateDir(resourceDir));
+    REQUIRE(cache->AddResourceDir(resourceDir));
+
+    const unsigned numResources = 40;
+    for (unsigned i = 0; i < numResources; ++i)
+    {
+        File dest(context, Format("{}Resource{}.json", resourceDir, i), FILE_WRITE);
+        REQUIRE(dest.IsOpen());
+        const ea::string text = Format("{{ \"index\": {} }}", i);
+        dest.Write(text.data(), text.length());
+    }
+
+    for (unsigned i = 0; i < numResources; ++i)
+        REQUIRE(cache->BackgroundLoadResource<JSONFile>(Format("Resource{}.json", i)));
+
+    HiresTimer timer;
+    while (cache->GetNumBackgroundLoadResources() > 0 && timer.GetUSec(false) < 10000000)
+    {
+        cache->FinishBackgroundResources(100);
+        Time::Sleep(1);
+    }
+    REQUIRE(cache->GetNumBackgroundLoadResources() == 0);
+
+    for (unsigned i = 0; i < numResources; ++i)
+    {
+        auto jsonFile = cache->GetExistingResource<JSONFile>(Format("Resource{}.json", i));
+        REQUIRE(jsonFile);
+        CHECK(jsonFile->GetRoot()["index"].GetUInt() == i);
+    }
+
+    cache->RemoveResourceDir(resourceDir);
+    fileSystem->RemoveDir(resourceDir, true);
+}
@@ -0,0 +1,214 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/IO/MemoryBuffer.h>
+#include <Urho3D/IO/VectorBuffer.h>
+#include <Urho3D/Scene/Scene.h>
+
+namespace
+{
+
+/// Stream over memory that doesn't expose contiguous data, so every read goes through virtual Read().
+class NonContiguousBuffer : public Deserializer
+{
+public:
+    explicit NonContiguousBuffer(const ByteVector& data)
+        : Deserializer(data.size())
+        , buffer_(data)
+    {
+    }
+
+    unsigned Read(void* dest, unsigned size) override
+    {
+        const unsigned bytesRead = buffer_.Read(dest, size);
+        position_ = buffer_.GetPosition();
+        return bytesRead;
+    }
+
+    unsigned Seek(unsigned position) override
+    {
+        position_ = buffer_.Seek(position);
+        return position_;
+    }
+
+private:
+    MemoryBuffer buffer_;
+};
+
+/// Write message similar to replication updates of moving objects.
+VectorBuffer CreateReplicationMessage(unsigned numObjects)
+{
+    VectorBuffer message;
+    for (unsigned i = 0; i < numObjects; ++i)
+    {
+        message.WriteNetID(i);
+        message.WriteVLE(i % 300);
+        message.WriteVector3({ i * 0.5f, 1.0f, -1.0f * i });
+        message.WritePackedQuaternion(Quaternion(i * 1.0f, Vector3::UP));
+        message.WriteFloat(i * 0.25f);
+        message.WriteUByte(static_cast<unsigned char>(i));
+    }
+    return message;
+}
+
+/// Decode replication message and return checksum.
+float DecodeReplicationMessage(Deserializer& source)
+{
+    float checksum = 0.0f;
+    while (!source.IsEof())
+    {
+        checksum += source.ReadNetID();
+        checksum += source.ReadVLE();
+        checksum += source.ReadVector3().x_;
+        checksum += source.ReadPackedQuaternion().w_;
+        checksum += source.ReadFloat();
+        checksum += source.ReadUByte();
+    }
+    return checksum;
+}
+
+ByteVector CreateSceneData(Context* context, unsigned numNodes)
+{
+    auto scene = MakeShared<Scene>(context);
+    for (unsigned i = 0; i < numNodes; ++i)
+    {
+        Node* node = scene->CreateChild(Format("Node {}", i));
+        node->SetPosition({ i * 1.0f, 0.0f, 0.0f });
+        node->SetVar("Index", i);
+        node->SetVar("Name", node->GetName());
+    }
+
+    VectorBuffer buffer;
+    scene->Save(buffer);
+    return buffer.GetBuffer();
+}
+
+}
+
+TEST_CASE("Deserializer reads contiguous and non-contiguous streams identically")
+{
+    VectorBuffer buffer;
+    buffer.WriteInt64(-1234567890123LL);
+    buffer.WriteUShort(65535);
+    buffer.WriteBool(true);
+    buffer.WriteVLE(1000000);
+    buffer.WriteString("Hello");
+    buffer.WriteVector3({ 1.0f, 2.0f, 3.0f });
+    buffer.WriteQuaternion({ 0.5f, 0.5f, 0.5f, 0.5f });
+    buffer.WriteColor(Color::RED);
+    buffer.WriteNetID(0x123456);
+    // Unterminated string at the end of stream
+    buffer.Write("End", 3);
+
+    MemoryBuffer contiguousSource(buffer.GetBuffer());
+    NonContiguousBuffer nonContiguousSource(buffer.GetBuffer());
+    for (Deserializer* source : { static_cast<Deserializer*>(&contiguousSource), static_cast<Deserializer*>(&nonContiguousSource) })
+    {
+        CHECK(source->ReadInt64() == -1234567890123LL);
+        CHECK(source->ReadUShort() == 65535);
+        CHECK(source->ReadBool() == true);
+        CHECK(source->ReadVLE() == 1000000);
+        CHECK(source->ReadString() == "Hello");
+        CHECK(source->ReadVector3() == Vector3(1.0f, 2.0f, 3.0f));
+        CHECK(source->ReadQuaternion() == Quaternion(0.5f, 0.5f, 0.5f, 0.5f));
+        CHECK(source->ReadColor() == Color::RED);
+        CHECK(source->ReadNetID() == 0x123456);
+        CHECK(source->ReadString() == "End");
+        CHECK(source->IsEof());
+
+        // Reads past the end return zeros and don't move the position
+        CHECK(source->ReadUInt() == 0);
+        CHECK(source->GetPosition() == buffer.GetSize());
+    }
+}
+
+TEST_CASE("Copied VectorBuffer reads its own data")
+{
+    auto source = ea::make_unique<VectorBuffer>();
+    source->WriteUInt(0x11111111);
+    source->WriteUInt(0x22222222);
+    source->Seek(0);
+
+    VectorBuffer copy(*source);
+    VectorBuffer assigned;
+    assigned = *source;
+    VectorBuffer moved(VectorBuffer{ *source });
+
+    // Mutate and destroy the source, copies should be unaffected
+    source->Seek(0);
+    source->WriteUInt(0x33333333);
+    source->Resize(1024);
+    source.reset();
+
+    for (VectorBuffer* buffer : { &copy, &assigned, &moved })
+    {
+        CHECK(buffer->ReadUInt() == 0x11111111);
+        CHECK(buffer->ReadUInt() == 0x22222222);
+        CHECK(buffer->IsEof());
+    }
+}
+
+TEST_CASE("VectorBuffer reads resized data after direct buffer access")
+{
+    VectorBuffer buffer;
+    buffer.WriteUInt(0x11111111);
+
+    ByteVector& data = buffer.GetBuffer();
+    data.resize(4096);
+    data.shrink_to_fit();
+    buffer.Seek(0);
+    CHECK(buffer.ReadUInt() == 0x11111111);
+}
+
+TEST_CASE("Deserializer decoding of scene and replication data", "[.][benchmark]")
+{
+    auto context = Tests::CreateCompleteTestContext();
+
+    const ByteVector sceneData = CreateSceneData(context, 2000);
+    BENCHMARK("Scene, contiguous stream")
+    {
+        auto scene = MakeShared<Scene>(context);
+        MemoryBuffer source(sceneData);
+        return scene->Load(source);
+    };
+    BENCHMARK("Scene, virtual reads")
+    {
+        auto scene = MakeShared<Scene>(context);
+        NonContiguousBuffer source(sceneData);
+        return scene->Load(source);
+    };
+
+    const VectorBuffer message = CreateReplicationMessage(10000);
+    BENCHMARK("Replication message, contiguous stream")
+    {
+        MemoryBuffer source(message.GetBuffer());
+        return DecodeReplicationMessage(source);
+    };
+    BENCHMARK("Replication message, virtual reads")
+    {
+        NonContiguousBuffer source(message.GetBuffer());
+        return DecodeReplicationMessage(source);
+    };
+}
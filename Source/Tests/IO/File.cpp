@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/IO/MemoryBuffer.h>
+#include <Urho3D/IO/PackageFile.h>
+
+namespace
+{
+
+/// Write uncompressed package with single entry.
+void WritePackage(File& dest, const ea::string& entryName, const ByteVector& data)
+{
+    dest.WriteFileID("UPAK");
+    dest.WriteUInt(1);
+    dest.WriteUInt(0);
+
+    const unsigned dataOffset = dest.GetPosition() + entryName.length() + 1 + 3 * sizeof(unsigned);
+    dest.WriteString(entryName);
+    dest.WriteUInt(dataOffset);
+    dest.WriteUInt(data.size());
+    dest.WriteUInt(0);
+    dest.Write(data.data(), data.size());
+}
+
+/// Check that file contents match the data, both through File and through mapped memory.
+void CheckFileContents(File& file, const ByteVector& data)
+{
+    REQUIRE(file.GetSize() == data.size());
+
+    const unsigned char* mappedData = file.GetMappedData();
+    REQUIRE(mappedData);
+    CHECK(ea::equal(data.begin(), data.end(), mappedData));
+
+    MemoryBuffer mappedBuffer(mappedData, file.GetSize());
+    CHECK(mappedBuffer.ReadUInt() == file.ReadUInt());
+
+    CHECK(file.Seek(5000) == 5000);
+    CHECK(file.ReadUByte() == data[5000]);
+
+    ByteVector buffer(data.size());
+    CHECK(file.Seek(0) == 0);
+    CHECK(file.Read(buffer.data(), buffer.size() + 100) == data.size());
+    CHECK(buffer == data);
+    CHECK(file.IsEof());
+}
+
+}
+
+TEST_CASE("Filesystem and package files are memory mapped")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto fileSystem = context->GetSubsystem<FileSystem>();
+    const ea::string fileName = fileSystem->GetTemporaryDir() + "Urho3DTestMappedFile.bin";
+    const ea::string packageName = fileSystem->GetTemporaryDir() + "Urho3DTestMappedPackage.pak";
+
+    ByteVector data(10000);
+    for (unsigned i = 0; i < data.size(); ++i)
+        data[i] = static_cast<unsigned char>(i * 7 + i / 256);
+
+    {
+        File dest(context, fileName, FILE_WRITE);
+        REQUIRE(dest.IsOpen());
+        dest.Write(data.data(), data.size());
+
+        // Files opened for writing are never mapped
+        CHECK_FALSE(dest.MemoryMap());
+    }
+    {
+        File dest(context, packageName, FILE_WRITE);
+        REQUIRE(dest.IsOpen());
+        WritePackage(dest, "Data.bin", data);
+    }
+
+    {
+        File file(context, fileName);
+        REQUIRE(file.IsOpen());
+        REQUIRE(file.MemoryMap(FILE_ACCESS_SEQUENTIAL));
+        CHECK(file.IsMemoryMapped());
+        CheckFileContents(file, data);
+
+        file.Close();
+        CHECK_FALSE(file.IsMemoryMapped());
+        CHECK(file.GetMappedData() == nullptr);
+    }
+
+    {
+        // Entry data is not aligned to page boundary within the package
+        auto package = MakeShared<PackageFile>(context, packageName);
+        File file(context, package, "Data.bin");
+        REQUIRE(file.IsOpen());
+        REQUIRE(file.MemoryMap(FILE_ACCESS_RANDOM));
+        CheckFileContents(file, data);
+    }
+
+    fileSystem->Delete(fileName);
+    fileSystem->Delete(packageName);
+}
@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/IO/FileWatcher.h>
+
+namespace
+{
+
+/// Wait until change of the file is reported or timeout expires. Return whether reported.
+bool WaitForChange(FileWatcher* watcher, const ea::string& fileName, FileChangeKind kind, const ea::function<void()>& action = {})
+{
+    HiresTimer timer;
+    ea::vector<FileChange> changes;
+    while (timer.GetUSec(false) < 5000000)
+    {
+        if (action)
+            action();
+
+        Time::Sleep(10);
+        watcher->GetNextChanges(changes);
+        for (const FileChange& change : changes)
+        {
+            if (change.fileName_ == fileName && change.kind_ == kind)
+                return true;
+        }
+    }
+    return false;
+}
+
+void WriteFile(Context* context, const ea::string& fileName)
+{
+    File file(context, fileName, FILE_WRITE);
+    file.WriteUInt(0);
+}
+
+}
+
+TEST_CASE("FileWatcher coalesces changes of the same file")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto watcher = MakeShared<FileWatcher>(context);
+    watcher->SetDelay(0.0f);
+
+    watcher->AddChange({ FILECHANGE_ADDED, "A.txt", EMPTY_STRING });
+    watcher->AddChange({ FILECHANGE_REMOVED, "B.txt", EMPTY_STRING });
+    watcher->AddChange({ FILECHANGE_MODIFIED, "A.txt", EMPTY_STRING });
+    watcher->AddChange({ FILECHANGE_ADDED, "C.txt", EMPTY_STRING });
+    watcher->AddChange({ FILECHANGE_ADDED, "B.txt", EMPTY_STRING });
+    watcher->AddChange({ FILECHANGE_REMOVED, "C.txt", EMPTY_STRING });
+
+    // Changes are reported in order of last update
+    ea::vector<FileChange> changes;
+    REQUIRE(watcher->GetNextChanges(changes) == 2);
+    CHECK(changes[0].fileName_ == "A.txt");
+    CHECK(changes[0].kind_ == FILECHANGE_ADDED);
+    CHECK(changes[1].fileName_ == "B.txt");
+    CHECK(changes[1].kind_ == FILECHANGE_MODIFIED);
+
+    FileChange change;
+    CHECK_FALSE(watcher->GetNextChange(change));
+}
+
+#if defined(URHO3D_FILEWATCHER) && defined(__linux__)
+TEST_CASE("FileWatcher watches subdirectories registered in background and created later")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto fileSystem = context->GetSubsystem<FileSystem>();
+    const ea::string path = fileSystem->GetTemporaryDir() + "Urho3DTestFileWatcher/";
+    fileSystem->RemoveDir(path, true);
+    REQUIRE(fileSystem->CreateDirsRecursive(path + "Existing/Nested"));
+    WriteFile(context, path + "Existing/Nested/File.txt");
+
+    auto watcher = MakeShared<FileWatcher>(context);
+    watcher->SetDelay(0.0f);
+    REQUIRE(watcher->StartWatching(path, true));
+
+    // Existing subdirectory is watched once the watcher thread gets to it
+    CHECK(WaitForChange(watcher, "Existing/Nested/File.txt", FILECHANGE_MODIFIED,
+        [&] { WriteFile(context, path + "Existing/Nested/File.txt"); }));
+
+    // Files created together with new directories are reported even if created before the directory is watched
+    REQUIRE(fileSystem->CreateDirsRecursive(path + "New/Deep"));
+    WriteFile(context, path + "New/Deep/File.txt");
+    CHECK(WaitForChange(watcher, "New/Deep/File.txt", FILECHANGE_ADDED));
+
+    // Watches follow renamed directories
+    REQUIRE(fileSystem->Rename(path + "New", path + "Renamed"));
+    CHECK(WaitForChange(watcher, "Renamed", FILECHANGE_RENAMED));
+    fileSystem->Delete(path + "Renamed/Deep/File.txt");
+    CHECK(WaitForChange(watcher, "Renamed/Deep/File.txt", FILECHANGE_REMOVED));
+
+    watcher->StopWatching();
+    fileSystem->RemoveDir(path, true);
+}
+#endif
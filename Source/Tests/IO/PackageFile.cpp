@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/IO/Compression.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/IO/PackageFile.h>
+
+namespace
+{
+
+/// Write compressed package with single entry split into LZ4 blocks.
+void WriteCompressedPackage(File& dest, const ea::string& entryName, const ByteVector& data, unsigned blockSize)
+{
+    dest.WriteFileID("ULZ4");
+    dest.WriteUInt(1);
+    dest.WriteUInt(0);
+
+    const unsigned dataOffset = dest.GetPosition() + entryName.length() + 1 + 3 * sizeof(unsigned);
+    dest.WriteString(entryName);
+    dest.WriteUInt(dataOffset);
+    dest.WriteUInt(data.size());
+    dest.WriteUInt(0);
+
+    ByteVector compressedBlock(EstimateCompressBound(blockSize));
+    for (unsigned pos = 0; pos < data.size(); pos += blockSize)
+    {
+        const unsigned unpackedSize = ea::min(blockSize, data.size() - pos);
+        const unsigned packedSize = CompressData(compressedBlock.data(), &data[pos], unpackedSize);
+        dest.WriteUShort(static_cast<unsigned short>(unpackedSize));
+        dest.WriteUShort(static_cast<unsigned short>(packedSize));
+        dest.Write(compressedBlock.data(), packedSize);
+    }
+}
+
+}
+
+TEST_CASE("Compressed package file supports seeking across blocks")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto fileSystem = context->GetSubsystem<FileSystem>();
+    const ea::string packageName = fileSystem->GetTemporaryDir() + "Urho3DTestCompressedPackage.pak";
+
+    ByteVector data(10000);
+    for (unsigned i = 0; i < data.size(); ++i)
+        data[i] = static_cast<unsigned char>(i * 7 + i / 256);
+
+    {
+        File dest(context, packageName, FILE_WRITE);
+        REQUIRE(dest.IsOpen());
+        WriteCompressedPackage(dest, "Data.bin", data, 1024);
+    }
+
+    {
+        auto package = MakeShared<PackageFile>(context, packageName);
+        REQUIRE(package->IsCompressed());
+        File file(context, package, "Data.bin");
+        REQUIRE(file.IsOpen());
+        REQUIRE(file.GetSize() == data.size());
+
+        // Forward seeks over several blocks, backward seek within block and backward seek to previous block
+        for (unsigned position : { 10u, 5000u, 4990u, 9999u, 1500u, 0u, 3072u, 10000u })
+        {
+            CHECK(file.Seek(position) == position);
+            unsigned char value{};
+            if (position < data.size())
+            {
+                CHECK(file.Read(&value, 1) == 1);
+                CHECK(value == data[position]);
+            }
+            else
+                CHECK(file.IsEof());
+        }
+
+        // Sequential read after seeks
+        file.Seek(1000);
+        ByteVector buffer(3000);
+        CHECK(file.Read(buffer.data(), buffer.size()) == buffer.size());
+        CHECK(ea::equal(buffer.begin(), buffer.end(), data.begin() + 1000));
+    }
+
+    fileSystem->Delete(packageName);
+}
@@ -0,0 +1,264 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/IO/File.h>
+#include <Urho3D/IO/FileSystem.h>
+#include <Urho3D/IO/PackageFile.h>
+#include <Urho3D/IO/VectorBuffer.h>
+#include <Urho3D/Network/PackageTransfer.h>
+
+namespace
+{
+
+/// Return contents of uncompressed package with single entry.
+ByteVector CreatePackageData(unsigned checksum, unsigned dataSize)
+{
+    const ea::string entryName = "Data.bin";
+
+    VectorBuffer buffer;
+    buffer.WriteFileID("UPAK");
+    buffer.WriteUInt(1);
+    buffer.WriteUInt(checksum);
+
+    const unsigned dataOffset = buffer.GetPosition() + entryName.length() + 1 + 3 * sizeof(unsigned);
+    buffer.WriteString(entryName);
+    buffer.WriteUInt(dataOffset);
+    buffer.WriteUInt(dataSize);
+    buffer.WriteUInt(0);
+
+    for (unsigned i = 0; i < dataSize; ++i)
+        buffer.WriteUByte(static_cast<unsigned char>(i * 7 + i / 256));
+    return buffer.GetBuffer();
+}
+
+/// Write file with given contents.
+void WriteFile(Context* context, const ea::string& fileName, const unsigned char* data, unsigned size)
+{
+    File file(context, fileName, FILE_WRITE);
+    REQUIRE(file.IsOpen());
+    REQUIRE(file.Write(data, size) == size);
+}
+
+}
+
+TEST_CASE("Package upload budget is refilled every network update without accumulation")
+{
+    const unsigned bandwidth = 1024 * 1024;
+    const int updateFps = 30;
+    const unsigned updateBudget = bandwidth / updateFps;
+
+    CHECK(GetPackageUploadUpdateBudget(bandwidth, updateFps) == updateBudget);
+    CHECK(GetPackageUploadUpdateBudget(10, updateFps) == 1);
+    CHECK(GetPackageUploadUpdateBudget(bandwidth, 0) == bandwidth);
+    CHECK(GetPackageUploadUpdateBudget(0, updateFps) == MAX_PACKAGE_CHUNK_SIZE);
+
+    // Unused budget is not accumulated, overspent budget is subtracted from the next update
+    CHECK(RefillPackageUploadBudget(0, bandwidth, updateFps) == updateBudget);
+    CHECK(RefillPackageUploadBudget(updateBudget / 2, bandwidth, updateFps) == updateBudget);
+    CHECK(RefillPackageUploadBudget(-100, bandwidth, updateFps) == updateBudget - 100);
+    CHECK(RefillPackageUploadBudget(-3 * static_cast<int>(updateBudget), bandwidth, updateFps) == -2 * static_cast<int>(updateBudget));
+
+    // Zero bandwidth is unlimited, switching back to limited bandwidth doesn't overflow
+    CHECK(RefillPackageUploadBudget(0, 0, updateFps) == M_MAX_INT);
+    CHECK(RefillPackageUploadBudget(M_MAX_INT, bandwidth, updateFps) == updateBudget);
+}
+
+TEST_CASE("Package upload chunks and fragments are aligned to delta blocks")
+{
+    const unsigned fragmentSize = 16 * 1024;
+    const unsigned blockSize = 64 * 1024;
+
+    // Chunk size is update budget rounded up to alignment and limited by max chunk size
+    CHECK(GetPackageChunkSize(0, fragmentSize) == fragmentSize);
+    CHECK(GetPackageChunkSize(1000, fragmentSize) == fragmentSize);
+    CHECK(GetPackageChunkSize(40000, fragmentSize) == 3 * fragmentSize);
+    CHECK(GetPackageChunkSize(M_MAX_UNSIGNED, blockSize) == MAX_PACKAGE_CHUNK_SIZE);
+    CHECK(GetPackageChunkSize(1000, 2 * MAX_PACKAGE_CHUNK_SIZE) == 2 * MAX_PACKAGE_CHUNK_SIZE);
+
+    // Chunk end is aligned to blocks unless it's the end of file, resumed offset may be unaligned
+    CHECK(GetPackageChunkEnd(0, 2 * blockSize, blockSize, 100 * blockSize) == 2 * blockSize);
+    CHECK(GetPackageChunkEnd(100, 2 * blockSize, blockSize, 100 * blockSize) == 2 * blockSize);
+    CHECK(GetPackageChunkEnd(blockSize + 100, 1000, blockSize, 100 * blockSize) == blockSize + 1100);
+    CHECK(GetPackageChunkEnd(99 * blockSize, 2 * blockSize, blockSize, 99 * blockSize + 5) == 99 * blockSize + 5);
+    CHECK(GetPackageChunkEnd(100, 1000, 0, 10000) == 1100);
+
+    // Fragments don't cross block boundaries
+    CHECK(GetPackageFragmentSize(0, 2 * blockSize, fragmentSize, blockSize) == fragmentSize);
+    CHECK(GetPackageFragmentSize(blockSize - 4096, 2 * blockSize, fragmentSize, blockSize) == 4096);
+    CHECK(GetPackageFragmentSize(blockSize - 4096, blockSize - 100, fragmentSize, blockSize) == 3996);
+    CHECK(GetPackageFragmentSize(100, 150, fragmentSize, 0) == 50);
+
+    // Whole file is covered by consecutive chunks and fragments
+    const unsigned fileSize = 10 * blockSize + 12345;
+    const unsigned resumeOffset = 3 * blockSize + 777;
+    const unsigned chunkSize = GetPackageChunkSize(100000, blockSize);
+    unsigned offset = resumeOffset;
+    unsigned numFragments = 0;
+    while (offset < fileSize)
+    {
+        const unsigned chunkEnd = GetPackageChunkEnd(offset, chunkSize, blockSize, fileSize);
+        REQUIRE(chunkEnd > offset);
+        CHECK((chunkEnd % blockSize == 0 || chunkEnd == fileSize));
+
+        while (offset < chunkEnd)
+        {
+            const unsigned size = GetPackageFragmentSize(offset, chunkEnd, fragmentSize, blockSize);
+            REQUIRE(size > 0);
+            CHECK(offset / blockSize == (offset + size - 1) / blockSize);
+            offset += size;
+            ++numFragments;
+        }
+        CHECK(offset == chunkEnd);
+    }
+    CHECK(offset == fileSize);
+    CHECK(numFragments == 1 + 7 * blockSize / fragmentSize);
+}
+
+TEST_CASE("Package download is resumed, renamed and verified")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto fileSystem = context->GetSubsystem<FileSystem>();
+    const ea::string cacheDir = fileSystem->GetTemporaryDir() + "Urho3DTestPackageCache/";
+    REQUIRE(fileSystem->CreateDir(cacheDir));
+
+    const unsigned checksum = 0x1234abcd;
+    const ByteVector packageData = CreatePackageData(checksum, 5000);
+    const ea::string fileName = cacheDir + ToStringHex(checksum) + "_Test.pak";
+    const ea::string partialFileName = fileName + ".part";
+
+    const auto initDownload = [&](PackageDownload& download)
+    {
+        download.name_ = "Test.pak";
+        download.fileSize_ = packageData.size();
+        download.checksum_ = checksum;
+    };
+
+    SECTION("Partial download is continued after reconnect")
+    {
+        {
+            PackageDownload download;
+            initDownload(download);
+            REQUIRE(download.OpenPartialFile(context, cacheDir));
+            CHECK(download.receivedBytes_ == 0);
+            CHECK(download.AppendData(packageData.data(), 3000));
+            CHECK_FALSE(download.IsComplete());
+        }
+
+        PackageDownload download;
+        initDownload(download);
+        REQUIRE(download.OpenPartialFile(context, cacheDir));
+        CHECK(download.receivedBytes_ == 3000);
+        CHECK(download.AppendData(packageData.data() + 3000, packageData.size() - 3000));
+        REQUIRE(download.IsComplete());
+
+        auto package = download.Finalize(context);
+        REQUIRE(package);
+        CHECK(package->GetChecksum() == checksum);
+        CHECK(package->Exists("Data.bin"));
+        CHECK(fileSystem->FileExists(fileName));
+        CHECK_FALSE(fileSystem->FileExists(partialFileName));
+    }
+
+    SECTION("Complete partial file is finalized without receiving data")
+    {
+        WriteFile(context, partialFileName, packageData.data(), packageData.size());
+
+        PackageDownload download;
+        initDownload(download);
+        REQUIRE(download.OpenPartialFile(context, cacheDir));
+        CHECK(download.receivedBytes_ == packageData.size());
+        CHECK(download.IsComplete());
+
+        // Server replies to resume at the end of file with empty data
+        CHECK(download.AppendData(nullptr, 0));
+        REQUIRE(download.Finalize(context));
+        CHECK(fileSystem->FileExists(fileName));
+        CHECK_FALSE(fileSystem->FileExists(partialFileName));
+    }
+
+    SECTION("Partial file larger than package is discarded")
+    {
+        ByteVector largerData = packageData;
+        largerData.resize(packageData.size() + 100);
+        WriteFile(context, partialFileName, largerData.data(), largerData.size());
+
+        PackageDownload download;
+        initDownload(download);
+        REQUIRE(download.OpenPartialFile(context, cacheDir));
+        CHECK(download.receivedBytes_ == 0);
+        CHECK(download.AppendData(packageData.data(), packageData.size()));
+        CHECK(download.Finalize(context));
+    }
+
+    SECTION("Package with wrong checksum is deleted so it can be downloaded again")
+    {
+        const ByteVector corruptedData = CreatePackageData(checksum + 1, 5000);
+        WriteFile(context, partialFileName, corruptedData.data(), corruptedData.size());
+
+        PackageDownload download;
+        initDownload(download);
+        REQUIRE(download.OpenPartialFile(context, cacheDir));
+        REQUIRE(download.IsComplete());
+        CHECK_FALSE(download.Finalize(context));
+        CHECK_FALSE(fileSystem->FileExists(fileName));
+        CHECK_FALSE(fileSystem->FileExists(partialFileName));
+
+        REQUIRE(download.OpenPartialFile(context, cacheDir));
+        CHECK(download.receivedBytes_ == 0);
+    }
+
+    SECTION("Blocks are copied from older version of the package")
+    {
+        const ea::string oldFileName = cacheDir + "00000001_Test.pak";
+        WriteFile(context, oldFileName, packageData.data(), 4096);
+
+        PackageDownload download;
+        initDownload(download);
+        REQUIRE(download.OpenPartialFile(context, cacheDir));
+        CHECK_FALSE(download.AppendBlockCopy(0, 1024));
+
+        download.deltaSource_ = MakeShared<File>(context, oldFileName);
+        CHECK(download.AppendBlockCopy(0, 1024));
+        CHECK(download.AppendData(packageData.data() + 1024, 1024));
+        CHECK(download.AppendBlockCopy(2048, 2048));
+        CHECK_FALSE(download.AppendBlockCopy(4096, 1024));
+        CHECK(download.receivedBytes_ == 4096);
+        CHECK(download.AppendData(packageData.data() + 4096, packageData.size() - 4096));
+
+        REQUIRE(download.Finalize(context));
+        CHECK_FALSE(download.deltaSource_);
+
+        File file(context, fileName);
+        ByteVector fileData(file.GetSize());
+        file.Read(fileData.data(), fileData.size());
+        CHECK(fileData == packageData);
+
+        fileSystem->Delete(oldFileName);
+    }
+
+    fileSystem->Delete(fileName);
+    fileSystem->Delete(partialFileName);
+}
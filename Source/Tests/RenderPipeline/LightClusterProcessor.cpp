@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Core/WorkQueue.h>
+#include <Urho3D/Graphics/Camera.h>
+#include <Urho3D/RenderPipeline/LightClusterProcessor.h>
+#include <Urho3D/Scene/Scene.h>
+
+namespace
+{
+
+Camera* CreateTestCamera(Scene* scene)
+{
+    Node* cameraNode = scene->CreateChild("Camera");
+    cameraNode->SetPosition({ 1.0f, 2.0f, -3.0f });
+    cameraNode->SetRotation({ 15.0f, 30.0f, 0.0f });
+
+    auto camera = cameraNode->CreateComponent<Camera>();
+    camera->SetFov(60.0f);
+    camera->SetAspectRatio(16.0f / 9.0f);
+    camera->SetNearClip(0.1f);
+    camera->SetFarClip(100.0f);
+    return camera;
+}
+
+bool HasLight(const LightClusterProcessor& processor, const Vector3& viewPosition, unsigned lightIndex)
+{
+    IntVector3 beginCluster;
+    IntVector3 endCluster;
+    if (!processor.GetClusterRange(BoundingBox{ viewPosition, viewPosition }, beginCluster, endCluster))
+        return false;
+
+    const auto lights = processor.GetClusterLights(processor.GetClusterIndex(beginCluster));
+    return ea::find(lights.begin(), lights.end(), lightIndex) != lights.end();
+}
+
+}
+
+TEST_CASE("Point lights are assigned to all clusters they touch")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto scene = MakeShared<Scene>(context);
+    Camera* camera = CreateTestCamera(scene);
+    const Matrix3x4& view = camera->GetView();
+    const Matrix3x4 viewInverse = view.Inverse();
+
+    LightClusterProcessor processor;
+    processor.BeginUpdate(camera, { 16, 8, 24 }, 256);
+
+    SetRandomSeed(1);
+    ea::vector<Sphere> lights;
+    for (unsigned i = 0; i < 300; ++i)
+    {
+        const Vector3 viewPosition{ Random(-40.0f, 40.0f), Random(-25.0f, 25.0f), Random(-5.0f, 90.0f) };
+        const Sphere sphere{ viewPosition, Random(0.2f, 5.0f) };
+        lights.push_back(sphere);
+        processor.AddPointLight(i, viewInverse * sphere.center_, sphere.radius_);
+    }
+
+    processor.Build(context->GetSubsystem<WorkQueue>());
+    REQUIRE(processor.GetNumDroppedLights() == 0);
+
+    // No light is assigned to cluster it doesn't touch
+    const IntVector3& gridSize = processor.GetGridSize();
+    for (int z = 0; z < gridSize.z_; ++z)
+    {
+        for (int y = 0; y < gridSize.y_; ++y)
+        {
+            for (int x = 0; x < gridSize.x_; ++x)
+            {
+                const BoundingBox clusterBox = processor.GetClusterBoundingBox({ x, y, z });
+                for (unsigned lightIndex : processor.GetClusterLights(processor.GetClusterIndex({ x, y, z })))
+                    CHECK(lights[lightIndex].IsInside(clusterBox) != OUTSIDE);
+            }
+        }
+    }
+
+    // Every point inside the light and the camera frustum is covered by the cluster containing this point
+    const Frustum viewSpaceFrustum = camera->GetViewSpaceFrustum();
+    for (unsigned lightIndex = 0; lightIndex < lights.size(); ++lightIndex)
+    {
+        const Sphere& sphere = lights[lightIndex];
+        for (unsigned i = 0; i < 32; ++i)
+        {
+            const Vector3 offset = Vector3{ Random(-1.0f, 1.0f), Random(-1.0f, 1.0f), Random(-1.0f, 1.0f) };
+            const Vector3 samplePosition = sphere.center_ + offset.Normalized() * Random(sphere.radius_ * 0.99f);
+
+            if (viewSpaceFrustum.IsInside(samplePosition) == INSIDE)
+                CHECK(HasLight(processor, samplePosition, lightIndex));
+        }
+    }
+}
+
+TEST_CASE("Spot lights are assigned only to clusters inside light cone")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto scene = MakeShared<Scene>(context);
+    Camera* camera = CreateTestCamera(scene);
+    const Matrix3x4 viewInverse = camera->GetView().Inverse();
+
+    LightClusterProcessor processor;
+    processor.BeginUpdate(camera, { 16, 8, 24 }, 256);
+
+    // Spot light looking along camera X axis
+    const Vector3 apex{ -10.0f, 0.0f, 30.0f };
+    const Vector3 direction = Vector3::RIGHT;
+    processor.AddSpotLight(0, viewInverse * apex, viewInverse.RotationMatrix() * direction, 20.0f, 15.0f);
+    processor.Build(context->GetSubsystem<WorkQueue>());
+
+    CHECK(HasLight(processor, apex + direction * 10.0f, 0));
+    CHECK(HasLight(processor, apex + direction * 19.0f, 0));
+    CHECK_FALSE(HasLight(processor, apex - direction * 12.0f, 0));
+    CHECK_FALSE(HasLight(processor, apex + direction * 10.0f + Vector3::UP * 14.0f, 0));
+    CHECK_FALSE(HasLight(processor, apex + direction * 30.0f, 0));
+}
+
+TEST_CASE("Cluster light lists are compact and respect capacity")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto scene = MakeShared<Scene>(context);
+    Camera* camera = CreateTestCamera(scene);
+    const Matrix3x4 viewInverse = camera->GetView().Inverse();
+
+    LightClusterProcessor processor;
+    processor.BeginUpdate(camera, { 4, 4, 4 }, 4);
+    for (unsigned i = 0; i < 10; ++i)
+        processor.AddPointLight(i, viewInverse * Vector3{ 0.0f, 0.0f, 10.0f }, 0.5f);
+    processor.Build(nullptr);
+
+    CHECK(processor.GetNumDroppedLights() > 0);
+
+    unsigned expectedOffset = 0;
+    for (const LightCluster& cluster : processor.GetClusters())
+    {
+        CHECK(cluster.offset_ == expectedOffset);
+        CHECK(cluster.count_ <= 4);
+        expectedOffset += cluster.count_;
+    }
+    CHECK(processor.GetLightIndices().size() == expectedOffset);
+
+    ea::vector<unsigned> lightIndices;
+    processor.CollectLights(BoundingBox{ Sphere{ viewInverse * Vector3{ 0.0f, 0.0f, 10.0f }, 0.1f } }, lightIndices);
+    CHECK(lightIndices == ea::vector<unsigned>{ 0, 1, 2, 3 });
+}
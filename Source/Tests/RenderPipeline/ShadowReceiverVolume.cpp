@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/RenderPipeline/ShadowReceiverVolume.h>
+
+TEST_CASE("Shadow casters are culled by receiver volume")
+{
+    ShadowReceiverVolume volume;
+    volume.Define({ Vector2{ -16.0f, -16.0f }, Vector2{ 16.0f, 16.0f } });
+    CHECK_FALSE(volume.HasReceivers());
+    CHECK_FALSE(volume.IsShadowCasterVisible({ Vector3{ -1.0f, -1.0f, 0.0f }, Vector3{ 1.0f, 1.0f, 1.0f } }));
+
+    // Receiver in the middle of the split
+    volume.AddReceiver({ Vector3{ -2.0f, -2.0f, 10.0f }, Vector3{ 2.0f, 2.0f, 12.0f } });
+    REQUIRE(volume.HasReceivers());
+
+    // Caster above receiver
+    CHECK(volume.IsShadowCasterVisible({ Vector3{ -1.0f, -1.0f, 0.0f }, Vector3{ 1.0f, 1.0f, 1.0f } }));
+    // Caster partially overlapping receiver
+    CHECK(volume.IsShadowCasterVisible({ Vector3{ 1.5f, 1.5f, 0.0f }, Vector3{ 6.0f, 6.0f, 1.0f } }));
+    // Caster intersecting receiver
+    CHECK(volume.IsShadowCasterVisible({ Vector3{ -1.0f, -1.0f, 11.0f }, Vector3{ 1.0f, 1.0f, 13.0f } }));
+    // Caster behind receiver
+    CHECK_FALSE(volume.IsShadowCasterVisible({ Vector3{ -1.0f, -1.0f, 13.0f }, Vector3{ 1.0f, 1.0f, 14.0f } }));
+    // Caster aside of receiver
+    CHECK_FALSE(volume.IsShadowCasterVisible({ Vector3{ 8.0f, -1.0f, 0.0f }, Vector3{ 10.0f, 1.0f, 1.0f } }));
+    CHECK_FALSE(volume.IsShadowCasterVisible({ Vector3{ -1.0f, -15.0f, 0.0f }, Vector3{ 1.0f, -12.0f, 1.0f } }));
+    // Caster outside of the split
+    CHECK_FALSE(volume.IsShadowCasterVisible({ Vector3{ 20.0f, 20.0f, 0.0f }, Vector3{ 30.0f, 30.0f, 1.0f } }));
+    // Big caster covering whole split
+    CHECK(volume.IsShadowCasterVisible({ Vector3{ -100.0f, -100.0f, 0.0f }, Vector3{ 100.0f, 100.0f, 1.0f } }));
+}
+
+TEST_CASE("Receiver volume keeps max depth of receivers per cell")
+{
+    ShadowReceiverVolume volume;
+    volume.Define({ Vector2{ 0.0f, 0.0f }, Vector2{ 16.0f, 16.0f } });
+    volume.AddReceiver({ Vector3{ 0.5f, 0.5f, 1.0f }, Vector3{ 3.5f, 0.5f, 5.0f } });
+    volume.AddReceiver({ Vector3{ 2.5f, 0.5f, 1.0f }, Vector3{ 6.5f, 0.5f, 3.0f } });
+
+    CHECK(volume.GetMaxDepth(0, 0) == 5.0f);
+    CHECK(volume.GetMaxDepth(3, 0) == 5.0f);
+    CHECK(volume.GetMaxDepth(5, 0) == 3.0f);
+    CHECK(volume.GetMaxDepth(7, 0) == -M_INFINITY);
+    CHECK(volume.GetMaxDepth(0, 1) == -M_INFINITY);
+
+    // Caster spanning cells of different depths, tested across SSE vector boundary
+    CHECK(volume.IsShadowCasterVisible({ Vector3{ 4.5f, 0.5f, 2.0f }, Vector3{ 9.5f, 0.5f, 2.5f } }));
+    CHECK_FALSE(volume.IsShadowCasterVisible({ Vector3{ 4.5f, 0.5f, 4.0f }, Vector3{ 9.5f, 0.5f, 4.5f } }));
+    CHECK(volume.IsShadowCasterVisible({ Vector3{ 3.5f, 0.5f, 4.0f }, Vector3{ 9.5f, 0.5f, 4.5f } }));
+}
@@ -0,0 +1,260 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Graphics/Camera.h>
+#include <Urho3D/Graphics/Light.h>
+#include <Urho3D/Graphics/Material.h>
+#include <Urho3D/Graphics/Model.h>
+#include <Urho3D/Graphics/ModelView.h>
+#include <Urho3D/Graphics/Octree.h>
+#include <Urho3D/Graphics/Renderer.h>
+#include <Urho3D/Graphics/StaticModel.h>
+#include <Urho3D/Graphics/Texture2D.h>
+#include <Urho3D/RenderPipeline/DrawableProcessor.h>
+#include <Urho3D/RenderPipeline/LightProcessor.h>
+#include <Urho3D/RenderPipeline/ShadowSplitProcessor.h>
+#include <Urho3D/Scene/Scene.h>
+
+namespace
+{
+
+/// Create unit cube model with specified number of LODs.
+SharedPtr<Model> CreateCubeModel(Context* context, unsigned numLods)
+{
+    GeometryLODView lod;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+        ModelVertex vertex{};
+        vertex.SetPosition({ i & 1 ? 0.5f : -0.5f, i & 2 ? 0.5f : -0.5f, i & 4 ? 0.5f : -0.5f });
+        lod.vertices_.push_back(vertex);
+    }
+    lod.indices_ = {
+        0, 2, 3, 0, 3, 1, 4, 5, 7, 4, 7, 6, 0, 1, 5, 0, 5, 4,
+        2, 6, 7, 2, 7, 3, 0, 4, 6, 0, 6, 2, 1, 3, 7, 1, 7, 5 };
+
+    GeometryView geometry;
+    for (unsigned i = 0; i < numLods; ++i)
+    {
+        lod.lodDistance_ = i * 10.0f;
+        geometry.lods_.push_back(lod);
+    }
+
+    ModelVertexFormat vertexFormat;
+    vertexFormat.position_ = TYPE_VECTOR3;
+
+    auto modelView = MakeShared<ModelView>(context);
+    modelView->SetVertexFormat(vertexFormat);
+    modelView->SetGeometries({ geometry });
+    return modelView->ExportModel();
+}
+
+/// Render pipeline that only provides signals.
+class TestRenderPipeline : public RenderPipelineInterface
+{
+public:
+    explicit TestRenderPipeline(Context* context) : context_(context) {}
+
+    Context* GetContext() const override { return context_; }
+    RenderPipelineDebugger* GetDebugger() override { return nullptr; }
+
+private:
+    Context* context_{};
+};
+
+/// Light processor callback that always preserves persistent shadow map, like allocator does for the same owner.
+class TestLightProcessorCallback : public LightProcessorCallback
+{
+public:
+    explicit TestLightProcessorCallback(Context* context) : texture_(MakeShared<Texture2D>(context)) {}
+
+    bool IsLightShadowed(Light* light) override { return true; }
+    unsigned GetShadowMapSize(Light* light, unsigned numActiveSplits) const override { return 256; }
+    ShadowMapRegion AllocateTransientShadowMap(const IntVector2& size) override { return { 0, texture_, { IntVector2::ZERO, size } }; }
+
+    ShadowMapRegion AllocatePersistentShadowMap(const IntVector2& size, const void* owner, bool& isPreserved) override
+    {
+        isPreserved = true;
+        return { 0, texture_, { IntVector2::ZERO, size } };
+    }
+
+private:
+    SharedPtr<Texture2D> texture_;
+};
+
+}
+
+TEST_CASE("Cached shadow map is rebuilt when shadow casters change without moving")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    auto scene = MakeShared<Scene>(context);
+    scene->CreateComponent<Octree>();
+
+    const SharedPtr<Model> model = CreateCubeModel(context, 2);
+    const auto material = MakeShared<Material>(context);
+
+    auto staticModel = scene->CreateChild("Caster")->CreateComponent<StaticModel>();
+    staticModel->SetModel(model);
+    staticModel->SetMaterial(material);
+    staticModel->SetCastShadows(true);
+
+    const ea::vector<Drawable*> shadowCasters{ staticModel };
+    const unsigned originalHash = ShadowSplitProcessor::CalculateShadowCastersHash(shadowCasters);
+    CHECK(ShadowSplitProcessor::CalculateShadowCastersHash(shadowCasters) == originalHash);
+
+    SECTION("Material is changed")
+    {
+        staticModel->SetMaterial(MakeShared<Material>(context));
+        CHECK(ShadowSplitProcessor::CalculateShadowCastersHash(shadowCasters) != originalHash);
+        staticModel->SetMaterial(material);
+        CHECK(ShadowSplitProcessor::CalculateShadowCastersHash(shadowCasters) == originalHash);
+    }
+
+    SECTION("Material is modified")
+    {
+        material->SetShaderParameter("MatDiffColor", Color::RED);
+        CHECK(ShadowSplitProcessor::CalculateShadowCastersHash(shadowCasters) != originalHash);
+    }
+
+    SECTION("Model is changed")
+    {
+        staticModel->SetModel(CreateCubeModel(context, 1));
+        staticModel->SetMaterial(material);
+        CHECK(ShadowSplitProcessor::CalculateShadowCastersHash(shadowCasters) != originalHash);
+    }
+
+    SECTION("LOD is changed")
+    {
+        auto camera = scene->CreateChild("Camera")->CreateComponent<Camera>();
+        camera->GetNode()->SetPosition({ 0.0f, 0.0f, -100.0f });
+
+        FrameInfo frame;
+        frame.frameNumber_ = 1;
+        frame.camera_ = camera;
+        frame.viewSize_ = { 1024, 768 };
+        staticModel->UpdateBatches(frame);
+        CHECK(staticModel->GetBatches()[0].geometry_ == model->GetGeometry(0, 1));
+        CHECK(ShadowSplitProcessor::CalculateShadowCastersHash(shadowCasters) != originalHash);
+    }
+
+    SECTION("LOD bias is changed")
+    {
+        staticModel->SetLodBias(2.0f);
+        CHECK(ShadowSplitProcessor::CalculateShadowCastersHash(shadowCasters) != originalHash);
+    }
+
+    SECTION("Shadow casting is disabled")
+    {
+        staticModel->SetCastShadows(false);
+        CHECK(ShadowSplitProcessor::CalculateShadowCastersHash(shadowCasters) != originalHash);
+    }
+}
+
+TEST_CASE("Cached shadow map is reused until shadow casters change")
+{
+    auto context = Tests::CreateCompleteTestContext();
+    if (!context->GetSubsystem<Renderer>())
+        context->RegisterSubsystem(new Renderer(context));
+
+    auto scene = MakeShared<Scene>(context);
+    auto octree = scene->CreateComponent<Octree>();
+
+    const SharedPtr<Model> model = CreateCubeModel(context, 2);
+    const auto material = MakeShared<Material>(context);
+
+    Node* casterNode = scene->CreateChild("Caster");
+    auto staticModel = casterNode->CreateComponent<StaticModel>();
+    staticModel->SetModel(model);
+    staticModel->SetMaterial(material);
+    staticModel->SetCastShadows(true);
+
+    Node* lightNode = scene->CreateChild("Light");
+    lightNode->SetPosition({ 0.0f, 5.0f, 0.0f });
+    lightNode->SetDirection(Vector3::DOWN);
+    auto light = lightNode->CreateComponent<Light>();
+    light->SetLightType(LIGHT_SPOT);
+    light->SetRange(20.0f);
+    light->SetCastShadows(true);
+
+    Node* cameraNode = scene->CreateChild("Camera");
+    cameraNode->SetPosition({ 0.0f, 0.0f, -5.0f });
+    auto camera = cameraNode->CreateComponent<Camera>();
+
+    TestRenderPipeline renderPipeline{ context };
+    TestLightProcessorCallback callback{ context };
+    auto drawableProcessor = MakeShared<DrawableProcessor>(&renderPipeline);
+    DrawableProcessorSettings settings;
+    settings.cacheStaticShadowMaps_ = true;
+    drawableProcessor->SetSettings(settings);
+
+    FrameInfo frameInfo;
+    frameInfo.octree_ = octree;
+    frameInfo.scene_ = scene;
+    frameInfo.camera_ = camera;
+    frameInfo.viewSize_ = { 1024, 768 };
+    frameInfo.timeStep_ = 0.01f;
+
+    // Process frame like render pipeline does and return whether shadow map was reused
+    const auto processFrame = [&]()
+    {
+        ++frameInfo.frameNumber_;
+        octree->Update(frameInfo);
+        drawableProcessor->OnUpdateBegin(frameInfo);
+        drawableProcessor->ProcessVisibleDrawables({ staticModel, light }, nullptr);
+        drawableProcessor->ProcessLights(&callback);
+
+        REQUIRE(drawableProcessor->GetLightProcessors().size() == 1);
+        LightProcessor* lightProcessor = drawableProcessor->GetLightProcessor(0);
+        REQUIRE(lightProcessor->IsShadowMapCached());
+        REQUIRE(lightProcessor->GetNumSplits() == 1);
+        REQUIRE(lightProcessor->GetSplit(0)->GetShadowCasters().size() == 1);
+        return lightProcessor->GetSplit(0)->IsShadowMapReused();
+    };
+
+    CHECK_FALSE(processFrame());
+    CHECK(processFrame());
+    CHECK(processFrame());
+
+    SECTION("Shadow caster is moved")
+    {
+        casterNode->Translate({ 0.5f, 0.0f, 0.0f });
+        CHECK_FALSE(processFrame());
+        CHECK(processFrame());
+    }
+
+    SECTION("Material of shadow caster is changed")
+    {
+        staticModel->SetMaterial(MakeShared<Material>(context));
+        CHECK_FALSE(processFrame());
+        CHECK(processFrame());
+    }
+
+    SECTION("LOD of shadow caster is switched")
+    {
+        cameraNode->SetPosition({ 0.0f, 0.0f, -100.0f });
+        CHECK_FALSE(processFrame());
+        CHECK(staticModel->GetBatches()[0].geometry_ == model->GetGeometry(0, 1));
+        CHECK(processFrame());
+    }
+}
@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../CommonUtils.h"
+
+#include <Urho3D/Core/StringUtils.h>
+#include <Urho3D/IO/MemoryBuffer.h>
+#include <Urho3D/IO/VectorBuffer.h>
+#include <Urho3D/Resource/JSONFile.h>
+#include <Urho3D/Scene/Scene.h>
+
+namespace
+{
+
+ByteVector CreateSceneJSON(Context* context, unsigned numNodes)
+{
+    auto scene = MakeShared<Scene>(context);
+    for (unsigned i = 0; i < numNodes; ++i)
+    {
+        Node* node = scene->CreateChild(Format("Node {}", i));
+        node->SetPosition({ i * 1.0f, 0.0f, 0.0f });
+        node->SetVar("Index", i);
+        node->SetVar("Name", node->GetName());
+    }
+
+    VectorBuffer buffer;
+    scene->SaveJSON(buffer);
+    return buffer.GetBuffer();
+}
+
+}
+
+TEST_CASE("JSONFile parses all value types")
+{
+    auto context = Tests::CreateCompleteTestContext();
+
+    const char text[] = R"({
+        // Comments and trailing commas are allowed
+        "null": null,
+        "bool": true,
+        "int": -5,
+        "smallUInt": 5,
+        "uint": 4000000000,
+        "int64": -10000000000,
+        "double": 0.5,
+        "string": "Line\n\"quoted\" é",
+        "array": [1, "two", [3], {}, ],
+        /* Nested object */
+        "object": { "key": "value", "empty": [] },
+    })";
+
+    auto jsonFile = MakeShared<JSONFile>(context);
+    MemoryBuffer source(text, sizeof(text) - 1);
+    REQUIRE(jsonFile->Load(source));
+
+    const JSONValue& root = jsonFile->GetRoot();
+    REQUIRE(root.IsObject());
+    CHECK(root.Size() == 10);
+    CHECK(root.Get("null").IsNull());
+    CHECK(root.Get("bool").GetBool() == true);
+    CHECK(root.Get("int").GetInt() == -5);
+    CHECK(root.Get("int").GetNumberType() == JSONNT_INT);
+    CHECK(root.Get("smallUInt").GetNumberType() == JSONNT_INT);
+    CHECK(root.Get("uint").GetUInt() == 4000000000u);
+    CHECK(root.Get("uint").GetNumberType() == JSONNT_UINT);
+    CHECK(root.Get("int64").GetDouble() == -10000000000.0);
+    CHECK(root.Get("double").GetDouble() == 0.5);
+    CHECK(root.Get("string").GetString() == "Line\n\"quoted\" \xc3\xa9");
+
+    const JSONValue& array = root.Get("array");
+    REQUIRE(array.Size() == 4);
+    CHECK(array[0].GetInt() == 1);
+    CHECK(array[1].GetString() == "two");
+    CHECK(array[2].Size() == 1);
+    CHECK(array[3].IsObject());
+
+    const JSONValue& object = root.Get("object");
+    CHECK(object.Get("key").GetString() == "value");
+    CHECK(object.Get("empty").IsArray());
+
+    MemoryBuffer malformedSource("{ \"key\": [1, 2 }", 16);
+    CHECK_FALSE(jsonFile->Load(malformedSource));
+}
+
+TEST_CASE("JSONFile loading", "[.][benchmark]")
+{
+    auto context = Tests::CreateCompleteTestContext();
+
+    const ByteVector sceneData = CreateSceneJSON(context, 2000);
+    BENCHMARK("Load JSON scene")
+    {
+        auto jsonFile = MakeShared<JSONFile>(context);
+        MemoryBuffer source(sceneData);
+        return jsonFile->Load(source);
+    };
+}
@@ -37,6 +37,7 @@ URHO3D_EVENT(E_EDITORRESOURCESAVED, EditorResourceSaved)
 /// Event sent right before reloading user components.
 URHO3D_EVENT(E_EDITORUSERCODERELOADSTART, EditorUserCodeReloadStart)
 {
+    URHO3D_PARAM(P_FULLRELOAD, FullReload);    // bool, whole scene should be recreated because plugin types are not known
 }
 
 /// Event sent right after reloading user components.
@@ -129,8 +129,9 @@ void Pipeline::EnableWatcher()
 
 void Pipeline::OnEndFrame(StringHash, VariantMap&)
 {
-    FileChange entry;
-    while (watcher_.GetNextChange(entry))
+    ea::vector<FileChange> changes;
+    watcher_.GetNextChanges(changes);
+    for (const FileChange& entry : changes)
     {
         if (entry.fileName_.ends_with(".asset"))
             continue;
@@ -43,6 +43,8 @@ public:
     bool IsOutOfDate() const override;
     /// This function will block until plugin file is complete and ready to be loaded. Returns false if timeout exceeded, but file is still incomplete.
     bool WaitForCompleteFile(unsigned timeoutMs) const override;
+    /// Returns true for native plugins, they register all their types through PluginApplication.
+    bool SupportsStateMigration() const override { return lastModuleType_ == MODULE_NATIVE; }
 
 protected:
     ///
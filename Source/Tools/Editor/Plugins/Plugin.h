@@ -60,6 +60,8 @@ public:
     virtual bool WaitForCompleteFile(unsigned timeoutMs) const { return true; }
     /// Returns true if user may configure loading or unloading plugin.
     bool IsManagedManually() const { return isManagedManually_; }
+    /// Returns true if all object types of the plugin are known, so only objects of these types need to be recreated on reload.
+    virtual bool SupportsStateMigration() const { return false; }
 
 protected:
     /// Actually unloads the module. Called by %PluginManager at the end of frame when unloading_ flag is set.
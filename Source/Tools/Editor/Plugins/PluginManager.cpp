@@ -23,11 +23,14 @@
 #include <Urho3D/Core/CoreEvents.h>
 #include <Urho3D/Core/ProcessUtils.h>
 #include <Urho3D/Engine/EngineEvents.h>
+#include <Urho3D/Core/Timer.h>
 #include <Urho3D/Engine/PluginApplication.h>
+#include <Urho3D/Engine/PluginStateMigration.h>
 #include <Urho3D/IO/ArchiveSerialization.h>
 #include <Urho3D/IO/File.h>
 #include <Urho3D/IO/FileSystem.h>
 #include <Urho3D/IO/Log.h>
+#include <Urho3D/Scene/SceneManager.h>
 #include <Urho3D/Script/Script.h>
 #include <Toolbox/SystemUI/Widgets.h>
 #include "EditorEvents.h"
@@ -103,12 +106,13 @@ void PluginManager::OnEndFrame()
 {
     // TODO: Timeout probably should be configured, larger projects will have a pretty long linking time.
     const unsigned pluginLinkingTimeout = 10000;
-    bool eventSent = false;
 
     bool checkOutOfDatePlugins = updateCheckTimer_.GetMSec(false) >= 1000;
     if (checkOutOfDatePlugins)
         updateCheckTimer_.Reset();
 
+    // Find plugins that are unloaded or reloaded this frame.
+    ea::vector<ea::pair<Plugin*, bool>> changedPlugins;
     for (Plugin* plugin : plugins_)
     {
         if (plugin->application_.Null())
@@ -125,25 +129,55 @@ void PluginManager::OnEndFrame()
         }
 
         if (plugin->unloading_ || pluginOutOfDate)
+            changedPlugins.emplace_back(plugin, pluginOutOfDate);
+    }
+
+    if (changedPlugins.empty())
+        return;
+
+    // Only components of plugin types are recreated, unless some plugin does not report its types.
+    HiresTimer reloadTimer;
+    bool fullReload = false;
+    ea::hash_set<StringHash> pluginTypes;
+    for (const auto& [plugin, pluginOutOfDate] : changedPlugins)
+    {
+        if (!plugin->SupportsStateMigration())
+            fullReload = true;
+        for (const auto& [type, category] : plugin->application_->GetRegisteredTypes())
+            pluginTypes.insert(type);
+    }
+
+    using namespace EditorUserCodeReloadStart;
+    VariantMap& eventData = GetEventDataMap();
+    eventData[P_FULLRELOAD] = fullReload;
+    SendEvent(E_EDITORUSERCODERELOADSTART, eventData);
+
+    PluginStateMigration migration(context_);
+    if (!fullReload)
+    {
+        ea::vector<Scene*> scenes;
+        if (auto* sceneManager = GetSubsystem<SceneManager>())
         {
-            if (!eventSent)
-            {
-                SendEvent(E_EDITORUSERCODERELOADSTART);
-                eventSent = true;
-            }
+            for (Scene* scene : sceneManager->GetScenes())
+                scenes.push_back(scene);
+        }
+        migration.Save(scenes, pluginTypes);
+    }
 
-            plugin->application_->SendEvent(E_PLUGINUNLOAD);
-            plugin->application_->Unload();
+    HiresTimer swapTimer;
+    for (const auto& [plugin, pluginOutOfDate] : changedPlugins)
+    {
+        plugin->application_->SendEvent(E_PLUGINUNLOAD);
+        plugin->application_->Unload();
 
-            int allowedPluginRefs = 1;
-            if (plugin->application_->Refs() != 1)
-            {
-                URHO3D_LOGERROR("Plugin application '{}' has more than one reference remaining. "
-                                 "This will lead to memory leaks or crashes.",
-                                 plugin->application_->GetTypeName());
-            }
-            plugin->PerformUnload();
+        int allowedPluginRefs = 1;
+        if (plugin->application_->Refs() != 1)
+        {
+            URHO3D_LOGERROR("Plugin application '{}' has more than one reference remaining. "
+                             "This will lead to memory leaks or crashes.",
+                             plugin->application_->GetTypeName());
         }
+        plugin->PerformUnload();
 
         if (pluginOutOfDate)
         {
@@ -176,8 +210,20 @@ void PluginManager::OnEndFrame()
         }
     }
 
-    if (eventSent)
-        SendEvent(E_EDITORUSERCODERELOADEND);
+    const long long swapTime = swapTimer.GetUSec(false);
+
+    migration.Restore();
+    SendEvent(E_EDITORUSERCODERELOADEND);
+
+    const PluginStateMigrationStats& stats = migration.GetStats();
+    if (fullReload)
+        URHO3D_LOGINFO("Reloaded user code in {:.2f} ms with full scene reload.", reloadTimer.GetUSec(false) / 1000.0);
+    else
+    {
+        URHO3D_LOGINFO("Reloaded user code in {:.2f} ms: migrated {} components, collect {:.2f} ms, serialize {:.2f} ms, "
+            "swap modules {:.2f} ms, restore {:.2f} ms.", reloadTimer.GetUSec(false) / 1000.0, stats.numComponents_,
+            stats.collectTime_ / 1000.0, stats.serializeTime_ / 1000.0, swapTime / 1000.0, stats.restoreTime_ / 1000.0);
+    }
 }
 
 Plugin* PluginManager::GetPlugin(const ea::string& name)
@@ -115,16 +115,24 @@ void PreviewTab::OnReloadFinished(StringHash type, VariantMap& args)
 
 void PreviewTab::OnEditorUserCodeReloadStart(StringHash type, VariantMap& args)
 {
-    // On plugin code reload all scene state is serialized, plugin library is reloaded and scene state is unserialized.
-    // This way scene recreates all plugin-provided components on reload and gets to use new versions of them.
+    using namespace EditorUserCodeReloadStart;
+
     auto* tab = GetSubsystem<Editor>()->GetTab<SceneTab>();
     if (tab == nullptr || tab->GetScene() == nullptr)
         return;
 
     undo_->SetTrackingEnabled(false);
-    tab->SaveState(sceneReloadState_);
-    tab->GetScene()->RemoveAllChildren();
-    tab->GetScene()->RemoveAllComponents();
+
+    // Components of native plugins are migrated by PluginManager. When plugin types are not known, all scene state is
+    // serialized, plugin library is reloaded and scene state is unserialized. This way scene recreates all
+    // plugin-provided components on reload and gets to use new versions of them.
+    sceneReloadPending_ = args[P_FULLRELOAD].GetBool();
+    if (sceneReloadPending_)
+    {
+        tab->SaveState(sceneReloadState_);
+        tab->GetScene()->RemoveAllChildren();
+        tab->GetScene()->RemoveAllComponents();
+    }
 }
 
 void PreviewTab::OnEditorUserCodeReloadEnd(StringHash type, VariantMap& args)
@@ -133,7 +141,11 @@ void PreviewTab::OnEditorUserCodeReloadEnd(StringHash type, VariantMap& args)
     if (tab == nullptr || tab->GetScene() == nullptr)
         return;
 
-    tab->RestoreState(sceneReloadState_);
+    if (sceneReloadPending_)
+    {
+        tab->RestoreState(sceneReloadState_);
+        sceneReloadPending_ = false;
+    }
     undo_->SetTrackingEnabled(true);
 }
 
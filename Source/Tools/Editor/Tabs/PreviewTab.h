@@ -109,6 +109,8 @@ protected:
     SceneState sceneState_;
     /// Temporary storage of scene data used when plugins are being reloaded.
     SceneState sceneReloadState_;
+    /// Flag indicating that whole scene was saved to sceneReloadState_ and should be restored when plugins are reloaded.
+    bool sceneReloadPending_ = false;
     /// Time since ESC was last pressed. Used for double-press ESC to exit scene simulation.
     unsigned lastEscPressTime_ = 0;
     /// Flag indicating game view assumed control of the input.
@@ -35,6 +35,7 @@
 #include <Urho3D/Resource/JSONFile.h>
 #include <Urho3D/Resource/XMLArchive.h>
 #include <Urho3D/Resource/JSONArchive.h>
+#include <Urho3D/Resource/JSONStreamArchive.h>
 #include <Urho3D/Scene/Serializable.h>
 #include <Urho3D/Scene/Scene.h>
 #include <Urho3D/UI/UIElement.h>
@@ -96,16 +97,24 @@ public:
             }
             else if (GetExtension(input_) == ".json")
             {
-                JSONFile file(context_);
+                if (inputType_ == "old")
+                {
+                    JSONFile file(context_);
 
-                if (!(read = file.LoadFile(input_)))
-                    break;
+                    if (!(read = file.LoadFile(input_)))
+                        break;
 
-                if (inputType_ == "old")
                     loaded = converter->LoadJSON(file.GetRoot());
+                }
                 else if (inputType_ == "new")
                 {
-                    JSONInputArchive archive(&file);
+                    // Avoid building JSON tree for huge files
+                    File file(context_);
+
+                    if (!(read = file.Open(input_)))
+                        break;
+
+                    JSONStreamInputArchive archive(context_, file);
                     loaded = converter->Serialize(archive);
                 }
             }
@@ -0,0 +1,215 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+using System;
+using System.Collections.Generic;
+using System.Reflection;
+using System.Runtime.InteropServices;
+
+namespace Urho3DNet
+{
+    /// Marks field of event payload struct that receives event parameter with given name.
+    [AttributeUsage(AttributeTargets.Field)]
+    public sealed class EventParamAttribute : Attribute
+    {
+        public EventParamAttribute(string name)
+        {
+            Key = new StringHash(name);
+        }
+
+        /// Hash of event parameter name.
+        public StringHash Key { get; }
+    }
+
+    /// Blittable struct that receives event parameters without marshalling VariantMap. Fields marked with
+    /// EventParamAttribute are filled by native code, missing parameters are zeroed. Supported field types are
+    /// bool (as U1), int, uint, long, float, double, StringHash, vectors, Quaternion, Color, IntRect, IntPtr and EventBuffer.
+    public interface IEventPayload
+    {
+        /// Copy payload from native memory into this struct. Implement as `this = *(T*)payload;`.
+        void Load(IntPtr payload);
+    }
+
+    /// Handler of event with typed payload.
+    public delegate void EventPayloadHandler<T>(StringHash eventType, in T args) where T : struct, IEventPayload;
+
+    /// View of buffer event parameter. Points to native event data and is valid only while the event is handled.
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct EventBuffer
+    {
+        /// Pointer to buffer data.
+        public readonly IntPtr Data;
+        /// Size of buffer data in bytes.
+        public readonly int Size;
+
+        public unsafe byte this[int index]
+        {
+            get
+            {
+                if ((uint)index >= (uint)Size)
+                    throw new IndexOutOfRangeException();
+                return ((byte*)Data)[index];
+            }
+        }
+
+        /// Copy buffer data into array.
+        public byte[] ToArray()
+        {
+            var result = new byte[Size];
+            if (Size > 0)
+                Marshal.Copy(Data, result, 0, Size);
+            return result;
+        }
+    }
+
+    /// Payload of update events that have only time step: Update, PostUpdate, RenderUpdate and PostRenderUpdate.
+    [StructLayout(LayoutKind.Sequential)]
+    public struct UpdateEventArgs : IEventPayload
+    {
+        [EventParam("TimeStep")] public float TimeStep;
+
+        public unsafe void Load(IntPtr payload) { this = *(UpdateEventArgs*)payload; }
+    }
+
+    /// Payload of scene update events: SceneUpdate, ScenePostUpdate, SceneSubsystemUpdate.
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SceneUpdateEventArgs : IEventPayload
+    {
+        [EventParam("Scene")] public IntPtr Scene;
+        [EventParam("TimeStep")] public float TimeStep;
+
+        public unsafe void Load(IntPtr payload) { this = *(SceneUpdateEventArgs*)payload; }
+    }
+
+    /// Payload of KeyDown and KeyUp events.
+    [StructLayout(LayoutKind.Sequential)]
+    public struct KeyEventArgs : IEventPayload
+    {
+        [EventParam("Key")] public int Key;
+        [EventParam("Scancode")] public int Scancode;
+        [EventParam("Buttons")] public int Buttons;
+        [EventParam("Qualifiers")] public int Qualifiers;
+        [EventParam("Repeat"), MarshalAs(UnmanagedType.U1)] public bool Repeat;
+
+        public unsafe void Load(IntPtr payload) { this = *(KeyEventArgs*)payload; }
+    }
+
+    /// Payload of MouseMove event.
+    [StructLayout(LayoutKind.Sequential)]
+    public struct MouseMoveEventArgs : IEventPayload
+    {
+        [EventParam("X")] public int X;
+        [EventParam("Y")] public int Y;
+        [EventParam("DX")] public int DX;
+        [EventParam("DY")] public int DY;
+        [EventParam("Buttons")] public int Buttons;
+        [EventParam("Qualifiers")] public int Qualifiers;
+
+        public unsafe void Load(IntPtr payload) { this = *(MouseMoveEventArgs*)payload; }
+    }
+
+    /// Payload of NetworkMessage event.
+    [StructLayout(LayoutKind.Sequential)]
+    public struct NetworkMessageEventArgs : IEventPayload
+    {
+        [EventParam("Connection")] public IntPtr Connection;
+        [EventParam("MessageID")] public int MessageID;
+        [EventParam("Data")] public EventBuffer Data;
+
+        public unsafe void Load(IntPtr payload) { this = *(NetworkMessageEventArgs*)payload; }
+    }
+
+    /// Layout of event payload struct, computed once per type.
+    internal static class EventPayloadLayout<T> where T : struct, IEventPayload
+    {
+        public static readonly uint[] Keys;
+        public static readonly int[] Types;
+        public static readonly uint[] Offsets;
+        public static readonly uint Size;
+
+        static EventPayloadLayout()
+        {
+            var keys = new List<uint>();
+            var types = new List<int>();
+            var offsets = new List<uint>();
+            foreach (FieldInfo field in typeof(T).GetFields(BindingFlags.Instance | BindingFlags.Public | BindingFlags.NonPublic))
+            {
+                var param = field.GetCustomAttribute<EventParamAttribute>();
+                if (param == null)
+                    continue;
+
+                keys.Add(param.Key.Hash);
+                types.Add((int)GetVariantType(field.FieldType));
+                offsets.Add((uint)Marshal.OffsetOf<T>(field.Name));
+            }
+
+            Keys = keys.ToArray();
+            Types = types.ToArray();
+            Offsets = offsets.ToArray();
+            Size = (uint)Marshal.SizeOf<T>();
+        }
+
+        private static VariantType GetVariantType(Type type)
+        {
+            if (type == typeof(bool)) return VariantType.VarBool;
+            if (type == typeof(int) || type == typeof(uint) || type == typeof(StringHash)) return VariantType.VarInt;
+            if (type == typeof(long) || type == typeof(ulong)) return VariantType.VarInt64;
+            if (type == typeof(float)) return VariantType.VarFloat;
+            if (type == typeof(double)) return VariantType.VarDouble;
+            if (type == typeof(Vector2)) return VariantType.VarVector2;
+            if (type == typeof(Vector3)) return VariantType.VarVector3;
+            if (type == typeof(Vector4)) return VariantType.VarVector4;
+            if (type == typeof(Quaternion)) return VariantType.VarQuaternion;
+            if (type == typeof(Color)) return VariantType.VarColor;
+            if (type == typeof(IntVector2)) return VariantType.VarIntVector2;
+            if (type == typeof(IntVector3)) return VariantType.VarIntVector3;
+            if (type == typeof(IntRect)) return VariantType.VarIntRect;
+            if (type == typeof(IntPtr)) return VariantType.VarPtr;
+            if (type == typeof(EventBuffer)) return VariantType.VarBuffer;
+            throw new NotSupportedException($"Type {type.Name} is not supported in event payload {typeof(T).Name}");
+        }
+    }
+
+    /// Invokes event payload handler from native callback.
+    internal abstract class EventPayloadInvoker
+    {
+        public abstract void Invoke(uint eventHash, IntPtr payload);
+    }
+
+    internal sealed class EventPayloadInvoker<T> : EventPayloadInvoker where T : struct, IEventPayload
+    {
+        private readonly EventPayloadHandler<T> _handler;
+
+        public EventPayloadInvoker(EventPayloadHandler<T> handler)
+        {
+            _handler = handler;
+        }
+
+        public override void Invoke(uint eventHash, IntPtr payload)
+        {
+            var args = default(T);
+            args.Load(payload);
+            _handler(new StringHash(eventHash), in args);
+        }
+    }
+}
@@ -46,6 +46,26 @@ namespace Urho3DNet
         }
         private static readonly EventCallbackDelegate EventHandlerCallbackInstance = EventHandlerCallback;
 
+        [DllImport(global::Urho3DNet.Urho3DPINVOKE.DllImportModule, EntryPoint = "Urho3D_Object_SubscribeToEventPayload")]
+        [return: MarshalAs(UnmanagedType.I1)]
+        private static extern bool Urho3D_Object_SubscribeToEventPayload(HandleRef receiver, HandleRef sender, uint eventType,
+            uint[] keys, int[] types, uint[] offsets, uint numParams, uint payloadSize, IntPtr callback, IntPtr callbackHandle);
+
+#if __IOS__
+        [global::ObjCRuntime.MonoNativeFunctionWrapper]
+#endif
+        private delegate void EventPayloadCallbackDelegate(IntPtr invokerHandle, uint eventHash, IntPtr payload);
+
+#if __IOS__
+        [global::ObjCRuntime.MonoPInvokeCallback(typeof(EventPayloadCallbackDelegate))]
+#endif
+        private static void EventPayloadCallback(IntPtr invokerHandle, uint eventHash, IntPtr payload)
+        {
+            var invoker = (EventPayloadInvoker)GCHandle.FromIntPtr(invokerHandle).Target;
+            invoker.Invoke(eventHash, payload);
+        }
+        private static readonly EventPayloadCallbackDelegate EventPayloadCallbackInstance = EventPayloadCallback;
+
         public void SubscribeToEvent(StringHash e, Object sender, Action<StringHash, VariantMap> eventHandler)
         {
             IntPtr handle = GCHandle.ToIntPtr(GCHandle.Alloc(eventHandler));
@@ -68,6 +88,27 @@ namespace Urho3DNet
             SubscribeToEvent(e, null, eventHandler);
         }
 
+        /// Subscribe to event with typed payload. Event parameters are copied into payload struct by native code,
+        /// so the handler does not allocate wrappers of VariantMap and its values.
+        public void SubscribeToEvent<T>(StringHash e, Object sender, EventPayloadHandler<T> eventHandler)
+            where T : struct, IEventPayload
+        {
+            GCHandle handle = GCHandle.Alloc(new EventPayloadInvoker<T>(eventHandler));
+            IntPtr callback = Marshal.GetFunctionPointerForDelegate(EventPayloadCallbackInstance);
+            if (!Urho3D_Object_SubscribeToEventPayload(swigCPtr, getCPtr(sender), e.Hash, EventPayloadLayout<T>.Keys,
+                EventPayloadLayout<T>.Types, EventPayloadLayout<T>.Offsets, (uint)EventPayloadLayout<T>.Keys.Length,
+                EventPayloadLayout<T>.Size, callback, GCHandle.ToIntPtr(handle)))
+            {
+                handle.Free();
+                throw new ArgumentException($"Event payload {typeof(T).Name} has unsupported layout");
+            }
+        }
+
+        public void SubscribeToEvent<T>(StringHash e, EventPayloadHandler<T> eventHandler) where T : struct, IEventPayload
+        {
+            SubscribeToEvent(e, null, eventHandler);
+        }
+
         public T GetSubsystem<T>() where T : Object
         {
             return (T)GetSubsystem(typeof(T).Name);
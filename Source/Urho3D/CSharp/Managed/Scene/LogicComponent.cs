@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Urho3DNet
+{
+    /// <summary>
+    /// Marks logic component type to be updated in batches. Instead of receiving a native callback per component per
+    /// update event, all components of this type in a scene are updated by a single call per update phase.
+    /// </summary>
+    [AttributeUsage(AttributeTargets.Class)]
+    public class BatchedUpdateAttribute : System.Attribute
+    {
+    }
+
+    public partial class LogicComponent
+    {
+        [DllImport(global::Urho3DNet.Urho3DPINVOKE.DllImportModule, EntryPoint = "Urho3D_Script_SetUpdateBatchCallback")]
+        private static extern void Urho3D_Script_SetUpdateBatchCallback(IntPtr callback);
+
+#if __IOS__
+        [global::ObjCRuntime.MonoNativeFunctionWrapper]
+#endif
+        private delegate void UpdateBatchCallbackDelegate(uint phase, float timeStep, IntPtr components, uint count);
+
+#if __IOS__
+        [global::ObjCRuntime.MonoPInvokeCallback(typeof(UpdateBatchCallbackDelegate))]
+#endif
+        private static unsafe void UpdateBatchCallback(uint phase, float timeStep, IntPtr components, uint count)
+        {
+            var handles = (IntPtr*)components;
+            switch ((UpdateEvent)phase)
+            {
+                case UpdateEvent.UseUpdate:
+                    for (uint i = 0; i < count; i++)
+                        ((LogicComponent)GCHandle.FromIntPtr(handles[i]).Target).Update(timeStep);
+                    break;
+                case UpdateEvent.UsePostupdate:
+                    for (uint i = 0; i < count; i++)
+                        ((LogicComponent)GCHandle.FromIntPtr(handles[i]).Target).PostUpdate(timeStep);
+                    break;
+                case UpdateEvent.UseFixedupdate:
+                    for (uint i = 0; i < count; i++)
+                        ((LogicComponent)GCHandle.FromIntPtr(handles[i]).Target).FixedUpdate(timeStep);
+                    break;
+                case UpdateEvent.UseFixedpostupdate:
+                    for (uint i = 0; i < count; i++)
+                        ((LogicComponent)GCHandle.FromIntPtr(handles[i]).Target).FixedPostUpdate(timeStep);
+                    break;
+            }
+        }
+        private static readonly UpdateBatchCallbackDelegate UpdateBatchCallbackInstance = UpdateBatchCallback;
+        private static bool _updateBatchCallbackSet;
+
+        protected new void OnSetupInstance()
+        {
+            base.OnSetupInstance();
+
+            Type type = GetType();
+            if (!Attribute.IsDefined(type, typeof(BatchedUpdateAttribute), false))
+                return;
+
+            if (!_updateBatchCallbackSet)
+            {
+                Urho3D_Script_SetUpdateBatchCallback(Marshal.GetFunctionPointerForDelegate(UpdateBatchCallbackInstance));
+                _updateBatchCallbackSet = true;
+            }
+            // Type handle is stable for the lifetime of the type and identifies the batch on native side.
+            SetBatchedUpdateType(type.TypeHandle.Value);
+        }
+    }
+}
@@ -23,10 +23,95 @@
 #include <Urho3D/Core/Object.h>
 #include <Urho3D/Script/Script.h>
 
+#include <cstring>
+
 namespace Urho3D
 {
 
 typedef void(SWIGSTDCALL*EventHandlerCallback)(void*, unsigned, VariantMap*);
+typedef void(SWIGSTDCALL*EventPayloadCallback)(void*, unsigned, const void*);
+
+/// Max size of blittable event payload.
+static const unsigned MAX_EVENT_PAYLOAD_SIZE = 256;
+
+/// Event parameter copied into blittable payload.
+struct ManagedEventParam
+{
+    /// Parameter name hash.
+    StringHash key_;
+    /// Type of payload field.
+    VariantType type_;
+    /// Offset of payload field.
+    unsigned offset_;
+};
+
+/// Buffer parameter in blittable payload. Points to event data, valid only during the event.
+struct ManagedEventBuffer
+{
+    const void* data_;
+    int size_;
+};
+
+/// Return size of payload field of given type, or 0 if the type is not supported.
+static unsigned GetEventPayloadFieldSize(VariantType type)
+{
+    switch (type)
+    {
+    case VAR_BOOL: return sizeof(bool);
+    case VAR_INT: return sizeof(int);
+    case VAR_INT64: return sizeof(long long);
+    case VAR_FLOAT: return sizeof(float);
+    case VAR_DOUBLE: return sizeof(double);
+    case VAR_VECTOR2: return sizeof(Vector2);
+    case VAR_VECTOR3: return sizeof(Vector3);
+    case VAR_VECTOR4: return sizeof(Vector4);
+    case VAR_QUATERNION: return sizeof(Quaternion);
+    case VAR_COLOR: return sizeof(Color);
+    case VAR_INTVECTOR2: return sizeof(IntVector2);
+    case VAR_INTVECTOR3: return sizeof(IntVector3);
+    case VAR_INTRECT: return sizeof(IntRect);
+    case VAR_PTR: return sizeof(void*);
+    case VAR_VOIDPTR: return sizeof(void*);
+    case VAR_BUFFER: return sizeof(ManagedEventBuffer);
+    default: return 0;
+    }
+}
+
+/// Write event parameter into payload field. Missing and mismatching parameters are left zeroed.
+static void WriteEventPayloadField(unsigned char* dest, VariantType type, const Variant& value)
+{
+    switch (type)
+    {
+    case VAR_BOOL: *reinterpret_cast<bool*>(dest) = value.GetBool(); break;
+    case VAR_INT: *reinterpret_cast<int*>(dest) = value.GetInt(); break;
+    case VAR_INT64: *reinterpret_cast<long long*>(dest) = value.GetInt64(); break;
+    case VAR_FLOAT: *reinterpret_cast<float*>(dest) = value.GetFloat(); break;
+    case VAR_DOUBLE: *reinterpret_cast<double*>(dest) = value.GetDouble(); break;
+    case VAR_VECTOR2: memcpy(dest, &value.GetVector2(), sizeof(Vector2)); break;
+    case VAR_VECTOR3: memcpy(dest, &value.GetVector3(), sizeof(Vector3)); break;
+    case VAR_VECTOR4: memcpy(dest, &value.GetVector4(), sizeof(Vector4)); break;
+    case VAR_QUATERNION: memcpy(dest, &value.GetQuaternion(), sizeof(Quaternion)); break;
+    case VAR_COLOR: memcpy(dest, &value.GetColor(), sizeof(Color)); break;
+    case VAR_INTVECTOR2: memcpy(dest, &value.GetIntVector2(), sizeof(IntVector2)); break;
+    case VAR_INTVECTOR3: memcpy(dest, &value.GetIntVector3(), sizeof(IntVector3)); break;
+    case VAR_INTRECT: memcpy(dest, &value.GetIntRect(), sizeof(IntRect)); break;
+    case VAR_PTR:
+    case VAR_VOIDPTR:
+    {
+        void* ptr = value.GetType() == VAR_VOIDPTR ? value.GetVoidPtr() : static_cast<void*>(value.GetPtr());
+        memcpy(dest, &ptr, sizeof(ptr));
+        break;
+    }
+    case VAR_BUFFER:
+    {
+        const VariantBuffer& buffer = value.GetBuffer();
+        const ManagedEventBuffer view{ buffer.data(), static_cast<int>(buffer.size()) };
+        memcpy(dest, &view, sizeof(view));
+        break;
+    }
+    default: break;
+    }
+}
 
 class ManagedEventHandler : public EventHandler
 {
@@ -61,6 +146,52 @@ protected:
     void* callbackHandle_ = nullptr;
 };
 
+/// Event handler that passes selected event parameters to managed code as blittable struct.
+class ManagedEventPayloadHandler : public EventHandler
+{
+public:
+    ManagedEventPayloadHandler(Object* receiver, ea::vector<ManagedEventParam> params, unsigned payloadSize,
+        EventPayloadCallback callback, void* callbackHandle)
+        : EventHandler(receiver, nullptr)
+        , params_(ea::move(params))
+        , payloadSize_(payloadSize)
+        , callback_(callback)
+        , callbackHandle_(callbackHandle)
+    {
+    }
+
+    ~ManagedEventPayloadHandler() override
+    {
+        Script::GetRuntimeApi()->FreeGCHandle(callbackHandle_);
+        callbackHandle_ = nullptr;
+    }
+
+    void Invoke(VariantMap& eventData) override
+    {
+        alignas(16) unsigned char payload[MAX_EVENT_PAYLOAD_SIZE];
+        memset(payload, 0, payloadSize_);
+        for (const ManagedEventParam& param : params_)
+        {
+            const auto iter = eventData.find(param.key_);
+            if (iter != eventData.end())
+                WriteEventPayloadField(payload + param.offset_, param.type_, iter->second);
+        }
+        callback_(callbackHandle_, eventType_.Value(), payload);
+    }
+
+    EventHandler* Clone() const override
+    {
+        return new ManagedEventPayloadHandler(receiver_, params_, payloadSize_, callback_,
+            Script::GetRuntimeApi()->CloneGCHandle(callbackHandle_));
+    }
+
+protected:
+    ea::vector<ManagedEventParam> params_;
+    unsigned payloadSize_ = 0;
+    EventPayloadCallback callback_ = nullptr;
+    void* callbackHandle_ = nullptr;
+};
+
 extern "C"
 {
 
@@ -77,6 +208,33 @@ URHO3D_EXPORT_API void SWIGSTDCALL Urho3D_Object_SubscribeToEvent(Object* receiv
         receiver->SubscribeToEvent(sender, event, new ManagedEventHandler(receiver, callback, callbackHandle));
 }
 
+URHO3D_EXPORT_API bool SWIGSTDCALL Urho3D_Object_SubscribeToEventPayload(Object* receiver, Object* sender, unsigned eventType,
+    const unsigned* keys, const int* types, const unsigned* offsets, unsigned numParams, unsigned payloadSize,
+    EventPayloadCallback callback, void* callbackHandle)
+{
+    // Layout is validated once on subscription, so the handler may write fields without checks.
+    if (payloadSize > MAX_EVENT_PAYLOAD_SIZE)
+        return false;
+
+    ea::vector<ManagedEventParam> params(numParams);
+    for (unsigned i = 0; i < numParams; ++i)
+    {
+        const auto type = static_cast<VariantType>(types[i]);
+        const unsigned fieldSize = GetEventPayloadFieldSize(type);
+        if (fieldSize == 0 || offsets[i] + fieldSize > payloadSize)
+            return false;
+        params[i] = ManagedEventParam{ StringHash(keys[i]), type, offsets[i] };
+    }
+
+    auto handler = new ManagedEventPayloadHandler(receiver, ea::move(params), payloadSize, callback, callbackHandle);
+    StringHash event(eventType);
+    if (sender == nullptr)
+        receiver->SubscribeToEvent(event, handler);
+    else
+        receiver->SubscribeToEvent(sender, event, handler);
+    return true;
+}
+
 }
 
 }
@@ -1,4 +1,5 @@
 #include <cstddef>
+#include <type_traits>
 
 template<typename T> T* addr(T& ref)  { return &ref; }
 template<typename T> T* addr(T* ptr)  { return ptr;  }
@@ -27,6 +28,10 @@ DEFINE_POD_HELPER_STRUCT(float, 12);
 DEFINE_POD_HELPER_STRUCT(float, 16);
 #undef DEFINE_POD_HELPER_STRUCT
 
+/// Whether native type may be reinterpreted as POD type and shared with C# without conversion.
+template<typename T, typename Pod>
+struct is_blittable : std::integral_constant<bool, std::is_standard_layout<T>::value && sizeof(T) == sizeof(Pod)> {};
+
 template<typename From, typename To>
 To convert(const From& from)
 {
@@ -107,6 +107,26 @@ URHO3D_BINARY_COMPATIBLE_TYPE(Ray, pod::float6);
 
 }
 
+%{
+// Math types are passed to C# by reference and shared in bulk via vectors, their layout must match C# structs.
+static_assert(pod::is_blittable<Urho3D::Color, pod::float4>::value, "");
+static_assert(pod::is_blittable<Urho3D::Rect, pod::float4>::value, "");
+static_assert(pod::is_blittable<Urho3D::IntRect, pod::int4>::value, "");
+static_assert(pod::is_blittable<Urho3D::Vector2, pod::float2>::value, "");
+static_assert(pod::is_blittable<Urho3D::IntVector2, pod::int2>::value, "");
+static_assert(pod::is_blittable<Urho3D::Vector3, pod::float3>::value, "");
+static_assert(pod::is_blittable<Urho3D::IntVector3, pod::int3>::value, "");
+static_assert(pod::is_blittable<Urho3D::Vector4, pod::float4>::value, "");
+static_assert(pod::is_blittable<Urho3D::Matrix3, pod::float9>::value, "");
+static_assert(pod::is_blittable<Urho3D::Matrix3x4, pod::float12>::value, "");
+static_assert(pod::is_blittable<Urho3D::Matrix4, pod::float16>::value, "");
+static_assert(pod::is_blittable<Urho3D::Quaternion, pod::float4>::value, "");
+static_assert(pod::is_blittable<Urho3D::Plane, pod::float7>::value, "");
+static_assert(pod::is_blittable<Urho3D::BoundingBox, pod::float8>::value, "");
+static_assert(pod::is_blittable<Urho3D::Sphere, pod::float4>::value, "");
+static_assert(pod::is_blittable<Urho3D::Ray, pod::float6>::value, "");
+%}
+
 URHO3D_BINARY_COMPATIBLE_TYPE_EX(Vector2, ImVec2, pod::float2);
 URHO3D_BINARY_COMPATIBLE_TYPE_EX(Vector4, ImVec4, pod::float4);
 URHO3D_BINARY_COMPATIBLE_TYPE_EX(Vector4, btVector3, pod::float4);  // Bullet stores 4 floats despite the name.
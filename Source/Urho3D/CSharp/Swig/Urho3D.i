@@ -348,6 +348,7 @@ namespace SDL
 %ignore Urho3D::PluginApplication::PluginApplicationMain;
 %ignore Urho3D::PluginApplication::InitializeReloadablePlugin;
 %ignore Urho3D::PluginApplication::UninitializeReloadablePlugin;
+%ignore Urho3D::PluginApplication::GetRegisteredTypes;
 
 %include "generated/Urho3D/_pre_engine.i"
 %include "Urho3D/Engine/EngineDefs.h"
@@ -356,6 +357,8 @@ namespace SDL
 %include "Urho3D/Engine/PluginApplication.h"
 %include "generated/Urho3D/_pre_script.i"
 #if URHO3D_CSHARP
+%ignore Urho3D::Script::SetUpdateBatchCallback;
+%ignore Urho3D::Script::AddBatchedComponent;
 %include "Urho3D/Script/Script.h"
 #endif
 
@@ -715,6 +718,7 @@ public:
 %ignore Urho3D::Network::MakeHttpRequest;
 %ignore Urho3D::PackageDownload;
 %ignore Urho3D::PackageUpload;
+%ignore Urho3D::PackageUploadChunk;
 
 // These methods use forward-declared types from SLikeNet.
 %ignore Urho3D::Connection::Connection;
@@ -947,6 +951,16 @@ using ImGuiConfigFlags = unsigned;
 %template(TextureMap)                   eastl::unordered_map<Urho3D::TextureUnit, Urho3D::SharedPtr<Urho3D::Texture>>;
 
 using Vector3 = Urho3D::Vector3;
+// Math types have the same layout in C# and C++, elements of these vectors are accessed without marshalling.
+SWIG_EASTL_VECTOR_BLITTABLE(Urho3D::Vector2)
+SWIG_EASTL_VECTOR_BLITTABLE(Urho3D::Vector3)
+SWIG_EASTL_VECTOR_BLITTABLE(Urho3D::Vector4)
+SWIG_EASTL_VECTOR_BLITTABLE(Urho3D::IntVector2)
+SWIG_EASTL_VECTOR_BLITTABLE(Urho3D::IntVector3)
+SWIG_EASTL_VECTOR_BLITTABLE(Urho3D::Quaternion)
+SWIG_EASTL_VECTOR_BLITTABLE(Urho3D::Rect)
+SWIG_EASTL_VECTOR_BLITTABLE(Urho3D::IntRect)
+SWIG_EASTL_VECTOR_BLITTABLE(Urho3D::Matrix3x4)
 %template(StringHashList)                   eastl::vector<Urho3D::StringHash>;
 %template(Vector2List)                      eastl::vector<Urho3D::Vector2>;
 %template(Vector3List)                      eastl::vector<Urho3D::Vector3>;
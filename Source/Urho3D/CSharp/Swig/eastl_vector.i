@@ -110,10 +110,17 @@
       throw new global::System.ArgumentException("Multi dimensional array.", "array");
     if (index+count > this.Count || arrayIndex+count > array.Length)
       throw new global::System.ArgumentException("Number of elements to copy is too large.");
+    bool copied = false;
+    CopyToBlittable(index, array, arrayIndex, count, ref copied);
+    if (copied)
+      return;
     for (int i=0; i<count; i++)
       array.SetValue(getitemcopy(index+i), arrayIndex+i);
   }
 
+  // Implemented by vectors of blittable types, see SWIG_EASTL_VECTOR_BLITTABLE
+  partial void CopyToBlittable(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count, ref bool copied);
+
   public $typemap(cstype, CTYPE)[] ToArray() {
     $typemap(cstype, CTYPE)[] array = new $typemap(cstype, CTYPE)[this.Count];
     this.CopyTo(array);
@@ -355,6 +362,56 @@ namespace eastl {
 }
 %enddef
 
+// Extra methods added to the collection class if CTYPE has the same memory layout in C++ and C#.
+// Elements are copied in bulk and native storage is exposed to C# without marshalling of individual elements.
+%define SWIG_EASTL_VECTOR_EXTRA_BLITTABLE(CTYPE...)
+    %proxycode %{
+  // Pointer to contiguous native storage of elements. Valid until the collection is modified or disposed.
+  public $typemap(cstype, CTYPE)* Data => ($typemap(cstype, CTYPE)*)GetData();
+
+  partial void CopyToBlittable(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count, ref bool copied)
+  {
+    copied = true;
+    if (count == 0)
+      return;
+    fixed ($typemap(cstype, CTYPE)* dest = &array[arrayIndex])
+    {
+      long bytesToCopy = (long)count * sizeof($typemap(cstype, CTYPE));
+      global::System.Buffer.MemoryCopy(Data + index, dest, bytesToCopy, bytesToCopy);
+    }
+  }
+
+  public void AddRange($typemap(cstype, CTYPE)[] values)
+  {
+    if (values == null)
+      throw new global::System.ArgumentNullException("values");
+    if (values.Length == 0)
+      return;
+    fixed ($typemap(cstype, CTYPE)* source = &values[0])
+      AppendData((global::System.IntPtr)source, values.Length);
+  }
+    %}
+    %extend {
+      void* GetData() {
+        return $self->data();
+      }
+      void AppendData(void* data, int count) {
+        const CTYPE* begin = static_cast<const CTYPE*>(data);
+        $self->insert($self->end(), begin, begin + count);
+      }
+    }
+%enddef
+
+%define SWIG_EASTL_VECTOR_BLITTABLE(CTYPE...)
+namespace eastl {
+  template<> class vector< CTYPE > {
+    SWIG_EASTL_VECTOR_MINIMUM_INTERNAL(IList, %arg(CTYPE const&), %arg(CTYPE))
+    SWIG_EASTL_VECTOR_EXTRA_OP_EQUALS_EQUALS(CTYPE)
+    SWIG_EASTL_VECTOR_EXTRA_BLITTABLE(CTYPE)
+  };
+}
+%enddef
+
 // Legacy macros
 %define SWIG_EASTL_VECTOR_SPECIALIZE(CSTYPE, CTYPE...)
 #warning SWIG_EASTL_VECTOR_SPECIALIZE macro deprecated, please see csharp/std_vector.i and switch to SWIG_EASTL_VECTOR_ENHANCED
@@ -377,6 +434,8 @@ SWIG_EASTL_VECTOR_ENHANCED(CTYPE)
 %csmethodmodifiers eastl::vector::size "private"
 %csmethodmodifiers eastl::vector::capacity "private"
 %csmethodmodifiers eastl::vector::reserve "private"
+%csmethodmodifiers eastl::vector::GetData "private"
+%csmethodmodifiers eastl::vector::AppendData "private"
 
 namespace eastl {
   // primary (unspecialized) class template for eastl::vector
@@ -399,18 +458,18 @@ namespace eastl {
 // template specializations for eastl::vector
 // these provide extra collections methods as operator== is defined
 SWIG_EASTL_VECTOR_ENHANCED(char)
-SWIG_EASTL_VECTOR_ENHANCED(signed char)
-SWIG_EASTL_VECTOR_ENHANCED(unsigned char)
-SWIG_EASTL_VECTOR_ENHANCED(short)
-SWIG_EASTL_VECTOR_ENHANCED(unsigned short)
-SWIG_EASTL_VECTOR_ENHANCED(int)
-SWIG_EASTL_VECTOR_ENHANCED(unsigned int)
+SWIG_EASTL_VECTOR_BLITTABLE(signed char)
+SWIG_EASTL_VECTOR_BLITTABLE(unsigned char)
+SWIG_EASTL_VECTOR_BLITTABLE(short)
+SWIG_EASTL_VECTOR_BLITTABLE(unsigned short)
+SWIG_EASTL_VECTOR_BLITTABLE(int)
+SWIG_EASTL_VECTOR_BLITTABLE(unsigned int)
 SWIG_EASTL_VECTOR_ENHANCED(long)
 SWIG_EASTL_VECTOR_ENHANCED(unsigned long)
-SWIG_EASTL_VECTOR_ENHANCED(long long)
-SWIG_EASTL_VECTOR_ENHANCED(unsigned long long)
-SWIG_EASTL_VECTOR_ENHANCED(float)
-SWIG_EASTL_VECTOR_ENHANCED(double)
+SWIG_EASTL_VECTOR_BLITTABLE(long long)
+SWIG_EASTL_VECTOR_BLITTABLE(unsigned long long)
+SWIG_EASTL_VECTOR_BLITTABLE(float)
+SWIG_EASTL_VECTOR_BLITTABLE(double)
 SWIG_EASTL_VECTOR_ENHANCED(eastl::string) // also requires a %include <std_string.i>
 SWIG_EASTL_VECTOR_ENHANCED(eastl::wstring) // also requires a %include <std_wstring.i>
 
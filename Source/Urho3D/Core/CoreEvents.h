@@ -58,6 +58,13 @@ URHO3D_EVENT(E_POSTRENDERUPDATE, PostRenderUpdate)
     URHO3D_PARAM(P_TIMESTEP, TimeStep);            // float
 }
 
+/// Extraction boundary between frame update and rendering. Scene state is final for the frame after this event.
+/// Pipelined work queued via Engine::AddPipelinedWork may run concurrently with rendering after this event.
+URHO3D_EVENT(E_RENDEREXTRACT, RenderExtract)
+{
+    URHO3D_PARAM(P_TIMESTEP, TimeStep);            // float
+}
+
 /// Frame end event.
 URHO3D_EVENT(E_ENDFRAME, EndFrame)
 {
@@ -314,6 +314,28 @@ void WorkQueue::Complete(unsigned priority)
     completing_ = false;
 }
 
+bool WorkQueue::ExecuteQueuedItem(unsigned maxPriority)
+{
+    WorkItem* item = nullptr;
+    {
+        // Mutex is recursive, so it's safe to lock even if worker threads are paused
+        MutexLock lock(queueMutex_);
+
+        // Queue is sorted by priority, take the first item that is not above the limit
+        auto i = ea::find_if(queue_.begin(), queue_.end(),
+            [&](const WorkItem* queuedItem) { return queuedItem->priority_ <= maxPriority; });
+        if (i == queue_.end())
+            return false;
+
+        item = *i;
+        queue_.erase(i);
+    }
+
+    item->workFunction_(item, 0);
+    item->completed_ = true;
+    return true;
+}
+
 unsigned WorkQueue::GetNumIncomplete(unsigned priority) const
 {
     unsigned incomplete = 0;
@@ -100,6 +100,8 @@ public:
     void Resume();
     /// Finish all queued work which has at least the specified priority. Main thread will also execute priority work. Pause worker threads if no more work remains.
     void Complete(unsigned priority);
+    /// Execute one queued work item with at most the specified priority in the main thread. Return false if there is no such item.
+    bool ExecuteQueuedItem(unsigned maxPriority = M_MAX_UNSIGNED);
 
     /// Set the pool telerance before it starts deleting pool items.
     void SetTolerance(int tolerance) { tolerance_ = tolerance; }
@@ -26,6 +26,7 @@
 #include "../Engine/Application.h"
 #include "../Engine/EngineDefs.h"
 #include "../Engine/EngineEvents.h"
+#include "../Engine/FixedTickScheduler.h"
 #include "../IO/IOEvents.h"
 #include "../IO/Log.h"
 #if URHO3D_CSHARP
@@ -117,6 +118,15 @@ int Application::Run()
             return exitCode_;
         }
 
+        // Headless servers may run at fixed tick rate. Scheduler is available as subsystem for Start() to configure
+        const int tickRate = engine_->GetParameter(engineParameters_, EP_TICK_RATE, 0).GetInt();
+        if (engine_->IsHeadless() && tickRate > 0)
+        {
+            auto tickScheduler = MakeShared<FixedTickScheduler>(context_);
+            tickScheduler->SetTickRate(tickRate);
+            context_->RegisterSubsystem(tickScheduler);
+        }
+
 #if URHO3D_PLUGINS && URHO3D_CSHARP
         if (engine_->GetParameter(engineParameters_, EP_ENGINE_AUTO_LOAD_SCRIPTS, true).GetBool())
         {
@@ -145,8 +155,13 @@ int Application::Run()
 
         // Platforms other than iOS/tvOS and Emscripten run a blocking main loop
 #if !defined(IOS) && !defined(TVOS) && !defined(__EMSCRIPTEN__)
-        while (!engine_->IsExiting())
-            engine_->RunFrame();
+        if (auto* tickScheduler = GetSubsystem<FixedTickScheduler>())
+            tickScheduler->Run();
+        else
+        {
+            while (!engine_->IsExiting())
+                engine_->RunFrame();
+        }
 
 #if URHO3D_PLUGINS && URHO3D_CSHARP
         if (scriptsPlugin_.NotNull())
@@ -105,6 +105,18 @@ namespace Urho3D
 
 extern const char* logLevelNames[];
 
+namespace
+{
+
+/// Time before frame deadline in microseconds when frame limiter stops sleeping and starts spinning.
+const long long frameLimiterSpinTime = 1000;
+/// Minimum time before frame deadline in microseconds to start new slack work.
+const long long slackWorkMinTime = 2000;
+/// Number of frames to aggregate frame pacing statistics over.
+const unsigned framePacingWindow = 60;
+
+}
+
 Engine::Engine(Context* context) :
     Object(context),
     timeStep_(0.0f),
@@ -230,6 +242,8 @@ bool Engine::Initialize(const VariantMap& parameters)
     if (GetParameter(parameters, EP_FRAME_LIMITER, true) == false)
         SetMaxFps(0);
 
+    SetPipelinedFrame(GetParameter(parameters, EP_PIPELINED_FRAME, false).GetBool());
+
     // Set amount of worker threads according to the available physical CPU cores. Using also hyperthreaded cores results in
     // unpredictable extra synchronization overhead. Also reserve one core for the main thread
 #ifdef URHO3D_THREADING
@@ -526,6 +540,9 @@ void Engine::RunFrame()
     auto* input = GetSubsystem<Input>();
     auto* audio = GetSubsystem<Audio>();
 
+    // Results of pipelined work of the previous frame are available starting from the beginning of the frame
+    CompletePipelinedWork();
+
     {
         URHO3D_PROFILE("DoFrame");
         time->BeginFrame(timeStep_);
@@ -746,6 +763,32 @@ void Engine::Update()
 
     // Post-render update event
     SendEvent(E_POSTRENDERUPDATE, eventData);
+
+    // Extraction boundary, scene is not updated anymore during this frame
+    SendEvent(E_RENDEREXTRACT, eventData);
+
+    // Overlap pipelined work with rendering
+    if (!pipelinedFrame_)
+        CompletePipelinedWork();
+}
+
+SharedPtr<WorkItem> Engine::AddPipelinedWork(std::function<void(unsigned threadIndex)> workFunction)
+{
+    ++numPipelinedWorkItems_;
+    return GetSubsystem<WorkQueue>()->AddWorkItem(ea::move(workFunction), PIPELINED_WORK_PRIORITY);
+}
+
+void Engine::CompletePipelinedWork()
+{
+    if (numPipelinedWorkItems_ == 0)
+        return;
+
+    URHO3D_PROFILE("CompletePipelinedWork");
+
+    HiresTimer timer;
+    GetSubsystem<WorkQueue>()->Complete(PIPELINED_WORK_PRIORITY);
+    pipelinedWorkWaitTime_ = timer.GetUSec(false);
+    numPipelinedWorkItems_ = 0;
 }
 
 void Engine::Render()
@@ -774,6 +817,40 @@ void Engine::Render()
     graphics->EndFrame();
 }
 
+void Engine::DoSlackWork(long long targetFrameTime)
+{
+    URHO3D_PROFILE("FrameLimiterSlackWork");
+
+    auto* workQueue = GetSubsystem<WorkQueue>();
+    auto* cache = GetSubsystem<ResourceCache>();
+
+    // Don't start new work too close to the deadline, work items are not preemptible
+    while (targetFrameTime - frameTimer_.GetUSec(false) >= slackWorkMinTime)
+    {
+        const bool resourcesFinished = cache && cache->GetNumBackgroundLoadResources() > 0
+            && cache->FinishBackgroundResources(1) > 0;
+        const bool workExecuted = workQueue && workQueue->ExecuteQueuedItem(SLACK_WORK_MAX_PRIORITY);
+        if (!resourcesFinished && !workExecuted)
+            break;
+    }
+}
+
+void Engine::UpdateFramePacingJitter(long long deviation)
+{
+    deviation = Abs(deviation);
+    framePacingJitterSum_ += deviation;
+    framePacingJitterMax_ = Max(framePacingJitterMax_, deviation);
+
+    if (++numFramePacingSamples_ >= framePacingWindow)
+    {
+        framePacingJitter_ = framePacingJitterSum_ / numFramePacingSamples_;
+        maxFramePacingJitter_ = framePacingJitterMax_;
+        framePacingJitterSum_ = 0;
+        framePacingJitterMax_ = 0;
+        numFramePacingSamples_ = 0;
+    }
+}
+
 void Engine::ApplyFrameLimit()
 {
     if (!initialized_)
@@ -798,7 +875,10 @@ void Engine::ApplyFrameLimit()
     {
         URHO3D_PROFILE("ApplyFrameLimit");
 
-        long long targetMax = 1000000LL / maxFps;
+        const long long targetMax = 1000000LL / maxFps;
+
+        if (frameLimiterSlackWork_)
+            DoSlackWork(targetMax);
 
         for (;;)
         {
@@ -806,13 +886,13 @@ void Engine::ApplyFrameLimit()
             if (elapsed >= targetMax)
                 break;
 
-            // Sleep if 1 ms or more off the frame limiting goal
-            if (targetMax - elapsed >= 1000LL)
-            {
-                auto sleepTime = (unsigned)((targetMax - elapsed) / 1000LL);
-                Time::Sleep(sleepTime);
-            }
+            // Sleep until shortly before the deadline, then spin to compensate for coarse sleep granularity
+            const long long remaining = targetMax - elapsed;
+            if (remaining > frameLimiterSpinTime)
+                Time::Sleep(static_cast<unsigned>((remaining - frameLimiterSpinTime) / 1000LL));
         }
+
+        UpdateFramePacingJitter(elapsed - targetMax);
     }
 #endif
 
@@ -919,6 +999,7 @@ void Engine::DefineParameters(CLI::App& commandLine, VariantMap& engineParameter
     addFlag("--headless", EP_HEADLESS, true, "Do not initialize graphics subsystem");
     addFlag("--validate-shaders", EP_VALIDATE_SHADERS, true, "Validate shaders before submitting them to GAPI");
     addFlag("--nolimit", EP_FRAME_LIMITER, false, "Disable frame limiter");
+    addFlag("--pipelined", EP_PIPELINED_FRAME, true, "Overlap pipelined work with rendering");
     addFlag("--flushgpu", EP_FLUSH_GPU, true, "Enable GPU flushing");
     addFlag("--gl2", EP_FORCE_GL2, true, "Force OpenGL2");
     addOptionPrependString("--landscape", EP_ORIENTATIONS, "LandscapeLeft LandscapeRight ", "Force landscape orientation");
@@ -955,6 +1036,7 @@ void Engine::DefineParameters(CLI::App& commandLine, VariantMap& engineParameter
     addOptionInt("-y,--height", EP_WINDOW_HEIGHT, "Window height");
     addOptionInt("--monitor", EP_MONITOR, "Create window on the specified monitor");
     addOptionInt("--hz", EP_REFRESH_RATE, "Use custom refresh rate");
+    addOptionInt("--tick-rate", EP_TICK_RATE, "Run headless main loop at fixed tick rate");
     addOptionInt("-m,--multisample", EP_MULTI_SAMPLE, "Multisampling samples");
     addOptionInt("-b,--sound-buffer", EP_SOUND_BUFFER, "Sound buffer size");
     addOptionInt("-r,--mix-rate", EP_SOUND_MIX_RATE, "Sound mixing rate");
@@ -1035,6 +1117,8 @@ void Engine::HandleEndFrame(StringHash eventType, VariantMap& eventData)
 
 void Engine::DoExit()
 {
+    CompletePipelinedWork();
+
     auto* graphics = GetSubsystem<Graphics>();
     if (graphics)
         graphics->Close();
@@ -37,6 +37,13 @@ namespace Urho3D
 
 class Console;
 class DebugHud;
+class WorkItem;
+
+/// Priority of pipelined work items. Lower than priority of work items used for rendering.
+static const unsigned PIPELINED_WORK_PRIORITY = M_MAX_UNSIGNED - 1;
+/// Max priority of work items executed by frame limiter while waiting for the frame deadline. Only low-priority work is
+/// executed there, as long items would overrun the deadline.
+static const unsigned SLACK_WORK_MAX_PRIORITY = 0;
 
 /// Urho3D engine. Creates the other subsystems.
 class URHO3D_API Engine : public Object
@@ -77,6 +84,20 @@ public:
     /// Set whether to exit automatically on exit request (window close button).
     /// @property
     void SetAutoExit(bool enable);
+    /// Set whether pipelined work is completed at the beginning of the next frame instead of before rendering.
+    /// In headless mode pipelined work overlaps with the frame limiter instead of rendering.
+    /// @property
+    void SetPipelinedFrame(bool enable) { pipelinedFrame_ = enable; }
+    /// Queue work to be executed in worker threads. Work is guaranteed to be completed before the next frame begins.
+    /// In pipelined mode it runs concurrently with rendering, so it must not modify state observed by rendering.
+    /// Results should be consumed only after completion. Should be called from the main thread.
+    SharedPtr<WorkItem> AddPipelinedWork(std::function<void(unsigned threadIndex)> workFunction);
+    /// Wait until all pipelined work is completed. Called automatically by the engine.
+    void CompletePipelinedWork();
+    /// Set whether frame limiter spends remaining frame time on low-priority work items and background resource loading
+    /// instead of sleeping. Default false.
+    /// @property
+    void SetFrameLimiterSlackWork(bool enable) { frameLimiterSlackWork_ = enable; }
     /// Override timestep of the next frame. Should be called in between RunFrame() calls.
     void SetNextTimeStep(float seconds);
     /// Close the graphics window and set the exit flag. No-op on iOS/tvOS, as an iOS/tvOS application can not legally exit.
@@ -114,6 +135,22 @@ public:
     /// @property
     bool GetPauseMinimized() const { return pauseMinimized_; }
 
+    /// Return whether pipelined work is completed at the beginning of the next frame instead of before rendering.
+    /// @property
+    bool GetPipelinedFrame() const { return pipelinedFrame_; }
+
+    /// Return time in microseconds that main thread spent waiting for pipelined work during the last completion.
+    long long GetPipelinedWorkWaitTime() const { return pipelinedWorkWaitTime_; }
+
+    /// Return whether frame limiter spends remaining frame time on background work.
+    /// @property
+    bool GetFrameLimiterSlackWork() const { return frameLimiterSlackWork_; }
+
+    /// Return average absolute deviation of frame time from frame limiter target over recent frames, in microseconds.
+    long long GetFramePacingJitter() const { return framePacingJitter_; }
+    /// Return maximum absolute deviation of frame time from frame limiter target over recent frames, in microseconds.
+    long long GetMaxFramePacingJitter() const { return maxFramePacingJitter_; }
+
     /// Return whether to exit automatically on exit request.
     /// @property
     bool GetAutoExit() const { return autoExit_; }
@@ -154,6 +191,10 @@ private:
     void HandleEndFrame(StringHash eventType, VariantMap& eventData);
     /// Actually perform the exit actions.
     void DoExit();
+    /// Execute queued work and finish background loaded resources while there's enough time left until frame deadline.
+    void DoSlackWork(long long targetFrameTime);
+    /// Accumulate frame pacing statistics.
+    void UpdateFramePacingJitter(long long deviation);
 
     /// App preference directory.
     ea::string appPreferencesDir_;
@@ -173,6 +214,22 @@ private:
     unsigned maxInactiveFps_;
     /// Pause when minimized flag.
     bool pauseMinimized_;
+    /// Pipelined frame flag.
+    bool pipelinedFrame_{};
+    /// Number of pipelined work items queued since the last completion.
+    unsigned numPipelinedWorkItems_{};
+    /// Time spent waiting for pipelined work during the last completion.
+    long long pipelinedWorkWaitTime_{};
+    /// Frame limiter slack work flag.
+    bool frameLimiterSlackWork_{};
+    /// Frame pacing statistics
+    /// @{
+    long long framePacingJitter_{};
+    long long maxFramePacingJitter_{};
+    long long framePacingJitterSum_{};
+    long long framePacingJitterMax_{};
+    unsigned numFramePacingSamples_{};
+    /// @}
 #ifdef URHO3D_TESTING
     /// Time out counter for testing.
     long long timeOut_;
@@ -52,6 +52,7 @@ static const ea::string EP_MULTI_SAMPLE = "MultiSample";
 static const ea::string EP_ORGANIZATION_NAME = "OrganizationName";
 static const ea::string EP_APPLICATION_NAME = "ApplicationName";
 static const ea::string EP_ORIENTATIONS = "Orientations";
+static const ea::string EP_PIPELINED_FRAME = "PipelinedFrame";
 static const ea::string EP_PACKAGE_CACHE_DIR = "PackageCacheDir";
 static const ea::string EP_RENDER_PATH = "RenderPath";
 static const ea::string EP_REFRESH_RATE = "RefreshRate";
@@ -68,6 +69,7 @@ static const ea::string EP_SOUND_STEREO = "SoundStereo";
 static const ea::string EP_TEXTURE_ANISOTROPY = "TextureAnisotropy";
 static const ea::string EP_TEXTURE_FILTER_MODE = "TextureFilterMode";
 static const ea::string EP_TEXTURE_QUALITY = "TextureQuality";
+static const ea::string EP_TICK_RATE = "TickRate";
 static const ea::string EP_TIME_OUT = "TimeOut";
 static const ea::string EP_TOUCH_EMULATION = "TouchEmulation";
 static const ea::string EP_TRIPLE_BUFFER = "TripleBuffer";
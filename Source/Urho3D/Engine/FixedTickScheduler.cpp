@@ -0,0 +1,226 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Core/Context.h"
+#include "../Engine/Engine.h"
+#include "../Engine/FixedTickScheduler.h"
+#ifdef URHO3D_PHYSICS
+#include "../Physics/PhysicsWorld.h"
+#endif
+
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <cerrno>
+#include <ctime>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+namespace
+{
+
+#if !defined(__linux__) || defined(__EMSCRIPTEN__)
+/// Time before deadline in nanoseconds when fallback sleep switches to spinning.
+const long long fallbackSpinTime = 2000000;
+#endif
+
+/// Return percentile of samples. Samples are copied because partial sort reorders them.
+long long GetPercentile(ea::vector<long long> samples, float percentile)
+{
+    if (samples.empty())
+        return 0;
+
+    const unsigned index = Min(static_cast<unsigned>(percentile * samples.size()), samples.size() - 1);
+    ea::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+}
+
+FixedTickScheduler::FixedTickScheduler(Context* context)
+    : Object(context)
+{
+    SetTickRate(tickRate_);
+}
+
+void FixedTickScheduler::SetTickRate(unsigned tickRate)
+{
+    tickRate_ = Max(tickRate, 1u);
+    tickPeriod_ = 1000000000LL / tickRate_;
+    scheduleStarted_ = false;
+}
+
+void FixedTickScheduler::SetStatisticsWindow(unsigned numTicks)
+{
+    statisticsWindow_ = Max(numTicks, 1u);
+    ResetStatistics();
+}
+
+#ifdef URHO3D_PHYSICS
+void FixedTickScheduler::SetupPhysicsWorld(PhysicsWorld* physicsWorld) const
+{
+    if (!physicsWorld)
+        return;
+
+    // Negative number of substeps makes physics world perform single step of exactly frame timestep
+    physicsWorld->SetFps(tickRate_);
+    physicsWorld->SetMaxSubSteps(-1);
+}
+#endif
+
+void FixedTickScheduler::Run()
+{
+    auto* engine = GetSubsystem<Engine>();
+
+    ResetSchedule();
+    while (!engine->IsExiting())
+        Step();
+}
+
+unsigned FixedTickScheduler::Step()
+{
+    auto* engine = GetSubsystem<Engine>();
+    engine->SetMaxFps(0);
+
+    if (!scheduleStarted_)
+    {
+        nextDeadline_ = GetMonotonicTime();
+        scheduleStarted_ = true;
+    }
+
+    SleepUntil(nextDeadline_);
+
+    // Count ticks that are due now, including the current one
+    const long long lateness = Max(GetMonotonicTime() - nextDeadline_, 0LL);
+    const unsigned numDueTicks = static_cast<unsigned>(lateness / tickPeriod_) + 1;
+    const unsigned numTicksToRun = catchUpMode_ == TickCatchUpMode::Burst ? Min(numDueTicks, maxCatchUpTicks_ + 1) : 1;
+
+    unsigned numExecutedTicks = 0;
+    for (; numExecutedTicks < numTicksToRun && !engine->IsExiting(); ++numExecutedTicks)
+        RunTick(nextDeadline_ + numExecutedTicks * tickPeriod_);
+
+    // Keep deadlines on the tick grid even if some ticks are skipped
+    numSkippedTicks_ += numDueTicks - numExecutedTicks;
+    nextDeadline_ += numDueTicks * tickPeriod_;
+    return numExecutedTicks;
+}
+
+void FixedTickScheduler::ResetStatistics()
+{
+    numTicks_ = 0;
+    numOverruns_ = 0;
+    numSkippedTicks_ = 0;
+    nextSample_ = 0;
+    durations_.clear();
+    lateness_.clear();
+}
+
+FixedTickStatistics FixedTickScheduler::GetStatistics() const
+{
+    FixedTickStatistics stats;
+    stats.numTicks_ = numTicks_;
+    stats.numOverruns_ = numOverruns_;
+    stats.numSkippedTicks_ = numSkippedTicks_;
+    if (!durations_.empty())
+    {
+        stats.durationP50_ = GetPercentile(durations_, 0.5f);
+        stats.durationP90_ = GetPercentile(durations_, 0.9f);
+        stats.durationP99_ = GetPercentile(durations_, 0.99f);
+        stats.durationMax_ = *ea::max_element(durations_.begin(), durations_.end());
+        stats.latenessP50_ = GetPercentile(lateness_, 0.5f);
+        stats.latenessP99_ = GetPercentile(lateness_, 0.99f);
+        stats.latenessMax_ = *ea::max_element(lateness_.begin(), lateness_.end());
+    }
+    return stats;
+}
+
+long long FixedTickScheduler::GetMonotonicTime()
+{
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    timespec time{};
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec * 1000000000LL + time.tv_nsec;
+#else
+    const auto timeSinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timeSinceEpoch).count();
+#endif
+}
+
+void FixedTickScheduler::SleepUntil(long long deadline)
+{
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    // Absolute deadline is immune to preemption between reading the clock and going to sleep
+    timespec time{ static_cast<time_t>(deadline / 1000000000LL), static_cast<long>(deadline % 1000000000LL) };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR)
+        ;
+#else
+    // Sleep granularity may be as coarse as scheduler quantum, spin for the rest
+    const long long sleepDeadline = deadline - fallbackSpinTime;
+    const long long now = GetMonotonicTime();
+    if (now < sleepDeadline)
+        std::this_thread::sleep_for(std::chrono::nanoseconds(sleepDeadline - now));
+    while (GetMonotonicTime() < deadline)
+        std::this_thread::yield();
+#endif
+}
+
+void FixedTickScheduler::RunTick(long long deadline)
+{
+    auto* engine = GetSubsystem<Engine>();
+
+    const long long startTime = GetMonotonicTime();
+    engine->SetNextTimeStep(GetTickPeriod());
+    engine->RunFrame();
+    const long long duration = GetMonotonicTime() - startTime;
+
+    ++numTicks_;
+    if (duration > tickPeriod_)
+        ++numOverruns_;
+    AddSample(duration / 1000, Max(startTime - deadline, 0LL) / 1000);
+}
+
+void FixedTickScheduler::AddSample(long long duration, long long lateness)
+{
+    if (durations_.size() < statisticsWindow_)
+    {
+        durations_.push_back(duration);
+        lateness_.push_back(lateness);
+    }
+    else
+    {
+        durations_[nextSample_] = duration;
+        lateness_[nextSample_] = lateness;
+    }
+    nextSample_ = (nextSample_ + 1) % statisticsWindow_;
+}
+
+}
@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Core/Object.h"
+
+#include <EASTL/vector.h>
+
+namespace Urho3D
+{
+
+#ifdef URHO3D_PHYSICS
+class PhysicsWorld;
+#endif
+
+/// Policy of fixed tick scheduler when ticks are missed due to overruns or stalls.
+enum class TickCatchUpMode
+{
+    /// Run one tick and skip missed ones, keeping deadlines aligned to the tick grid.
+    Skip,
+    /// Run missed ticks back to back, up to the limit of catch-up ticks.
+    Burst
+};
+
+/// Statistics of fixed tick scheduler. Times are in microseconds.
+struct FixedTickStatistics
+{
+    /// Total number of executed ticks.
+    unsigned numTicks_{};
+    /// Number of ticks that took longer than tick period.
+    unsigned numOverruns_{};
+    /// Number of ticks that were skipped according to catch-up policy.
+    unsigned numSkippedTicks_{};
+    /// Tick duration percentiles over statistics window.
+    /// @{
+    long long durationP50_{};
+    long long durationP90_{};
+    long long durationP99_{};
+    long long durationMax_{};
+    /// @}
+    /// Delay of tick start after its deadline, percentiles over statistics window.
+    /// @{
+    long long latenessP50_{};
+    long long latenessP99_{};
+    long long latenessMax_{};
+    /// @}
+};
+
+/// Main loop for headless servers that runs engine frames at fixed tick rate.
+/// Ticks are scheduled against absolute deadlines on monotonic clock, so sleep inaccuracy doesn't accumulate into drift.
+/// Each tick runs one engine frame with timestep of exactly one tick period. Engine frame limiter is disabled.
+class URHO3D_API FixedTickScheduler : public Object
+{
+    URHO3D_OBJECT(FixedTickScheduler, Object);
+
+public:
+    /// Construct.
+    explicit FixedTickScheduler(Context* context);
+
+    /// Set number of ticks per second. Resets schedule.
+    void SetTickRate(unsigned tickRate);
+    /// Set catch-up policy for missed ticks.
+    void SetCatchUpMode(TickCatchUpMode mode) { catchUpMode_ = mode; }
+    /// Set maximum number of missed ticks executed back to back in Burst mode. Remaining missed ticks are skipped.
+    void SetMaxCatchUpTicks(unsigned maxTicks) { maxCatchUpTicks_ = maxTicks; }
+    /// Set number of recent ticks used to calculate percentiles.
+    void SetStatisticsWindow(unsigned numTicks);
+#ifdef URHO3D_PHYSICS
+    /// Configure physics world to perform exactly one fixed step of tick period per tick.
+    /// Scene time scale should be 1, otherwise steps will be scaled accordingly.
+    void SetupPhysicsWorld(PhysicsWorld* physicsWorld) const;
+#endif
+
+    /// Run ticks until engine exits.
+    void Run();
+    /// Wait for the next deadline and run all ticks that are due according to catch-up policy.
+    /// Return number of executed ticks.
+    unsigned Step();
+    /// Reset schedule. Next step will run immediately and define new tick grid.
+    void ResetSchedule() { scheduleStarted_ = false; }
+    /// Reset statistics.
+    void ResetStatistics();
+
+    /// Return tick rate.
+    unsigned GetTickRate() const { return tickRate_; }
+    /// Return tick period in seconds.
+    float GetTickPeriod() const { return 1.0f / tickRate_; }
+    /// Return catch-up policy.
+    TickCatchUpMode GetCatchUpMode() const { return catchUpMode_; }
+    /// Return maximum number of catch-up ticks.
+    unsigned GetMaxCatchUpTicks() const { return maxCatchUpTicks_; }
+    /// Return statistics window size.
+    unsigned GetStatisticsWindow() const { return statisticsWindow_; }
+    /// Return statistics. Percentiles are calculated on demand.
+    FixedTickStatistics GetStatistics() const;
+
+    /// Return current time of monotonic clock in nanoseconds.
+    static long long GetMonotonicTime();
+    /// Sleep until absolute time of monotonic clock in nanoseconds.
+    static void SleepUntil(long long deadline);
+
+private:
+    /// Run single engine frame and record its statistics.
+    void RunTick(long long deadline);
+    /// Add tick duration and lateness to ring buffers of statistics window.
+    void AddSample(long long duration, long long lateness);
+
+    /// Settings
+    /// @{
+    unsigned tickRate_{ 60 };
+    TickCatchUpMode catchUpMode_{ TickCatchUpMode::Skip };
+    unsigned maxCatchUpTicks_{ 4 };
+    unsigned statisticsWindow_{ 600 };
+    /// @}
+
+    /// Schedule
+    /// @{
+    bool scheduleStarted_{};
+    long long tickPeriod_{};
+    long long nextDeadline_{};
+    /// @}
+
+    /// Statistics
+    /// @{
+    unsigned numTicks_{};
+    unsigned numOverruns_{};
+    unsigned numSkippedTicks_{};
+    unsigned nextSample_{};
+    ea::vector<long long> durations_;
+    ea::vector<long long> lateness_;
+    /// @}
+};
+
+}
@@ -55,6 +55,8 @@ public:
     template<typename T> void RegisterFactory();
     /// Register a factory for an object type and specify the object category.
     template<typename T> void RegisterFactory(const char* category);
+    /// Return types registered by the plugin and their categories.
+    const ea::vector<ea::pair<StringHash, ea::string>>& GetRegisteredTypes() const { return registeredTypes_; }
 
 protected:
     /// Record type factory that will be unregistered on plugin unload.
@@ -0,0 +1,170 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Core/Timer.h"
+#include "../Core/WorkQueue.h"
+#include "../Engine/PluginStateMigration.h"
+#include "../IO/BinaryArchive.h"
+#include "../IO/Log.h"
+#include "../IO/MemoryBuffer.h"
+#include "../Scene/Component.h"
+#include "../Scene/Scene.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+namespace
+{
+
+/// Number of components processed by one work item.
+const unsigned COMPONENTS_PER_WORK_ITEM = 32;
+
+}
+
+PluginStateMigration::PluginStateMigration(Context* context)
+    : Object(context)
+{
+}
+
+void PluginStateMigration::Save(const ea::vector<Scene*>& scenes, const ea::hash_set<StringHash>& types)
+{
+    URHO3D_PROFILE("SavePluginState");
+
+    components_.clear();
+    stats_ = {};
+
+    if (types.empty())
+        return;
+
+    // Collect components of plugin types
+    HiresTimer timer;
+    ea::vector<Node*> nodes;
+    for (Scene* scene : scenes)
+    {
+        nodes.clear();
+        nodes.push_back(scene);
+        scene->GetChildren(nodes, true);
+        for (Node* node : nodes)
+        {
+            const auto& nodeComponents = node->GetComponents();
+            for (unsigned index = 0; index < nodeComponents.size(); ++index)
+            {
+                Component* component = nodeComponents[index];
+                if (!types.contains(component->GetType()))
+                    continue;
+
+                SavedComponent& saved = components_.emplace_back();
+                saved.node_ = node;
+                saved.type_ = component->GetType();
+                saved.id_ = component->GetID();
+                saved.index_ = index;
+                saved.temporary_ = component->IsTemporary();
+                saved.component_ = component;
+            }
+        }
+    }
+    stats_.numComponents_ = components_.size();
+    stats_.collectTime_ = timer.GetUSec(true);
+
+    // Serialize components, attributes are only read so it's safe to do in parallel
+    ForEachParallel(GetSubsystem<WorkQueue>(), COMPONENTS_PER_WORK_ITEM, components_,
+        [this](unsigned /*index*/, SavedComponent& saved)
+    {
+        BinaryOutputArchive archive(context_, saved.data_);
+        if (!saved.component_->Serialize(archive))
+            URHO3D_LOGERROR("Failed to save state of component {} of type {}", saved.id_, saved.component_->GetTypeName());
+    });
+
+    // Remove components so plugin module doesn't have any objects alive
+    for (SavedComponent& saved : components_)
+    {
+        saved.component_->Remove();
+        saved.component_ = nullptr;
+    }
+    stats_.serializeTime_ = timer.GetUSec(false);
+}
+
+unsigned PluginStateMigration::Restore()
+{
+    URHO3D_PROFILE("RestorePluginState");
+
+    HiresTimer timer;
+
+    // Recreate components at the same positions. Components are stored in the same order as they were in nodes,
+    // so indices of preceding components are already restored when the component is inserted.
+    unsigned numDropped = 0;
+    for (SavedComponent& saved : components_)
+    {
+        Node* node = saved.node_;
+        if (!node)
+            continue;
+
+        const CreateMode mode = Scene::IsReplicatedID(saved.id_) ? REPLICATED : LOCAL;
+        Component* component = node->CreateComponent(saved.type_, mode, saved.id_);
+        if (!component)
+        {
+            ++numDropped;
+            continue;
+        }
+
+        node->ReorderComponent(component, ea::min(saved.index_, node->GetNumComponents() - 1));
+        component->SetTemporary(saved.temporary_);
+        saved.component_ = component;
+    }
+
+    if (numDropped > 0)
+        URHO3D_LOGWARNING("{} components of unregistered types were dropped on plugin reload", numDropped);
+
+    // Load attributes in main thread. Attribute setters may load resources and send events, which is not allowed
+    // from worker threads.
+    for (SavedComponent& saved : components_)
+    {
+        if (!saved.component_)
+            continue;
+
+        MemoryBuffer buffer(saved.data_.GetBuffer());
+        BinaryInputArchive archive(context_, buffer);
+        if (!saved.component_->Serialize(archive))
+            URHO3D_LOGERROR("Failed to restore state of component {} of type {}", saved.id_, saved.component_->GetTypeName());
+    }
+
+    // Apply attributes when all components are loaded, as components may access the rest of the scene
+    unsigned numRestored = 0;
+    for (SavedComponent& saved : components_)
+    {
+        if (!saved.component_)
+            continue;
+
+        saved.component_->ApplyAttributes();
+        ++numRestored;
+    }
+
+    components_.clear();
+    stats_.restoreTime_ = timer.GetUSec(false);
+    return numRestored;
+}
+
+}
@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Container/Ptr.h"
+#include "../Core/Object.h"
+#include "../IO/VectorBuffer.h"
+
+#include <EASTL/hash_set.h>
+
+namespace Urho3D
+{
+
+class Component;
+class Node;
+class Scene;
+
+/// Time spent in phases of plugin state migration, in microseconds.
+struct PluginStateMigrationStats
+{
+    /// Number of components migrated.
+    unsigned numComponents_{};
+    /// Time spent looking up components of plugin types.
+    long long collectTime_{};
+    /// Time spent serializing and removing components.
+    long long serializeTime_{};
+    /// Time spent recreating components and restoring their state.
+    long long restoreTime_{};
+};
+
+/// Preserves scene components of plugin-provided types while plugin module is reloaded.
+/// Only components of specified types are serialized and removed, the rest of the scene is left intact.
+/// After reload components are recreated in place with the same IDs and order and their state is restored.
+class URHO3D_API PluginStateMigration : public Object
+{
+    URHO3D_OBJECT(PluginStateMigration, Object);
+
+public:
+    /// Construct.
+    explicit PluginStateMigration(Context* context);
+
+    /// Serialize and remove components of specified types from scenes. Should be called before unloading plugin modules.
+    void Save(const ea::vector<Scene*>& scenes, const ea::hash_set<StringHash>& types);
+    /// Recreate saved components and restore their state. Should be called after plugin types are registered again.
+    /// Components of types that are not registered anymore are dropped. Return number of restored components.
+    unsigned Restore();
+
+    /// Return whether there are saved components.
+    bool IsEmpty() const { return components_.empty(); }
+    /// Return statistics of last migration.
+    const PluginStateMigrationStats& GetStats() const { return stats_; }
+
+private:
+    /// Saved state of single component.
+    struct SavedComponent
+    {
+        /// Owner node.
+        WeakPtr<Node> node_;
+        /// Component type.
+        StringHash type_;
+        /// Component ID.
+        unsigned id_{};
+        /// Index of component in the owner node.
+        unsigned index_{};
+        /// Whether the component is temporary.
+        bool temporary_{};
+        /// Serialized attributes.
+        VectorBuffer data_;
+        /// Removed component on save, recreated component on restore.
+        SharedPtr<Component> component_;
+    };
+
+    /// Saved components, ordered by owner node and index within node.
+    ea::vector<SavedComponent> components_;
+    /// Statistics of last migration.
+    PluginStateMigrationStats stats_;
+};
+
+}
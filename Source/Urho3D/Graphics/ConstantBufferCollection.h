@@ -79,6 +79,13 @@ public:
         return {{ currentBufferIndex_, offset, size }, data };
     }
 
+    /// Remove block allocated by last AddBlock call.
+    void RemoveLastBlock(const ConstantBufferCollectionRef& ref)
+    {
+        assert(ref.index_ == currentBufferIndex_);
+        buffers_[currentBufferIndex_].second = ref.offset_;
+    }
+
     /// Return number of buffers.
     unsigned GetNumBuffers() const { return currentBufferIndex_ + 1; }
 
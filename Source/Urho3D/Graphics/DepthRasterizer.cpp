@@ -0,0 +1,278 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Graphics/DepthRasterizer.h"
+
+#include <EASTL/algorithm.h>
+
+#include <cstring>
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+namespace
+{
+
+/// Return signed doubled area of triangle. Positive for clockwise triangles in screen space (Y down).
+inline float EdgeFunction(const Vector3& a, const Vector3& b, float x, float y)
+{
+    return (b.x_ - a.x_) * (y - a.y_) - (b.y_ - a.y_) * (x - a.x_);
+}
+
+/// Return whether edge of clockwise triangle is top or left edge.
+inline bool IsTopLeftEdge(const Vector3& a, const Vector3& b)
+{
+    return (a.y_ == b.y_ && b.x_ > a.x_) || b.y_ < a.y_;
+}
+
+/// Read index from index data.
+inline unsigned ReadIndex(const unsigned char* indexData, unsigned indexSize, unsigned index)
+{
+    if (indexSize == sizeof(unsigned))
+    {
+        unsigned value;
+        memcpy(&value, indexData + index * sizeof(unsigned), sizeof(unsigned));
+        return value;
+    }
+    else
+    {
+        unsigned short value;
+        memcpy(&value, indexData + index * sizeof(unsigned short), sizeof(unsigned short));
+        return value;
+    }
+}
+
+/// Clip polygon against near plane (z >= 0). Return number of output vertices.
+unsigned ClipNearPlane(const Vector4 (&input)[3], Vector4 (&output)[4])
+{
+    unsigned numOutput = 0;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        const Vector4& current = input[i];
+        const Vector4& next = input[(i + 1) % 3];
+        const bool currentInside = current.z_ >= 0.0f;
+        const bool nextInside = next.z_ >= 0.0f;
+
+        if (currentInside)
+            output[numOutput++] = current;
+        if (currentInside != nextInside)
+        {
+            const float t = current.z_ / (current.z_ - next.z_);
+            output[numOutput++] = current.Lerp(next, t);
+        }
+    }
+    return numOutput;
+}
+
+}
+
+void DepthRasterizer::SetTarget(float* data, int width, int height)
+{
+    data_ = data;
+    width_ = data ? width : 0;
+    height_ = data ? height : 0;
+}
+
+void DepthRasterizer::Clear(const IntRect& rect, float depth)
+{
+    const int left = Max(rect.left_, 0);
+    const int top = Max(rect.top_, 0);
+    const int right = Min(rect.right_, width_);
+    const int bottom = Min(rect.bottom_, height_);
+    for (int y = top; y < bottom; ++y)
+    {
+        float* row = data_ + y * width_;
+        ea::fill(row + left, row + Max(left, right), depth);
+    }
+}
+
+void DepthRasterizer::DrawTriangles(const Matrix4& modelViewProj, const DepthRasterizerBatch& batch)
+{
+    if (!data_ || !batch.vertexData_)
+        return;
+
+    const bool indexed = batch.indexData_ != nullptr;
+    const unsigned maxIndex = indexed ? batch.indexDataCount_ : batch.vertexCount_;
+    if (batch.drawStart_ >= maxIndex)
+        return;
+
+    const unsigned drawEnd = batch.drawStart_ + Min(batch.drawCount_, maxIndex - batch.drawStart_);
+    for (unsigned i = batch.drawStart_; i + 3 <= drawEnd; i += 3)
+    {
+        Vector4 clipPositions[3];
+        bool valid = true;
+        for (unsigned j = 0; j < 3; ++j)
+        {
+            const unsigned vertexIndex = batch.baseVertexIndex_
+                + (indexed ? ReadIndex(batch.indexData_, batch.indexSize_, i + j) : i + j);
+            if (vertexIndex >= batch.vertexCount_)
+            {
+                valid = false;
+                break;
+            }
+
+            Vector3 position;
+            memcpy(&position, batch.vertexData_ + vertexIndex * batch.vertexSize_ + batch.positionOffset_, sizeof(Vector3));
+            clipPositions[j] = modelViewProj * Vector4(position, 1.0f);
+        }
+
+        if (valid)
+            DrawTriangle(clipPositions[0], clipPositions[1], clipPositions[2]);
+    }
+}
+
+void DepthRasterizer::DrawTriangle(const Vector4& v0, const Vector4& v1, const Vector4& v2)
+{
+    ++numTriangles_;
+    if (!data_)
+        return;
+
+    const Vector4 input[3]{ v0, v1, v2 };
+    Vector4 clipped[4];
+    const unsigned numVertices = ClipNearPlane(input, clipped);
+    if (numVertices < 3)
+        return;
+
+    const IntRect& viewport = state_.viewport_;
+    const float halfWidth = viewport.Width() * 0.5f;
+    const float halfHeight = viewport.Height() * 0.5f;
+
+    Vector3 screen[4];
+    for (unsigned i = 0; i < numVertices; ++i)
+    {
+        const Vector4& v = clipped[i];
+        if (v.w_ <= M_EPSILON)
+            return;
+
+        const float invW = 1.0f / v.w_;
+        screen[i].x_ = viewport.left_ + (v.x_ * invW + 1.0f) * halfWidth;
+        screen[i].y_ = viewport.top_ + (1.0f - v.y_ * invW) * halfHeight;
+        screen[i].z_ = v.z_ * invW + state_.depthBias_;
+    }
+
+    RasterizeTriangle(screen[0], screen[1], screen[2]);
+    if (numVertices == 4)
+        RasterizeTriangle(screen[0], screen[2], screen[3]);
+}
+
+void DepthRasterizer::ResetStatistics()
+{
+    numTriangles_ = 0;
+    numRasterizedTriangles_ = 0;
+    numPixelsPassed_ = 0;
+}
+
+void DepthRasterizer::RasterizeTriangle(const Vector3& v0, const Vector3& v1, const Vector3& v2)
+{
+    const float area = EdgeFunction(v0, v1, v2.x_, v2.y_);
+    if (area == 0.0f)
+        return;
+
+    // Clockwise triangles are front-facing
+    if ((state_.cullMode_ == CULL_CCW && area < 0.0f) || (state_.cullMode_ == CULL_CW && area > 0.0f))
+        return;
+
+    // Rasterize as clockwise triangle
+    const Vector3& a = v0;
+    const Vector3& b = area > 0.0f ? v1 : v2;
+    const Vector3& c = area > 0.0f ? v2 : v1;
+    const float invArea = 1.0f / Abs(area);
+
+    IntRect bounds{ 0, 0, width_, height_ };
+    bounds.left_ = Max(bounds.left_, state_.viewport_.left_);
+    bounds.top_ = Max(bounds.top_, state_.viewport_.top_);
+    bounds.right_ = Min(bounds.right_, state_.viewport_.right_);
+    bounds.bottom_ = Min(bounds.bottom_, state_.viewport_.bottom_);
+    if (state_.scissorTest_)
+    {
+        bounds.left_ = Max(bounds.left_, state_.scissorRect_.left_);
+        bounds.top_ = Max(bounds.top_, state_.scissorRect_.top_);
+        bounds.right_ = Min(bounds.right_, state_.scissorRect_.right_);
+        bounds.bottom_ = Min(bounds.bottom_, state_.scissorRect_.bottom_);
+    }
+
+    // Clamp in floating point first to avoid integer overflow for huge triangles
+    const float maxX = static_cast<float>(width_);
+    const float maxY = static_cast<float>(height_);
+    bounds.left_ = Max(bounds.left_, FloorToInt(Clamp(Min(Min(a.x_, b.x_), c.x_), 0.0f, maxX)));
+    bounds.top_ = Max(bounds.top_, FloorToInt(Clamp(Min(Min(a.y_, b.y_), c.y_), 0.0f, maxY)));
+    bounds.right_ = Min(bounds.right_, CeilToInt(Clamp(Max(Max(a.x_, b.x_), c.x_), 0.0f, maxX)));
+    bounds.bottom_ = Min(bounds.bottom_, CeilToInt(Clamp(Max(Max(a.y_, b.y_), c.y_), 0.0f, maxY)));
+    if (bounds.left_ >= bounds.right_ || bounds.top_ >= bounds.bottom_)
+        return;
+
+    ++numRasterizedTriangles_;
+
+    const bool topLeftA = IsTopLeftEdge(b, c);
+    const bool topLeftB = IsTopLeftEdge(c, a);
+    const bool topLeftC = IsTopLeftEdge(a, b);
+
+    for (int y = bounds.top_; y < bounds.bottom_; ++y)
+    {
+        const float sampleY = y + 0.5f;
+        float* row = data_ + y * width_;
+        for (int x = bounds.left_; x < bounds.right_; ++x)
+        {
+            const float sampleX = x + 0.5f;
+            const float weightA = EdgeFunction(b, c, sampleX, sampleY);
+            const float weightB = EdgeFunction(c, a, sampleX, sampleY);
+            const float weightC = EdgeFunction(a, b, sampleX, sampleY);
+
+            if (weightA < 0.0f || weightB < 0.0f || weightC < 0.0f)
+                continue;
+            if ((weightA == 0.0f && !topLeftA) || (weightB == 0.0f && !topLeftB) || (weightC == 0.0f && !topLeftC))
+                continue;
+
+            const float depth = (weightA * a.z_ + weightB * b.z_ + weightC * c.z_) * invArea;
+            if (depth < 0.0f || depth > 1.0f)
+                continue;
+
+            if (!PassDepthTest(depth, row[x]))
+                continue;
+
+            ++numPixelsPassed_;
+            if (state_.depthWrite_)
+                row[x] = depth;
+        }
+    }
+}
+
+bool DepthRasterizer::PassDepthTest(float depth, float storedDepth) const
+{
+    switch (state_.depthTestMode_)
+    {
+    case CMP_ALWAYS: return true;
+    case CMP_EQUAL: return depth == storedDepth;
+    case CMP_NOTEQUAL: return depth != storedDepth;
+    case CMP_LESS: return depth < storedDepth;
+    case CMP_LESSEQUAL: return depth <= storedDepth;
+    case CMP_GREATER: return depth > storedDepth;
+    case CMP_GREATEREQUAL: return depth >= storedDepth;
+    default: return false;
+    }
+}
+
+}
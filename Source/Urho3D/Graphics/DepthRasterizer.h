@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Core/NonCopyable.h"
+#include "../Graphics/GraphicsDefs.h"
+#include "../Math/Matrix4.h"
+#include "../Math/Rect.h"
+#include "../Math/Vector4.h"
+
+namespace Urho3D
+{
+
+/// Depth and rasterizer state used by DepthRasterizer.
+struct DepthRasterizerState
+{
+    /// Viewport in target pixels.
+    IntRect viewport_;
+    /// Whether to clip to scissor rectangle.
+    bool scissorTest_{};
+    /// Scissor rectangle in target pixels.
+    IntRect scissorRect_;
+    /// Depth compare mode.
+    CompareMode depthTestMode_{ CMP_LESSEQUAL };
+    /// Whether to write depth.
+    bool depthWrite_{ true };
+    /// Culling mode.
+    CullMode cullMode_{ CULL_CCW };
+    /// Constant depth bias.
+    float depthBias_{};
+};
+
+/// Triangle list geometry to be rasterized.
+struct DepthRasterizerBatch
+{
+    /// Vertex data.
+    const unsigned char* vertexData_{};
+    /// Number of vertices in vertex data.
+    unsigned vertexCount_{};
+    /// Vertex size in bytes.
+    unsigned vertexSize_{};
+    /// Offset of Vector3 position in vertex.
+    unsigned positionOffset_{};
+    /// Index data. Null if using non-indexed geometry.
+    const unsigned char* indexData_{};
+    /// Number of indices in index data.
+    unsigned indexDataCount_{};
+    /// Index size in bytes.
+    unsigned indexSize_{};
+    /// Draw start. First index for indexed geometry, otherwise first vertex.
+    unsigned drawStart_{};
+    /// Index or vertex count.
+    unsigned drawCount_{};
+    /// Offset added to each index.
+    unsigned baseVertexIndex_{};
+};
+
+/// Software rasterizer of triangle depth into floating-point depth buffer.
+/// Follows Direct3D conventions: clip-space depth is in range [0, 1], clockwise triangles are front-facing.
+class URHO3D_API DepthRasterizer : public NonCopyable
+{
+public:
+    /// Set target depth buffer. Buffer is not owned by the rasterizer.
+    void SetTarget(float* data, int width, int height);
+    /// Set depth and rasterizer state.
+    void SetState(const DepthRasterizerState& state) { state_ = state; }
+    /// Fill rectangle of target with depth value.
+    void Clear(const IntRect& rect, float depth);
+    /// Rasterize triangle list transformed by model-view-projection matrix.
+    void DrawTriangles(const Matrix4& modelViewProj, const DepthRasterizerBatch& batch);
+    /// Rasterize single triangle in clip space.
+    void DrawTriangle(const Vector4& v0, const Vector4& v1, const Vector4& v2);
+    /// Reset statistics.
+    void ResetStatistics();
+
+    /// Return target.
+    /// @{
+    float* GetTarget() const { return data_; }
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+    /// @}
+
+    /// Return statistics
+    /// @{
+    unsigned GetNumTriangles() const { return numTriangles_; }
+    unsigned GetNumRasterizedTriangles() const { return numRasterizedTriangles_; }
+    unsigned GetNumPixelsPassed() const { return numPixelsPassed_; }
+    /// @}
+
+private:
+    /// Rasterize triangle in screen space. Z is depth.
+    void RasterizeTriangle(const Vector3& v0, const Vector3& v1, const Vector3& v2);
+    /// Return whether depth passes depth test.
+    bool PassDepthTest(float depth, float storedDepth) const;
+
+    /// Target depth buffer.
+    float* data_{};
+    int width_{};
+    int height_{};
+    /// Current state.
+    DepthRasterizerState state_;
+
+    /// Statistics
+    /// @{
+    unsigned numTriangles_{};
+    unsigned numRasterizedTriangles_{};
+    unsigned numPixelsPassed_{};
+    /// @}
+};
+
+}
@@ -655,6 +655,8 @@ bool Graphics::BeginFrame()
 
     numPrimitives_ = 0;
     numBatches_ = 0;
+    numConstantBufferBytes_ = 0;
+    numDeduplicatedConstantBufferBlocks_ = 0;
 
     SendEvent(E_BEGINRENDERING);
 
@@ -38,9 +38,15 @@ DrawCommandQueue::DrawCommandQueue(Graphics* graphics)
 
 void DrawCommandQueue::Reset(bool preferConstantBuffers)
 {
-    useConstantBuffers_ = preferConstantBuffers
+    const bool useConstantBuffers = preferConstantBuffers
         ? graphics_->GetCaps().constantBuffersSupported_
         : !graphics_->GetCaps().globalUniformsSupported_;
+    Reset(useConstantBuffers, graphics_->GetCaps().constantBufferOffsetAlignment_);
+}
+
+void DrawCommandQueue::Reset(bool useConstantBuffers, unsigned constantBufferOffsetAlignment)
+{
+    useConstantBuffers_ = useConstantBuffers;
 
     // Reset state accumulators
     currentDrawCommand_ = {};
@@ -49,10 +55,12 @@ void DrawCommandQueue::Reset(bool preferConstantBuffers)
     // Clear shadep parameters
     if (useConstantBuffers_)
     {
-        constantBuffers_.collection_.ClearAndInitialize(graphics_->GetCaps().constantBufferOffsetAlignment_);
+        constantBuffers_.collection_.ClearAndInitialize(constantBufferOffsetAlignment);
         constantBuffers_.currentLayout_ = nullptr;
         constantBuffers_.currentData_ = nullptr;
         constantBuffers_.currentHashes_.fill(0);
+        constantBuffers_.blocksByHash_.clear();
+        constantBuffers_.numDeduplicatedBlocks_ = 0;
 
         currentDrawCommand_.constantBuffers_.fill({});
     }
@@ -71,6 +79,127 @@ void DrawCommandQueue::Reset(bool preferConstantBuffers)
     scissorRects_.push_back(IntRect::ZERO);
 }
 
+void DrawCommandQueue::Append(const DrawCommandQueue& other)
+{
+    assert(useConstantBuffers_ == other.useConstantBuffers_);
+    if (other.drawCommands_.empty())
+        return;
+
+    // Append shader parameters or constant buffers
+    unsigned shaderParametersOffset = 0;
+    if (useConstantBuffers_)
+    {
+        constantBuffers_.numDeduplicatedBlocks_ += other.constantBuffers_.numDeduplicatedBlocks_;
+    }
+    else
+    {
+        shaderParametersOffset = shaderParameters_.collection_.Size();
+        shaderParameters_.collection_.Append(other.shaderParameters_.collection_);
+        shaderParameters_.currentGroupRange_.first = shaderParameters_.collection_.Size();
+        shaderParameters_.currentGroupRange_.second = shaderParameters_.currentGroupRange_.first;
+    }
+
+    // Append shader resources
+    const unsigned shaderResourcesOffset = shaderResources_.size();
+    shaderResources_.insert(shaderResources_.end(), other.shaderResources_.begin(), other.shaderResources_.end());
+    currentShaderResourceGroup_.first = shaderResources_.size();
+    currentShaderResourceGroup_.second = currentShaderResourceGroup_.first;
+
+    // Append scissor rects except the first one which is always empty
+    const unsigned scissorRectsOffset = scissorRects_.size() - 1;
+    scissorRects_.insert(scissorRects_.end(), other.scissorRects_.begin() + 1, other.scissorRects_.end());
+
+    // Append draw commands and adjust references
+    ea::array<ConstantBufferCollectionRef, MAX_SHADER_PARAMETER_GROUPS> lastSourceRefs{};
+    ea::array<ConstantBufferCollectionRef, MAX_SHADER_PARAMETER_GROUPS> lastRefs{};
+    const unsigned firstCommand = drawCommands_.size();
+    drawCommands_.insert(drawCommands_.end(), other.drawCommands_.begin(), other.drawCommands_.end());
+    for (unsigned i = firstCommand; i < drawCommands_.size(); ++i)
+    {
+        DrawCommandDescription& cmd = drawCommands_[i];
+        if (useConstantBuffers_)
+        {
+            // Copy blocks one by one so shared blocks are deduplicated across queues
+            for (unsigned i = 0; i < MAX_SHADER_PARAMETER_GROUPS; ++i)
+            {
+                ConstantBufferCollectionRef& ref = cmd.constantBuffers_[i];
+                if (ref.size_ == 0)
+                    continue;
+
+                // Consecutive commands usually share blocks
+                ConstantBufferCollectionRef& lastSourceRef = lastSourceRefs[i];
+                if (lastSourceRef.size_ != 0 && ref.index_ == lastSourceRef.index_ && ref.offset_ == lastSourceRef.offset_)
+                {
+                    ref = lastRefs[i];
+                    continue;
+                }
+                lastSourceRef = ref;
+
+                const auto sourceData = static_cast<const unsigned char*>(
+                    other.constantBuffers_.collection_.GetBufferData(ref.index_)) + ref.offset_;
+                const auto& refAndData = constantBuffers_.collection_.AddBlock(ref.size_);
+                memcpy(refAndData.second, sourceData, ref.size_);
+
+                const auto group = static_cast<ShaderParameterGroup>(i);
+                ref = DeduplicateConstantBufferBlock(group, refAndData.first, refAndData.second);
+                lastRefs[i] = ref;
+            }
+        }
+        else
+        {
+            for (ShaderParameterRange& range : cmd.shaderParameters_)
+            {
+                range.first += shaderParametersOffset;
+                range.second += shaderParametersOffset;
+            }
+        }
+
+        cmd.shaderResources_.first += shaderResourcesOffset;
+        cmd.shaderResources_.second += shaderResourcesOffset;
+        if (cmd.scissorRect_ != 0)
+            cmd.scissorRect_ += scissorRectsOffset;
+    }
+}
+
+ConstantBufferCollectionRef DrawCommandQueue::DeduplicateConstantBufferBlock(ShaderParameterGroup group,
+    const ConstantBufferCollectionRef& ref, const unsigned char* data)
+{
+    // Object blocks are too unique to be worth hashing
+    if (group == SP_OBJECT || group == SP_CUSTOM)
+        return ref;
+
+    // Blocks of different groups never match. Blocks with identical contents are interchangeable regardless of layout
+    unsigned hash = group;
+    CombineHash(hash, ref.size_);
+    for (unsigned i = 0; i + sizeof(unsigned) <= ref.size_; i += sizeof(unsigned))
+    {
+        unsigned value;
+        memcpy(&value, data + i, sizeof(value));
+        CombineHash(hash, value);
+    }
+
+    const auto iter = constantBuffers_.blocksByHash_.find(hash);
+    if (iter == constantBuffers_.blocksByHash_.end())
+    {
+        constantBuffers_.blocksByHash_.emplace(hash, ref);
+        return ref;
+    }
+
+    // Keep newer block on hash collision
+    const ConstantBufferCollectionRef existingRef = iter->second;
+    const auto existingData = static_cast<const unsigned char*>(
+        constantBuffers_.collection_.GetBufferData(existingRef.index_)) + existingRef.offset_;
+    if (existingRef.size_ != ref.size_ || memcmp(existingData, data, ref.size_) != 0)
+    {
+        iter->second = ref;
+        return ref;
+    }
+
+    constantBuffers_.collection_.RemoveLastBlock(ref);
+    ++constantBuffers_.numDeduplicatedBlocks_;
+    return existingRef;
+}
+
 void DrawCommandQueue::Execute()
 {
     if (drawCommands_.empty())
@@ -91,7 +220,9 @@ void DrawCommandQueue::Execute()
         {
             constantBuffers[i] = graphics_->GetOrCreateConstantBuffer(VS, i, constantBuffers_.collection_.GetGPUBufferSize(i));
             constantBuffers[i]->Update(constantBuffers_.collection_.GetBufferData(i));
+            graphics_->AddConstantBufferBytes(constantBuffers[i]->GetSize());
         }
+        graphics_->AddDeduplicatedConstantBufferBlocks(constantBuffers_.numDeduplicatedBlocks_);
     }
     else
     {
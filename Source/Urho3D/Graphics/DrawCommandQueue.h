@@ -32,6 +32,8 @@
 #include "../Graphics/ConstantBufferCollection.h"
 #include "../IO/Log.h"
 
+#include <EASTL/unordered_map.h>
+
 namespace Urho3D
 {
 
@@ -101,16 +103,23 @@ public:
 
     /// Reset queue.
     void Reset(bool preferConstantBuffers = true);
+    /// Reset queue with explicit shader parameter storage regardless of graphics caps.
+    void Reset(bool useConstantBuffers, unsigned constantBufferOffsetAlignment);
 
     /// Set pipeline state. Must be called first.
     void SetPipelineState(PipelineState* pipelineState)
     {
         assert(pipelineState);
         currentDrawCommand_.pipelineState_ = pipelineState;
+        SetShaderProgramLayout(pipelineState->GetShaderProgramLayout());
+    }
 
+    /// Set layout of constant buffers. Called from SetPipelineState.
+    void SetShaderProgramLayout(ShaderProgramLayout* layout)
+    {
         if (useConstantBuffers_)
         {
-            constantBuffers_.currentLayout_ = pipelineState->GetShaderProgramLayout();
+            constantBuffers_.currentLayout_ = layout;
         }
     }
 
@@ -200,7 +209,9 @@ public:
     {
         if (useConstantBuffers_)
         {
-            // All data is already stored, nothing to do
+            // All data is already stored, reuse identical block if possible
+            ConstantBufferCollectionRef& ref = currentDrawCommand_.constantBuffers_[group];
+            ref = DeduplicateConstantBufferBlock(group, ref, constantBuffers_.currentData_);
             constantBuffers_.currentGroup_ = MAX_SHADER_PARAMETER_GROUPS;
         }
         else
@@ -366,10 +377,27 @@ public:
         drawCommands_.push_back(currentDrawCommand_);
     }
 
+    /// Append all commands from another queue, e.g. recorded in another thread.
+    /// Queues should be reset with the same constant buffer preference.
+    /// Shared constant buffer blocks identical to blocks of this queue are not copied.
+    void Append(const DrawCommandQueue& other);
+
     /// Execute commands in the queue.
     void Execute();
 
+    /// Return whether the queue stores shader parameters in constant buffers.
+    bool GetUseConstantBuffers() const { return useConstantBuffers_; }
+    /// Return number of enqueued draw commands.
+    unsigned GetNumDrawCommands() const { return drawCommands_.size(); }
+    /// Return number of constant buffer blocks replaced with identical blocks recorded earlier.
+    unsigned GetNumDeduplicatedBlocks() const { return constantBuffers_.numDeduplicatedBlocks_; }
+
 private:
+    /// Return identical block recorded earlier and remove just written block, if there is any.
+    /// Return just written block otherwise. Object and custom blocks are never deduplicated.
+    ConstantBufferCollectionRef DeduplicateConstantBufferBlock(ShaderParameterGroup group,
+        const ConstantBufferCollectionRef& ref, const unsigned char* data);
+
     /// Cached pointer to Graphics.
     Graphics* graphics_{};
     /// Whether to use constant buffers.
@@ -399,6 +427,11 @@ private:
         unsigned char* currentData_{};
         /// Current constant buffer layout hashes.
         ea::array<unsigned, MAX_SHADER_PARAMETER_GROUPS> currentHashes_{};
+
+        /// Blocks of shared groups by content hash, used to deduplicate blocks.
+        ea::unordered_map<unsigned, ConstantBufferCollectionRef> blocksByHash_;
+        /// Number of deduplicated blocks.
+        unsigned numDeduplicatedBlocks_{};
     } constantBuffers_;
 
     /// Shader resources.
@@ -111,7 +111,7 @@ void Drawable::RegisterObject(Context* context)
 
 void Drawable::OnSetEnabled()
 {
-    bool enabled = IsEnabledEffective();
+    bool enabled = IsEnabledEffective() && !hiddenByLOD_;
 
     if (enabled && !octant_)
         AddToOctree();
@@ -250,6 +250,15 @@ void Drawable::SetOccludee(bool enable)
     }
 }
 
+void Drawable::SetHiddenByLOD(bool hidden)
+{
+    if (hidden != hiddenByLOD_)
+    {
+        hiddenByLOD_ = hidden;
+        Drawable::OnSetEnabled();
+    }
+}
+
 void Drawable::SetGlobalIlluminationType(GlobalIlluminationType type)
 {
     giType_ = type;
@@ -422,7 +431,7 @@ void Drawable::OnMarkedDirty(Node* node)
 void Drawable::AddToOctree()
 {
     // Do not add to octree when disabled
-    if (!IsEnabledEffective())
+    if (!IsEnabledEffective() || hiddenByLOD_)
         return;
 
     Scene* scene = GetScene();
@@ -243,6 +243,9 @@ public:
     /// Set occludee flag.
     /// @property
     void SetOccludee(bool enable);
+    /// Set whether the drawable is temporarily removed from octree and replaced with other geometry, e.g. by hierarchical LOD.
+    /// Not serialized.
+    void SetHiddenByLOD(bool hidden);
     /// Set GI type.
     void SetGlobalIlluminationType(GlobalIlluminationType type);
     /// Mark for update and octree reinsertion. Update is automatically queued when the drawable's scene node moves or changes scale.
@@ -302,6 +305,8 @@ public:
     /// Return occludee flag.
     /// @property
     bool IsOccludee() const { return occludee_; }
+    /// Return whether the drawable is temporarily hidden by LOD.
+    bool IsHiddenByLOD() const { return hiddenByLOD_; }
 
     /// Return global illumination type.
     GlobalIlluminationType GetGlobalIlluminationType() const { return giType_; }
@@ -341,6 +346,8 @@ public:
 
     /// Return octree octant.
     Octant* GetOctant() const { return octant_; }
+    /// Return frame number of the last octree update, i.e. when the drawable was last moved, resized or animated.
+    unsigned GetUpdateFrameNumber() const { return updateFrameNumber_; }
 
     /// Return index in octree.
     unsigned GetDrawableIndex() const { return drawableIndex_; }
@@ -459,6 +466,8 @@ protected:
     bool occluder_;
     /// Occludee flag.
     bool occludee_;
+    /// Hidden by LOD flag.
+    bool hiddenByLOD_{};
     /// Octree update queued flag.
     bool updateQueued_;
     /// Zone inconclusive or dirtied flag.
@@ -479,6 +488,8 @@ protected:
     unsigned zoneMask_;
     /// Last visible frame number.
     unsigned viewFrameNumber_;
+    /// Last octree update frame number.
+    unsigned updateFrameNumber_{};
     /// Current distance to camera.
     float distance_;
     /// LOD scaled distance.
@@ -36,6 +36,8 @@
 #include "../Graphics/Graphics.h"
 #include "../Graphics/GraphicsEvents.h"
 #include "../Graphics/GraphicsImpl.h"
+#include "../Graphics/HierarchicalLOD.h"
+#include "../Graphics/Impostor.h"
 #include "../Graphics/IndexBuffer.h"
 #include "../Graphics/LightBaker.h"
 #include "../Graphics/LightProbeGroup.h"
@@ -52,9 +54,7 @@
 #include "../Graphics/Technique.h"
 #include "../Graphics/Terrain.h"
 #include "../Graphics/TerrainPatch.h"
-#ifdef _WIN32
 #include "../Graphics/Texture2D.h"
-#endif
 #include "../Graphics/Texture2DArray.h"
 #include "../Graphics/Texture3D.h"
 #include "../Graphics/TextureCube.h"
@@ -635,6 +635,8 @@ void RegisterGraphicsLibrary(Context* context)
     GlobalIllumination::RegisterObject(context);
     StaticModel::RegisterObject(context);
     StaticModelGroup::RegisterObject(context);
+    HierarchicalLODGroup::RegisterObject(context);
+    Impostor::RegisterObject(context);
     Skybox::RegisterObject(context);
     AnimatedModel::RegisterObject(context);
     AnimationController::RegisterObject(context);
@@ -232,6 +232,8 @@ public:
     void SetFlushGPU(bool enable);
     /// Set forced use of OpenGL 2 even if OpenGL 3 is available. Must be called before setting the screen mode for the first time. Default false. No effect on Direct3D9 & 11.
     void SetForceGL2(bool enable);
+    /// Set whether to rasterize depth of drawn triangles on CPU. Default false. Effective only on Null graphics backend.
+    void SetRasterizeDepth(bool enable) { rasterizeDepth_ = enable; }
     /// Set allowed screen orientations as a space-separated list of "LandscapeLeft", "LandscapeRight", "Portrait" and "PortraitUpsideDown". Affects currently only iOS platform.
     /// @property
     void SetOrientations(const ea::string& orientations);
@@ -477,6 +479,9 @@ public:
     /// Return whether OpenGL 2 use is forced. Effective only on OpenGL.
     bool GetForceGL2() const { return forceGL2_; }
 
+    /// Return whether depth is rasterized on CPU. Effective only on Null graphics backend.
+    bool GetRasterizeDepth() const { return rasterizeDepth_; }
+
     /// Return allowed screen orientations.
     /// @property
     const ea::string& GetOrientations() const { return orientations_; }
@@ -493,6 +498,15 @@ public:
     /// @property
     unsigned GetNumBatches() const { return numBatches_; }
 
+    /// Return number of bytes uploaded to constant buffers by draw command queues this frame.
+    unsigned GetNumConstantBufferBytes() const { return numConstantBufferBytes_; }
+    /// Add bytes uploaded to constant buffers to frame statistics.
+    void AddConstantBufferBytes(unsigned size) { numConstantBufferBytes_ += size; }
+    /// Return number of constant buffer blocks reused by draw command queues this frame.
+    unsigned GetNumDeduplicatedConstantBufferBlocks() const { return numDeduplicatedConstantBufferBlocks_; }
+    /// Add constant buffer blocks reused instead of uploaded to frame statistics.
+    void AddDeduplicatedConstantBufferBlocks(unsigned count) { numDeduplicatedConstantBufferBlocks_ += count; }
+
     /// Return dummy color texture format for shadow maps. Is "NULL" (consume no video memory) if supported.
     unsigned GetDummyColorFormat() const { return dummyColorFormat_; }
 
@@ -827,6 +841,8 @@ private:
     void SetVertexAttribDivisor(unsigned location, unsigned divisor);
     /// Release/clear GPU objects and optionally close the window. Used only on OpenGL.
     void Release(bool clearGPUObjects, bool closeWindow);
+    /// Rasterize depth of triangle list on CPU. Used only on Null graphics backend.
+    void RasterizeDepth(PrimitiveType type, bool indexed, unsigned drawStart, unsigned drawCount, unsigned baseVertexIndex, unsigned instanceCount);
 
     /// Mutex for accessing the GPU objects vector from several threads.
     Mutex gpuObjectMutex_;
@@ -859,6 +875,8 @@ private:
     bool flushGPU_{};
     /// Force OpenGL 2 flag. Only used on OpenGL.
     bool forceGL2_{};
+    /// CPU depth rasterization flag. Only used on Null graphics backend.
+    bool rasterizeDepth_{};
     /// sRGB conversion on write flag for the main window.
     bool sRGB_{};
     /// Light pre-pass rendering support flag.
@@ -887,6 +905,10 @@ private:
     unsigned numPrimitives_{};
     /// Number of batches this frame.
     unsigned numBatches_{};
+    /// Number of bytes uploaded to constant buffers this frame.
+    unsigned numConstantBufferBytes_{};
+    /// Number of constant buffer blocks reused this frame.
+    unsigned numDeduplicatedConstantBufferBlocks_{};
     /// Largest scratch buffer request this frame.
     unsigned maxScratchBufferRequest_{};
     /// GPU objects.
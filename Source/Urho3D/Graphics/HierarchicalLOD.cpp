@@ -0,0 +1,483 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Core/Context.h"
+#include "../Graphics/Camera.h"
+#include "../Graphics/HierarchicalLOD.h"
+#include "../Graphics/Material.h"
+#include "../Graphics/Model.h"
+#include "../Graphics/Renderer.h"
+#include "../Graphics/StaticModel.h"
+#include "../Graphics/Viewport.h"
+#include "../IO/FileSystem.h"
+#include "../IO/Log.h"
+#include "../Resource/ResourceCache.h"
+#include "../Scene/Scene.h"
+#include "../Scene/SceneEvents.h"
+
+#include <EASTL/unordered_map.h>
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+extern const char* GEOMETRY_CATEGORY;
+
+namespace
+{
+
+static const StringVector sourceNodesStructureElementNames =
+{
+    "Node Count",
+    "   NodeID"
+};
+
+/// Relative distance to switch back from proxy to source models, to avoid flickering on the border.
+static const float proxyDistanceHysteresis = 0.05f;
+
+/// Return whether the static model may be replaced with proxy.
+bool IsEligibleForProxy(StaticModel* staticModel)
+{
+    return staticModel->GetType() == StaticModel::GetTypeStatic()
+        && staticModel->IsEnabledEffective()
+        && staticModel->GetModel()
+        && !staticModel->GetNode()->HasComponent<HierarchicalLODGroup>();
+}
+
+/// Return vertex format suitable for all static models.
+ModelVertexFormat GetProxyVertexFormat(ea::span<const SharedPtr<ModelView>> modelViews)
+{
+    ModelVertexFormat result;
+    result.position_ = TYPE_VECTOR3;
+    for (ModelView* modelView : modelViews)
+    {
+        const ModelVertexFormat& format = modelView->GetVertexFormat();
+        if (format.normal_ != ModelVertexFormat::Undefined)
+            result.normal_ = TYPE_VECTOR3;
+        if (format.tangent_ != ModelVertexFormat::Undefined)
+            result.tangent_ = TYPE_VECTOR4;
+        if (format.color_[0] != ModelVertexFormat::Undefined)
+            result.color_[0] = TYPE_UBYTE4_NORM;
+        if (format.uv_[0] != ModelVertexFormat::Undefined)
+            result.uv_[0] = TYPE_VECTOR2;
+    }
+    return result;
+}
+
+/// Return key of vertex clustering cell.
+unsigned long long GetCellKey(const Vector3& position, float cellSize)
+{
+    static const long long mask = (1ll << 21) - 1;
+    const IntVector3 cell = VectorFloorToInt(position / cellSize);
+    return (static_cast<unsigned long long>(cell.x_ & mask) << 42)
+        | (static_cast<unsigned long long>(cell.y_ & mask) << 21)
+        | static_cast<unsigned long long>(cell.z_ & mask);
+}
+
+}
+
+HierarchicalLODGroup::HierarchicalLODGroup(Context* context)
+    : Component(context)
+{
+    nodeIDsAttr_.push_back(0);
+}
+
+HierarchicalLODGroup::~HierarchicalLODGroup()
+{
+    ResetSourceDrawables();
+}
+
+void HierarchicalLODGroup::RegisterObject(Context* context)
+{
+    context->RegisterFactory<HierarchicalLODGroup>(GEOMETRY_CATEGORY);
+
+    URHO3D_ACCESSOR_ATTRIBUTE("Is Enabled", IsEnabled, SetEnabled, bool, true, AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Proxy Distance", GetProxyDistance, SetProxyDistance, float, 200.0f, AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Source Nodes", GetNodeIDsAttr, SetNodeIDsAttr,
+        VariantVector, Variant::emptyVariantVector, AM_DEFAULT | AM_NODEIDVECTOR)
+        .SetMetadata(AttributeMetadata::P_VECTOR_STRUCT_ELEMENTS, sourceNodesStructureElementNames);
+}
+
+void HierarchicalLODGroup::ApplyAttributes()
+{
+    if (!nodesDirty_)
+        return;
+
+    nodesDirty_ = false;
+    ResetSourceDrawables();
+    sourceNodes_.clear();
+
+    Scene* scene = GetScene();
+    if (!scene)
+        return;
+
+    // The first index stores the number of IDs redundantly. This is for editing
+    for (unsigned i = 1; i < nodeIDsAttr_.size(); ++i)
+    {
+        if (Node* node = scene->GetNode(nodeIDsAttr_[i].GetUInt()))
+            sourceNodes_.emplace_back(node);
+    }
+
+    for (Node* node : sourceNodes_)
+    {
+        ea::vector<StaticModel*> staticModels;
+        node->GetComponents(staticModels);
+        for (StaticModel* staticModel : staticModels)
+        {
+            if (staticModel->GetType() == StaticModel::GetTypeStatic())
+                sourceDrawables_.emplace_back(staticModel);
+        }
+    }
+
+    proxyModel_ = node_->GetComponent<StaticModel>();
+    ApplyProxyState(proxyActive_);
+}
+
+void HierarchicalLODGroup::SetSourceNodes(ea::span<Node* const> nodes)
+{
+    VariantVector nodeIDs;
+    nodeIDs.push_back(nodes.size());
+    for (Node* node : nodes)
+        nodeIDs.push_back(node->GetID());
+    SetNodeIDsAttr(nodeIDs);
+    ApplyAttributes();
+}
+
+void HierarchicalLODGroup::UpdateLOD(const Vector3& viewPosition)
+{
+    if (nodesDirty_)
+        ApplyAttributes();
+
+    if (!proxyModel_ || !IsEnabledEffective())
+        return;
+
+    const float distance = proxyModel_->GetWorldBoundingBox().DistanceToPoint(viewPosition);
+    const float switchDistance = proxyActive_ ? proxyDistance_ * (1.0f - proxyDistanceHysteresis) : proxyDistance_;
+    const bool proxyActive = distance > switchDistance;
+    if (proxyActive != proxyActive_)
+        ApplyProxyState(proxyActive);
+}
+
+void HierarchicalLODGroup::SetNodeIDsAttr(const VariantVector& value)
+{
+    // Just remember the node IDs. They need to go through the SceneResolver, and we actually find the nodes during
+    // ApplyAttributes()
+    nodeIDsAttr_.clear();
+    if (value.size())
+    {
+        unsigned index = 0;
+        unsigned numNodes = value[index++].GetUInt();
+        // Prevent crash on entering negative value in the editor
+        if (numNodes > M_MAX_INT)
+            numNodes = 0;
+
+        nodeIDsAttr_.push_back(numNodes);
+        while (numNodes--)
+        {
+            // If vector contains less IDs than should, fill the rest with zeroes
+            nodeIDsAttr_.push_back(index < value.size() ? value[index++].GetUInt() : 0u);
+        }
+    }
+    else
+        nodeIDsAttr_.push_back(0);
+
+    nodesDirty_ = true;
+}
+
+const VariantVector& HierarchicalLODGroup::GetNodeIDsAttr() const
+{
+    // Nodes are not resolved yet
+    if (nodesDirty_)
+        return nodeIDsAttr_;
+
+    nodeIDsAttr_.clear();
+    nodeIDsAttr_.push_back(sourceNodes_.size());
+    for (Node* node : sourceNodes_)
+        nodeIDsAttr_.push_back(node ? node->GetID() : 0);
+    return nodeIDsAttr_;
+}
+
+void HierarchicalLODGroup::OnSceneSet(Scene* scene)
+{
+    if (scene)
+    {
+        SubscribeToEvent(scene, E_SCENEPOSTUPDATE, URHO3D_HANDLER(HierarchicalLODGroup, HandleScenePostUpdate));
+        nodesDirty_ = true;
+    }
+    else
+    {
+        UnsubscribeFromEvent(E_SCENEPOSTUPDATE);
+        ResetSourceDrawables();
+    }
+}
+
+void HierarchicalLODGroup::HandleScenePostUpdate(StringHash eventType, VariantMap& eventData)
+{
+    auto renderer = GetSubsystem<Renderer>();
+    Viewport* viewport = renderer ? renderer->GetViewportForScene(GetScene(), 0) : nullptr;
+    Camera* camera = viewport ? viewport->GetCamera() : nullptr;
+    if (camera)
+        UpdateLOD(camera->GetNode()->GetWorldPosition());
+}
+
+void HierarchicalLODGroup::ApplyProxyState(bool proxyActive)
+{
+    proxyActive_ = proxyActive;
+    if (proxyModel_)
+        proxyModel_->SetHiddenByLOD(!proxyActive_);
+    for (Drawable* drawable : sourceDrawables_)
+    {
+        if (drawable)
+            drawable->SetHiddenByLOD(proxyActive_);
+    }
+}
+
+void HierarchicalLODGroup::ResetSourceDrawables()
+{
+    if (proxyModel_)
+        proxyModel_->SetHiddenByLOD(false);
+    for (Drawable* drawable : sourceDrawables_)
+    {
+        if (drawable)
+            drawable->SetHiddenByLOD(false);
+    }
+    sourceDrawables_.clear();
+    proxyModel_ = nullptr;
+    proxyActive_ = false;
+}
+
+HierarchicalLODBuilder::HierarchicalLODBuilder(Context* context)
+    : Object(context)
+{
+}
+
+unsigned HierarchicalLODBuilder::Build(Scene* scene, const HierarchicalLODSettings& settings)
+{
+    auto cache = GetSubsystem<ResourceCache>();
+
+    // Cluster static models by cell
+    ea::vector<StaticModel*> staticModels;
+    scene->GetComponents(staticModels, true);
+
+    ea::unordered_map<IntVector3, ea::vector<StaticModel*>> clusters;
+    for (StaticModel* staticModel : staticModels)
+    {
+        if (!IsEligibleForProxy(staticModel))
+            continue;
+
+        const Vector3 center = staticModel->GetWorldBoundingBox().Center();
+        const IntVector3 cell = VectorFloorToInt(center / ea::max(settings.clusterSize_, M_EPSILON));
+        clusters[cell].push_back(staticModel);
+    }
+
+    // Build proxies
+    unsigned numProxies = 0;
+    for (const auto& [cell, clusterModels] : clusters)
+    {
+        if (clusterModels.size() < ea::max(1u, settings.minModelsInCluster_))
+            continue;
+
+        BoundingBox clusterBoundingBox;
+        for (StaticModel* staticModel : clusterModels)
+            clusterBoundingBox.Merge(staticModel->GetWorldBoundingBox());
+
+        const Vector3 origin = clusterBoundingBox.Center();
+        ea::vector<Material*> materials;
+        SharedPtr<ModelView> modelView = MergeModels(clusterModels, Matrix3x4(-origin, Quaternion::IDENTITY, 1.0f), materials);
+        if (!modelView)
+            continue;
+
+        // Simplify geometries and remove ones that collapsed completely
+        ea::vector<GeometryView>& geometries = modelView->GetGeometries();
+        for (unsigned i = 0; i < geometries.size();)
+        {
+            SimplifyGeometry(geometries[i].lods_[0], settings.simplificationCellSize_);
+            if (geometries[i].lods_[0].indices_.empty())
+            {
+                geometries.erase_at(i);
+                materials.erase_at(i);
+            }
+            else
+                ++i;
+        }
+        if (geometries.empty())
+            continue;
+
+        SharedPtr<Model> model = modelView->ExportModel();
+        const ea::string modelName = Format("{}Proxy_{}_{}_{}.mdl", settings.modelNamePrefix_, cell.x_, cell.y_, cell.z_);
+        model->SetName(modelName);
+        if (!settings.outputDirectory_.empty())
+        {
+            const ea::string fileName = AddTrailingSlash(settings.outputDirectory_)
+                + modelName.substr(settings.modelNamePrefix_.length());
+            GetSubsystem<FileSystem>()->CreateDirsRecursive(GetPath(fileName));
+            if (!model->SaveFile(fileName))
+                URHO3D_LOGERROR("Cannot save proxy model to '{}'", fileName);
+        }
+        if (cache)
+            cache->AddManualResource(model);
+
+        Node* proxyNode = scene->CreateChild(Format("HLOD Proxy {} {} {}", cell.x_, cell.y_, cell.z_));
+        proxyNode->SetWorldPosition(origin);
+
+        auto proxyModel = proxyNode->CreateComponent<StaticModel>();
+        proxyModel->SetModel(model);
+        for (unsigned i = 0; i < materials.size(); ++i)
+            proxyModel->SetMaterial(i, materials[i]);
+        proxyModel->SetCastShadows(ea::any_of(clusterModels.begin(), clusterModels.end(),
+            [](StaticModel* staticModel) { return staticModel->GetCastShadows(); }));
+
+        ea::vector<Node*> sourceNodes;
+        for (StaticModel* staticModel : clusterModels)
+        {
+            if (!sourceNodes.contains(staticModel->GetNode()))
+                sourceNodes.push_back(staticModel->GetNode());
+        }
+
+        auto group = proxyNode->CreateComponent<HierarchicalLODGroup>();
+        group->SetProxyDistance(settings.proxyDistance_);
+        group->SetSourceNodes(sourceNodes);
+        ++numProxies;
+    }
+
+    return numProxies;
+}
+
+SharedPtr<ModelView> HierarchicalLODBuilder::MergeModels(ea::span<StaticModel* const> staticModels,
+    const Matrix3x4& transform, ea::vector<Material*>& materials) const
+{
+    ea::vector<SharedPtr<ModelView>> sourceModelViews;
+    for (StaticModel* staticModel : staticModels)
+    {
+        auto modelView = MakeShared<ModelView>(context_);
+        if (!modelView->ImportModel(staticModel->GetModel()))
+        {
+            URHO3D_LOGERROR("Cannot import model '{}'", staticModel->GetModel()->GetName());
+            return nullptr;
+        }
+        sourceModelViews.push_back(modelView);
+    }
+
+    materials.clear();
+    ea::vector<GeometryView> geometries;
+    for (unsigned modelIndex = 0; modelIndex < staticModels.size(); ++modelIndex)
+    {
+        StaticModel* staticModel = staticModels[modelIndex];
+        const Matrix3x4 vertexTransform = transform * staticModel->GetNode()->GetWorldTransform();
+        const Matrix3 normalTransform = vertexTransform.ToMatrix3().Inverse().Transpose();
+        const Matrix3 tangentTransform = vertexTransform.ToMatrix3();
+
+        const auto& sourceGeometries = sourceModelViews[modelIndex]->GetGeometries();
+        for (unsigned geometryIndex = 0; geometryIndex < sourceGeometries.size(); ++geometryIndex)
+        {
+            if (sourceGeometries[geometryIndex].lods_.empty())
+                continue;
+
+            // Merge geometries with the same material
+            Material* material = staticModel->GetMaterial(geometryIndex);
+            unsigned outputIndex = materials.index_of(material);
+            if (outputIndex == materials.size())
+            {
+                materials.push_back(material);
+                geometries.emplace_back().lods_.resize(1);
+            }
+
+            // Use the lowest LOD
+            const GeometryLODView& sourceLod = sourceGeometries[geometryIndex].lods_.back();
+            GeometryLODView& outputLod = geometries[outputIndex].lods_[0];
+            const unsigned baseVertex = outputLod.vertices_.size();
+            for (ModelVertex vertex : sourceLod.vertices_)
+            {
+                vertex.SetPosition(vertexTransform * vertex.GetPosition());
+                if (vertex.HasNormal())
+                    vertex.SetNormal((normalTransform * static_cast<Vector3>(vertex.normal_)).Normalized());
+                if (vertex.HasTangent())
+                {
+                    const Vector3 tangent = (tangentTransform * static_cast<Vector3>(vertex.tangent_)).Normalized();
+                    vertex.tangent_ = Vector4(tangent, vertex.tangent_.w_);
+                }
+                outputLod.vertices_.push_back(vertex);
+            }
+            for (unsigned index : sourceLod.indices_)
+                outputLod.indices_.push_back(baseVertex + index);
+        }
+    }
+
+    if (geometries.empty())
+        return nullptr;
+
+    auto result = MakeShared<ModelView>(context_);
+    result->SetVertexFormat(GetProxyVertexFormat(sourceModelViews));
+    result->SetGeometries(ea::move(geometries));
+    return result;
+}
+
+void HierarchicalLODBuilder::SimplifyGeometry(GeometryLODView& geometry, float cellSize)
+{
+    if (cellSize <= 0.0f)
+        return;
+
+    // Pick one vertex per cell, first vertex keeps its attributes and gets averaged position
+    ea::unordered_map<unsigned long long, unsigned> cellToVertex;
+    ea::vector<ModelVertex> vertices;
+    ea::vector<unsigned> numMergedVertices;
+    ea::vector<unsigned> vertexRemap(geometry.vertices_.size());
+    for (unsigned i = 0; i < geometry.vertices_.size(); ++i)
+    {
+        const ModelVertex& vertex = geometry.vertices_[i];
+        const auto insertResult = cellToVertex.emplace(GetCellKey(vertex.GetPosition(), cellSize), vertices.size());
+        const unsigned newIndex = insertResult.first->second;
+        if (insertResult.second)
+        {
+            vertices.push_back(vertex);
+            numMergedVertices.push_back(1);
+        }
+        else
+        {
+            vertices[newIndex].position_ += vertex.position_;
+            ++numMergedVertices[newIndex];
+        }
+        vertexRemap[i] = newIndex;
+    }
+
+    for (unsigned i = 0; i < vertices.size(); ++i)
+        vertices[i].SetPosition(vertices[i].GetPosition() / static_cast<float>(numMergedVertices[i]));
+
+    // Remove degenerate triangles
+    ea::vector<unsigned> indices;
+    for (unsigned i = 0; i + 3 <= geometry.indices_.size(); i += 3)
+    {
+        const unsigned i0 = vertexRemap[geometry.indices_[i]];
+        const unsigned i1 = vertexRemap[geometry.indices_[i + 1]];
+        const unsigned i2 = vertexRemap[geometry.indices_[i + 2]];
+        if (i0 != i1 && i1 != i2 && i2 != i0)
+            indices.insert(indices.end(), { i0, i1, i2 });
+    }
+
+    geometry.vertices_ = ea::move(vertices);
+    geometry.indices_ = ea::move(indices);
+}
+
+}
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+/// \file
+
+#pragma once
+
+#include "../Graphics/ModelView.h"
+#include "../Scene/Component.h"
+
+#include <EASTL/span.h>
+
+namespace Urho3D
+{
+
+class Drawable;
+class Material;
+class Scene;
+class StaticModel;
+
+/// Settings of hierarchical LOD generation.
+struct HierarchicalLODSettings
+{
+    /// Size of cubic cell of static models merged into one proxy.
+    float clusterSize_{ 100.0f };
+    /// Minimum number of static models in cluster.
+    unsigned minModelsInCluster_{ 2 };
+    /// Size of vertex clustering cell used to simplify proxy geometry. 0 to disable simplification.
+    float simplificationCellSize_{ 1.0f };
+    /// Distance from view to proxy bounding box beyond which the proxy replaces source models.
+    float proxyDistance_{ 200.0f };
+    /// Resource name prefix of generated proxy models.
+    ea::string modelNamePrefix_{ "HLOD/" };
+    /// Directory to save proxy models to. Corresponds to resource name without prefix. Models are not saved if empty.
+    ea::string outputDirectory_;
+};
+
+/// Swaps cluster of static source models with merged proxy StaticModel on the same node depending on view distance.
+/// Hidden drawables are removed from Octree, so they don't cost anything for culling and rendering.
+class URHO3D_API HierarchicalLODGroup : public Component
+{
+    URHO3D_OBJECT(HierarchicalLODGroup, Component);
+
+public:
+    /// Construct.
+    explicit HierarchicalLODGroup(Context* context);
+    /// Destruct.
+    ~HierarchicalLODGroup() override;
+    /// Register object factory.
+    static void RegisterObject(Context* context);
+    /// Apply attribute changes that can not be applied immediately.
+    void ApplyAttributes() override;
+
+    /// Set distance beyond which proxy is used.
+    void SetProxyDistance(float distance) { proxyDistance_ = ea::max(0.0f, distance); }
+    /// Set source nodes. All StaticModel components of these nodes are replaced with proxy.
+    void SetSourceNodes(ea::span<Node* const> nodes);
+    /// Select proxy or source models for view position. Called automatically for the camera of first viewport.
+    void UpdateLOD(const Vector3& viewPosition);
+
+    /// Return distance beyond which proxy is used.
+    float GetProxyDistance() const { return proxyDistance_; }
+    /// Return whether the proxy is currently used.
+    bool IsProxyActive() const { return proxyActive_; }
+    /// Return number of source drawables.
+    unsigned GetNumSourceDrawables() const { return sourceDrawables_.size(); }
+
+    /// Attributes.
+    /// @{
+    void SetNodeIDsAttr(const VariantVector& value);
+    const VariantVector& GetNodeIDsAttr() const;
+    /// @}
+
+protected:
+    /// Handle scene being assigned.
+    void OnSceneSet(Scene* scene) override;
+
+private:
+    /// Handle scene post-update.
+    void HandleScenePostUpdate(StringHash eventType, VariantMap& eventData);
+    /// Show or hide proxy and source drawables.
+    void ApplyProxyState(bool proxyActive);
+    /// Show all drawables and forget source drawables.
+    void ResetSourceDrawables();
+
+    /// Distance beyond which proxy is used.
+    float proxyDistance_{ 200.0f };
+    /// Whether the proxy is used.
+    bool proxyActive_{};
+
+    /// Source nodes.
+    ea::vector<WeakPtr<Node>> sourceNodes_;
+    /// Source drawables.
+    ea::vector<WeakPtr<Drawable>> sourceDrawables_;
+    /// Proxy drawable.
+    WeakPtr<StaticModel> proxyModel_;
+    /// Node ID attribute. The first element is the number of nodes.
+    mutable VariantVector nodeIDsAttr_;
+    /// Whether node IDs should be resolved.
+    bool nodesDirty_{};
+};
+
+/// Generates hierarchical LOD proxies for static models in the scene. Intended to be run offline.
+/// Static models are clustered by spatial cell, all geometries of the same material are merged and simplified.
+class URHO3D_API HierarchicalLODBuilder : public Object
+{
+    URHO3D_OBJECT(HierarchicalLODBuilder, Object);
+
+public:
+    /// Construct.
+    explicit HierarchicalLODBuilder(Context* context);
+
+    /// Generate proxy nodes with HierarchicalLODGroup for all eligible StaticModels in the scene.
+    /// Return number of created proxies.
+    unsigned Build(Scene* scene, const HierarchicalLODSettings& settings);
+
+    /// Merge lowest LODs of static models into model view in space of given transform.
+    /// Geometries with the same material are merged, materials are returned per output geometry.
+    SharedPtr<ModelView> MergeModels(ea::span<StaticModel* const> staticModels, const Matrix3x4& transform,
+        ea::vector<Material*>& materials) const;
+    /// Simplify geometry by merging vertices within cubic cells.
+    static void SimplifyGeometry(GeometryLODView& geometry, float cellSize);
+};
+
+}
@@ -0,0 +1,601 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Core/Context.h"
+#include "../Core/WorkQueue.h"
+#include "../Graphics/Camera.h"
+#include "../Graphics/Impostor.h"
+#include "../Graphics/Material.h"
+#include "../Graphics/Model.h"
+#include "../Graphics/ModelView.h"
+#include "../Graphics/Renderer.h"
+#include "../Graphics/Technique.h"
+#include "../Graphics/Texture.h"
+#include "../IO/Log.h"
+#include "../Resource/Image.h"
+#include "../Resource/ResourceCache.h"
+#include "../Scene/Node.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+extern const char* GEOMETRY_CATEGORY;
+
+namespace
+{
+
+/// Return value with sign of the argument and magnitude 1. Zero is considered positive.
+inline float SignNotZero(float value)
+{
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+/// Vertex of baked geometry in model space.
+struct BakeVertex
+{
+    Vector3 position_;
+    Vector2 uv_;
+};
+
+/// Triangle list of baked geometry with material inputs.
+struct BakeGeometry
+{
+    ea::vector<BakeVertex> vertices_;
+    ea::vector<unsigned> indices_;
+    /// Diffuse texture, optional.
+    SharedPtr<Image> diffuseImage_;
+    /// Diffuse color.
+    Color diffuseColor_{ Color::WHITE };
+};
+
+/// Vertex of baked geometry projected to frame.
+struct FrameVertex
+{
+    /// Position in frame pixels.
+    Vector2 position_;
+    /// Depth. Greater values are closer to the viewer.
+    float depth_{};
+    Vector2 uv_;
+};
+
+/// Return UV transformed by material UV offset parameter.
+Vector2 TransformUV(const Vector2& uv, const Variant& uOffset, const Variant& vOffset)
+{
+    const Vector4 uTransform = uOffset.IsEmpty() ? Vector4(1.0f, 0.0f, 0.0f, 0.0f) : uOffset.GetVector4();
+    const Vector4 vTransform = vOffset.IsEmpty() ? Vector4(0.0f, 1.0f, 0.0f, 0.0f) : vOffset.GetVector4();
+    return {
+        uv.x_ * uTransform.x_ + uv.y_ * uTransform.y_ + uTransform.w_,
+        uv.x_ * vTransform.x_ + uv.y_ * vTransform.y_ + vTransform.w_ };
+}
+
+/// Load CPU image of material diffuse texture, if possible.
+SharedPtr<Image> LoadDiffuseImage(ResourceCache* cache, Material* material)
+{
+    Texture* texture = material->GetTexture(TU_DIFFUSE);
+    if (!texture || texture->GetName().empty())
+        return nullptr;
+
+    SharedPtr<Image> image(cache->GetResource<Image>(texture->GetName()));
+    if (image && image->IsCompressed())
+        image = image->GetDecompressedImage();
+    return image;
+}
+
+/// Return diffuse color of baked geometry at given UV.
+Color SampleDiffuse(const BakeGeometry& geometry, const Vector2& uv)
+{
+    if (!geometry.diffuseImage_)
+        return geometry.diffuseColor_;
+
+    const float u = uv.x_ - Floor(uv.x_);
+    const float v = uv.y_ - Floor(uv.y_);
+    const Color& color = geometry.diffuseColor_;
+    const Color texel = geometry.diffuseImage_->GetPixelBilinear(u, v);
+    return { color.r_ * texel.r_, color.g_ * texel.g_, color.b_ * texel.b_, color.a_ * texel.a_ };
+}
+
+/// Return signed doubled area of triangle in frame space.
+inline float EdgeFunction(const Vector2& a, const Vector2& b, const Vector2& point)
+{
+    return (b.x_ - a.x_) * (point.y_ - a.y_) - (b.y_ - a.y_) * (point.x_ - a.x_);
+}
+
+/// Software rasterizer of one impostor frame.
+class FrameRasterizer
+{
+public:
+    /// Construct for frame size.
+    explicit FrameRasterizer(unsigned frameSize)
+        : frameSize_(frameSize)
+        , colors_(frameSize * frameSize)
+        , depths_(frameSize * frameSize)
+        , coverage_(frameSize * frameSize)
+    {
+    }
+
+    /// Render geometries as seen from direction.
+    void Render(ea::span<const BakeGeometry> geometries, const Vector3& center, float radius, const Vector3& direction,
+        float alphaThreshold)
+    {
+        ea::fill(colors_.begin(), colors_.end(), Color::TRANSPARENT_BLACK);
+        ea::fill(depths_.begin(), depths_.end(), -M_LARGE_VALUE);
+        ea::fill(coverage_.begin(), coverage_.end(), false);
+
+        const Vector3 upHint = Abs(direction.y_) > 0.999f ? Vector3::FORWARD : Vector3::UP;
+        const Vector3 right = direction.CrossProduct(upHint).Normalized();
+        const Vector3 up = right.CrossProduct(direction);
+        const float scale = 0.5f * frameSize_ / radius;
+
+        for (const BakeGeometry& geometry : geometries)
+        {
+            frameVertices_.clear();
+            for (const BakeVertex& vertex : geometry.vertices_)
+            {
+                const Vector3 offset = vertex.position_ - center;
+                FrameVertex& frameVertex = frameVertices_.emplace_back();
+                frameVertex.position_.x_ = (radius + offset.DotProduct(right)) * scale;
+                frameVertex.position_.y_ = (radius - offset.DotProduct(up)) * scale;
+                frameVertex.depth_ = offset.DotProduct(direction);
+                frameVertex.uv_ = vertex.uv_;
+            }
+
+            for (unsigned i = 0; i + 3 <= geometry.indices_.size(); i += 3)
+            {
+                RasterizeTriangle(geometry, frameVertices_[geometry.indices_[i]],
+                    frameVertices_[geometry.indices_[i + 1]], frameVertices_[geometry.indices_[i + 2]], alphaThreshold);
+            }
+        }
+    }
+
+    /// Dilate colors of covered texels into neighboring transparent texels.
+    void Dilate(unsigned numIterations)
+    {
+        const int size = static_cast<int>(frameSize_);
+        const IntVector2 offsets[4]{ { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+        for (unsigned iteration = 0; iteration < numIterations; ++iteration)
+        {
+            const ea::vector<bool> prevCoverage = coverage_;
+            for (int y = 0; y < size; ++y)
+            {
+                for (int x = 0; x < size; ++x)
+                {
+                    const unsigned index = y * size + x;
+                    if (prevCoverage[index])
+                        continue;
+
+                    Color sum = Color::TRANSPARENT_BLACK;
+                    unsigned count = 0;
+                    for (const IntVector2& offset : offsets)
+                    {
+                        const int neighborX = x + offset.x_;
+                        const int neighborY = y + offset.y_;
+                        if (neighborX < 0 || neighborY < 0 || neighborX >= size || neighborY >= size)
+                            continue;
+
+                        const unsigned neighborIndex = neighborY * size + neighborX;
+                        if (prevCoverage[neighborIndex])
+                        {
+                            sum += colors_[neighborIndex];
+                            ++count;
+                        }
+                    }
+
+                    if (count > 0)
+                    {
+                        colors_[index] = sum * (1.0f / count);
+                        colors_[index].a_ = 0.0f;
+                        coverage_[index] = true;
+                    }
+                }
+            }
+        }
+    }
+
+    /// Copy frame into image at given offset.
+    void CopyTo(Image* image, const IntVector2& offset) const
+    {
+        for (unsigned y = 0; y < frameSize_; ++y)
+        {
+            for (unsigned x = 0; x < frameSize_; ++x)
+                image->SetPixel(offset.x_ + x, offset.y_ + y, colors_[y * frameSize_ + x]);
+        }
+    }
+
+private:
+    /// Rasterize triangle with depth test and alpha test. Both faces are rendered.
+    void RasterizeTriangle(const BakeGeometry& geometry, const FrameVertex& v0, const FrameVertex& v1,
+        const FrameVertex& v2, float alphaThreshold)
+    {
+        const float area = EdgeFunction(v0.position_, v1.position_, v2.position_);
+        if (Abs(area) < M_EPSILON)
+            return;
+
+        const float invArea = 1.0f / area;
+        const float maxCoord = static_cast<float>(frameSize_);
+        const int left = FloorToInt(Clamp(Min(Min(v0.position_.x_, v1.position_.x_), v2.position_.x_), 0.0f, maxCoord));
+        const int top = FloorToInt(Clamp(Min(Min(v0.position_.y_, v1.position_.y_), v2.position_.y_), 0.0f, maxCoord));
+        const int right = CeilToInt(Clamp(Max(Max(v0.position_.x_, v1.position_.x_), v2.position_.x_), 0.0f, maxCoord));
+        const int bottom = CeilToInt(Clamp(Max(Max(v0.position_.y_, v1.position_.y_), v2.position_.y_), 0.0f, maxCoord));
+
+        for (int y = top; y < bottom; ++y)
+        {
+            for (int x = left; x < right; ++x)
+            {
+                const Vector2 sample{ x + 0.5f, y + 0.5f };
+                const float weight0 = EdgeFunction(v1.position_, v2.position_, sample) * invArea;
+                const float weight1 = EdgeFunction(v2.position_, v0.position_, sample) * invArea;
+                const float weight2 = 1.0f - weight0 - weight1;
+                if (weight0 < 0.0f || weight1 < 0.0f || weight2 < 0.0f)
+                    continue;
+
+                const unsigned index = y * frameSize_ + x;
+                const float depth = weight0 * v0.depth_ + weight1 * v1.depth_ + weight2 * v2.depth_;
+                if (depth <= depths_[index])
+                    continue;
+
+                const Vector2 uv = v0.uv_ * weight0 + v1.uv_ * weight1 + v2.uv_ * weight2;
+                Color color = SampleDiffuse(geometry, uv);
+                if (color.a_ < alphaThreshold)
+                    continue;
+
+                color.a_ = 1.0f;
+                colors_[index] = color;
+                depths_[index] = depth;
+                coverage_[index] = true;
+            }
+        }
+    }
+
+    unsigned frameSize_{};
+    ea::vector<Color> colors_;
+    ea::vector<float> depths_;
+    ea::vector<bool> coverage_;
+    ea::vector<FrameVertex> frameVertices_;
+};
+
+}
+
+Impostor::Impostor(Context* context)
+    : StaticModel(context)
+{
+}
+
+Impostor::~Impostor() = default;
+
+void Impostor::RegisterObject(Context* context)
+{
+    context->RegisterFactory<Impostor>(GEOMETRY_CATEGORY);
+
+    URHO3D_COPY_BASE_ATTRIBUTES(StaticModel);
+    URHO3D_REMOVE_ATTRIBUTE("Material");
+    URHO3D_ACCESSOR_ATTRIBUTE("Material", GetMaterialsAttr, SetMaterialsAttr, ResourceRefList, ResourceRefList(Material::GetTypeStatic()),
+        AM_DEFAULT);
+    URHO3D_MIXED_ACCESSOR_ATTRIBUTE("Impostor Material", GetImpostorMaterialAttr, SetImpostorMaterialAttr, ResourceRef,
+        ResourceRef(Material::GetTypeStatic()), AM_DEFAULT);
+    URHO3D_ACCESSOR_ATTRIBUTE("Impostor Distance", GetImpostorDistance, SetImpostorDistance, float, 0.0f, AM_DEFAULT);
+}
+
+void Impostor::UpdateBatches(const FrameInfo& frame)
+{
+    const float distance = frame.camera_->GetDistance(GetWorldBoundingBox().Center());
+    SetImpostorActive(impostorDistance_ > 0.0f && distance >= impostorDistance_);
+
+    if (!impostorActive_)
+    {
+        StaticModel::UpdateBatches(frame);
+        return;
+    }
+
+    distance_ = distance;
+    SourceBatch& batch = batches_[0];
+    batch.distance_ = distance;
+    batch.worldTransform_ = &node_->GetWorldTransform();
+}
+
+Geometry* Impostor::GetLodGeometry(unsigned batchIndex, unsigned level)
+{
+    if (batchIndex >= geometries_.size() || geometries_[batchIndex].empty())
+        return nullptr;
+
+    // If level is out of range, use current LOD of the model
+    const ea::vector<SharedPtr<Geometry>>& batchGeometries = geometries_[batchIndex];
+    if (level >= batchGeometries.size())
+        level = Min(geometryData_[batchIndex].lodLevel_, static_cast<unsigned>(batchGeometries.size()) - 1);
+    return batchGeometries[level];
+}
+
+void Impostor::SetModel(Model* model)
+{
+    SetImpostorActive(false);
+    StaticModel::SetModel(model);
+}
+
+void Impostor::SetMaterial(Material* material)
+{
+    SetImpostorActive(false);
+    StaticModel::SetMaterial(material);
+}
+
+bool Impostor::SetMaterial(unsigned index, Material* material)
+{
+    SetImpostorActive(false);
+    return StaticModel::SetMaterial(index, material);
+}
+
+Material* Impostor::GetMaterial(unsigned index) const
+{
+    if (impostorActive_ && index == 0)
+        return modelMaterial_;
+    return index < batches_.size() ? batches_[index].material_ : nullptr;
+}
+
+void Impostor::SetImpostorMaterial(Material* material)
+{
+    SetImpostorActive(false);
+    impostorMaterial_ = material;
+    MarkNetworkUpdate();
+}
+
+void Impostor::SetImpostorGeometry(Geometry* geometry)
+{
+    SetImpostorActive(false);
+    impostorGeometry_ = geometry;
+}
+
+void Impostor::SetImpostorDistance(float distance)
+{
+    impostorDistance_ = Max(distance, 0.0f);
+    MarkNetworkUpdate();
+}
+
+void Impostor::SetMaterialsAttr(const ResourceRefList& value)
+{
+    SetImpostorActive(false);
+    StaticModel::SetMaterialsAttr(value);
+}
+
+const ResourceRefList& Impostor::GetMaterialsAttr() const
+{
+    materialsAttr_.names_.resize(batches_.size());
+    for (unsigned i = 0; i < batches_.size(); ++i)
+        materialsAttr_.names_[i] = GetResourceName(GetMaterial(i));
+
+    return materialsAttr_;
+}
+
+void Impostor::SetImpostorMaterialAttr(const ResourceRef& value)
+{
+    auto* cache = GetSubsystem<ResourceCache>();
+    SetImpostorMaterial(cache->GetResource<Material>(value.name_));
+}
+
+ResourceRef Impostor::GetImpostorMaterialAttr() const
+{
+    return GetResourceRef(impostorMaterial_, Material::GetTypeStatic());
+}
+
+void Impostor::SetImpostorActive(bool active)
+{
+    if (active == impostorActive_ || (active && (batches_.empty() || !impostorMaterial_)))
+        return;
+
+    if (active)
+    {
+        // Renderer geometries are created with the screen, so look up the quad when it is needed
+        if (!impostorGeometry_)
+        {
+            auto* renderer = GetSubsystem<Renderer>();
+            impostorGeometry_ = renderer ? renderer->GetQuadGeometry() : nullptr;
+            if (!impostorGeometry_)
+                return;
+        }
+
+        modelMaterial_ = batches_[0].material_;
+        batches_[0].geometry_ = impostorGeometry_;
+        batches_[0].material_ = impostorMaterial_;
+        for (unsigned i = 1; i < batches_.size(); ++i)
+            batches_[i].geometry_ = nullptr;
+    }
+    else
+    {
+        batches_[0].material_ = modelMaterial_;
+        modelMaterial_ = nullptr;
+        for (unsigned i = 0; i < batches_.size(); ++i)
+            batches_[i].geometry_ = GetLodGeometry(i, M_MAX_UNSIGNED);
+    }
+
+    impostorActive_ = active;
+}
+
+ImpostorBaker::ImpostorBaker(Context* context)
+    : Object(context)
+{
+}
+
+bool ImpostorBaker::Bake(Model* model, ea::span<Material* const> materials, const ImpostorBakeSettings& settings,
+    ImpostorBakeResult& result)
+{
+    if (!model)
+        return false;
+
+    auto modelView = MakeShared<ModelView>(context_);
+    if (!modelView->ImportModel(model))
+    {
+        URHO3D_LOGERROR("Cannot import model '{}'", model->GetName());
+        return false;
+    }
+
+    // Collect the most detailed LOD of each geometry
+    auto* cache = GetSubsystem<ResourceCache>();
+    const auto& sourceGeometries = modelView->GetGeometries();
+    ea::vector<BakeGeometry> geometries;
+    BoundingBox boundingBox;
+    for (unsigned geometryIndex = 0; geometryIndex < sourceGeometries.size(); ++geometryIndex)
+    {
+        if (sourceGeometries[geometryIndex].lods_.empty())
+            continue;
+
+        const GeometryLODView& sourceLod = sourceGeometries[geometryIndex].lods_[0];
+        Material* material = geometryIndex < materials.size() ? materials[geometryIndex] : nullptr;
+
+        BakeGeometry& geometry = geometries.emplace_back();
+        geometry.indices_ = sourceLod.indices_;
+        if (material)
+        {
+            const Variant& diffuseColor = material->GetShaderParameter("MatDiffColor");
+            if (!diffuseColor.IsEmpty())
+                geometry.diffuseColor_ = Color(diffuseColor.GetVector4());
+            geometry.diffuseImage_ = LoadDiffuseImage(cache, material);
+        }
+
+        const Variant& uOffset = material ? material->GetShaderParameter("UOffset") : Variant::EMPTY;
+        const Variant& vOffset = material ? material->GetShaderParameter("VOffset") : Variant::EMPTY;
+        for (const ModelVertex& sourceVertex : sourceLod.vertices_)
+        {
+            BakeVertex& vertex = geometry.vertices_.emplace_back();
+            vertex.position_ = sourceVertex.GetPosition();
+            vertex.uv_ = TransformUV(static_cast<Vector2>(sourceVertex.uv_[0]), uOffset, vOffset);
+            boundingBox.Merge(vertex.position_);
+        }
+    }
+
+    if (!boundingBox.Defined())
+    {
+        URHO3D_LOGERROR("Model '{}' has no geometry to bake impostor", model->GetName());
+        return false;
+    }
+
+    // Find bounding sphere around bounding box center
+    const Vector3 center = boundingBox.Center();
+    float radius = M_EPSILON;
+    for (const BakeGeometry& geometry : geometries)
+    {
+        for (const BakeVertex& vertex : geometry.vertices_)
+            radius = Max(radius, (vertex.position_ - center).Length());
+    }
+
+    const unsigned framesPerSide = Max(settings.framesPerSide_, 2u);
+    const unsigned frameSize = Max(settings.frameSize_, 1u);
+    const unsigned atlasSize = framesPerSide * frameSize;
+
+    auto atlas = MakeShared<Image>(context_);
+    if (!atlas->SetSize(atlasSize, atlasSize, 4))
+        return false;
+
+    // Each frame is rendered by one work item into its own atlas region
+    auto* workQueue = GetSubsystem<WorkQueue>();
+    ForEachParallel(workQueue, 1, framesPerSide * framesPerSide,
+        [&](unsigned beginIndex, unsigned endIndex)
+    {
+        FrameRasterizer rasterizer(frameSize);
+        for (unsigned frameIndex = beginIndex; frameIndex < endIndex; ++frameIndex)
+        {
+            const IntVector2 frame{ static_cast<int>(frameIndex % framesPerSide), static_cast<int>(frameIndex / framesPerSide) };
+            const Vector3 direction = GetFrameDirection(frame, framesPerSide, settings.hemisphere_);
+            rasterizer.Render(geometries, center, radius, direction, settings.alphaThreshold_);
+            rasterizer.Dilate(settings.paddingIterations_);
+            rasterizer.CopyTo(atlas, frame * static_cast<int>(frameSize));
+        }
+    });
+
+    result.atlas_ = atlas;
+    result.center_ = center;
+    result.radius_ = radius;
+    result.framesPerSide_ = framesPerSide;
+    result.hemisphere_ = settings.hemisphere_;
+    return true;
+}
+
+bool ImpostorBaker::Bake(StaticModel* staticModel, const ImpostorBakeSettings& settings, ImpostorBakeResult& result)
+{
+    ea::vector<Material*> materials;
+    for (unsigned i = 0; i < staticModel->GetNumGeometries(); ++i)
+        materials.push_back(staticModel->GetMaterial(i));
+    return Bake(staticModel->GetModel(), materials, settings, result);
+}
+
+void ImpostorBaker::SetupMaterial(Material* material, Technique* technique, Texture* atlas, const ImpostorBakeResult& result)
+{
+    material->SetNumTechniques(1);
+    material->SetTechnique(0, technique);
+    material->SetTexture(TU_DIFFUSE, atlas);
+    material->SetShaderParameter("ImpostorCenter", Vector4(result.center_, result.radius_));
+    material->SetShaderParameter("ImpostorFrames",
+        Vector2(static_cast<float>(result.framesPerSide_), result.hemisphere_ ? 1.0f : 0.0f));
+}
+
+Vector2 ImpostorBaker::DirectionToOctahedral(const Vector3& direction, bool hemisphere)
+{
+    Vector3 dir = direction;
+    if (hemisphere)
+        dir.y_ = Max(dir.y_, 0.0f);
+
+    const float sum = Abs(dir.x_) + Abs(dir.y_) + Abs(dir.z_);
+    if (sum < M_EPSILON)
+        return { 0.5f, 0.5f };
+    dir /= sum;
+
+    Vector2 coords;
+    if (hemisphere)
+        coords = { dir.x_ + dir.z_, dir.x_ - dir.z_ };
+    else if (dir.y_ >= 0.0f)
+        coords = { dir.x_, dir.z_ };
+    else
+        coords = { (1.0f - Abs(dir.z_)) * SignNotZero(dir.x_), (1.0f - Abs(dir.x_)) * SignNotZero(dir.z_) };
+
+    return coords * 0.5f + Vector2::ONE * 0.5f;
+}
+
+Vector3 ImpostorBaker::OctahedralToDirection(const Vector2& coords, bool hemisphere)
+{
+    const Vector2 octahedral = coords * 2.0f - Vector2::ONE;
+
+    Vector3 dir;
+    if (hemisphere)
+    {
+        dir.x_ = (octahedral.x_ + octahedral.y_) * 0.5f;
+        dir.z_ = (octahedral.x_ - octahedral.y_) * 0.5f;
+        dir.y_ = 1.0f - Abs(dir.x_) - Abs(dir.z_);
+    }
+    else
+    {
+        dir = { octahedral.x_, 1.0f - Abs(octahedral.x_) - Abs(octahedral.y_), octahedral.y_ };
+        if (dir.y_ < 0.0f)
+        {
+            dir.x_ = (1.0f - Abs(octahedral.y_)) * SignNotZero(octahedral.x_);
+            dir.z_ = (1.0f - Abs(octahedral.x_)) * SignNotZero(octahedral.y_);
+        }
+    }
+    return dir.Normalized();
+}
+
+Vector3 ImpostorBaker::GetFrameDirection(const IntVector2& frame, unsigned framesPerSide, bool hemisphere)
+{
+    const Vector2 coords = Vector2(frame) / static_cast<float>(framesPerSide - 1);
+    return OctahedralToDirection(coords, hemisphere);
+}
+
+}
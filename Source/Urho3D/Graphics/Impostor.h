@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+/// \file
+
+#pragma once
+
+#include "../Graphics/StaticModel.h"
+
+#include <EASTL/span.h>
+
+namespace Urho3D
+{
+
+class Image;
+class Technique;
+class Texture;
+
+/// Settings of impostor baking.
+struct ImpostorBakeSettings
+{
+    /// Number of frames along each side of the atlas.
+    unsigned framesPerSide_{ 8 };
+    /// Size of one frame in pixels.
+    unsigned frameSize_{ 128 };
+    /// Whether to bake upper hemisphere of view directions only.
+    /// Doubles angular resolution for objects that are never seen from below, like trees.
+    bool hemisphere_{ true };
+    /// Texels with lower diffuse alpha are treated as transparent.
+    float alphaThreshold_{ 0.5f };
+    /// Number of iterations of color dilation into transparent texels, to avoid dark borders when filtered.
+    unsigned paddingIterations_{ 4 };
+};
+
+/// Result of impostor baking.
+struct ImpostorBakeResult
+{
+    /// RGBA atlas of octahedral view frames. Transparent texels have zero alpha.
+    SharedPtr<Image> atlas_;
+    /// Center of impostor in model space.
+    Vector3 center_;
+    /// Radius of impostor in model space.
+    float radius_{};
+    /// Number of frames along each side of the atlas.
+    unsigned framesPerSide_{};
+    /// Whether the atlas covers upper hemisphere only.
+    bool hemisphere_{};
+};
+
+/// Static model that is replaced with camera-facing impostor quad beyond impostor distance.
+/// Impostor frame is selected in vertex shader from octahedral atlas baked by ImpostorBaker,
+/// so all impostors with the same material are instanced together.
+class URHO3D_API Impostor : public StaticModel
+{
+    URHO3D_OBJECT(Impostor, StaticModel);
+
+public:
+    /// Construct.
+    explicit Impostor(Context* context);
+    /// Destruct.
+    ~Impostor() override;
+    /// Register object factory. StaticModel must be registered first.
+    /// @nobind
+    static void RegisterObject(Context* context);
+
+    /// Calculate distance and select model or impostor batches. May be called from worker thread(s).
+    void UpdateBatches(const FrameInfo& frame) override;
+    /// Return the model geometry for a specific LOD level. Used for raycasts and occlusion even if impostor is active.
+    Geometry* GetLodGeometry(unsigned batchIndex, unsigned level) override;
+
+    /// Set model.
+    void SetModel(Model* model) override;
+    /// Set material on all geometries.
+    void SetMaterial(Material* material) override;
+    /// Set material on one geometry. Return true if successful.
+    bool SetMaterial(unsigned index, Material* material) override;
+    /// Return material of model geometry by index.
+    Material* GetMaterial(unsigned index) const override;
+    using StaticModel::GetMaterial;
+
+    /// Set impostor material. Use ImpostorBaker::SetupMaterial to configure it.
+    void SetImpostorMaterial(Material* material);
+    /// Set geometry rendered as impostor. Quad geometry of Renderer is used if not set.
+    void SetImpostorGeometry(Geometry* geometry);
+    /// Set distance from camera beyond which the impostor is rendered. 0 disables impostor.
+    void SetImpostorDistance(float distance);
+
+    /// Return impostor material.
+    Material* GetImpostorMaterial() const { return impostorMaterial_; }
+    /// Return distance from camera beyond which the impostor is rendered.
+    float GetImpostorDistance() const { return impostorDistance_; }
+    /// Return whether the impostor was selected for the last processed view.
+    bool IsImpostorActive() const { return impostorActive_; }
+
+    /// Attributes.
+    /// @{
+    void SetMaterialsAttr(const ResourceRefList& value);
+    const ResourceRefList& GetMaterialsAttr() const;
+    void SetImpostorMaterialAttr(const ResourceRef& value);
+    ResourceRef GetImpostorMaterialAttr() const;
+    /// @}
+
+private:
+    /// Replace model geometries with impostor in the first batch or restore them.
+    /// Number and order of batches never change, views rendered later may still reference them by index.
+    void SetImpostorActive(bool active);
+
+    /// Impostor material.
+    SharedPtr<Material> impostorMaterial_;
+    /// Impostor geometry.
+    SharedPtr<Geometry> impostorGeometry_;
+    /// Distance beyond which the impostor is rendered.
+    float impostorDistance_{};
+    /// Whether the impostor is currently stored in the first batch.
+    bool impostorActive_{};
+    /// Model material of the first batch while impostor is active.
+    SharedPtr<Material> modelMaterial_;
+};
+
+/// Bakes octahedral views of a model into an impostor atlas using software rasterization.
+/// Doesn't require GPU, so it can be run on build machines without graphics.
+class URHO3D_API ImpostorBaker : public Object
+{
+    URHO3D_OBJECT(ImpostorBaker, Object);
+
+public:
+    /// Construct.
+    explicit ImpostorBaker(Context* context);
+
+    /// Bake impostor of model in model space. Diffuse textures are loaded as images from resource cache.
+    /// Frames are rasterized in worker threads.
+    bool Bake(Model* model, ea::span<Material* const> materials, const ImpostorBakeSettings& settings,
+        ImpostorBakeResult& result);
+    /// Bake impostor of static model with its current materials.
+    bool Bake(StaticModel* staticModel, const ImpostorBakeSettings& settings, ImpostorBakeResult& result);
+
+    /// Configure impostor material with technique, atlas texture and impostor shader parameters.
+    static void SetupMaterial(Material* material, Technique* technique, Texture* atlas, const ImpostorBakeResult& result);
+
+    /// Convert normalized direction to octahedral coordinates in range [0, 1].
+    static Vector2 DirectionToOctahedral(const Vector3& direction, bool hemisphere);
+    /// Convert octahedral coordinates in range [0, 1] to normalized direction.
+    static Vector3 OctahedralToDirection(const Vector2& coords, bool hemisphere);
+    /// Return view direction of atlas frame, from impostor center towards viewer.
+    static Vector3 GetFrameDirection(const IntVector2& frame, unsigned framesPerSide, bool hemisphere);
+};
+
+}
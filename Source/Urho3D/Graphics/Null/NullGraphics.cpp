@@ -0,0 +1,1364 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../../Precompiled.h"
+
+#include "../../Core/Context.h"
+#include "../../Core/Profiler.h"
+#include "../../Graphics/ConstantBuffer.h"
+#include "../../Graphics/Graphics.h"
+#include "../../Graphics/GraphicsEvents.h"
+#include "../../Graphics/GraphicsImpl.h"
+#include "../../Graphics/IndexBuffer.h"
+#include "../../Graphics/Shader.h"
+#include "../../Graphics/ShaderPrecache.h"
+#include "../../Graphics/ShaderProgram.h"
+#include "../../Graphics/Texture2D.h"
+#include "../../Graphics/TextureCube.h"
+#include "../../Graphics/VertexBuffer.h"
+#include "../../IO/Log.h"
+#include "../../Resource/ResourceCache.h"
+
+#include "../../DebugNew.h"
+
+namespace Urho3D
+{
+
+static void GetPrimitiveCount(unsigned elementCount, PrimitiveType type, unsigned& primitiveCount)
+{
+    switch (type)
+    {
+    case TRIANGLE_LIST:
+        primitiveCount = elementCount / 3;
+        break;
+
+    case LINE_LIST:
+        primitiveCount = elementCount / 2;
+        break;
+
+    case POINT_LIST:
+        primitiveCount = elementCount;
+        break;
+
+    case TRIANGLE_STRIP:
+        primitiveCount = elementCount - 2;
+        break;
+
+    case LINE_STRIP:
+        primitiveCount = elementCount - 1;
+        break;
+
+    case TRIANGLE_FAN:
+        // Triangle fan is not supported
+        primitiveCount = 0;
+        break;
+    }
+}
+
+const Vector2 Graphics::pixelUVOffset(0.0f, 0.0f);
+bool Graphics::gl3Support = false;
+
+Graphics::Graphics(Context* context) :
+    Object(context),
+    impl_(new GraphicsImpl()),
+    shaderPath_("Shaders/GLSL/"),
+    shaderExtension_(".glsl"),
+    orientations_("LandscapeLeft LandscapeRight"),
+    apiName_("Null")
+{
+    SetTextureUnitMappings();
+    ResetCachedState();
+
+    // Register Graphics library object factories
+    RegisterGraphicsLibrary(context_);
+}
+
+Graphics::~Graphics()
+{
+    {
+        MutexLock lock(gpuObjectMutex_);
+
+        // Release all GPU objects that still exist
+        for (auto i = gpuObjects_.begin(); i != gpuObjects_.end(); ++i)
+            (*i)->Release();
+        gpuObjects_.clear();
+    }
+
+    impl_->shaderPrograms_.clear();
+
+    delete impl_;
+    impl_ = nullptr;
+}
+
+bool Graphics::SetScreenMode(int width, int height, const ScreenModeParams& params, bool maximize)
+{
+    URHO3D_PROFILE("SetScreenMode");
+
+    // There is no window, use default size if not specified
+    if (width <= 0 || height <= 0)
+    {
+        width = 1024;
+        height = 768;
+    }
+
+    // If nothing changes, do not reset the state
+    if (impl_->initialized_ && width == width_ && height == height_ && params == screenParams_)
+        return true;
+
+    width_ = width;
+    height_ = height;
+    screenParams_ = params;
+    screenParams_.multiSample_ = 1;
+
+    impl_->defaultDepthBuffer_.clear();
+    impl_->defaultDepthBuffer_.resize(static_cast<unsigned>(width_ * height_), 1.0f);
+    impl_->initialized_ = true;
+
+    CheckFeatureSupport();
+    ResetCachedState();
+
+    OnScreenModeChanged();
+    return true;
+}
+
+void Graphics::SetSRGB(bool enable)
+{
+    sRGB_ = enable && sRGBWriteSupport_;
+}
+
+void Graphics::SetDither(bool enable)
+{
+    // No effect on Null graphics
+}
+
+void Graphics::SetFlushGPU(bool enable)
+{
+    flushGPU_ = enable;
+}
+
+void Graphics::SetForceGL2(bool enable)
+{
+    // No effect on Null graphics
+}
+
+void Graphics::Close()
+{
+    // No window on Null graphics
+}
+
+bool Graphics::TakeScreenShot(Image& destImage)
+{
+    URHO3D_LOGERROR("Screenshots are not supported on Null graphics");
+    return false;
+}
+
+bool Graphics::BeginFrame()
+{
+    if (!IsInitialized())
+        return false;
+
+    // Set default rendertarget and depth buffer
+    ResetRenderTargets();
+
+    // Cleanup textures from previous frame
+    for (unsigned i = 0; i < MAX_TEXTURE_UNITS; ++i)
+        SetTexture(i, nullptr);
+
+    numPrimitives_ = 0;
+    numBatches_ = 0;
+    numConstantBufferBytes_ = 0;
+    numDeduplicatedConstantBufferBlocks_ = 0;
+    impl_->depthRasterizer_.ResetStatistics();
+
+    SendEvent(E_BEGINRENDERING);
+    return true;
+}
+
+void Graphics::EndFrame()
+{
+    if (!IsInitialized())
+        return;
+
+    SendEvent(E_ENDRENDERING);
+
+    // Clean up too large scratch buffers
+    CleanupScratchBuffers();
+}
+
+void Graphics::Clear(ClearTargetFlags flags, const Color& color, float depth, unsigned stencil)
+{
+    if (!rasterizeDepth_ || !(flags & CLEAR_DEPTH))
+        return;
+
+    PrepareDraw();
+    impl_->depthRasterizer_.Clear(viewport_, Clamp(depth, 0.0f, 1.0f));
+}
+
+bool Graphics::ResolveToTexture(Texture2D* destination, const IntRect& viewport)
+{
+    // Color output is not stored on Null graphics
+    return destination && destination->GetRenderSurface();
+}
+
+bool Graphics::ResolveToTexture(Texture2D* texture)
+{
+    if (!texture)
+        return false;
+    RenderSurface* surface = texture->GetRenderSurface();
+    if (!surface)
+        return false;
+
+    texture->SetResolveDirty(false);
+    surface->SetResolveDirty(false);
+    return true;
+}
+
+bool Graphics::ResolveToTexture(TextureCube* texture)
+{
+    if (!texture)
+        return false;
+
+    texture->SetResolveDirty(false);
+    for (unsigned i = 0; i < MAX_CUBEMAP_FACES; ++i)
+    {
+        if (RenderSurface* surface = texture->GetRenderSurface((CubeMapFace)i))
+            surface->SetResolveDirty(false);
+    }
+    return true;
+}
+
+void Graphics::Draw(PrimitiveType type, unsigned vertexStart, unsigned vertexCount)
+{
+    if (!vertexCount || !impl_->shaderProgram_)
+        return;
+
+    PrepareDraw();
+
+    if (fillMode_ == FILL_POINT)
+        type = POINT_LIST;
+
+    unsigned primitiveCount;
+    GetPrimitiveCount(vertexCount, type, primitiveCount);
+    if (rasterizeDepth_)
+        RasterizeDepth(type, false, vertexStart, vertexCount, 0, 0);
+
+    numPrimitives_ += primitiveCount;
+    ++numBatches_;
+}
+
+void Graphics::Draw(PrimitiveType type, unsigned indexStart, unsigned indexCount, unsigned minVertex, unsigned vertexCount)
+{
+    Draw(type, indexStart, indexCount, 0, minVertex, vertexCount);
+}
+
+void Graphics::Draw(PrimitiveType type, unsigned indexStart, unsigned indexCount, unsigned baseVertexIndex, unsigned minVertex, unsigned vertexCount)
+{
+    if (!indexCount || !impl_->shaderProgram_)
+        return;
+
+    PrepareDraw();
+
+    if (fillMode_ == FILL_POINT)
+        type = POINT_LIST;
+
+    unsigned primitiveCount;
+    GetPrimitiveCount(indexCount, type, primitiveCount);
+    if (rasterizeDepth_)
+        RasterizeDepth(type, true, indexStart, indexCount, baseVertexIndex, 0);
+
+    numPrimitives_ += primitiveCount;
+    ++numBatches_;
+}
+
+void Graphics::DrawInstanced(PrimitiveType type, unsigned indexStart, unsigned indexCount, unsigned minVertex, unsigned vertexCount,
+    unsigned instanceCount)
+{
+    DrawInstanced(type, indexStart, indexCount, 0, minVertex, vertexCount, instanceCount);
+}
+
+void Graphics::DrawInstanced(PrimitiveType type, unsigned indexStart, unsigned indexCount, unsigned baseVertexIndex, unsigned minVertex, unsigned vertexCount,
+    unsigned instanceCount)
+{
+    if (!indexCount || !instanceCount || !impl_->shaderProgram_)
+        return;
+
+    PrepareDraw();
+
+    if (fillMode_ == FILL_POINT)
+        type = POINT_LIST;
+
+    unsigned primitiveCount;
+    GetPrimitiveCount(indexCount, type, primitiveCount);
+    if (rasterizeDepth_)
+        RasterizeDepth(type, true, indexStart, indexCount, baseVertexIndex, instanceCount);
+
+    numPrimitives_ += instanceCount * primitiveCount;
+    ++numBatches_;
+}
+
+void Graphics::SetVertexBuffer(VertexBuffer* buffer)
+{
+    // Note: this is not multi-instance safe
+    static ea::vector<VertexBuffer*> vertexBuffers(1);
+    vertexBuffers[0] = buffer;
+    SetVertexBuffers(vertexBuffers);
+}
+
+bool Graphics::SetVertexBuffers(const ea::vector<VertexBuffer*>& buffers, unsigned instanceOffset)
+{
+    if (buffers.size() > MAX_VERTEX_STREAMS)
+    {
+        URHO3D_LOGERROR("Too many vertex buffers");
+        return false;
+    }
+
+    for (unsigned i = 0; i < MAX_VERTEX_STREAMS; ++i)
+    {
+        VertexBuffer* buffer = i < buffers.size() ? buffers[i] : nullptr;
+        if (buffer)
+        {
+            const ea::vector<VertexElement>& elements = buffer->GetElements();
+            // Check if buffer has per-instance data
+            const bool hasInstanceData = elements.size() && elements[0].perInstance_;
+            vertexBuffers_[i] = buffer;
+            impl_->vertexOffsets_[i] = hasInstanceData ? instanceOffset : 0;
+        }
+        else
+        {
+            vertexBuffers_[i] = nullptr;
+            impl_->vertexOffsets_[i] = 0;
+        }
+    }
+
+    return true;
+}
+
+bool Graphics::SetVertexBuffers(const ea::vector<SharedPtr<VertexBuffer> >& buffers, unsigned instanceOffset)
+{
+    ea::vector<VertexBuffer*> bufferPointers;
+    bufferPointers.reserve(buffers.size());
+    for (auto& buffer : buffers)
+        bufferPointers.push_back(buffer.Get());
+    return SetVertexBuffers(bufferPointers, instanceOffset);
+}
+
+void Graphics::SetIndexBuffer(IndexBuffer* buffer)
+{
+    indexBuffer_ = buffer;
+}
+
+ShaderProgramLayout* Graphics::GetShaderProgramLayout(ShaderVariation* vs, ShaderVariation* ps)
+{
+    const auto combination = ea::make_pair(vs, ps);
+    auto iter = impl_->shaderPrograms_.find(combination);
+    if (iter != impl_->shaderPrograms_.end())
+        return iter->second;
+
+    ShaderVariation* prevVertexShader = vertexShader_;
+    ShaderVariation* prevPixelShader = pixelShader_;
+    SetShaders(vs, ps);
+    ShaderProgramLayout* layout = impl_->shaderProgram_;
+    SetShaders(prevVertexShader, prevPixelShader);
+    return layout;
+}
+
+void Graphics::SetShaders(ShaderVariation* vs, ShaderVariation* ps)
+{
+    if (vs == vertexShader_ && ps == pixelShader_)
+        return;
+
+    ClearParameterSources();
+
+    if (vs != vertexShader_)
+    {
+        // Create the shader now if not yet created. If already attempted, do not retry
+        if (vs && !vs->GetGPUObject())
+        {
+            if (vs->GetCompilerOutput().empty())
+            {
+                if (!vs->Create())
+                {
+                    URHO3D_LOGERROR("Failed to create vertex shader " + vs->GetFullName() + ":\n" + vs->GetCompilerOutput());
+                    vs = nullptr;
+                }
+            }
+            else
+                vs = nullptr;
+        }
+
+        vertexShader_ = vs;
+    }
+
+    if (ps != pixelShader_)
+    {
+        if (ps && !ps->GetGPUObject())
+        {
+            if (ps->GetCompilerOutput().empty())
+            {
+                if (!ps->Create())
+                {
+                    URHO3D_LOGERROR("Failed to create pixel shader " + ps->GetFullName() + ":\n" + ps->GetCompilerOutput());
+                    ps = nullptr;
+                }
+            }
+            else
+                ps = nullptr;
+        }
+
+        pixelShader_ = ps;
+    }
+
+    if (vertexShader_ && pixelShader_)
+    {
+        ea::pair<ShaderVariation*, ShaderVariation*> key = ea::make_pair(vertexShader_, pixelShader_);
+        auto i = impl_->shaderPrograms_.find(key);
+        if (i != impl_->shaderPrograms_.end())
+            impl_->shaderProgram_ = i->second.Get();
+        else
+        {
+            ShaderProgram* newProgram = impl_->shaderPrograms_[key] = new ShaderProgram(vertexShader_, pixelShader_);
+            impl_->shaderProgram_ = newProgram;
+        }
+    }
+    else
+        impl_->shaderProgram_ = nullptr;
+
+    // Store shader combination if shader dumping in progress
+    if (shaderPrecache_)
+        shaderPrecache_->StoreShaders(vertexShader_, pixelShader_);
+}
+
+void Graphics::SetShaderConstantBuffers(ea::span<const ConstantBufferRange, MAX_SHADER_PARAMETER_GROUPS> constantBuffers)
+{
+    URHO3D_LOGERROR("Constant buffers are not supported on Null graphics");
+}
+
+void Graphics::SetShaderParameter(StringHash param, const float data[], unsigned count)
+{
+    // Only transforms are needed for depth rasterization
+    if (param == VSP_MODEL && count >= 12)
+        memcpy(&impl_->model_, data, sizeof(Matrix3x4));
+    else if (param == VSP_VIEWPROJ && count >= 16)
+        impl_->viewProj_ = Matrix4(data);
+}
+
+void Graphics::SetShaderParameter(StringHash param, float value)
+{
+}
+
+void Graphics::SetShaderParameter(StringHash param, int value)
+{
+}
+
+void Graphics::SetShaderParameter(StringHash param, bool value)
+{
+}
+
+void Graphics::SetShaderParameter(StringHash param, const Color& color)
+{
+}
+
+void Graphics::SetShaderParameter(StringHash param, const Vector2& vector)
+{
+}
+
+void Graphics::SetShaderParameter(StringHash param, const Matrix3& matrix)
+{
+}
+
+void Graphics::SetShaderParameter(StringHash param, const Vector3& vector)
+{
+}
+
+void Graphics::SetShaderParameter(StringHash param, const Matrix4& matrix)
+{
+    if (param == VSP_VIEWPROJ)
+        impl_->viewProj_ = matrix;
+}
+
+void Graphics::SetShaderParameter(StringHash param, const Vector4& vector)
+{
+}
+
+void Graphics::SetShaderParameter(StringHash param, const Matrix3x4& matrix)
+{
+    if (param == VSP_MODEL)
+        impl_->model_ = matrix;
+}
+
+bool Graphics::NeedParameterUpdate(ShaderParameterGroup group, const void* source)
+{
+    if ((unsigned)(size_t)shaderParameterSources_[group] == M_MAX_UNSIGNED || shaderParameterSources_[group] != source)
+    {
+        shaderParameterSources_[group] = source;
+        return true;
+    }
+    else
+        return false;
+}
+
+bool Graphics::HasShaderParameter(StringHash param)
+{
+    // Shader parameters are not reflected, accept everything
+    return impl_->shaderProgram_ != nullptr;
+}
+
+bool Graphics::HasTextureUnit(TextureUnit unit)
+{
+    return (vertexShader_ && vertexShader_->HasTextureUnit(unit)) || (pixelShader_ && pixelShader_->HasTextureUnit(unit));
+}
+
+void Graphics::ClearParameterSource(ShaderParameterGroup group)
+{
+    shaderParameterSources_[group] = (const void*)M_MAX_UNSIGNED;
+}
+
+void Graphics::ClearParameterSources()
+{
+    for (unsigned i = 0; i < MAX_SHADER_PARAMETER_GROUPS; ++i)
+        shaderParameterSources_[i] = (const void*)M_MAX_UNSIGNED;
+}
+
+void Graphics::ClearTransformSources()
+{
+    shaderParameterSources_[SP_CAMERA] = (const void*)M_MAX_UNSIGNED;
+    shaderParameterSources_[SP_OBJECT] = (const void*)M_MAX_UNSIGNED;
+}
+
+void Graphics::SetTexture(unsigned index, Texture* texture)
+{
+    if (index >= MAX_TEXTURE_UNITS)
+        return;
+
+    // Check if texture is currently bound as a rendertarget. In that case, use its backup texture, or blank if not defined
+    if (texture)
+    {
+        if (renderTargets_[0] && renderTargets_[0]->GetParentTexture() == texture)
+            texture = texture->GetBackupTexture();
+        else
+        {
+            // Resolve multisampled texture now as necessary
+            if (texture->GetMultiSample() > 1 && texture->GetAutoResolve() && texture->IsResolveDirty())
+            {
+                if (texture->GetType() == Texture2D::GetTypeStatic())
+                    ResolveToTexture(static_cast<Texture2D*>(texture));
+                if (texture->GetType() == TextureCube::GetTypeStatic())
+                    ResolveToTexture(static_cast<TextureCube*>(texture));
+            }
+        }
+
+        if (texture && texture->GetLevelsDirty())
+            texture->RegenerateLevels();
+    }
+
+    if (texture && texture->GetParametersDirty())
+        texture->UpdateParameters();
+
+    textures_[index] = texture;
+}
+
+void SetTextureForUpdate(Texture* texture)
+{
+    // No-op on Null graphics
+}
+
+void Graphics::SetDefaultTextureFilterMode(TextureFilterMode mode)
+{
+    if (mode != defaultTextureFilterMode_)
+    {
+        defaultTextureFilterMode_ = mode;
+        SetTextureParametersDirty();
+    }
+}
+
+void Graphics::SetDefaultTextureAnisotropy(unsigned level)
+{
+    level = Max(level, 1U);
+
+    if (level != defaultTextureAnisotropy_)
+    {
+        defaultTextureAnisotropy_ = level;
+        SetTextureParametersDirty();
+    }
+}
+
+void Graphics::Restore()
+{
+    // No-op on Null graphics
+}
+
+void Graphics::SetTextureParametersDirty()
+{
+    MutexLock lock(gpuObjectMutex_);
+
+    for (auto i = gpuObjects_.begin(); i != gpuObjects_.end(); ++i)
+    {
+        Texture* texture = dynamic_cast<Texture*>(*i);
+        if (texture)
+            texture->SetParametersDirty();
+    }
+}
+
+void Graphics::ResetRenderTargets()
+{
+    for (unsigned i = 0; i < MAX_RENDERTARGETS; ++i)
+        SetRenderTarget(i, (RenderSurface*)nullptr);
+    SetDepthStencil((RenderSurface*)nullptr);
+    SetViewport(IntRect(0, 0, width_, height_));
+}
+
+void Graphics::ResetRenderTarget(unsigned index)
+{
+    SetRenderTarget(index, (RenderSurface*)nullptr);
+}
+
+void Graphics::ResetDepthStencil()
+{
+    SetDepthStencil((RenderSurface*)nullptr);
+}
+
+void Graphics::SetRenderTarget(unsigned index, RenderSurface* renderTarget)
+{
+    if (index >= MAX_RENDERTARGETS)
+        return;
+
+    if (renderTarget != renderTargets_[index])
+    {
+        renderTargets_[index] = renderTarget;
+
+        // If the rendertarget is also bound as a texture, replace with backup texture or null
+        if (renderTarget)
+        {
+            Texture* parentTexture = renderTarget->GetParentTexture();
+
+            for (unsigned i = 0; i < MAX_TEXTURE_UNITS; ++i)
+            {
+                if (textures_[i] == parentTexture)
+                    SetTexture(i, textures_[i]->GetBackupTexture());
+            }
+
+            // If mipmapped, mark the levels needing regeneration
+            if (parentTexture->GetLevels() > 1)
+                parentTexture->SetLevelsDirty();
+        }
+    }
+}
+
+void Graphics::SetRenderTarget(unsigned index, Texture2D* texture)
+{
+    RenderSurface* renderTarget = nullptr;
+    if (texture)
+        renderTarget = texture->GetRenderSurface();
+
+    SetRenderTarget(index, renderTarget);
+}
+
+void Graphics::SetDepthStencil(RenderSurface* depthStencil)
+{
+    depthStencil_ = depthStencil;
+}
+
+void Graphics::SetDepthStencil(Texture2D* texture)
+{
+    RenderSurface* depthStencil = nullptr;
+    if (texture)
+        depthStencil = texture->GetRenderSurface();
+
+    SetDepthStencil(depthStencil);
+}
+
+void Graphics::SetViewport(const IntRect& rect)
+{
+    IntVector2 size = GetRenderTargetDimensions();
+
+    IntRect rectCopy = rect;
+
+    if (rectCopy.right_ <= rectCopy.left_)
+        rectCopy.right_ = rectCopy.left_ + 1;
+    if (rectCopy.bottom_ <= rectCopy.top_)
+        rectCopy.bottom_ = rectCopy.top_ + 1;
+    rectCopy.left_ = Clamp(rectCopy.left_, 0, size.x_);
+    rectCopy.top_ = Clamp(rectCopy.top_, 0, size.y_);
+    rectCopy.right_ = Clamp(rectCopy.right_, 0, size.x_);
+    rectCopy.bottom_ = Clamp(rectCopy.bottom_, 0, size.y_);
+
+    viewport_ = rectCopy;
+
+    // Disable scissor test, needs to be re-enabled by the user
+    SetScissorTest(false);
+}
+
+void Graphics::SetBlendMode(BlendMode mode, bool alphaToCoverage)
+{
+    blendMode_ = mode;
+    alphaToCoverage_ = alphaToCoverage;
+}
+
+void Graphics::SetColorWrite(bool enable)
+{
+    colorWrite_ = enable;
+}
+
+void Graphics::SetCullMode(CullMode mode)
+{
+    cullMode_ = mode;
+}
+
+void Graphics::SetDepthBias(float constantBias, float slopeScaledBias)
+{
+    constantDepthBias_ = constantBias;
+    slopeScaledDepthBias_ = slopeScaledBias;
+}
+
+void Graphics::SetDepthTest(CompareMode mode)
+{
+    depthTestMode_ = mode;
+}
+
+void Graphics::SetDepthWrite(bool enable)
+{
+    depthWrite_ = enable;
+}
+
+void Graphics::SetFillMode(FillMode mode)
+{
+    fillMode_ = mode;
+}
+
+void Graphics::SetLineAntiAlias(bool enable)
+{
+    lineAntiAlias_ = enable;
+}
+
+void Graphics::SetScissorTest(bool enable, const Rect& rect, bool borderInclusive)
+{
+    // During some light rendering loops, a full rect is toggled on/off repeatedly.
+    // Disable scissor in that case to reduce state changes
+    if (rect.min_.x_ <= 0.0f && rect.min_.y_ <= 0.0f && rect.max_.x_ >= 1.0f && rect.max_.y_ >= 1.0f)
+        enable = false;
+
+    if (enable)
+    {
+        IntVector2 rtSize(GetRenderTargetDimensions());
+        IntVector2 viewSize(viewport_.Size());
+        IntVector2 viewPos(viewport_.left_, viewport_.top_);
+        IntRect intRect;
+        int expand = borderInclusive ? 1 : 0;
+
+        intRect.left_ = Clamp((int)((rect.min_.x_ + 1.0f) * 0.5f * viewSize.x_) + viewPos.x_, 0, rtSize.x_ - 1);
+        intRect.top_ = Clamp((int)((-rect.max_.y_ + 1.0f) * 0.5f * viewSize.y_) + viewPos.y_, 0, rtSize.y_ - 1);
+        intRect.right_ = Clamp((int)((rect.max_.x_ + 1.0f) * 0.5f * viewSize.x_) + viewPos.x_ + expand, 0, rtSize.x_);
+        intRect.bottom_ = Clamp((int)((-rect.min_.y_ + 1.0f) * 0.5f * viewSize.y_) + viewPos.y_ + expand, 0, rtSize.y_);
+
+        if (intRect.right_ == intRect.left_)
+            intRect.right_++;
+        if (intRect.bottom_ == intRect.top_)
+            intRect.bottom_++;
+
+        if (intRect.right_ < intRect.left_ || intRect.bottom_ < intRect.top_)
+            enable = false;
+
+        if (enable)
+            scissorRect_ = intRect;
+    }
+
+    scissorTest_ = enable;
+}
+
+void Graphics::SetScissorTest(bool enable, const IntRect& rect)
+{
+    IntVector2 rtSize(GetRenderTargetDimensions());
+    IntVector2 viewPos(viewport_.left_, viewport_.top_);
+
+    if (enable)
+    {
+        IntRect intRect;
+        intRect.left_ = Clamp(rect.left_ + viewPos.x_, 0, rtSize.x_ - 1);
+        intRect.top_ = Clamp(rect.top_ + viewPos.y_, 0, rtSize.y_ - 1);
+        intRect.right_ = Clamp(rect.right_ + viewPos.x_, 0, rtSize.x_);
+        intRect.bottom_ = Clamp(rect.bottom_ + viewPos.y_, 0, rtSize.y_);
+
+        if (intRect.right_ == intRect.left_)
+            intRect.right_++;
+        if (intRect.bottom_ == intRect.top_)
+            intRect.bottom_++;
+
+        if (intRect.right_ < intRect.left_ || intRect.bottom_ < intRect.top_)
+            enable = false;
+
+        if (enable)
+            scissorRect_ = intRect;
+    }
+
+    scissorTest_ = enable;
+}
+
+void Graphics::SetStencilTest(bool enable, CompareMode mode, StencilOp pass, StencilOp fail, StencilOp zFail, unsigned stencilRef,
+    unsigned compareMask, unsigned writeMask)
+{
+    // Stencil is not emulated, only store the state
+    stencilTest_ = enable;
+    if (enable)
+    {
+        stencilTestMode_ = mode;
+        stencilPass_ = pass;
+        stencilFail_ = fail;
+        stencilZFail_ = zFail;
+        stencilCompareMask_ = compareMask;
+        stencilWriteMask_ = writeMask;
+        stencilRef_ = stencilRef;
+    }
+}
+
+void Graphics::SetClipPlane(bool enable, const Plane& clipPlane, const Matrix3x4& view, const Matrix4& projection)
+{
+    useClipPlane_ = enable;
+}
+
+bool Graphics::IsInitialized() const
+{
+    return impl_->initialized_;
+}
+
+ea::vector<int> Graphics::GetMultiSampleLevels() const
+{
+    ea::vector<int> ret;
+    ret.emplace_back(1);
+    return ret;
+}
+
+unsigned Graphics::GetFormat(CompressedFormat format) const
+{
+    switch (format)
+    {
+    case CF_RGBA:
+        return NULL_FORMAT_RGBA8;
+
+    case CF_DXT1:
+        return NULL_FORMAT_BC1;
+
+    case CF_DXT3:
+        return NULL_FORMAT_BC2;
+
+    case CF_DXT5:
+        return NULL_FORMAT_BC3;
+
+    default:
+        return 0;
+    }
+}
+
+ShaderVariation* Graphics::GetShader(ShaderType type, const ea::string& name, const ea::string& defines) const
+{
+    return GetShader(type, name.c_str(), defines.c_str());
+}
+
+ShaderVariation* Graphics::GetShader(ShaderType type, const char* name, const char* defines) const
+{
+    // Return cached shader
+    if (lastShaderName_ == name && lastShader_)
+        return lastShader_->GetVariation(type, defines);
+
+    auto cache = context_->GetSubsystem<ResourceCache>();
+    lastShader_ = nullptr;
+
+    // Try to load universal shader
+    if (strncmp(universalShaderNamePrefix_.c_str(), name, universalShaderNamePrefix_.size()) == 0)
+    {
+        const ea::string universalShaderName = Format(universalShaderPath_, name);
+        if (cache->Exists(universalShaderName))
+        {
+            lastShader_ = cache->GetResource<Shader>(universalShaderName);
+            lastShaderName_ = name;
+        }
+    }
+
+    // Try to load native shader
+    if (!lastShader_)
+    {
+        const ea::string fullShaderName = shaderPath_ + name + shaderExtension_;
+        // Try to reduce repeated error log prints because of missing shaders
+        if (lastShaderName_ != name || cache->Exists(fullShaderName))
+        {
+            lastShader_ = cache->GetResource<Shader>(fullShaderName);
+            lastShaderName_ = name;
+        }
+    }
+
+    return lastShader_ ? lastShader_->GetVariation(type, defines) : nullptr;
+}
+
+VertexBuffer* Graphics::GetVertexBuffer(unsigned index) const
+{
+    return index < MAX_VERTEX_STREAMS ? vertexBuffers_[index] : nullptr;
+}
+
+ShaderProgram* Graphics::GetShaderProgram() const
+{
+    return impl_->shaderProgram_;
+}
+
+TextureUnit Graphics::GetTextureUnit(const ea::string& name)
+{
+    auto i = textureUnits_.find(name);
+    if (i != textureUnits_.end())
+        return i->second;
+    else
+        return MAX_TEXTURE_UNITS;
+}
+
+const ea::string& Graphics::GetTextureUnitName(TextureUnit unit)
+{
+    for (auto i = textureUnits_.begin(); i != textureUnits_.end(); ++i)
+    {
+        if (i->second == unit)
+            return i->first;
+    }
+    return EMPTY_STRING;
+}
+
+Texture* Graphics::GetTexture(unsigned index) const
+{
+    return index < MAX_TEXTURE_UNITS ? textures_[index] : nullptr;
+}
+
+RenderSurface* Graphics::GetRenderTarget(unsigned index) const
+{
+    return index < MAX_RENDERTARGETS ? renderTargets_[index] : nullptr;
+}
+
+IntVector2 Graphics::GetRenderTargetDimensions() const
+{
+    int width, height;
+
+    if (renderTargets_[0])
+    {
+        width = renderTargets_[0]->GetWidth();
+        height = renderTargets_[0]->GetHeight();
+    }
+    else if (depthStencil_) // Depth-only rendering
+    {
+        width = depthStencil_->GetWidth();
+        height = depthStencil_->GetHeight();
+    }
+    else
+    {
+        width = width_;
+        height = height_;
+    }
+
+    return IntVector2(width, height);
+}
+bool Graphics::GetDither() const
+{
+    return false;
+}
+
+bool Graphics::IsDeviceLost() const
+{
+    // Null graphics context is never lost
+    return false;
+}
+
+void Graphics::OnWindowResized()
+{
+    // No window on Null graphics
+}
+
+void Graphics::OnWindowMoved()
+{
+    // No window on Null graphics
+}
+
+void Graphics::CleanupShaderPrograms(ShaderVariation* variation)
+{
+    for (auto i = impl_->shaderPrograms_.begin(); i != impl_->shaderPrograms_.end();)
+    {
+        if (i->first.first == variation || i->first.second == variation)
+            i = impl_->shaderPrograms_.erase(i);
+        else
+            ++i;
+    }
+
+    if (vertexShader_ == variation || pixelShader_ == variation)
+        impl_->shaderProgram_ = nullptr;
+}
+
+void Graphics::CleanupRenderSurface(RenderSurface* surface)
+{
+    // No-op on Null graphics
+}
+
+ConstantBuffer* Graphics::GetOrCreateConstantBuffer(ShaderType type, unsigned index, unsigned size)
+{
+    // Constant buffers are not supported on Null graphics
+    return nullptr;
+}
+
+unsigned Graphics::GetAlphaFormat()
+{
+    return NULL_FORMAT_A8;
+}
+
+unsigned Graphics::GetLuminanceFormat()
+{
+    return NULL_FORMAT_R8;
+}
+
+unsigned Graphics::GetLuminanceAlphaFormat()
+{
+    return NULL_FORMAT_RG8;
+}
+
+unsigned Graphics::GetRGBFormat()
+{
+    return NULL_FORMAT_RGBA8;
+}
+
+unsigned Graphics::GetRGBAFormat()
+{
+    return NULL_FORMAT_RGBA8;
+}
+
+unsigned Graphics::GetRGBA16Format()
+{
+    return NULL_FORMAT_RGBA16;
+}
+
+unsigned Graphics::GetRGBAFloat16Format()
+{
+    return NULL_FORMAT_RGBA16F;
+}
+
+unsigned Graphics::GetRGBAFloat32Format()
+{
+    return NULL_FORMAT_RGBA32F;
+}
+
+unsigned Graphics::GetRG16Format()
+{
+    return NULL_FORMAT_RG16;
+}
+
+unsigned Graphics::GetRGFloat16Format()
+{
+    return NULL_FORMAT_RG16F;
+}
+
+unsigned Graphics::GetRGFloat32Format()
+{
+    return NULL_FORMAT_RG32F;
+}
+
+unsigned Graphics::GetFloat16Format()
+{
+    return NULL_FORMAT_R16F;
+}
+
+unsigned Graphics::GetFloat32Format()
+{
+    return NULL_FORMAT_R32F;
+}
+
+unsigned Graphics::GetLinearDepthFormat()
+{
+    return NULL_FORMAT_R32F;
+}
+
+unsigned Graphics::GetDepthStencilFormat()
+{
+    return NULL_FORMAT_D24S8;
+}
+
+unsigned Graphics::GetReadableDepthFormat()
+{
+    return NULL_FORMAT_D32;
+}
+
+unsigned Graphics::GetReadableDepthStencilFormat()
+{
+    return NULL_FORMAT_D24S8;
+}
+
+unsigned Graphics::GetFormat(const ea::string& formatName)
+{
+    ea::string nameLower = formatName.to_lower();
+    nameLower.trim();
+
+    if (nameLower == "a")
+        return GetAlphaFormat();
+    if (nameLower == "l")
+        return GetLuminanceFormat();
+    if (nameLower == "la")
+        return GetLuminanceAlphaFormat();
+    if (nameLower == "rgb")
+        return GetRGBFormat();
+    if (nameLower == "rgba")
+        return GetRGBAFormat();
+    if (nameLower == "rgba16")
+        return GetRGBA16Format();
+    if (nameLower == "rgba16f")
+        return GetRGBAFloat16Format();
+    if (nameLower == "rgba32f")
+        return GetRGBAFloat32Format();
+    if (nameLower == "rg16")
+        return GetRG16Format();
+    if (nameLower == "rg16f")
+        return GetRGFloat16Format();
+    if (nameLower == "rg32f")
+        return GetRGFloat32Format();
+    if (nameLower == "r16f")
+        return GetFloat16Format();
+    if (nameLower == "r32f" || nameLower == "float")
+        return GetFloat32Format();
+    if (nameLower == "lineardepth" || nameLower == "depth")
+        return GetLinearDepthFormat();
+    if (nameLower == "d24s8")
+        return GetDepthStencilFormat();
+    if (nameLower == "readabledepth" || nameLower == "hwdepth")
+        return GetReadableDepthFormat();
+
+    return GetRGBFormat();
+}
+
+unsigned Graphics::GetMaxBones()
+{
+    return 128;
+}
+
+bool Graphics::GetGL3Support()
+{
+    return gl3Support;
+}
+
+void Graphics::CheckFeatureSupport()
+{
+    anisotropySupport_ = true;
+    dxtTextureSupport_ = true;
+    lightPrepassSupport_ = true;
+    deferredSupport_ = true;
+    hardwareShadowSupport_ = true;
+    instancingSupport_ = true;
+    shadowMapFormat_ = NULL_FORMAT_D16;
+    hiresShadowMapFormat_ = NULL_FORMAT_D32;
+    dummyColorFormat_ = NULL_FORMAT_NONE;
+    sRGBSupport_ = true;
+    sRGBWriteSupport_ = true;
+
+    // Shader parameters are passed as global uniforms so transforms can be intercepted
+    caps.maxVertexShaderUniforms_ = 4096;
+    caps.maxPixelShaderUniforms_ = 4096;
+    caps.constantBuffersSupported_ = false;
+    caps.globalUniformsSupported_ = true;
+    caps.maxTextureSize_ = 16384;
+    caps.maxRenderTargetSize_ = 16384;
+    caps.maxNumRenderTargets_ = MAX_RENDERTARGETS;
+}
+
+void Graphics::ResetCachedState()
+{
+    for (auto& constantBuffer : constantBuffers_)
+        constantBuffer = {};
+
+    for (unsigned i = 0; i < MAX_VERTEX_STREAMS; ++i)
+    {
+        vertexBuffers_[i] = nullptr;
+        impl_->vertexOffsets_[i] = 0;
+    }
+
+    for (unsigned i = 0; i < MAX_TEXTURE_UNITS; ++i)
+        textures_[i] = nullptr;
+
+    for (unsigned i = 0; i < MAX_RENDERTARGETS; ++i)
+        renderTargets_[i] = nullptr;
+
+    depthStencil_ = nullptr;
+    viewport_ = IntRect(0, 0, width_, height_);
+
+    indexBuffer_ = nullptr;
+    vertexDeclarationHash_ = 0;
+    primitiveType_ = 0;
+    vertexShader_ = nullptr;
+    pixelShader_ = nullptr;
+    blendMode_ = BLEND_REPLACE;
+    alphaToCoverage_ = false;
+    colorWrite_ = true;
+    cullMode_ = CULL_CCW;
+    constantDepthBias_ = 0.0f;
+    slopeScaledDepthBias_ = 0.0f;
+    depthTestMode_ = CMP_LESSEQUAL;
+    depthWrite_ = true;
+    fillMode_ = FILL_SOLID;
+    lineAntiAlias_ = false;
+    scissorTest_ = false;
+    scissorRect_ = IntRect::ZERO;
+    stencilTest_ = false;
+    stencilTestMode_ = CMP_ALWAYS;
+    stencilPass_ = OP_KEEP;
+    stencilFail_ = OP_KEEP;
+    stencilZFail_ = OP_KEEP;
+    stencilRef_ = 0;
+    stencilCompareMask_ = M_MAX_UNSIGNED;
+    stencilWriteMask_ = M_MAX_UNSIGNED;
+    useClipPlane_ = false;
+    impl_->shaderProgram_ = nullptr;
+    impl_->model_ = Matrix3x4::IDENTITY;
+    impl_->viewProj_ = Matrix4::IDENTITY;
+    ClearParameterSources();
+}
+
+void Graphics::PrepareDraw()
+{
+    DepthRasterizer& rasterizer = impl_->depthRasterizer_;
+    if (!rasterizeDepth_)
+        return;
+
+    // Depth-only render target without depth-stencil is not rasterized
+    if (depthStencil_)
+    {
+        auto data = static_cast<ByteVector*>(depthStencil_->GetRenderTargetView());
+        const bool validData = data && data->size() >= depthStencil_->GetWidth() * depthStencil_->GetHeight() * sizeof(float);
+        rasterizer.SetTarget(validData ? reinterpret_cast<float*>(data->data()) : nullptr,
+            depthStencil_->GetWidth(), depthStencil_->GetHeight());
+    }
+    else if (renderTargets_[0])
+        rasterizer.SetTarget(nullptr, 0, 0);
+    else
+        rasterizer.SetTarget(impl_->defaultDepthBuffer_.data(), width_, height_);
+
+    DepthRasterizerState state;
+    state.viewport_ = viewport_;
+    state.scissorTest_ = scissorTest_;
+    state.scissorRect_ = scissorRect_;
+    state.depthTestMode_ = depthTestMode_;
+    state.depthWrite_ = depthWrite_;
+    state.cullMode_ = cullMode_;
+    state.depthBias_ = constantDepthBias_;
+    rasterizer.SetState(state);
+}
+
+void Graphics::RasterizeDepth(PrimitiveType type, bool indexed, unsigned drawStart, unsigned drawCount,
+    unsigned baseVertexIndex, unsigned instanceCount)
+{
+    DepthRasterizer& rasterizer = impl_->depthRasterizer_;
+    if (type != TRIANGLE_LIST || !rasterizer.GetTarget())
+        return;
+
+    // Find vertex positions and instance transforms. Skinned geometry is not supported
+    VertexBuffer* positionBuffer = nullptr;
+    VertexBuffer* instanceBuffer = nullptr;
+    unsigned instanceBufferIndex = 0;
+    for (unsigned i = 0; i < MAX_VERTEX_STREAMS; ++i)
+    {
+        VertexBuffer* buffer = vertexBuffers_[i];
+        if (!buffer || !buffer->GetGPUObject())
+            continue;
+
+        if (buffer->HasElement(SEM_BLENDWEIGHTS))
+            return;
+        if (!positionBuffer && buffer->HasElement(TYPE_VECTOR3, SEM_POSITION))
+            positionBuffer = buffer;
+        if (!instanceBuffer && buffer->HasElement(TYPE_VECTOR4, SEM_TEXCOORD, 4))
+        {
+            instanceBuffer = buffer;
+            instanceBufferIndex = i;
+        }
+    }
+
+    if (!positionBuffer || (indexed && (!indexBuffer_ || !indexBuffer_->GetGPUObject())))
+        return;
+    if (instanceCount > 0 && !instanceBuffer)
+        return;
+
+    const auto vertexData = static_cast<const ByteVector*>(positionBuffer->GetGPUObject());
+
+    DepthRasterizerBatch batch;
+    batch.vertexData_ = vertexData->data();
+    batch.vertexCount_ = positionBuffer->GetVertexCount();
+    batch.vertexSize_ = positionBuffer->GetVertexSize();
+    batch.positionOffset_ = positionBuffer->GetElementOffset(TYPE_VECTOR3, SEM_POSITION);
+    if (indexed)
+    {
+        batch.indexData_ = static_cast<const ByteVector*>(indexBuffer_->GetGPUObject())->data();
+        batch.indexDataCount_ = indexBuffer_->GetIndexCount();
+        batch.indexSize_ = indexBuffer_->GetIndexSize();
+    }
+    batch.drawStart_ = drawStart;
+    batch.drawCount_ = drawCount;
+    batch.baseVertexIndex_ = baseVertexIndex;
+
+    if (instanceCount == 0)
+    {
+        rasterizer.DrawTriangles(impl_->viewProj_ * impl_->model_, batch);
+        return;
+    }
+
+    const auto instanceData = static_cast<const ByteVector*>(instanceBuffer->GetGPUObject());
+    const unsigned instanceSize = instanceBuffer->GetVertexSize();
+    const unsigned transformOffset = instanceBuffer->GetElementOffset(TYPE_VECTOR4, SEM_TEXCOORD, 4);
+    const unsigned instanceStart = impl_->vertexOffsets_[instanceBufferIndex];
+    const unsigned instanceEnd = Min(instanceStart + instanceCount, instanceBuffer->GetVertexCount());
+    for (unsigned i = instanceStart; i < instanceEnd; ++i)
+    {
+        Matrix3x4 model;
+        memcpy(&model, instanceData->data() + i * instanceSize + transformOffset, sizeof(Matrix3x4));
+        rasterizer.DrawTriangles(impl_->viewProj_ * model, batch);
+    }
+}
+
+void Graphics::SetTextureUnitMappings()
+{
+    textureUnits_["DiffMap"] = TU_DIFFUSE;
+    textureUnits_["DiffCubeMap"] = TU_DIFFUSE;
+    textureUnits_["NormalMap"] = TU_NORMAL;
+    textureUnits_["SpecMap"] = TU_SPECULAR;
+    textureUnits_["EmissiveMap"] = TU_EMISSIVE;
+    textureUnits_["EnvMap"] = TU_ENVIRONMENT;
+    textureUnits_["EnvCubeMap"] = TU_ENVIRONMENT;
+    textureUnits_["LightRampMap"] = TU_LIGHTRAMP;
+    textureUnits_["LightSpotMap"] = TU_LIGHTSHAPE;
+    textureUnits_["LightCubeMap"] = TU_LIGHTSHAPE;
+    textureUnits_["ShadowMap"] = TU_SHADOWMAP;
+    textureUnits_["FaceSelectCubeMap"] = TU_FACESELECT;
+    textureUnits_["IndirectionCubeMap"] = TU_INDIRECTION;
+    textureUnits_["VolumeMap"] = TU_VOLUMEMAP;
+    textureUnits_["ZoneCubeMap"] = TU_ZONE;
+    textureUnits_["ZoneVolumeMap"] = TU_ZONE;
+}
+
+void Graphics::SetTextureForUpdate(Texture* texture)
+{
+}
+
+void Graphics::MarkFBODirty()
+{
+}
+
+void Graphics::SetVBO(unsigned object)
+{
+}
+
+void Graphics::SetUBO(unsigned object)
+{
+}
+
+}
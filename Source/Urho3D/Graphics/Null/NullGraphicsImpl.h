@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../../Container/ByteVector.h"
+#include "../../Graphics/DepthRasterizer.h"
+#include "../../Graphics/ShaderProgram.h"
+#include "../../Math/Matrix3x4.h"
+
+namespace Urho3D
+{
+
+/// Texture formats of Null graphics. Values define only the layout of texture data in CPU memory.
+/// Depth formats are stored as 32-bit floats regardless of precision.
+enum NullTextureFormat : unsigned
+{
+    NULL_FORMAT_NONE = 0,
+    NULL_FORMAT_A8,
+    NULL_FORMAT_R8,
+    NULL_FORMAT_RG8,
+    NULL_FORMAT_RGBA8,
+    NULL_FORMAT_RG16,
+    NULL_FORMAT_RGBA16,
+    NULL_FORMAT_R16F,
+    NULL_FORMAT_RG16F,
+    NULL_FORMAT_RGBA16F,
+    NULL_FORMAT_R32F,
+    NULL_FORMAT_RG32F,
+    NULL_FORMAT_RGBA32F,
+    NULL_FORMAT_D16,
+    NULL_FORMAT_D24S8,
+    NULL_FORMAT_D32,
+    NULL_FORMAT_BC1,
+    NULL_FORMAT_BC2,
+    NULL_FORMAT_BC3,
+};
+
+/// Texture data in CPU memory. Used as GPU object of textures on Null graphics.
+struct NullTextureData
+{
+    /// Construct with number of layers (array layers or cube faces) and mip levels.
+    NullTextureData(unsigned layers, unsigned levels)
+        : levels_(levels)
+        , subresources_(layers * levels)
+    {
+    }
+
+    /// Return data of mip level of layer.
+    ByteVector& GetSubresource(unsigned layer, unsigned level) { return subresources_[layer * levels_ + level]; }
+    const ByteVector& GetSubresource(unsigned layer, unsigned level) const { return subresources_[layer * levels_ + level]; }
+
+    /// Number of mip levels.
+    unsigned levels_{};
+    /// Data of subresources, ordered by layer and then by mip level.
+    ea::vector<ByteVector> subresources_;
+};
+
+using ShaderProgramMap = ea::unordered_map<ea::pair<ShaderVariation*, ShaderVariation*>, SharedPtr<ShaderProgram> >;
+
+/// %Graphics implementation. Holds CPU-side state of Null graphics.
+class URHO3D_API GraphicsImpl
+{
+    friend class Graphics;
+
+public:
+    /// Construct.
+    GraphicsImpl();
+
+    /// Return software depth rasterizer. Target and state are updated before each draw if depth rasterization is enabled.
+    DepthRasterizer& GetDepthRasterizer() { return depthRasterizer_; }
+    /// Return default depth buffer contents.
+    const ea::vector<float>& GetDefaultDepthBuffer() const { return defaultDepthBuffer_; }
+    /// Return model matrix of the last draw.
+    const Matrix3x4& GetModelMatrix() const { return model_; }
+    /// Return view-projection matrix of the last draw.
+    const Matrix4& GetViewProjMatrix() const { return viewProj_; }
+
+private:
+    /// Default depth buffer.
+    ea::vector<float> defaultDepthBuffer_;
+    /// Software depth rasterizer.
+    DepthRasterizer depthRasterizer_;
+    /// Model matrix from shader parameters.
+    Matrix3x4 model_;
+    /// View-projection matrix from shader parameters.
+    Matrix4 viewProj_;
+    /// Vertex offsets per buffer, in vertices.
+    unsigned vertexOffsets_[MAX_VERTEX_STREAMS]{};
+    /// Shader programs.
+    ShaderProgramMap shaderPrograms_;
+    /// Shader program in use.
+    ShaderProgram* shaderProgram_{};
+    /// Whether the screen mode is set.
+    bool initialized_{};
+};
+
+}
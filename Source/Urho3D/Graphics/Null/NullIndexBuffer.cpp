@@ -0,0 +1,245 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../../Precompiled.h"
+
+#include "../../Container/ByteVector.h"
+#include "../../Graphics/Graphics.h"
+#include "../../Graphics/GraphicsImpl.h"
+#include "../../Graphics/IndexBuffer.h"
+#include "../../IO/Log.h"
+
+#include "../../DebugNew.h"
+
+namespace Urho3D
+{
+
+void IndexBuffer::OnDeviceLost()
+{
+    // No-op on Null graphics
+}
+
+void IndexBuffer::OnDeviceReset()
+{
+    // No-op on Null graphics
+}
+
+void IndexBuffer::Release()
+{
+    Unlock();
+
+    if (graphics_ && graphics_->GetIndexBuffer() == this)
+        graphics_->SetIndexBuffer(nullptr);
+
+    delete static_cast<ByteVector*>(object_.ptr_);
+    object_.ptr_ = nullptr;
+}
+
+bool IndexBuffer::SetData(const void* data)
+{
+    if (!data)
+    {
+        URHO3D_LOGERROR("Null pointer for index buffer data");
+        return false;
+    }
+
+    if (!indexSize_)
+    {
+        URHO3D_LOGERROR("Index size not defined, can not set index buffer data");
+        return false;
+    }
+
+    if (shadowData_ && data != shadowData_.get())
+        memcpy(shadowData_.get(), data, indexCount_ * indexSize_);
+
+    if (object_.ptr_)
+    {
+        void* hwData = MapBuffer(0, indexCount_, true);
+        if (hwData)
+        {
+            memcpy(hwData, data, indexCount_ * indexSize_);
+            UnmapBuffer();
+        }
+        else
+            return false;
+    }
+
+    dataLost_ = false;
+    return true;
+}
+
+bool IndexBuffer::SetDataRange(const void* data, unsigned start, unsigned count, bool discard)
+{
+    if (start == 0 && count == indexCount_)
+        return SetData(data);
+
+    if (!data)
+    {
+        URHO3D_LOGERROR("Null pointer for index buffer data");
+        return false;
+    }
+
+    if (!indexSize_)
+    {
+        URHO3D_LOGERROR("Index size not defined, can not set index buffer data");
+        return false;
+    }
+
+    if (start + count > indexCount_)
+    {
+        URHO3D_LOGERROR("Illegal range for setting new index buffer data");
+        return false;
+    }
+
+    if (!count)
+        return true;
+
+    if (shadowData_ && shadowData_.get() + start * indexSize_ != data)
+        memcpy(shadowData_.get() + start * indexSize_, data, count * indexSize_);
+
+    if (object_.ptr_)
+    {
+        void* hwData = MapBuffer(start, count, discard);
+        if (hwData)
+        {
+            memcpy(hwData, data, count * indexSize_);
+            UnmapBuffer();
+        }
+        else
+            return false;
+    }
+
+    return true;
+}
+
+void* IndexBuffer::Lock(unsigned start, unsigned count, bool discard)
+{
+    if (lockState_ != LOCK_NONE)
+    {
+        URHO3D_LOGERROR("Index buffer already locked");
+        return nullptr;
+    }
+
+    if (!indexSize_)
+    {
+        URHO3D_LOGERROR("Index size not defined, can not lock index buffer");
+        return nullptr;
+    }
+
+    if (start + count > indexCount_)
+    {
+        URHO3D_LOGERROR("Illegal range for locking index buffer");
+        return nullptr;
+    }
+
+    if (!count)
+        return nullptr;
+
+    lockStart_ = start;
+    lockCount_ = count;
+
+    // Because shadow data must be kept in sync, can only lock hardware buffer if not shadowed
+    if (object_.ptr_ && !shadowData_)
+        return MapBuffer(start, count, discard);
+    else if (shadowData_)
+    {
+        lockState_ = LOCK_SHADOW;
+        return shadowData_.get() + start * indexSize_;
+    }
+    else if (graphics_)
+    {
+        lockState_ = LOCK_SCRATCH;
+        lockScratchData_ = graphics_->ReserveScratchBuffer(count * indexSize_);
+        return lockScratchData_;
+    }
+    else
+        return nullptr;
+}
+
+void IndexBuffer::Unlock()
+{
+    switch (lockState_)
+    {
+    case LOCK_HARDWARE:
+        UnmapBuffer();
+        break;
+
+    case LOCK_SHADOW:
+        SetDataRange(shadowData_.get() + lockStart_ * indexSize_, lockStart_, lockCount_);
+        lockState_ = LOCK_NONE;
+        break;
+
+    case LOCK_SCRATCH:
+        SetDataRange(lockScratchData_, lockStart_, lockCount_);
+        if (graphics_)
+            graphics_->FreeScratchBuffer(lockScratchData_);
+        lockScratchData_ = nullptr;
+        lockState_ = LOCK_NONE;
+        break;
+
+    default: break;
+    }
+}
+
+bool IndexBuffer::Create()
+{
+    Release();
+
+    if (!indexCount_)
+        return true;
+
+    // Keep hardware buffer contents in CPU memory, so they can be read back by software rasterization
+    if (graphics_)
+        object_.ptr_ = new ByteVector(indexCount_ * indexSize_);
+
+    return true;
+}
+
+bool IndexBuffer::UpdateToGPU()
+{
+    if (object_.ptr_ && shadowData_)
+        return SetData(shadowData_.get());
+    else
+        return false;
+}
+
+void* IndexBuffer::MapBuffer(unsigned start, unsigned count, bool discard)
+{
+    void* hwData = nullptr;
+
+    if (object_.ptr_)
+    {
+        auto data = static_cast<ByteVector*>(object_.ptr_);
+        hwData = data->data() + start * indexSize_;
+        lockState_ = LOCK_HARDWARE;
+    }
+
+    return hwData;
+}
+
+void IndexBuffer::UnmapBuffer()
+{
+    if (object_.ptr_ && lockState_ == LOCK_HARDWARE)
+        lockState_ = LOCK_NONE;
+}
+
+}
@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../../Precompiled.h"
+
+#include "../../Graphics/Graphics.h"
+#include "../../Graphics/GraphicsImpl.h"
+#include "../../Graphics/Shader.h"
+#include "../../Graphics/ShaderVariation.h"
+#include "../../IO/Log.h"
+
+#include "../../DebugNew.h"
+
+namespace Urho3D
+{
+
+const char* ShaderVariation::elementSemanticNames[] =
+{
+    "POSITION",
+    "NORMAL",
+    "BINORMAL",
+    "TANGENT",
+    "TEXCOORD",
+    "COLOR",
+    "BLENDWEIGHT",
+    "BLENDINDICES",
+    "OBJECTINDEX"
+};
+
+void ShaderVariation::OnDeviceLost()
+{
+    // No-op on Null graphics
+}
+
+bool ShaderVariation::Create()
+{
+    Release();
+
+    if (!graphics_)
+        return false;
+
+    if (!owner_)
+    {
+        compilerOutput_ = "Owner shader has expired";
+        return false;
+    }
+
+    if (owner_->GetSourceCode(type_).empty())
+    {
+        compilerOutput_ = "Shader source code is empty";
+        return false;
+    }
+
+    // Shaders are never executed, so every texture unit is considered used to keep texture binding on par with real backends
+    for (unsigned i = 0; i < MAX_TEXTURE_UNITS; ++i)
+        useTextureUnits_[i] = true;
+
+    // There is no API object, use non-null handle to mark the shader as created
+    object_.ptr_ = this;
+    return true;
+}
+
+void ShaderVariation::Release()
+{
+    if (object_.ptr_ && graphics_)
+    {
+        graphics_->CleanupShaderPrograms(this);
+
+        if (type_ == VS)
+        {
+            if (graphics_->GetVertexShader() == this)
+                graphics_->SetShaders(nullptr, nullptr);
+        }
+        else
+        {
+            if (graphics_->GetPixelShader() == this)
+                graphics_->SetShaders(nullptr, nullptr);
+        }
+    }
+
+    object_.ptr_ = nullptr;
+
+    compilerOutput_.clear();
+
+    for (unsigned i = 0; i < MAX_TEXTURE_UNITS; ++i)
+        useTextureUnits_[i] = false;
+    parameters_.clear();
+}
+
+void ShaderVariation::SetDefines(const ea::string& defines)
+{
+    defines_ = defines;
+}
+
+bool ShaderVariation::LoadByteCode(const ea::string& binaryShaderName) { return false; }
+bool ShaderVariation::Compile() { return false; }
+void ShaderVariation::ParseParameters(unsigned char* bufData, unsigned bufSize) {}
+void ShaderVariation::SaveByteCode(const ea::string& binaryShaderName) {}
+void ShaderVariation::CalculateConstantBufferSizes() {}
+
+}
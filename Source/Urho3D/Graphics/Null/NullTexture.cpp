@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../../Precompiled.h"
+
+#include "../../Graphics/Graphics.h"
+#include "../../Graphics/GraphicsImpl.h"
+#include "../../Graphics/Texture.h"
+#include "../../IO/Log.h"
+
+#include "../../DebugNew.h"
+
+namespace Urho3D
+{
+
+void Texture::SetSRGB(bool enable)
+{
+    if (graphics_)
+        enable &= graphics_->GetSRGBSupport();
+
+    // Texture data layout doesn't depend on sRGB mode, no need to recreate
+    sRGB_ = enable;
+}
+
+bool Texture::GetParametersDirty() const
+{
+    return parametersDirty_;
+}
+
+bool Texture::IsCompressed() const
+{
+    return format_ == NULL_FORMAT_BC1 || format_ == NULL_FORMAT_BC2 || format_ == NULL_FORMAT_BC3;
+}
+
+unsigned Texture::GetRowDataSize(int width) const
+{
+    switch (format_)
+    {
+    case NULL_FORMAT_A8:
+    case NULL_FORMAT_R8:
+        return (unsigned)width;
+
+    case NULL_FORMAT_RG8:
+    case NULL_FORMAT_R16F:
+        return (unsigned)(width * 2);
+
+    case NULL_FORMAT_RGBA8:
+    case NULL_FORMAT_RG16:
+    case NULL_FORMAT_RG16F:
+    case NULL_FORMAT_R32F:
+    case NULL_FORMAT_D16:
+    case NULL_FORMAT_D24S8:
+    case NULL_FORMAT_D32:
+        return (unsigned)(width * 4);
+
+    case NULL_FORMAT_RGBA16:
+    case NULL_FORMAT_RGBA16F:
+    case NULL_FORMAT_RG32F:
+        return (unsigned)(width * 8);
+
+    case NULL_FORMAT_RGBA32F:
+        return (unsigned)(width * 16);
+
+    case NULL_FORMAT_BC1:
+        return (unsigned)(((width + 3) >> 2) * 8);
+
+    case NULL_FORMAT_BC2:
+    case NULL_FORMAT_BC3:
+        return (unsigned)(((width + 3) >> 2) * 16);
+
+    default:
+        return 0;
+    }
+}
+
+void Texture::UpdateParameters()
+{
+    // There are no sampler objects on Null graphics
+    parametersDirty_ = false;
+}
+
+unsigned Texture::GetSRVFormat(unsigned format)
+{
+    return format;
+}
+
+unsigned Texture::GetDSVFormat(unsigned format)
+{
+    return format;
+}
+
+unsigned Texture::GetSRGBFormat(unsigned format)
+{
+    return format;
+}
+
+void Texture::RegenerateLevels()
+{
+    // Mip levels are not generated on Null graphics, contents of rendertargets are undefined anyway
+    levelsDirty_ = false;
+}
+
+unsigned Texture::GetExternalFormat(unsigned format)
+{
+    return 0;
+}
+
+unsigned Texture::GetDataType(unsigned format)
+{
+    return 0;
+}
+
+}
@@ -57,6 +57,9 @@ static ea::vector<Drawable*> unusedDrawablesVector;
 
 static const float DEFAULT_OCTREE_SIZE = 1000.0f;
 static const int DEFAULT_OCTREE_LEVELS = 8;
+static const unsigned MIN_ZONES_FOR_GRID = 16;
+static const unsigned ZONE_GRID_CELLS_PER_ZONE = 4;
+static const int MAX_ZONE_GRID_SIZE = 32;
 
 extern const char* SUBSYSTEM_CATEGORY;
 
@@ -282,6 +285,52 @@ void Octant::GetDrawablesInternal(OctreeQuery& query, bool inside) const
     }
 }
 
+void Octant::GetDrawablesInternal(ea::span<OctreeQuery* const> queries, unsigned activeMask, unsigned insideMask) const
+{
+    if (this != octree_->GetRootOctant())
+    {
+        // Test octant only against queries that don't contain it yet
+        const unsigned testMask = activeMask & ~insideMask;
+        for (unsigned index = 0; index < queries.size(); ++index)
+        {
+            const unsigned bit = 1u << index;
+            if (!(testMask & bit))
+                continue;
+
+            const Intersection res = queries[index]->TestOctant(cullingBox_, false);
+            if (res == INSIDE)
+                insideMask |= bit;
+            else if (res == OUTSIDE)
+                activeMask &= ~bit;
+        }
+
+        // Fully outside of all queries, so cull this octant, its children & drawables
+        if (!activeMask)
+            return;
+    }
+
+    if (drawables_.size())
+    {
+        auto** start = const_cast<Drawable**>(&drawables_[0]);
+        Drawable** end = start + drawables_.size();
+
+        for (unsigned index = 0; index < queries.size(); ++index)
+        {
+            const unsigned bit = 1u << index;
+            if (!(activeMask & bit))
+                continue;
+
+            queries[index]->TestDrawables(start, end, !!(insideMask & bit));
+        }
+    }
+
+    for (auto child : children_)
+    {
+        if (child)
+            child->GetDrawablesInternal(queries, activeMask, insideMask);
+    }
+}
+
 void Octant::GetDrawablesInternal(RayOctreeQuery& query) const
 {
     float octantDist = query.ray_.HitDistance(cullingBox_);
@@ -360,6 +409,7 @@ void ZoneLookupIndex::RemoveZone(Zone* zone)
     const unsigned index = zones_.index_of(zone);
     assert(index < zones_.size());
     zones_.erase_at(index);
+    zonesDirty_ = true;
 }
 
 void ZoneLookupIndex::Commit()
@@ -382,6 +432,8 @@ void ZoneLookupIndex::Commit()
             data.boundingBox_ = zone->GetBoundingBox();
             data.inverseWorldTransform_ = zone->GetInverseWorldTransform();
         }
+
+        UpdateGrid();
     }
 
     for (Zone* zone : zones_)
@@ -396,12 +448,11 @@ CachedDrawableZone ZoneLookupIndex::QueryZone(const Vector3& position, unsigned
     float distanceToBestZone = M_LARGE_VALUE;
     Zone* bestZone = nullptr;
 
-    const unsigned numZones = zones_.size();
-    for (unsigned i = 0; i < numZones; ++i)
+    const auto processZone = [&](unsigned i)
     {
         const ZoneData& data = zonesData_[i];
         if ((data.zoneMask_ & zoneMask) == 0)
-            continue;
+            return;
 
         const Vector3 localPosition = data.inverseWorldTransform_ * position;
         const float signedDistance = data.boundingBox_.SignedDistanceToPoint(localPosition);
@@ -417,12 +468,113 @@ CachedDrawableZone ZoneLookupIndex::QueryZone(const Vector3& position, unsigned
             bestZone = zones_[i];
             distanceToBestZone = -signedDistance;
         }
+    };
+
+    if (gridCellOffsets_.empty())
+    {
+        const unsigned numZones = zones_.size();
+        for (unsigned i = 0; i < numZones; ++i)
+            processZone(i);
+    }
+    else
+    {
+        // Zones outside of the cell are at least as far as cell border
+        IntVector3 cell;
+        if (GetGridCell(position, cell))
+        {
+            const unsigned cellIndex = GetGridCellIndex(cell);
+            for (unsigned i = gridCellOffsets_[cellIndex]; i < gridCellOffsets_[cellIndex + 1]; ++i)
+                processZone(gridCellZones_[i]);
+
+            const Vector3 cellMin = gridBoundingBox_.min_ + Vector3(cell) * gridCellSize_;
+            const Vector3 cellMax = cellMin + gridCellSize_;
+            const Vector3 distanceToMin = position - cellMin;
+            const Vector3 distanceToMax = cellMax - position;
+            minDistanceToOtherZone = ea::min({ minDistanceToOtherZone,
+                distanceToMin.x_, distanceToMin.y_, distanceToMin.z_,
+                distanceToMax.x_, distanceToMax.y_, distanceToMax.z_ });
+        }
+        else
+            minDistanceToOtherZone = gridBoundingBox_.SignedDistanceToPoint(position);
     }
 
-    const float cacheInvalidationDistance = ea::min(minDistanceToOtherZone, distanceToBestZone);
+    const float cacheInvalidationDistance = ea::max(0.0f, ea::min(minDistanceToOtherZone, distanceToBestZone));
     return { bestZone ? bestZone : defaultZone_, position, cacheInvalidationDistance * cacheInvalidationDistance };
 }
 
+void ZoneLookupIndex::UpdateGrid()
+{
+    gridCellOffsets_.clear();
+    gridCellZones_.clear();
+
+    const unsigned numZones = zones_.size();
+    if (numZones < MIN_ZONES_FOR_GRID)
+        return;
+
+    // Calculate world bounding boxes of zones
+    ea::vector<BoundingBox> zoneBoxes(numZones);
+    gridBoundingBox_.Clear();
+    for (unsigned i = 0; i < numZones; ++i)
+    {
+        const ZoneData& data = zonesData_[i];
+        zoneBoxes[i] = data.boundingBox_.Transformed(data.inverseWorldTransform_.Inverse());
+        gridBoundingBox_.Merge(zoneBoxes[i]);
+    }
+
+    // Pick roughly cubic cells, several cells per zone
+    const Vector3 gridExtent = gridBoundingBox_.Size();
+    const float maxExtent = ea::max({ gridExtent.x_, gridExtent.y_, gridExtent.z_ });
+    if (!std::isfinite(maxExtent) || maxExtent <= M_EPSILON)
+        return;
+
+    const float volume = gridExtent.x_ * gridExtent.y_ * gridExtent.z_;
+    const float numTargetCells = static_cast<float>(numZones * ZONE_GRID_CELLS_PER_ZONE);
+    const float cellEdge = ea::max(std::cbrt(volume / numTargetCells), maxExtent / MAX_ZONE_GRID_SIZE);
+    const auto getGridSize = [&](float extent) { return Clamp(CeilToInt(extent / cellEdge), 1, MAX_ZONE_GRID_SIZE); };
+    gridSize_ = { getGridSize(gridExtent.x_), getGridSize(gridExtent.y_), getGridSize(gridExtent.z_) };
+    gridCellSize_ = VectorMax(gridExtent / Vector3(gridSize_), Vector3::ONE * M_EPSILON);
+
+    // Count zones in each cell and then fill cells. Zones are added in order of priority.
+    const unsigned numCells = static_cast<unsigned>(gridSize_.x_ * gridSize_.y_ * gridSize_.z_);
+    const auto forEachCell = [&](const BoundingBox& box, const auto& callback)
+    {
+        IntVector3 beginCell = VectorFloorToInt((box.min_ - gridBoundingBox_.min_) / gridCellSize_);
+        IntVector3 endCell = VectorFloorToInt((box.max_ - gridBoundingBox_.min_) / gridCellSize_);
+        beginCell = VectorMax(beginCell, IntVector3::ZERO);
+        endCell = VectorMin(endCell, gridSize_ - IntVector3::ONE);
+        for (int z = beginCell.z_; z <= endCell.z_; ++z)
+        {
+            for (int y = beginCell.y_; y <= endCell.y_; ++y)
+            {
+                for (int x = beginCell.x_; x <= endCell.x_; ++x)
+                    callback(GetGridCellIndex({ x, y, z }));
+            }
+        }
+    };
+
+    gridCellOffsets_.assign(numCells + 1, 0u);
+    for (unsigned i = 0; i < numZones; ++i)
+        forEachCell(zoneBoxes[i], [&](unsigned cellIndex) { ++gridCellOffsets_[cellIndex + 1]; });
+
+    for (unsigned cellIndex = 0; cellIndex < numCells; ++cellIndex)
+        gridCellOffsets_[cellIndex + 1] += gridCellOffsets_[cellIndex];
+
+    ea::vector<unsigned> cellFill(gridCellOffsets_.begin(), gridCellOffsets_.end() - 1);
+    gridCellZones_.resize(gridCellOffsets_.back());
+    for (unsigned i = 0; i < numZones; ++i)
+        forEachCell(zoneBoxes[i], [&](unsigned cellIndex) { gridCellZones_[cellFill[cellIndex]++] = i; });
+}
+
+bool ZoneLookupIndex::GetGridCell(const Vector3& position, IntVector3& cell) const
+{
+    if (gridBoundingBox_.IsInside(position) == OUTSIDE)
+        return false;
+
+    cell = VectorFloorToInt((position - gridBoundingBox_.min_) / gridCellSize_);
+    cell = VectorMin(VectorMax(cell, IntVector3::ZERO), gridSize_ - IntVector3::ONE);
+    return true;
+}
+
 Zone* ZoneLookupIndex::GetBackgroundZone() const
 {
     return !zones_.empty() && zones_.back()->GetPriority() <= 0 ? zones_.back() : defaultZone_;
@@ -566,6 +718,7 @@ void Octree::Update(const FrameInfo& frame)
         {
             Drawable* drawable = *i;
             drawable->updateQueued_ = false;
+            drawable->updateFrameNumber_ = frame.frameNumber_;
             Octant* octant = drawable->GetOctant();
             const BoundingBox& box = drawable->GetWorldBoundingBox();
 
@@ -687,6 +840,19 @@ void Octree::GetDrawables(OctreeQuery& query) const
     rootOctant_.GetDrawablesInternal(query, false);
 }
 
+void Octree::GetDrawables(ea::span<OctreeQuery* const> queries) const
+{
+    for (OctreeQuery* query : queries)
+        query->result_.clear();
+
+    for (unsigned offset = 0; offset < queries.size(); offset += MaxBatchedQueries)
+    {
+        const unsigned numQueries = ea::min<unsigned>(queries.size() - offset, MaxBatchedQueries);
+        const unsigned activeMask = numQueries < MaxBatchedQueries ? (1u << numQueries) - 1 : M_MAX_UNSIGNED;
+        rootOctant_.GetDrawablesInternal(queries.subspan(offset, numQueries), activeMask, 0);
+    }
+}
+
 void Octree::Raycast(RayOctreeQuery& query) const
 {
     URHO3D_PROFILE("Raycast");
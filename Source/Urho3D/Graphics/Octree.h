@@ -26,6 +26,8 @@
 #include "../Graphics/Drawable.h"
 #include "../Graphics/OctreeQuery.h"
 
+#include <EASTL/span.h>
+
 namespace Urho3D
 {
 
@@ -107,6 +109,9 @@ public:
 
     /// Return drawable objects by a query, called internally.
     void GetDrawablesInternal(OctreeQuery& query, bool inside) const;
+    /// Return drawable objects by multiple queries at once, called internally.
+    /// Each bit of masks corresponds to query: whether query may intersect the octant and whether octant is inside query.
+    void GetDrawablesInternal(ea::span<OctreeQuery* const> queries, unsigned activeMask, unsigned insideMask) const;
     /// Return drawable objects by a ray query, called internally.
     void GetDrawablesInternal(RayOctreeQuery& query) const;
     /// Return drawable objects only for a threaded ray query, called internally.
@@ -185,7 +190,20 @@ public:
     /// Return background zone.
     Zone* GetBackgroundZone() const;
 
+    /// Return number of cells in zone grid. 0 if zones are scanned linearly.
+    unsigned GetNumGridCells() const { return gridCellOffsets_.empty() ? 0 : gridCellOffsets_.size() - 1; }
+
 private:
+    /// Rebuild grid of zones. Zones are sorted and cached data is up to date.
+    void UpdateGrid();
+    /// Return grid cell containing position. Return false if position is outside of the grid.
+    bool GetGridCell(const Vector3& position, IntVector3& cell) const;
+    /// Return index of grid cell.
+    unsigned GetGridCellIndex(const IntVector3& cell) const
+    {
+        return static_cast<unsigned>((cell.z_ * gridSize_.y_ + cell.y_) * gridSize_.x_ + cell.x_);
+    }
+
     /// Cached zone parameters.
     struct ZoneData
     {
@@ -205,6 +223,16 @@ private:
     ea::vector<ZoneData> zonesData_;
     /// Whether zones are dirty.
     bool zonesDirty_{};
+
+    /// Uniform grid of zones, used if there are many zones.
+    /// Each cell contains sorted indices of zones overlapping it.
+    /// @{
+    BoundingBox gridBoundingBox_;
+    IntVector3 gridSize_;
+    Vector3 gridCellSize_;
+    ea::vector<unsigned> gridCellOffsets_;
+    ea::vector<unsigned> gridCellZones_;
+    /// @}
 };
 
 /// %Octree component. Should be added only to the root scene node.
@@ -213,6 +241,9 @@ class URHO3D_API Octree : public Component
     URHO3D_OBJECT(Octree, Component);
 
 public:
+    /// Max number of queries processed by single octree traversal.
+    static const unsigned MaxBatchedQueries = 32;
+
     /// Construct.
     explicit Octree(Context* context);
     /// Destruct.
@@ -243,6 +274,9 @@ public:
     /// Return drawable objects by a query.
     /// @nobind
     void GetDrawables(OctreeQuery& query) const;
+    /// Return drawable objects by multiple queries. Queries are batched so octree is traversed once per MaxBatchedQueries.
+    /// @nobind
+    void GetDrawables(ea::span<OctreeQuery* const> queries) const;
     /// Return drawable objects by a ray query.
     void Raycast(RayOctreeQuery& query) const;
     /// Return the closest drawable object by a ray query.
@@ -253,6 +287,8 @@ public:
     CachedDrawableZone QueryZone(const Vector3& drawablePosition, unsigned zoneMask) const;
     /// Return background zone (arbitrary zone with 0 priority or lower). Zones with positive priority are ignored.
     Zone* GetBackgroundZone() const;
+    /// Return zone lookup index.
+    const ZoneLookupIndex& GetZoneLookupIndex() const { return zones_; }
 
     /// Return root octant.
     const Octant* GetRootOctant() const { return &rootOctant_; }
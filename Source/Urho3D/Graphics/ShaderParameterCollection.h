@@ -24,6 +24,7 @@
 
 #include "../Graphics/Graphics.h"
 
+#include <EASTL/algorithm.h>
 #include <EASTL/span.h>
 #include <EASTL/vector.h>
 
@@ -173,6 +174,41 @@ public:
     /// Return size.
     unsigned Size() const { return count_; }
 
+    /// Append all parameters from another collection. Indices of appended parameters are shifted by current size.
+    void Append(const ShaderParameterCollection& other)
+    {
+        if (other.count_ == 0)
+            return;
+
+        // Resize data buffer
+        const unsigned dataSize = data_.size();
+        if (offset_ + other.offset_ > dataSize)
+            data_.resize(ea::max(dataSize * 2, offset_ + other.offset_));
+
+        // Resize metadata buffers
+        const unsigned metadataSize = names_.size();
+        if (count_ + other.count_ > metadataSize)
+        {
+            const unsigned newMetadataSize = ea::max(metadataSize * 2, count_ + other.count_);
+            names_.resize(newMetadataSize);
+            dataOffsets_.resize(newMetadataSize);
+            dataSizes_.resize(newMetadataSize);
+            dataTypes_.resize(newMetadataSize);
+        }
+
+        // Copy metadata and data
+        ea::copy_n(other.names_.begin(), other.count_, names_.begin() + count_);
+        ea::copy_n(other.dataSizes_.begin(), other.count_, dataSizes_.begin() + count_);
+        ea::copy_n(other.dataTypes_.begin(), other.count_, dataTypes_.begin() + count_);
+        for (unsigned i = 0; i < other.count_; ++i)
+            dataOffsets_[count_ + i] = other.dataOffsets_[i] + offset_;
+
+        memcpy(&data_[offset_], other.data_.data(), other.offset_);
+
+        offset_ += other.offset_;
+        count_ += other.count_;
+    }
+
     /// Iterate subset.
     template <class T>
     void ForEach(unsigned from, unsigned to, const T& callback) const
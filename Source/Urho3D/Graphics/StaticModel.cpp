@@ -101,7 +101,7 @@ void StaticModel::ProcessRayQuery(const RayOctreeQuery& query, ea::vector<RayQue
 
             for (unsigned i = 0; i < batches_.size(); ++i)
             {
-                Geometry* geometry = batches_[i].geometry_;
+                Geometry* geometry = GetLodGeometry(i, M_MAX_UNSIGNED);
                 if (geometry)
                 {
                     Vector3 geometryNormal;
@@ -180,7 +180,7 @@ unsigned StaticModel::GetNumOccluderTriangles()
             continue;
 
         // Check that the material is suitable for occlusion (default material always is)
-        Material* mat = batches_[i].material_;
+        Material* mat = GetMaterial(i);
         if (mat && !mat->GetOcclusion())
             continue;
 
@@ -199,7 +199,7 @@ bool StaticModel::DrawOcclusion(OcclusionBuffer* buffer)
             continue;
 
         // Check that the material is suitable for occlusion (default material always is) and set culling mode
-        Material* material = batches_[i].material_;
+        Material* material = GetMaterial(i);
         if (material)
         {
             if (!material->GetOcclusion())
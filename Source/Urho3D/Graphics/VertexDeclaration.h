@@ -26,6 +26,8 @@
 //#error OpenGL Graphics API does not have VertexDeclaration class, remove this header file in your build to fix this error
 #elif defined(URHO3D_D3D11)
 #include "Direct3D11/D3D11VertexDeclaration.h"
+#elif defined(URHO3D_NULL_GRAPHICS)
+//#error Null Graphics API does not have VertexDeclaration class, remove this header file in your build to fix this error
 #else
 #include "Direct3D9/D3D9VertexDeclaration.h"
 #endif
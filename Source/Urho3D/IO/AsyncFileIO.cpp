@@ -0,0 +1,571 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../IO/AsyncFileIO.h"
+#include "../IO/File.h"
+#include "../IO/Log.h"
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef URHO3D_THREADING
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && !defined(__ANDROID__) && defined(URHO3D_THREADING) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#define URHO3D_IO_URING
+#endif
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+/// Read request in flight.
+struct AsyncReadRequest
+{
+    /// Request identifier.
+    unsigned id_{};
+    /// File to read from. Keeps the OS handle open.
+    SharedPtr<File> file_;
+#ifdef _WIN32
+    /// OS file handle.
+    HANDLE handle_{};
+#else
+    /// OS file descriptor.
+    int fd_{ -1 };
+#endif
+    /// Offset of the range within the OS file.
+    unsigned long long offset_{};
+    /// Destination buffer.
+    unsigned char* dest_{};
+    /// Size of the range.
+    unsigned size_{};
+    /// Number of bytes read so far.
+    unsigned bytesRead_{};
+    /// Whether the range was truncated by the end of file.
+    bool truncated_{};
+    /// Result of the last read: number of bytes read or negated error code.
+    int result_{};
+#ifdef URHO3D_IO_URING
+    /// Destination of the read submitted to io_uring.
+    iovec iovec_{};
+#endif
+};
+
+/// Interface of the asynchronous read backend.
+class AsyncFileIOImpl
+{
+public:
+    /// Destruct.
+    virtual ~AsyncFileIOImpl() = default;
+    /// Start reading remaining part of the request. Return false if no more reads can be started now.
+    virtual bool Submit(AsyncReadRequest* request) = 0;
+    /// Flush started reads to the OS.
+    virtual void Flush() {}
+    /// Collect requests whose read is finished. Optionally wait for at least one if any reads are in flight.
+    virtual void Reap(bool wait, ea::vector<AsyncReadRequest*>& completed) = 0;
+};
+
+namespace
+{
+
+/// Max number of bytes read by single OS call, so that the result fits into int.
+const unsigned maxReadSize = 1u << 30u;
+/// Max number of I/O threads of thread pool backend.
+const unsigned maxIOThreads = 4;
+
+/// Perform blocking read of remaining part of the request. Return number of bytes read or negated error code.
+int ReadBlocking(const AsyncReadRequest& request)
+{
+    unsigned char* dest = request.dest_ + request.bytesRead_;
+    const unsigned size = Min(request.size_ - request.bytesRead_, maxReadSize);
+    const unsigned long long offset = request.offset_ + request.bytesRead_;
+
+#ifdef _WIN32
+    OVERLAPPED overlapped{};
+    overlapped.Offset = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32u);
+    DWORD bytesRead = 0;
+    if (!ReadFile(request.handle_, dest, size, &bytesRead, &overlapped))
+        return GetLastError() == ERROR_HANDLE_EOF ? 0 : -EIO;
+    return static_cast<int>(bytesRead);
+#else
+    const ssize_t bytesRead = pread(request.fd_, dest, size, static_cast<off_t>(offset));
+    return bytesRead >= 0 ? static_cast<int>(bytesRead) : -errno;
+#endif
+}
+
+/// Backend that reads on submission.
+class SynchronousImpl : public AsyncFileIOImpl
+{
+public:
+    bool Submit(AsyncReadRequest* request) override
+    {
+        request->result_ = ReadBlocking(*request);
+        completed_.push_back(request);
+        return true;
+    }
+
+    void Reap(bool wait, ea::vector<AsyncReadRequest*>& completed) override
+    {
+        completed.insert(completed.end(), completed_.begin(), completed_.end());
+        completed_.clear();
+    }
+
+private:
+    /// Completed requests.
+    ea::vector<AsyncReadRequest*> completed_;
+};
+
+#ifdef URHO3D_THREADING
+/// Backend that performs blocking reads on pool of threads.
+class ThreadPoolImpl : public AsyncFileIOImpl
+{
+public:
+    explicit ThreadPoolImpl(unsigned numThreads)
+    {
+        for (unsigned i = 0; i < numThreads; ++i)
+            threads_.emplace_back([this] { ProcessRequests(); });
+    }
+
+    ~ThreadPoolImpl() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            shouldRun_ = false;
+        }
+        submittedCondition_.notify_all();
+        for (std::thread& thread : threads_)
+            thread.join();
+    }
+
+    bool Submit(AsyncReadRequest* request) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            submitted_.push_back(request);
+            ++numInFlight_;
+        }
+        submittedCondition_.notify_one();
+        return true;
+    }
+
+    void Reap(bool wait, ea::vector<AsyncReadRequest*>& completed) override
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (wait)
+            completedCondition_.wait(lock, [this] { return !completed_.empty() || numInFlight_ == 0; });
+
+        numInFlight_ -= completed_.size();
+        completed.insert(completed.end(), completed_.begin(), completed_.end());
+        completed_.clear();
+    }
+
+private:
+    /// Read submitted requests until stopped and no requests are left.
+    void ProcessRequests()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;)
+        {
+            submittedCondition_.wait(lock, [this] { return !shouldRun_ || !submitted_.empty(); });
+            if (submitted_.empty())
+                return;
+
+            AsyncReadRequest* request = submitted_.front();
+            submitted_.pop_front();
+
+            lock.unlock();
+            request->result_ = ReadBlocking(*request);
+            lock.lock();
+
+            completed_.push_back(request);
+            completedCondition_.notify_one();
+        }
+    }
+
+    /// I/O threads.
+    ea::vector<std::thread> threads_;
+    /// Mutex for the queues.
+    std::mutex mutex_;
+    /// Condition signaled when a request is submitted or the threads should stop.
+    std::condition_variable submittedCondition_;
+    /// Condition signaled when a request is completed.
+    std::condition_variable completedCondition_;
+    /// Requests waiting for I/O thread.
+    ea::deque<AsyncReadRequest*> submitted_;
+    /// Completed requests.
+    ea::vector<AsyncReadRequest*> completed_;
+    /// Number of submitted requests that are not reaped yet.
+    unsigned numInFlight_{};
+    /// Whether the threads should keep running.
+    bool shouldRun_{ true };
+};
+#endif
+
+#ifdef URHO3D_IO_URING
+/// Backend that submits reads to io_uring. Rings are shared with the kernel, so no syscall is needed per completion.
+class IOUringImpl : public AsyncFileIOImpl
+{
+public:
+    ~IOUringImpl() override
+    {
+        if (sqes_)
+            munmap(sqes_, sqesSize_);
+        if (cqRing_ && cqRing_ != sqRing_)
+            munmap(cqRing_, cqRingSize_);
+        if (sqRing_)
+            munmap(sqRing_, sqRingSize_);
+        if (ringFd_ >= 0)
+            close(ringFd_);
+    }
+
+    /// Create and map the rings. Return false if io_uring is not supported by the kernel or not permitted.
+    bool Initialize(unsigned queueDepth)
+    {
+        io_uring_params params{};
+        ringFd_ = static_cast<int>(syscall(__NR_io_uring_setup, queueDepth, &params));
+        if (ringFd_ < 0)
+            return false;
+
+        sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMapping)
+            sqRingSize_ = cqRingSize_ = Max(sqRingSize_, cqRingSize_);
+
+        sqRing_ = MapRing(sqRingSize_, IORING_OFF_SQ_RING);
+        cqRing_ = singleMapping ? sqRing_ : MapRing(cqRingSize_, IORING_OFF_CQ_RING);
+        sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(MapRing(sqesSize_, IORING_OFF_SQES));
+        if (!sqRing_ || !cqRing_ || !sqes_)
+            return false;
+
+        auto sqRing = static_cast<unsigned char*>(sqRing_);
+        sqTail_ = reinterpret_cast<unsigned*>(sqRing + params.sq_off.tail);
+        sqMask_ = *reinterpret_cast<unsigned*>(sqRing + params.sq_off.ring_mask);
+        sqArray_ = reinterpret_cast<unsigned*>(sqRing + params.sq_off.array);
+        sqEntries_ = params.sq_entries;
+
+        auto cqRing = static_cast<unsigned char*>(cqRing_);
+        cqHead_ = reinterpret_cast<unsigned*>(cqRing + params.cq_off.head);
+        cqTail_ = reinterpret_cast<unsigned*>(cqRing + params.cq_off.tail);
+        cqMask_ = *reinterpret_cast<unsigned*>(cqRing + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cqRing + params.cq_off.cqes);
+        return true;
+    }
+
+    bool Submit(AsyncReadRequest* request) override
+    {
+        // Completion queue is twice as large as submission queue, so it can't overflow
+        if (numInFlight_ >= sqEntries_)
+            return false;
+
+        request->iovec_.iov_base = request->dest_ + request->bytesRead_;
+        request->iovec_.iov_len = Min(request->size_ - request->bytesRead_, maxReadSize);
+
+        const unsigned tail = *sqTail_;
+        const unsigned index = tail & sqMask_;
+        io_uring_sqe& sqe = sqes_[index];
+        memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_READV;
+        sqe.fd = request->fd_;
+        sqe.off = request->offset_ + request->bytesRead_;
+        sqe.addr = reinterpret_cast<uintptr_t>(&request->iovec_);
+        sqe.len = 1;
+        sqe.user_data = reinterpret_cast<uintptr_t>(request);
+        sqArray_[index] = index;
+        __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+
+        ++numToSubmit_;
+        ++numInFlight_;
+        return true;
+    }
+
+    void Flush() override
+    {
+        while (numToSubmit_ > 0)
+        {
+            if (!Enter(0, 0))
+                break;
+        }
+    }
+
+    void Reap(bool wait, ea::vector<AsyncReadRequest*>& completed) override
+    {
+        for (;;)
+        {
+            unsigned head = *cqHead_;
+            const unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+            const bool hasCompleted = head != tail;
+            for (; head != tail; ++head)
+            {
+                const io_uring_cqe& cqe = cqes_[head & cqMask_];
+                auto request = reinterpret_cast<AsyncReadRequest*>(static_cast<uintptr_t>(cqe.user_data));
+                request->result_ = cqe.res;
+                completed.push_back(request);
+                --numInFlight_;
+            }
+            __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+
+            if (!wait || hasCompleted || numInFlight_ == 0)
+                break;
+            if (!Enter(1, IORING_ENTER_GETEVENTS))
+                break;
+        }
+    }
+
+private:
+    /// Map part of the ring. Return null on failure.
+    void* MapRing(size_t size, unsigned long long offset)
+    {
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd_, offset);
+        return data != MAP_FAILED ? data : nullptr;
+    }
+
+    /// Submit pending entries and optionally wait for completions. Return false on unrecoverable error.
+    bool Enter(unsigned minComplete, unsigned flags)
+    {
+        const long result = syscall(__NR_io_uring_enter, ringFd_, numToSubmit_, minComplete, flags, nullptr, 0);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                return true;
+            URHO3D_LOGERROR("Failed to submit asynchronous reads: {}", strerror(errno));
+            return false;
+        }
+
+        numToSubmit_ -= static_cast<unsigned>(result);
+        return true;
+    }
+
+    /// Ring file descriptor.
+    int ringFd_{ -1 };
+    /// Submission queue ring.
+    void* sqRing_{};
+    /// Size of submission queue ring.
+    size_t sqRingSize_{};
+    /// Completion queue ring. May be the same mapping as submission queue ring.
+    void* cqRing_{};
+    /// Size of completion queue ring.
+    size_t cqRingSize_{};
+    /// Submission queue entries.
+    io_uring_sqe* sqes_{};
+    /// Size of submission queue entries.
+    size_t sqesSize_{};
+
+    /// Submission queue tail, written by the application.
+    unsigned* sqTail_{};
+    /// Submission queue index mask.
+    unsigned sqMask_{};
+    /// Submission queue index array.
+    unsigned* sqArray_{};
+    /// Number of submission queue entries.
+    unsigned sqEntries_{};
+    /// Completion queue head, written by the application.
+    unsigned* cqHead_{};
+    /// Completion queue tail, written by the kernel.
+    unsigned* cqTail_{};
+    /// Completion queue index mask.
+    unsigned cqMask_{};
+    /// Completion queue entries.
+    io_uring_cqe* cqes_{};
+
+    /// Number of entries not yet submitted to the kernel.
+    unsigned numToSubmit_{};
+    /// Number of entries not yet reaped.
+    unsigned numInFlight_{};
+};
+#endif
+
+}
+
+AsyncFileIO::AsyncFileIO(unsigned maxReadsInFlight, bool allowIOUring)
+{
+    maxReadsInFlight = Max(maxReadsInFlight, 1u);
+
+#ifdef URHO3D_IO_URING
+    if (allowIOUring)
+    {
+        auto impl = ea::make_unique<IOUringImpl>();
+        if (impl->Initialize(maxReadsInFlight))
+        {
+            impl_ = ea::move(impl);
+            backend_ = AsyncIOBackend::IOUring;
+        }
+    }
+#else
+    (void)allowIOUring;
+#endif
+
+#ifdef URHO3D_THREADING
+    if (!impl_)
+    {
+        impl_ = ea::make_unique<ThreadPoolImpl>(Min(maxReadsInFlight, maxIOThreads));
+        backend_ = AsyncIOBackend::ThreadPool;
+    }
+#endif
+
+    if (!impl_)
+    {
+        impl_ = ea::make_unique<SynchronousImpl>();
+        backend_ = AsyncIOBackend::Synchronous;
+    }
+}
+
+AsyncFileIO::~AsyncFileIO()
+{
+    // Destination buffers are owned by the caller, so reads in flight can't be abandoned
+    ea::vector<AsyncReadResult> results;
+    while (!requests_.empty())
+    {
+        if (!WaitCompleted(results))
+            break;
+    }
+}
+
+bool AsyncFileIO::CanRead(const File& file)
+{
+    return file.GetHandle() && file.GetMode() == FILE_READ && !file.IsCompressed();
+}
+
+unsigned AsyncFileIO::Read(File* file, unsigned position, void* dest, unsigned size)
+{
+    if (!file || !CanRead(*file))
+        return 0;
+
+    const unsigned id = nextId_++;
+    if (!nextId_)
+        nextId_ = 1;
+
+    const unsigned fileSize = file->GetSize();
+    const unsigned clampedPosition = Min(position, fileSize);
+    const unsigned clampedSize = Min(size, fileSize - clampedPosition);
+    const bool truncated = clampedSize != size;
+
+    // Memory mapped files and empty ranges don't need I/O
+    if (file->IsMemoryMapped() || !clampedSize)
+    {
+        if (clampedSize)
+            memcpy(dest, file->GetMappedData() + clampedPosition, clampedSize);
+        completedOnSubmit_.push_back(AsyncReadResult{ id, clampedSize, !truncated });
+        return id;
+    }
+
+    auto request = ea::make_unique<AsyncReadRequest>();
+    request->id_ = id;
+    request->file_ = file;
+#ifdef _WIN32
+    request->handle_ = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(static_cast<FILE*>(file->GetHandle()))));
+#else
+    request->fd_ = fileno(static_cast<FILE*>(file->GetHandle()));
+#endif
+    request->offset_ = static_cast<unsigned long long>(file->GetOffset()) + clampedPosition;
+    request->dest_ = static_cast<unsigned char*>(dest);
+    request->size_ = clampedSize;
+    request->truncated_ = truncated;
+
+    queuedRequests_.push_back(request.get());
+    requests_.emplace(id, ea::move(request));
+    SubmitQueued();
+    return id;
+}
+
+unsigned AsyncFileIO::PollCompleted(ea::vector<AsyncReadResult>& results)
+{
+    return ProcessCompleted(false, results);
+}
+
+unsigned AsyncFileIO::WaitCompleted(ea::vector<AsyncReadResult>& results)
+{
+    return ProcessCompleted(true, results);
+}
+
+void AsyncFileIO::SubmitQueued()
+{
+    while (!queuedRequests_.empty() && impl_->Submit(queuedRequests_.front()))
+        queuedRequests_.pop_front();
+    impl_->Flush();
+}
+
+unsigned AsyncFileIO::ProcessCompleted(bool wait, ea::vector<AsyncReadResult>& results)
+{
+    const unsigned oldSize = results.size();
+    results.insert(results.end(), completedOnSubmit_.begin(), completedOnSubmit_.end());
+    completedOnSubmit_.clear();
+
+    ea::vector<AsyncReadRequest*> completed;
+    do
+    {
+        completed.clear();
+        impl_->Reap(wait && results.size() == oldSize && !requests_.empty(), completed);
+
+        for (AsyncReadRequest* request : completed)
+        {
+            const int result = request->result_;
+            if (result > 0)
+            {
+                request->bytesRead_ += static_cast<unsigned>(result);
+                if (request->bytesRead_ < request->size_)
+                    queuedRequests_.push_back(request);
+                else
+                    FinishRequest(request, true, results);
+            }
+            else if (result == -EINTR || result == -EAGAIN)
+                queuedRequests_.push_back(request);
+            else
+            {
+                if (result < 0)
+                    URHO3D_LOGERROR("Failed to read file {}: {}", request->file_->GetName(), strerror(-result));
+                FinishRequest(request, false, results);
+            }
+        }
+
+        SubmitQueued();
+    } while (wait && results.size() == oldSize && !completed.empty());
+
+    return results.size() - oldSize;
+}
+
+void AsyncFileIO::FinishRequest(AsyncReadRequest* request, bool success, ea::vector<AsyncReadResult>& results)
+{
+    results.push_back(AsyncReadResult{ request->id_, request->bytesRead_, success && !request->truncated_ });
+    requests_.erase(request->id_);
+}
+
+}
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Core/NonCopyable.h"
+
+#include <EASTL/deque.h>
+#include <EASTL/unique_ptr.h>
+#include <EASTL/unordered_map.h>
+#include <EASTL/vector.h>
+
+#include <Urho3D/Urho3D.h>
+
+namespace Urho3D
+{
+
+class File;
+class AsyncFileIOImpl;
+struct AsyncReadRequest;
+
+/// Backend used to perform asynchronous reads.
+enum class AsyncIOBackend
+{
+    /// Linux io_uring submission and completion queues.
+    IOUring,
+    /// Blocking reads on pool of I/O threads.
+    ThreadPool,
+    /// Reads are performed immediately on submission. Used when threading is disabled.
+    Synchronous
+};
+
+/// Result of completed asynchronous read.
+struct URHO3D_API AsyncReadResult
+{
+    /// Request identifier returned by AsyncFileIO::Read.
+    unsigned id_{};
+    /// Number of bytes read.
+    unsigned bytesRead_{};
+    /// Whether all requested bytes were read.
+    bool success_{};
+};
+
+/// Service that keeps multiple file reads in flight and reports their completion.
+/// Not thread-safe: all calls are expected from the same thread.
+/// @nobind
+class URHO3D_API AsyncFileIO : private NonCopyable
+{
+public:
+    /// Construct. Fall back to thread pool if io_uring is not available or not allowed.
+    explicit AsyncFileIO(unsigned maxReadsInFlight = 64, bool allowIOUring = true);
+    /// Destruct. Wait for reads in flight to finish.
+    ~AsyncFileIO();
+
+    /// Return whether the file can be read asynchronously. Compressed files and Android assets can not.
+    static bool CanRead(const File& file);
+
+    /// Queue read of the range of file into caller buffer. The buffer must stay valid until the read is completed.
+    /// Position is relative to the beginning of the file. Return request identifier, or 0 if the file can not be read.
+    /// Current position of the file is not used. Synchronous reads from the same file are not allowed until the read is completed.
+    unsigned Read(File* file, unsigned position, void* dest, unsigned size);
+    /// Append results of completed reads without blocking. Return number of appended results.
+    unsigned PollCompleted(ea::vector<AsyncReadResult>& results);
+    /// Wait until at least one read is completed if any is pending, then append results of completed reads. Return number of appended results.
+    unsigned WaitCompleted(ea::vector<AsyncReadResult>& results);
+
+    /// Return number of reads that are not completed yet.
+    unsigned GetNumPendingReads() const { return requests_.size(); }
+    /// Return backend used to perform reads.
+    AsyncIOBackend GetBackend() const { return backend_; }
+
+private:
+    /// Hand queued requests over to the implementation.
+    void SubmitQueued();
+    /// Process completions reported by the implementation.
+    unsigned ProcessCompleted(bool wait, ea::vector<AsyncReadResult>& results);
+    /// Finish request and append its result.
+    void FinishRequest(AsyncReadRequest* request, bool success, ea::vector<AsyncReadResult>& results);
+
+    /// Backend type.
+    AsyncIOBackend backend_{};
+    /// Backend implementation.
+    ea::unique_ptr<AsyncFileIOImpl> impl_;
+    /// Requests that are not completed yet.
+    ea::unordered_map<unsigned, ea::unique_ptr<AsyncReadRequest>> requests_;
+    /// Requests waiting to be handed over to the implementation.
+    ea::deque<AsyncReadRequest*> queuedRequests_;
+    /// Requests completed on submission, reported by the next poll.
+    ea::vector<AsyncReadResult> completedOnSubmit_;
+    /// Next request identifier.
+    unsigned nextId_{ 1 };
+};
+
+}
@@ -63,150 +63,19 @@ unsigned Deserializer::GetChecksum()
     return 0;
 }
 
-long long Deserializer::ReadInt64()
-{
-    long long ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-int Deserializer::ReadInt()
-{
-    int ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-short Deserializer::ReadShort()
-{
-    short ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-signed char Deserializer::ReadByte()
-{
-    signed char ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-unsigned long long Deserializer::ReadUInt64()
-{
-    unsigned long long ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-unsigned Deserializer::ReadUInt()
-{
-    unsigned ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-unsigned short Deserializer::ReadUShort()
-{
-    unsigned short ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-unsigned char Deserializer::ReadUByte()
-{
-    unsigned char ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-bool Deserializer::ReadBool()
-{
-    return ReadUByte() != 0;
-}
-
-float Deserializer::ReadFloat()
-{
-    float ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-double Deserializer::ReadDouble()
-{
-    double ret;
-    Read(&ret, sizeof ret);
-    return ret;
-}
-
-IntRect Deserializer::ReadIntRect()
-{
-    int data[4];
-    Read(data, sizeof data);
-    return IntRect(data);
-}
-
-IntVector2 Deserializer::ReadIntVector2()
-{
-    int data[2];
-    Read(data, sizeof data);
-    return IntVector2(data);
-}
-
-IntVector3 Deserializer::ReadIntVector3()
-{
-    int data[3];
-    Read(data, sizeof data);
-    return IntVector3(data);
-}
-
-Rect Deserializer::ReadRect()
-{
-    float data[4];
-    Read(data, sizeof data);
-    return Rect(data);
-}
-
-Vector2 Deserializer::ReadVector2()
-{
-    float data[2];
-    Read(data, sizeof data);
-    return Vector2(data);
-}
-
-Vector3 Deserializer::ReadVector3()
-{
-    float data[3];
-    Read(data, sizeof data);
-    return Vector3(data);
-}
-
 Vector3 Deserializer::ReadPackedVector3(float maxAbsCoord)
 {
     float invV = maxAbsCoord / 32767.0f;
     short coords[3];
-    Read(coords, sizeof coords);
+    ReadInline(coords, sizeof coords);
     Vector3 ret(coords[0] * invV, coords[1] * invV, coords[2] * invV);
     return ret;
 }
 
-Vector4 Deserializer::ReadVector4()
-{
-    float data[4];
-    Read(data, sizeof data);
-    return Vector4(data);
-}
-
-Quaternion Deserializer::ReadQuaternion()
-{
-    float data[4];
-    Read(data, sizeof data);
-    return Quaternion(data);
-}
-
 Quaternion Deserializer::ReadPackedQuaternion()
 {
     short coords[4];
-    Read(coords, sizeof coords);
+    ReadInline(coords, sizeof coords);
     Quaternion ret(coords[0] * invQ, coords[1] * invQ, coords[2] * invQ, coords[3] * invQ);
     ret.Normalize();
     return ret;
@@ -215,40 +84,44 @@ Quaternion Deserializer::ReadPackedQuaternion()
 Matrix3 Deserializer::ReadMatrix3()
 {
     float data[9];
-    Read(data, sizeof data);
+    ReadInline(data, sizeof data);
     return Matrix3(data);
 }
 
 Matrix3x4 Deserializer::ReadMatrix3x4()
 {
     float data[12];
-    Read(data, sizeof data);
+    ReadInline(data, sizeof data);
     return Matrix3x4(data);
 }
 
 Matrix4 Deserializer::ReadMatrix4()
 {
     float data[16];
-    Read(data, sizeof data);
+    ReadInline(data, sizeof data);
     return Matrix4(data);
 }
 
-Color Deserializer::ReadColor()
-{
-    float data[4];
-    Read(data, sizeof data);
-    return Color(data);
-}
-
 BoundingBox Deserializer::ReadBoundingBox()
 {
     float data[6];
-    Read(data, sizeof data);
+    ReadInline(data, sizeof data);
     return BoundingBox(Vector3(&data[0]), Vector3(&data[3]));
 }
 
 ea::string Deserializer::ReadString()
 {
+    // Find terminator directly if stream is contiguous in memory
+    if (contiguousData_)
+    {
+        const auto begin = reinterpret_cast<const char*>(contiguousData_ + position_);
+        const unsigned maxLength = size_ - position_;
+        const auto end = static_cast<const char*>(memchr(begin, 0, maxLength));
+        const unsigned length = end ? static_cast<unsigned>(end - begin) : maxLength;
+        position_ += end ? length + 1 : length;
+        return ea::string(begin, length);
+    }
+
     ea::string ret;
 
     while (!IsEof())
@@ -271,11 +144,6 @@ ea::string Deserializer::ReadFileID()
     return ret;
 }
 
-StringHash Deserializer::ReadStringHash()
-{
-    return StringHash(ReadUInt());
-}
-
 ea::vector<unsigned char> Deserializer::ReadBuffer()
 {
     ea::vector<unsigned char> ret(ReadVLE());
@@ -483,7 +351,7 @@ unsigned Deserializer::ReadVLE()
 unsigned Deserializer::ReadNetID()
 {
     unsigned ret = 0;
-    Read(&ret, 3);
+    ReadInline(&ret, 3);
     return ret;
 }
 
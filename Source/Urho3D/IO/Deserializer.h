@@ -26,6 +26,8 @@
 #include "../Math/BoundingBox.h"
 #include "../Math/Rect.h"
 
+#include <cstring>
+
 namespace Urho3D
 {
 
@@ -70,45 +72,45 @@ public:
     unsigned GetSize() const { return size_; }
 
     /// Read a 64-bit integer.
-    long long ReadInt64();
+    long long ReadInt64() { return ReadValue<long long>(); }
     /// Read a 32-bit integer.
-    int ReadInt();
+    int ReadInt() { return ReadValue<int>(); }
     /// Read a 16-bit integer.
-    short ReadShort();
+    short ReadShort() { return ReadValue<short>(); }
     /// Read an 8-bit integer.
-    signed char ReadByte();
+    signed char ReadByte() { return ReadValue<signed char>(); }
     /// Read a 64-bit unsigned integer.
-    unsigned long long ReadUInt64();
+    unsigned long long ReadUInt64() { return ReadValue<unsigned long long>(); }
     /// Read a 32-bit unsigned integer.
-    unsigned ReadUInt();
+    unsigned ReadUInt() { return ReadValue<unsigned>(); }
     /// Read a 16-bit unsigned integer.
-    unsigned short ReadUShort();
+    unsigned short ReadUShort() { return ReadValue<unsigned short>(); }
     /// Read an 8-bit unsigned integer.
-    unsigned char ReadUByte();
+    unsigned char ReadUByte() { return ReadValue<unsigned char>(); }
     /// Read a bool.
-    bool ReadBool();
+    bool ReadBool() { return ReadUByte() != 0; }
     /// Read a float.
-    float ReadFloat();
+    float ReadFloat() { return ReadValue<float>(); }
     /// Read a double.
-    double ReadDouble();
+    double ReadDouble() { return ReadValue<double>(); }
     /// Read an IntRect.
-    IntRect ReadIntRect();
+    IntRect ReadIntRect() { int data[4]; ReadInline(data, sizeof data); return IntRect(data); }
     /// Read an IntVector2.
-    IntVector2 ReadIntVector2();
+    IntVector2 ReadIntVector2() { int data[2]; ReadInline(data, sizeof data); return IntVector2(data); }
     /// Read an IntVector3.
-    IntVector3 ReadIntVector3();
+    IntVector3 ReadIntVector3() { int data[3]; ReadInline(data, sizeof data); return IntVector3(data); }
     /// Read a Rect.
-    Rect ReadRect();
+    Rect ReadRect() { float data[4]; ReadInline(data, sizeof data); return Rect(data); }
     /// Read a Vector2.
-    Vector2 ReadVector2();
+    Vector2 ReadVector2() { float data[2]; ReadInline(data, sizeof data); return Vector2(data); }
     /// Read a Vector3.
-    Vector3 ReadVector3();
+    Vector3 ReadVector3() { float data[3]; ReadInline(data, sizeof data); return Vector3(data); }
     /// Read a Vector3 packed into 3 x 16 bits with the specified maximum absolute range.
     Vector3 ReadPackedVector3(float maxAbsCoord);
     /// Read a Vector4.
-    Vector4 ReadVector4();
+    Vector4 ReadVector4() { float data[4]; ReadInline(data, sizeof data); return Vector4(data); }
     /// Read a quaternion.
-    Quaternion ReadQuaternion();
+    Quaternion ReadQuaternion() { float data[4]; ReadInline(data, sizeof data); return Quaternion(data); }
     /// Read a quaternion with each component packed in 16 bits.
     Quaternion ReadPackedQuaternion();
     /// Read a Matrix3.
@@ -118,7 +120,7 @@ public:
     /// Read a Matrix4.
     Matrix4 ReadMatrix4();
     /// Read a color.
-    Color ReadColor();
+    Color ReadColor() { float data[4]; ReadInline(data, sizeof data); return Color(data); }
     /// Read a bounding box.
     BoundingBox ReadBoundingBox();
     /// Read a null-terminated string.
@@ -126,7 +128,7 @@ public:
     /// Read a four-letter file ID.
     ea::string ReadFileID();
     /// Read a 32-bit StringHash.
-    StringHash ReadStringHash();
+    StringHash ReadStringHash() { return StringHash(ReadUInt()); }
     /// Read a buffer with size encoded as VLE.
     ea::vector<unsigned char> ReadBuffer();
     /// Read a resource reference.
@@ -151,10 +153,32 @@ public:
     ea::string ReadLine();
 
 protected:
+    /// Read bytes. Bypass virtual Read() if the stream is contiguous in memory and has enough data.
+    void ReadInline(void* dest, unsigned size)
+    {
+        if (contiguousData_ && size_ - position_ >= size)
+        {
+            memcpy(dest, contiguousData_ + position_, size);
+            position_ += size;
+        }
+        else
+            Read(dest, size);
+    }
+    /// Read trivially copyable value.
+    template <class T> T ReadValue()
+    {
+        T value{};
+        ReadInline(&value, sizeof(T));
+        return value;
+    }
+
     /// Stream position.
     unsigned position_;
     /// Stream size.
     unsigned size_;
+    /// Data of the whole stream if it's contiguous in memory, null otherwise.
+    /// Should be updated by derived class whenever data is reallocated.
+    const unsigned char* contiguousData_{};
 };
 
 }
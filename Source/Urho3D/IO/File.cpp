@@ -33,6 +33,14 @@
 #include <SDL/SDL_rwops.h>
 #endif
 
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <cstdio>
 #include <LZ4/lz4.h>
 
@@ -62,7 +70,6 @@ static const char* openMode[] =
 #ifdef __ANDROID__
 static const unsigned READ_BUFFER_SIZE = 32768;
 #endif
-static const unsigned SKIP_BUFFER_SIZE = 1024;
 
 File::File(Context* context) :
     Object(context),
@@ -75,6 +82,11 @@ File::File(Context* context) :
     readBufferSize_(0),
     offset_(0),
     checksum_(0),
+    mappedData_(nullptr),
+    mappedSize_(0),
+#ifdef _WIN32
+    mappingHandle_(nullptr),
+#endif
     compressed_(false),
     readSyncNeeded_(false),
     writeSyncNeeded_(false)
@@ -92,6 +104,11 @@ File::File(Context* context, const ea::string& fileName, FileMode mode) :
     readBufferSize_(0),
     offset_(0),
     checksum_(0),
+    mappedData_(nullptr),
+    mappedSize_(0),
+#ifdef _WIN32
+    mappingHandle_(nullptr),
+#endif
     compressed_(false),
     readSyncNeeded_(false),
     writeSyncNeeded_(false)
@@ -110,6 +127,11 @@ File::File(Context* context, PackageFile* package, const ea::string& fileName) :
     readBufferSize_(0),
     offset_(0),
     checksum_(0),
+    mappedData_(nullptr),
+    mappedSize_(0),
+#ifdef _WIN32
+    mappingHandle_(nullptr),
+#endif
     compressed_(false),
     readSyncNeeded_(false),
     writeSyncNeeded_(false)
@@ -173,6 +195,13 @@ unsigned File::Read(void* dest, unsigned size)
     if (!size)
         return 0;
 
+    if (mappedData_)
+    {
+        memcpy(dest, contiguousData_ + position_, size);
+        position_ += size;
+        return size;
+    }
+
 #ifdef __ANDROID__
     if (assetHandle_ && !compressed_)
     {
@@ -217,25 +246,9 @@ unsigned File::Read(void* dest, unsigned size)
         {
             if (!readBuffer_ || readBufferOffset_ >= readBufferSize_)
             {
-                unsigned char blockHeaderBytes[4];
-                ReadInternal(blockHeaderBytes, sizeof blockHeaderBytes);
-
-                MemoryBuffer blockHeader(&blockHeaderBytes[0], sizeof blockHeaderBytes);
-                unsigned unpackedSize = blockHeader.ReadUShort();
-                unsigned packedSize = blockHeader.ReadUShort();
-
-                if (!readBuffer_)
-                {
-                    readBuffer_ = new unsigned char[unpackedSize];
-                    inputBuffer_ = new unsigned char[LZ4_compressBound(unpackedSize)];
-                }
-
                 /// \todo Handle errors
-                ReadInternal(inputBuffer_.get(), packedSize);
-                LZ4_decompress_fast((const char*)inputBuffer_.get(), (char*)readBuffer_.get(), unpackedSize);
-
-                readBufferSize_ = unpackedSize;
-                readBufferOffset_ = 0;
+                if (!ReadCompressedBlock(0))
+                    break;
             }
 
             unsigned copySize = Min((readBufferSize_ - readBufferOffset_), sizeLeft);
@@ -246,7 +259,7 @@ unsigned File::Read(void* dest, unsigned size)
             position_ += copySize;
         }
 
-        return size;
+        return size - sizeLeft;
     }
 
     // Need to reassign the position due to internal buffering when transitioning from writing to reading
@@ -281,26 +294,15 @@ unsigned File::Seek(unsigned position)
     if (mode_ == FILE_READ && position > size_)
         position = size_;
 
-    if (compressed_)
+    if (mappedData_)
     {
-        // Start over from the beginning
-        if (position == 0)
-        {
-            position_ = 0;
-            readBufferOffset_ = 0;
-            readBufferSize_ = 0;
-            SeekInternal(offset_);
-        }
-        // Skip bytes
-        else if (position >= position_)
-        {
-            unsigned char skipBuffer[SKIP_BUFFER_SIZE];
-            while (position > position_)
-                Read(skipBuffer, Min(position - position_, SKIP_BUFFER_SIZE));
-        }
-        else
-            URHO3D_LOGERROR("Seeking backward in a compressed file is not supported");
+        position_ = position;
+        return position_;
+    }
 
+    if (compressed_)
+    {
+        SeekCompressed(position);
         return position_;
     }
 
@@ -311,6 +313,84 @@ unsigned File::Seek(unsigned position)
     return position_;
 }
 
+unsigned File::ReadCompressedBlock(unsigned skipPosition)
+{
+    unsigned char blockHeaderBytes[4];
+    if (!ReadInternal(blockHeaderBytes, sizeof blockHeaderBytes))
+        return 0;
+
+    MemoryBuffer blockHeader(&blockHeaderBytes[0], sizeof blockHeaderBytes);
+    unsigned unpackedSize = blockHeader.ReadUShort();
+    unsigned packedSize = blockHeader.ReadUShort();
+
+    if (!readBuffer_)
+    {
+        readBuffer_ = new unsigned char[unpackedSize];
+        inputBuffer_ = new unsigned char[LZ4_compressBound(unpackedSize)];
+    }
+
+    // Skipped blocks are not even read from disk
+    if (position_ + unpackedSize <= skipPosition)
+    {
+        SkipInternal(packedSize);
+        readBufferSize_ = 0;
+        readBufferOffset_ = 0;
+        return unpackedSize;
+    }
+
+    if (!ReadInternal(inputBuffer_.get(), packedSize))
+        return 0;
+
+    LZ4_decompress_fast((const char*)inputBuffer_.get(), (char*)readBuffer_.get(), unpackedSize);
+    readBufferSize_ = unpackedSize;
+    readBufferOffset_ = 0;
+    return unpackedSize;
+}
+
+void File::SeekCompressed(unsigned position)
+{
+    // Seek within current block
+    const unsigned blockStart = position_ - readBufferOffset_;
+    if (position >= blockStart && position < blockStart + readBufferSize_)
+    {
+        readBufferOffset_ = position - blockStart;
+        position_ = position;
+        return;
+    }
+
+    if (position < position_)
+    {
+        // Start over from the beginning. Blocks before new position are still skipped without decompression
+        position_ = 0;
+        readBufferOffset_ = 0;
+        readBufferSize_ = 0;
+        SeekInternal(offset_);
+    }
+    else
+    {
+        // Discard the rest of current block
+        position_ = blockStart + readBufferSize_;
+        readBufferOffset_ = 0;
+        readBufferSize_ = 0;
+    }
+
+    // Use recorded block sizes to skip blocks, decompress only the block containing new position
+    while (position_ < position)
+    {
+        const unsigned blockSize = ReadCompressedBlock(position);
+        if (!blockSize)
+            break;
+
+        if (readBufferSize_ > 0)
+        {
+            readBufferOffset_ = position - position_;
+            position_ = position;
+        }
+        else
+            position_ += blockSize;
+    }
+}
+
 unsigned File::Write(const void* data, unsigned size)
 {
     if (!IsOpen())
@@ -390,6 +470,7 @@ void File::Close()
     }
 #endif
 
+    UnmapMemory();
     readBuffer_.reset();
     inputBuffer_.reset();
 
@@ -410,6 +491,91 @@ void File::Flush()
         fflush((FILE*)handle_);
 }
 
+bool File::MemoryMap(FileAccessPattern accessPattern)
+{
+    if (!mappedData_)
+    {
+        if (!handle_ || mode_ != FILE_READ || compressed_ || !size_)
+            return false;
+
+#if defined(_WIN32)
+        SYSTEM_INFO systemInfo;
+        GetSystemInfo(&systemInfo);
+        const unsigned mappingOffset = offset_ - offset_ % systemInfo.dwAllocationGranularity;
+        const unsigned mappingSize = offset_ + size_ - mappingOffset;
+
+        auto fileHandle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno((FILE*)handle_)));
+        HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mappingHandle)
+            return false;
+
+        void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, mappingOffset, mappingSize);
+        if (!data)
+        {
+            CloseHandle(mappingHandle);
+            return false;
+        }
+
+        mappingHandle_ = mappingHandle;
+#elif !defined(__EMSCRIPTEN__)
+        const auto pageSize = static_cast<unsigned>(sysconf(_SC_PAGESIZE));
+        const unsigned mappingOffset = offset_ - offset_ % pageSize;
+        const unsigned mappingSize = offset_ + size_ - mappingOffset;
+
+        void* data = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fileno((FILE*)handle_), mappingOffset);
+        if (data == MAP_FAILED)
+            return false;
+#else
+        return false;
+#endif
+
+        mappedData_ = data;
+        mappedSize_ = mappingSize;
+        contiguousData_ = static_cast<const unsigned char*>(data) + (offset_ - mappingOffset);
+    }
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    switch (accessPattern)
+    {
+    case FILE_ACCESS_SEQUENTIAL:
+        madvise(mappedData_, mappedSize_, MADV_SEQUENTIAL);
+        break;
+
+    case FILE_ACCESS_RANDOM:
+        madvise(mappedData_, mappedSize_, MADV_RANDOM);
+        break;
+
+    default:
+        madvise(mappedData_, mappedSize_, MADV_NORMAL);
+        break;
+    }
+#endif
+
+    return true;
+}
+
+void File::UnmapMemory()
+{
+    if (!mappedData_)
+        return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(mappedData_);
+    CloseHandle(mappingHandle_);
+    mappingHandle_ = nullptr;
+#elif !defined(__EMSCRIPTEN__)
+    munmap(mappedData_, mappedSize_);
+#endif
+
+    mappedData_ = nullptr;
+    mappedSize_ = 0;
+    contiguousData_ = nullptr;
+
+    // Restore file position for buffered reads
+    if (handle_)
+        SeekInternal(position_ + offset_);
+}
+
 bool File::IsOpen() const
 {
 #ifdef __ANDROID__
@@ -546,6 +712,16 @@ void File::SeekInternal(unsigned newPosition)
         fseek((FILE*)handle_, newPosition, SEEK_SET);
 }
 
+void File::SkipInternal(unsigned size)
+{
+#ifdef __ANDROID__
+    if (assetHandle_)
+        SDL_RWseek(assetHandle_, size, SEEK_CUR);
+    else
+#endif
+        fseek((FILE*)handle_, size, SEEK_CUR);
+}
+
 void File::ReadBinary(ea::vector<unsigned char>& buffer)
 {
     buffer.clear();
@@ -58,6 +58,14 @@ enum FileMode
     FILE_READWRITE
 };
 
+/// Expected access pattern of memory mapped file.
+enum FileAccessPattern
+{
+    FILE_ACCESS_NORMAL = 0,
+    FILE_ACCESS_SEQUENTIAL,
+    FILE_ACCESS_RANDOM
+};
+
 class PackageFile;
 
 /// %File opened either through the filesystem or from within a package file.
@@ -107,6 +115,18 @@ public:
 
     /// Return the file handle.
     void* GetHandle() const { return handle_; }
+    /// Return offset of the file data within the file handle. Non-zero for packaged files.
+    unsigned GetOffset() const { return offset_; }
+    /// Return whether the file data is compressed.
+    bool IsCompressed() const { return compressed_; }
+
+    /// Map the file into memory for reading. Only uncompressed files opened for reading can be mapped.
+    /// Return false if not supported by the platform or the filesystem, the file is read as usual then.
+    bool MemoryMap(FileAccessPattern accessPattern = FILE_ACCESS_NORMAL);
+    /// Return whether the file is memory mapped.
+    bool IsMemoryMapped() const { return mappedData_ != nullptr; }
+    /// Return memory mapped contents of the file, null if not mapped. Valid until the file is closed.
+    const unsigned char* GetMappedData() const { return mappedData_ ? contiguousData_ : nullptr; }
 
     /// Return whether the file originates from a package.
     /// @property
@@ -135,6 +155,16 @@ private:
     bool ReadInternal(void* dest, unsigned size);
     /// Seek in file internally using either C standard IO functions or SDL RWops for Android asset files.
     void SeekInternal(unsigned newPosition);
+    /// Skip bytes from current position in file internally without reading them.
+    void SkipInternal(unsigned size);
+    /// Read next block of compressed file and decompress it into read buffer.
+    /// Block is skipped without reading or decompression if it ends before or at specified position.
+    /// Return uncompressed size of the block, 0 on failure.
+    unsigned ReadCompressedBlock(unsigned skipPosition);
+    /// Seek in compressed file. Skipped blocks are not decompressed.
+    void SeekCompressed(unsigned position);
+    /// Unmap memory mapped file.
+    void UnmapMemory();
 
     /// Absolute file name.
     ea::string absoluteFileName_;
@@ -158,6 +188,14 @@ private:
     unsigned offset_;
     /// Content checksum.
     unsigned checksum_;
+    /// Memory mapping of the file, aligned to page boundary.
+    void* mappedData_;
+    /// Size of memory mapping.
+    unsigned mappedSize_;
+#ifdef _WIN32
+    /// File mapping object handle.
+    void* mappingHandle_;
+#endif
     /// Compression flag.
     bool compressed_;
     /// Synchronization needed before read -flag.
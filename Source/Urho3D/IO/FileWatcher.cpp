@@ -31,8 +31,10 @@
 #ifdef _WIN32
 #include <windows.h>
 #elif __linux__
+#include <cerrno>
+#include <dirent.h>
+#include <poll.h>
 #include <sys/inotify.h>
-#include <sys/ioctl.h>
 extern "C"
 {
 // Need read/close for inotify
@@ -47,10 +49,50 @@ extern "C"
 
 namespace Urho3D
 {
-#ifndef __APPLE__
+#ifdef _WIN32
 static const unsigned BUFFERSIZE = 4096;
+#elif defined(__linux__)
+/// Size of inotify event buffer. Large enough to read bulk changes in few calls.
+static const unsigned INOTIFY_BUFFERSIZE = 64 * 1024;
+/// Events watched in each directory.
+static const unsigned INOTIFY_FLAGS = IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO;
+/// Max number of directories registered per update of watcher thread, so that changes keep being delivered.
+static const unsigned MAX_DIRECTORIES_PER_UPDATE = 256;
 #endif
 
+namespace
+{
+
+/// Merge subsequent change of the same file into the pending change. Return false if the changes cancel out.
+bool MergeFileChange(FileChange& pending, const FileChange& change)
+{
+    switch (change.kind_)
+    {
+    case FILECHANGE_MODIFIED:
+        // Added or renamed file stays added or renamed
+        return true;
+
+    case FILECHANGE_ADDED:
+        // Removed and created again is reported as modified
+        if (pending.kind_ == FILECHANGE_REMOVED || pending.kind_ == FILECHANGE_MODIFIED)
+            pending.kind_ = FILECHANGE_MODIFIED;
+        return true;
+
+    case FILECHANGE_REMOVED:
+        // Created and removed again is not reported at all
+        if (pending.kind_ == FILECHANGE_ADDED)
+            return false;
+        pending = change;
+        return true;
+
+    default:
+        pending = change;
+        return true;
+    }
+}
+
+}
+
 FileWatcher::FileWatcher(Context* context) :
     Object(context),
     fileSystem_(GetSubsystem<FileSystem>()),
@@ -59,7 +101,7 @@ FileWatcher::FileWatcher(Context* context) :
 {
 #ifdef URHO3D_FILEWATCHER
 #ifdef __linux__
-    watchHandle_ = inotify_init();
+    watchHandle_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
 #elif defined(__APPLE__) && !defined(IOS) && !defined(TVOS)
     supported_ = IsFileWatcherSupported();
 #endif
@@ -117,8 +159,7 @@ bool FileWatcher::StartWatching(const ea::string& pathName, bool watchSubDirs)
         return false;
     }
 #elif defined(__linux__)
-    int flags = IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO;
-    int handle = inotify_add_watch(watchHandle_, pathName.c_str(), (unsigned)flags);
+    int handle = inotify_add_watch(watchHandle_, pathName.c_str(), INOTIFY_FLAGS);
 
     if (handle < 0)
     {
@@ -132,29 +173,9 @@ bool FileWatcher::StartWatching(const ea::string& pathName, bool watchSubDirs)
         path_ = AddTrailingSlash(pathName);
         watchSubDirs_ = watchSubDirs;
 
+        // Sub-directories are registered by the watcher thread, so that large trees don't block the caller
         if (watchSubDirs_)
-        {
-            ea::vector<ea::string> subDirs;
-            fileSystem_->ScanDir(subDirs, pathName, "*", SCAN_DIRS, true);
-
-            for (unsigned i = 0; i < subDirs.size(); ++i)
-            {
-                ea::string subDirFullPath = AddTrailingSlash(path_ + subDirs[i]);
-
-                // Don't watch ./ or ../ sub-directories
-                if (!subDirFullPath.ends_with("./"))
-                {
-                    handle = inotify_add_watch(watchHandle_, subDirFullPath.c_str(), (unsigned)flags);
-                    if (handle < 0)
-                        URHO3D_LOGERROR("Failed to start watching subdirectory path " + subDirFullPath);
-                    else
-                    {
-                        // Store sub-directory to reconstruct later from inotify
-                        dirHandle_[handle] = AddTrailingSlash(subDirs[i]);
-                    }
-                }
-            }
-        }
+            pendingDirectories_.push_back({ EMPTY_STRING, false });
         Run();
 
         URHO3D_LOGDEBUG("Started watching path " + pathName);
@@ -209,7 +230,7 @@ void FileWatcher::StopWatching()
             fileSystem_->Delete(dummyFileName);
 #endif
 
-#if defined(__APPLE__) && !defined(IOS) && !defined(TVOS)
+#if defined(__linux__) || (defined(__APPLE__) && !defined(IOS) && !defined(TVOS))
         // Our implementation of file watcher requires the thread to be stopped first before closing the watcher
         Stop();
 #endif
@@ -220,11 +241,12 @@ void FileWatcher::StopWatching()
         for (auto i = dirHandle_.begin(); i != dirHandle_.end(); ++i)
             inotify_rm_watch(watchHandle_, i->first);
         dirHandle_.clear();
+        pendingDirectories_.clear();
 #elif defined(__APPLE__) && !defined(IOS) && !defined(TVOS)
         CloseFileWatcher(watcher_);
 #endif
 
-#ifndef __APPLE__
+#if !defined(__APPLE__) && !defined(__linux__)
         Stop();
 #endif
 
@@ -299,57 +321,106 @@ void FileWatcher::ThreadFunction()
         }
     }
 #elif defined(__linux__)
-    unsigned char buffer[BUFFERSIZE];
+    struct PendingRename
+    {
+        /// Rename information, partially filled if the other end of the move is outside of the watched path.
+        FileChange change_;
+        /// Whether directory was moved.
+        bool isDirectory_;
+    };
+
+    alignas(inotify_event) unsigned char buffer[INOTIFY_BUFFERSIZE];
 
     while (shouldRun_)
     {
-        unsigned available = 0;
-        ioctl(watchHandle_, FIONREAD, &available);
+        WatchPendingDirectories();
 
-        if (available == 0)
-        {
-            Time::Sleep(100);
+        // Don't wait for events while there are directories to register
+        pollfd pollInfo{ watchHandle_, POLLIN, 0 };
+        if (poll(&pollInfo, 1, pendingDirectories_.empty() ? 100 : 0) <= 0)
             continue;
-        }
-
-        int i = 0;
-        auto length = (int)read(watchHandle_, buffer, Min(available, sizeof(buffer)));
 
+        const auto length = (int)read(watchHandle_, buffer, sizeof(buffer));
         if (length < 0)
+        {
+            if (errno == EAGAIN || errno == EINTR)
+                continue;
             return;
+        }
 
-        ea::unordered_map<unsigned, FileChange> renames;
+        ea::unordered_map<unsigned, PendingRename> renames;
+        int i = 0;
         while (i < length)
         {
             auto* event = (inotify_event*)&buffer[i];
+            i += sizeof(inotify_event) + event->len;
 
-            if (event->len > 0)
+            if (event->mask & IN_Q_OVERFLOW)
             {
-                ea::string fileName = dirHandle_[event->wd] + event->name;
-
-                if ((event->mask & IN_CREATE) == IN_CREATE)
-                    AddChange({FILECHANGE_ADDED, fileName, EMPTY_STRING});
-                else if ((event->mask & IN_DELETE) == IN_DELETE)
-                    AddChange({FILECHANGE_REMOVED, fileName, EMPTY_STRING});
-                else if ((event->mask & IN_MODIFY) == IN_MODIFY || (event->mask & IN_ATTRIB) == IN_ATTRIB)
-                    AddChange({FILECHANGE_MODIFIED, fileName, EMPTY_STRING});
-                else if (event->mask & IN_MOVE)
-                {
-                    auto& entry = renames[event->cookie];
-                    if ((event->mask & IN_MOVED_FROM) == IN_MOVED_FROM)
-                        entry.oldFileName_ = fileName;
-                    else if ((event->mask & IN_MOVED_TO) == IN_MOVED_TO)
-                        entry.fileName_ = fileName;
+                URHO3D_LOGWARNING("Too many file changes, some changes in " + path_ + " were not tracked");
+                continue;
+            }
 
-                    if (!entry.oldFileName_.empty() && !entry.fileName_.empty())
-                    {
-                        entry.kind_ = FILECHANGE_RENAMED;
-                        AddChange(entry);
-                    }
-                }
+            if (event->mask & IN_IGNORED)
+            {
+                dirHandle_.erase(event->wd);
+                continue;
             }
 
-            i += sizeof(inotify_event) + event->len;
+            // Skip events of watches that are already removed
+            auto dirIter = dirHandle_.find(event->wd);
+            if (event->len == 0 || dirIter == dirHandle_.end())
+                continue;
+
+            ea::string fileName = dirIter->second + event->name;
+            const bool isDirectory = (event->mask & IN_ISDIR) != 0;
+
+            if ((event->mask & IN_CREATE) == IN_CREATE)
+            {
+                // Files may be created in the new directory before it's watched, so report everything found in it
+                if (isDirectory && watchSubDirs_)
+                    pendingDirectories_.push_back({ AddTrailingSlash(fileName), true });
+                AddChange({FILECHANGE_ADDED, fileName, EMPTY_STRING});
+            }
+            else if ((event->mask & IN_DELETE) == IN_DELETE)
+                AddChange({FILECHANGE_REMOVED, fileName, EMPTY_STRING});
+            else if ((event->mask & IN_MODIFY) == IN_MODIFY || (event->mask & IN_ATTRIB) == IN_ATTRIB)
+                AddChange({FILECHANGE_MODIFIED, fileName, EMPTY_STRING});
+            else if (event->mask & IN_MOVE)
+            {
+                PendingRename& entry = renames[event->cookie];
+                entry.isDirectory_ = isDirectory;
+                if ((event->mask & IN_MOVED_FROM) == IN_MOVED_FROM)
+                    entry.change_.oldFileName_ = ea::move(fileName);
+                else if ((event->mask & IN_MOVED_TO) == IN_MOVED_TO)
+                    entry.change_.fileName_ = ea::move(fileName);
+            }
+        }
+
+        for (auto& [cookie, entry] : renames)
+        {
+            FileChange& change = entry.change_;
+            if (!change.oldFileName_.empty() && !change.fileName_.empty())
+            {
+                if (entry.isDirectory_)
+                    RenameWatchedDirectory(change.oldFileName_, change.fileName_);
+                change.kind_ = FILECHANGE_RENAMED;
+                AddChange(change);
+            }
+            else if (!change.oldFileName_.empty())
+            {
+                // Moved outside of the watched path
+                if (entry.isDirectory_)
+                    UnwatchDirectory(change.oldFileName_);
+                AddChange({FILECHANGE_REMOVED, change.oldFileName_, EMPTY_STRING});
+            }
+            else
+            {
+                // Moved from outside of the watched path
+                if (entry.isDirectory_ && watchSubDirs_)
+                    pendingDirectories_.push_back({ AddTrailingSlash(change.fileName_), true });
+                AddChange({FILECHANGE_ADDED, change.fileName_, EMPTY_STRING});
+            }
         }
     }
 #elif defined(__APPLE__) && !defined(IOS) && !defined(TVOS)
@@ -398,10 +469,22 @@ void FileWatcher::AddChange(const FileChange& change)
 
     auto it = changes_.find(change.fileName_);
     if (it == changes_.end())
-        changes_[change.fileName_].change_ = change;
+    {
+        TimedFileChange& entry = changes_[change.fileName_];
+        entry.change_ = change;
+        entry.orderIter_ = changeOrder_.insert(changeOrder_.end(), change.fileName_);
+    }
+    else if (!MergeFileChange(it->second.change_, change))
+    {
+        changeOrder_.erase(it->second.orderIter_);
+        changes_.erase(it);
+    }
     else
+    {
         // Reset the timer associated with the filename. Will be notified once timer exceeds the delay
         it->second.timer_.Reset();
+        changeOrder_.splice(changeOrder_.end(), changeOrder_, it->second.orderIter_);
+    }
 }
 
 bool FileWatcher::GetNextChange(FileChange& dest)
@@ -410,22 +493,99 @@ bool FileWatcher::GetNextChange(FileChange& dest)
 
     auto delayMsec = (unsigned)(delay_ * 1000.0f);
 
-    if (changes_.empty())
+    // Changes are ordered by last update, so only the least recently updated one needs to be checked
+    if (changeOrder_.empty())
         return false;
-    else
+
+    auto it = changes_.find(changeOrder_.front());
+    if (it->second.timer_.GetMSec(false) < delayMsec)
+        return false;
+
+    dest = ea::move(it->second.change_);
+    changes_.erase(it);
+    changeOrder_.pop_front();
+    return true;
+}
+
+unsigned FileWatcher::GetNextChanges(ea::vector<FileChange>& dest)
+{
+    unsigned numChanges = 0;
+    FileChange change;
+    while (GetNextChange(change))
     {
-        for (auto i = changes_.begin(); i != changes_.end(); ++i)
+        dest.push_back(ea::move(change));
+        ++numChanges;
+    }
+    return numChanges;
+}
+
+#if defined(URHO3D_FILEWATCHER) && defined(__linux__)
+void FileWatcher::WatchPendingDirectories()
+{
+    for (unsigned numDirectories = 0; numDirectories < MAX_DIRECTORIES_PER_UPDATE && !pendingDirectories_.empty(); ++numDirectories)
+    {
+        const PendingDirectory directory = ea::move(pendingDirectories_.back());
+        pendingDirectories_.pop_back();
+
+        // Add the watch before listing the directory so that no file created meanwhile is missed
+        const ea::string fullPath = path_ + directory.path_;
+        const int handle = inotify_add_watch(watchHandle_, fullPath.c_str(), INOTIFY_FLAGS);
+        if (handle < 0)
         {
-            if (i->second.timer_.GetMSec(false) >= delayMsec)
-            {
-                dest = i->second.change_;
-                changes_.erase(i);
-                return true;
-            }
+            URHO3D_LOGERROR("Failed to start watching subdirectory path " + fullPath);
+            continue;
         }
 
-        return false;
+        // Store sub-directory to reconstruct later from inotify
+        dirHandle_[handle] = directory.path_;
+
+        DIR* dir = opendir(fullPath.c_str());
+        if (!dir)
+            continue;
+
+        // Directory entry type is enough to tell sub-directories apart, so files are never stat'ed
+        while (const dirent* entry = readdir(dir))
+        {
+            const ea::string name = entry->d_name;
+            if (name == "." || name == "..")
+                continue;
+
+            const bool isDirectory = entry->d_type == DT_DIR
+                || (entry->d_type == DT_UNKNOWN && fileSystem_->DirExists(fullPath + name));
+            if (isDirectory)
+                pendingDirectories_.push_back({ directory.path_ + name + "/", directory.reportFiles_ });
+            else if (directory.reportFiles_)
+                AddChange({FILECHANGE_ADDED, directory.path_ + name, EMPTY_STRING});
+        }
+        closedir(dir);
     }
 }
 
+void FileWatcher::RenameWatchedDirectory(const ea::string& oldPath, const ea::string& newPath)
+{
+    const ea::string oldPrefix = AddTrailingSlash(oldPath);
+    const ea::string newPrefix = AddTrailingSlash(newPath);
+    for (auto& [handle, path] : dirHandle_)
+    {
+        if (path.starts_with(oldPrefix))
+            path = newPrefix + path.substr(oldPrefix.length());
+    }
+}
+
+void FileWatcher::UnwatchDirectory(const ea::string& path)
+{
+    const ea::string prefix = AddTrailingSlash(path);
+    for (auto it = dirHandle_.begin(); it != dirHandle_.end();)
+    {
+        if (it->second.starts_with(prefix))
+        {
+            inotify_rm_watch(watchHandle_, it->first);
+            it = dirHandle_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+#endif
+
 }
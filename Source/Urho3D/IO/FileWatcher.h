@@ -27,6 +27,8 @@
 #include "../Core/Thread.h"
 #include "../Core/Timer.h"
 
+#include <EASTL/list.h>
+
 namespace Urho3D
 {
 
@@ -76,10 +78,12 @@ public:
     void StopWatching();
     /// Set the delay in seconds before file changes are notified. This (hopefully) avoids notifying when a file save is still in progress. Default 1 second.
     void SetDelay(float interval);
-    /// Add a file change into the changes queue.
+    /// Add a file change into the changes queue. Pending change of the same file is merged with the new one.
     void AddChange(const FileChange& change);
     /// Return a file change (true if was found, false if not).
     bool GetNextChange(FileChange& dest);
+    /// Append all file changes that are ready to be notified. Return number of appended changes.
+    unsigned GetNextChanges(ea::vector<FileChange>& dest);
 
     /// Return the path being watched, or empty if not watching.
     const ea::string& GetPath() const { return path_; }
@@ -94,14 +98,35 @@ private:
         FileChange change_;
         /// Timer used to filter out repeated events when file is being written.
         Timer timer_;
+        /// Position in the list of pending changes ordered by last update.
+        ea::list<ea::string>::iterator orderIter_;
+    };
+
+#ifdef __linux__
+    struct PendingDirectory
+    {
+        /// Directory path relative to the watched path, with trailing slash.
+        ea::string path_;
+        /// Whether to report files found in the directory as added.
+        bool reportFiles_;
     };
 
+    /// Register watches for some of pending directories. Subdirectories found are added as pending.
+    void WatchPendingDirectories();
+    /// Update paths of directory and its subdirectories after rename.
+    void RenameWatchedDirectory(const ea::string& oldPath, const ea::string& newPath);
+    /// Remove watches of directory and its subdirectories.
+    void UnwatchDirectory(const ea::string& path);
+#endif
+
     /// Filesystem.
     SharedPtr<FileSystem> fileSystem_;
     /// The path being watched.
     ea::string path_;
     /// Pending changes. These will be returned and removed from the list when their timer has exceeded the delay.
     ea::unordered_map<ea::string, TimedFileChange> changes_;
+    /// File names of pending changes from the least to the most recently updated.
+    ea::list<ea::string> changeOrder_;
     /// Mutex for the change buffer.
     Mutex changesMutex_;
     /// Delay in seconds for notifying changes.
@@ -120,6 +145,8 @@ private:
     ea::unordered_map<int, ea::string> dirHandle_;
     /// Linux inotify needs a handle.
     int watchHandle_;
+    /// Directories waiting for watch registration. Accessed only by the watcher thread after start.
+    ea::vector<PendingDirectory> pendingDirectories_;
 
 #elif defined(__APPLE__) && !defined(IOS) && !defined(TVOS)
 
@@ -34,6 +34,7 @@ MemoryBuffer::MemoryBuffer(void* data, unsigned size) :
 {
     if (!buffer_)
         size_ = 0;
+    contiguousData_ = buffer_;
 }
 
 MemoryBuffer::MemoryBuffer(const void* data, unsigned size) :
@@ -43,6 +44,7 @@ MemoryBuffer::MemoryBuffer(const void* data, unsigned size) :
 {
     if (!buffer_)
         size_ = 0;
+    contiguousData_ = buffer_;
 }
 
 MemoryBuffer::MemoryBuffer(ByteVector& data) :
@@ -50,6 +52,7 @@ MemoryBuffer::MemoryBuffer(ByteVector& data) :
     buffer_(data.data()),
     readOnly_(false)
 {
+    contiguousData_ = buffer_;
 }
 
 MemoryBuffer::MemoryBuffer(const ByteVector& data) :
@@ -57,6 +60,7 @@ MemoryBuffer::MemoryBuffer(const ByteVector& data) :
     buffer_(const_cast<unsigned char*>(data.data())),
     readOnly_(true)
 {
+    contiguousData_ = buffer_;
 }
 
 unsigned MemoryBuffer::Read(void* dest, unsigned size)
@@ -60,4 +60,12 @@ bool MultiFileWatcher::GetNextChange(FileChange& dest)
     return false;
 }
 
+unsigned MultiFileWatcher::GetNextChanges(ea::vector<FileChange>& dest)
+{
+    unsigned numChanges = 0;
+    for (FileWatcher* watcher : watchers_)
+        numChanges += watcher->GetNextChanges(dest);
+    return numChanges;
+}
+
 }
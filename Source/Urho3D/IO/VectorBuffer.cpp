@@ -48,6 +48,48 @@ VectorBuffer::VectorBuffer(Deserializer& source, unsigned size)
     SetData(source, size);
 }
 
+VectorBuffer::VectorBuffer(const VectorBuffer& other)
+    : AbstractFile(other)
+    , buffer_(other.buffer_)
+{
+    contiguousData_ = buffer_.data();
+}
+
+VectorBuffer::VectorBuffer(VectorBuffer&& other) noexcept
+    : AbstractFile(other)
+    , buffer_(ea::move(other.buffer_))
+{
+    contiguousData_ = buffer_.data();
+    other.position_ = 0;
+    other.size_ = 0;
+    other.contiguousData_ = other.buffer_.data();
+}
+
+VectorBuffer& VectorBuffer::operator =(const VectorBuffer& other)
+{
+    if (this != &other)
+    {
+        AbstractFile::operator =(other);
+        buffer_ = other.buffer_;
+        contiguousData_ = buffer_.data();
+    }
+    return *this;
+}
+
+VectorBuffer& VectorBuffer::operator =(VectorBuffer&& other) noexcept
+{
+    if (this != &other)
+    {
+        AbstractFile::operator =(other);
+        buffer_ = ea::move(other.buffer_);
+        contiguousData_ = buffer_.data();
+        other.position_ = 0;
+        other.size_ = 0;
+        other.contiguousData_ = other.buffer_.data();
+    }
+    return *this;
+}
+
 unsigned VectorBuffer::Read(void* dest, unsigned size)
 {
     if (size + position_ > size_)
@@ -82,6 +124,7 @@ unsigned VectorBuffer::Write(const void* data, unsigned size)
     {
         size_ = size + position_;
         buffer_.resize(size_);
+        contiguousData_ = buffer_.data();
     }
 
     auto* srcPtr = (unsigned char*)data;
@@ -98,6 +141,7 @@ void VectorBuffer::SetData(const ea::vector<unsigned char>& data)
     buffer_ = data;
     position_ = 0;
     size_ = data.size();
+    contiguousData_ = buffer_.data();
 }
 
 void VectorBuffer::SetData(const void* data, unsigned size)
@@ -111,6 +155,7 @@ void VectorBuffer::SetData(const void* data, unsigned size)
 
     position_ = 0;
     size_ = size;
+    contiguousData_ = buffer_.data();
 }
 
 void VectorBuffer::SetData(Deserializer& source, unsigned size)
@@ -122,6 +167,7 @@ void VectorBuffer::SetData(Deserializer& source, unsigned size)
 
     position_ = 0;
     size_ = actualSize;
+    contiguousData_ = buffer_.data();
 }
 
 void VectorBuffer::Clear()
@@ -129,16 +175,25 @@ void VectorBuffer::Clear()
     buffer_.clear();
     position_ = 0;
     size_ = 0;
+    contiguousData_ = buffer_.data();
 }
 
 void VectorBuffer::Resize(unsigned size)
 {
     buffer_.resize(size);
     size_ = size;
+    contiguousData_ = buffer_.data();
     if (position_ > size_)
         position_ = size_;
 }
 
+ByteVector& VectorBuffer::GetBuffer()
+{
+    // The caller may reallocate the buffer, so don't read through the cached pointer anymore
+    contiguousData_ = nullptr;
+    return buffer_;
+}
+
 const ea::string& VectorBuffer::GetName() const
 {
     return vectorBufferName;
@@ -40,6 +40,14 @@ public:
     VectorBuffer(const void* data, unsigned size);
     /// Construct from a stream.
     VectorBuffer(Deserializer& source, unsigned size);
+    /// Copy-construct from another buffer.
+    VectorBuffer(const VectorBuffer& other);
+    /// Move-construct from another buffer.
+    VectorBuffer(VectorBuffer&& other) noexcept;
+    /// Copy-assign from another buffer.
+    VectorBuffer& operator =(const VectorBuffer& other);
+    /// Move-assign from another buffer.
+    VectorBuffer& operator =(VectorBuffer&& other) noexcept;
 
     /// Returns name of this object.
     const ea::string& GetName() const override;
@@ -70,8 +78,9 @@ public:
 
     /// Return the buffer.
     const ByteVector& GetBuffer() const { return buffer_; }
-    /// Return the buffer.
-    ByteVector& GetBuffer() { return buffer_; }
+    /// Return the buffer. Buffer should not be resized directly, use Resize() instead.
+    /// Disables inline reads until the buffer is updated through VectorBuffer again.
+    ByteVector& GetBuffer();
 
 private:
     /// Dynamic data buffer.
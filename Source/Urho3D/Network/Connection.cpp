@@ -57,19 +57,8 @@ namespace Urho3D
 {
 
 static const int STATS_INTERVAL_MSEC = 2000;
-
-PackageDownload::PackageDownload() :
-    totalFragments_(0),
-    checksum_(0),
-    initiated_(false)
-{
-}
-
-PackageUpload::PackageUpload() :
-    fragment_(0),
-    totalFragments_(0)
-{
-}
+/// Number of package file chunks read ahead of sending.
+static const unsigned NUM_PACKAGE_CHUNKS_READ_AHEAD = 2;
 
 Connection::Connection(Context* context) :
     Object(context),
@@ -365,29 +354,148 @@ void Connection::SendRemoteEvents()
 
 void Connection::SendPackages()
 {
-    while (!uploads_.empty())
+    if (uploads_.empty())
+        return;
+
+    auto* network = GetSubsystem<Network>();
+
+    // Refill budget once per network update
+    const unsigned bandwidth = network->GetPackageUploadBandwidth();
+    const unsigned updateBudget = GetPackageUploadUpdateBudget(bandwidth, network->GetUpdateFps());
+    packageUploadBudget_ = RefillPackageUploadBudget(packageUploadBudget_, bandwidth, network->GetUpdateFps());
+
+    if (!packageReader_)
+        packageReader_ = ea::make_unique<AsyncFileIO>();
+
+    // Mark completed reads
+    packageReadResults_.clear();
+    packageReader_->PollCompleted(packageReadResults_);
+    for (const AsyncReadResult& result : packageReadResults_)
+    {
+        for (auto& item : uploads_)
+        {
+            PackageUpload& upload = item.second;
+            auto chunkIter = ea::find_if(upload.chunks_.begin(), upload.chunks_.end(),
+                [&](const PackageUploadChunk& chunk) { return chunk.readId_ == result.id_; });
+            if (chunkIter != upload.chunks_.end())
+            {
+                chunkIter->readId_ = 0;
+                upload.failed_ |= !result.success_;
+                break;
+            }
+        }
+    }
+
+    for (auto i = uploads_.begin(); i != uploads_.end();)
     {
-        unsigned char buffer[PACKAGE_FRAGMENT_SIZE];
+        auto current = i++;
+        PackageUpload& upload = current->second;
 
-        for (auto i = uploads_.begin(); i != uploads_.end();)
+        if (upload.failed_)
         {
-            auto current = i++;
-            PackageUpload& upload = current->second;
-            auto fragmentSize =
-                (unsigned)Min((int)(upload.file_->GetSize() - upload.file_->GetPosition()), (int)PACKAGE_FRAGMENT_SIZE);
-            upload.file_->Read(buffer, fragmentSize);
+            // Chunk buffers must outlive pending reads
+            const bool readsPending = ea::any_of(upload.chunks_.begin(), upload.chunks_.end(),
+                [](const PackageUploadChunk& chunk) { return chunk.readId_ != 0; });
+            if (!readsPending)
+            {
+                URHO3D_LOGERROR("Failed to read package file " + upload.file_->GetName());
+                SendPackageError(current->first);
+                uploads_.erase(current);
+            }
+            continue;
+        }
+
+        // Read chunks of about one update worth of data, aligned to delta blocks
+        const unsigned alignment = upload.deltaBlockSize_ ? upload.deltaBlockSize_ : network->GetPackageFragmentSize();
+        ReadPackageChunks(upload, GetPackageChunkSize(updateBudget, alignment));
+
+        const bool budgetLeft = SendPackageChunks(current->first, upload);
+        if (upload.offset_ == upload.file_->GetSize())
+            uploads_.erase(current);
+
+        if (!budgetLeft)
+            break;
+    }
+}
+
+void Connection::ReadPackageChunks(PackageUpload& upload, unsigned chunkSize)
+{
+    const unsigned fileSize = upload.file_->GetSize();
+    while (upload.chunks_.size() < NUM_PACKAGE_CHUNKS_READ_AHEAD && upload.readOffset_ < fileSize)
+    {
+        const unsigned chunkEnd = GetPackageChunkEnd(upload.readOffset_, chunkSize, upload.deltaBlockSize_, fileSize);
+
+        PackageUploadChunk& chunk = upload.chunks_.push_back();
+        chunk.offset_ = upload.readOffset_;
+        chunk.data_.resize(chunkEnd - upload.readOffset_);
+        chunk.readId_ = packageReader_->Read(upload.file_, chunk.offset_, chunk.data_.data(), chunk.data_.size());
+        upload.readOffset_ = chunkEnd;
+
+        // Fall back to reading on the main thread
+        if (!chunk.readId_)
+        {
+            upload.file_->Seek(chunk.offset_);
+            if (upload.file_->Read(chunk.data_.data(), chunk.data_.size()) != chunk.data_.size())
+            {
+                upload.failed_ = true;
+                break;
+            }
+        }
+    }
+}
+
+bool Connection::SendPackageChunks(StringHash nameHash, PackageUpload& upload)
+{
+    const unsigned fragmentSize = GetSubsystem<Network>()->GetPackageFragmentSize();
+    const unsigned blockSize = upload.deltaBlockSize_;
+
+    while (!upload.chunks_.empty() && !upload.chunks_.front().readId_)
+    {
+        const PackageUploadChunk& chunk = upload.chunks_.front();
+        const unsigned chunkEnd = chunk.offset_ + chunk.data_.size();
+
+        while (upload.offset_ < chunkEnd)
+        {
+            if (packageUploadBudget_ <= 0)
+                return false;
+
+            const unsigned char* data = chunk.data_.data() + (upload.offset_ - chunk.offset_);
+
+            // Let the client copy whole block from its older version if it has the same one
+            if (blockSize && upload.offset_ % blockSize == 0 && upload.offset_ + blockSize <= chunkEnd)
+            {
+                auto blockIter = upload.deltaBlocks_.find(HashPackageBlock(data, blockSize));
+                if (blockIter != upload.deltaBlocks_.end())
+                {
+                    msg_.Clear();
+                    msg_.WriteStringHash(nameHash);
+                    msg_.WriteUInt(upload.offset_);
+                    msg_.WriteUInt(blockIter->second);
+                    msg_.WriteUInt(blockSize);
+                    SendMessage(MSG_PACKAGEBLOCKCOPY, true, true, msg_);
+
+                    packageUploadBudget_ -= msg_.GetSize();
+                    upload.offset_ += blockSize;
+                    continue;
+                }
+            }
+
+            // Fragments do not cross block boundaries so that the next block can be copied
+            const unsigned size = GetPackageFragmentSize(upload.offset_, chunkEnd, fragmentSize, blockSize);
 
             msg_.Clear();
-            msg_.WriteStringHash(current->first);
-            msg_.WriteUInt(upload.fragment_++);
-            msg_.Write(buffer, fragmentSize);
-            SendMessage(MSG_PACKAGEDATA, true, false, msg_);
+            msg_.WriteStringHash(nameHash);
+            msg_.WriteUInt(upload.offset_);
+            msg_.Write(data, size);
+            SendMessage(MSG_PACKAGEDATA, true, true, msg_);
 
-            // Check if upload finished
-            if (upload.fragment_ == upload.totalFragments_)
-                uploads_.erase(current);
+            packageUploadBudget_ -= msg_.GetSize();
+            upload.offset_ += size;
         }
+
+        upload.chunks_.pop_front();
     }
+    return true;
 }
 
 void Connection::SendBuffer(PacketType type)
@@ -494,6 +602,7 @@ bool Connection::ProcessMessage(int msgID, MemoryBuffer& buffer)
 
             case MSG_REQUESTPACKAGE:
             case MSG_PACKAGEDATA:
+            case MSG_PACKAGEBLOCKCOPY:
                 ProcessPackageDownload(msgID, msg);
                 break;
 
@@ -850,103 +959,155 @@ void Connection::ProcessPackageDownload(int msgID, MemoryBuffer& msg)
                     if (!file->IsOpen())
                     {
                         URHO3D_LOGERROR("Failed to transmit package file " + name);
-                        SendPackageError(name);
+                        SendPackageError(nameHash);
                         return;
                     }
 
-                    URHO3D_LOGINFO("Transmitting package file " + name + " to client " + ToString());
+                    // Resume from the end of partially downloaded file
+                    const unsigned resumeOffset = Min(msg.ReadUInt(), file->GetSize());
+                    if (resumeOffset)
+                    {
+                        URHO3D_LOGINFO("Resuming transmission of package file {} to client {} from offset {}",
+                            name, ToString(), resumeOffset);
+                    }
+                    else
+                        URHO3D_LOGINFO("Transmitting package file " + name + " to client " + ToString());
+
+                    // Client already has all data, send empty data message so it completes the download
+                    if (resumeOffset == file->GetSize())
+                    {
+                        msg_.Clear();
+                        msg_.WriteStringHash(nameHash);
+                        msg_.WriteUInt(resumeOffset);
+                        SendMessage(MSG_PACKAGEDATA, true, true, msg_);
+                        return;
+                    }
+
+                    PackageUpload& upload = uploads_[nameHash];
+                    upload.file_ = file;
+                    upload.offset_ = resumeOffset;
+                    upload.readOffset_ = resumeOffset;
 
-                    uploads_[nameHash].file_ = file;
-                    uploads_[nameHash].fragment_ = 0;
-                    uploads_[nameHash].totalFragments_ = (file->GetSize() + PACKAGE_FRAGMENT_SIZE - 1) / PACKAGE_FRAGMENT_SIZE;
+                    // Remember blocks of older version of the package that the client has
+                    const unsigned blockSize = msg.ReadVLE();
+                    const unsigned numBlocks = msg.ReadVLE();
+                    if (blockSize >= MIN_PACKAGE_FRAGMENT_SIZE && blockSize <= MAX_PACKAGE_CHUNK_SIZE && numBlocks)
+                    {
+                        upload.deltaBlockSize_ = blockSize;
+                        for (unsigned j = 0; j < numBlocks && !msg.IsEof(); ++j)
+                            upload.deltaBlocks_.emplace(msg.ReadUInt64(), j * blockSize);
+                    }
                     return;
                 }
             }
 
             URHO3D_LOGERROR("Client requested an unexpected package file " + name);
             // Send the name hash only to indicate a failed download
-            SendPackageError(name);
+            SendPackageError(StringHash(name));
             return;
         }
         break;
 
     case MSG_PACKAGEDATA:
+    case MSG_PACKAGEBLOCKCOPY:
         if (IsClient())
         {
-            URHO3D_LOGWARNING("Received unexpected PackageData message from client");
+            URHO3D_LOGWARNING("Received unexpected package data message from client");
             return;
         }
         else
-        {
-            StringHash nameHash = msg.ReadStringHash();
+            ProcessPackageData(msgID, msg);
+        break;
 
-            auto i = downloads_.find(nameHash);
-            // In case of being unable to create the package file into the cache, we will still receive all data from the server.
-            // Simply disregard it
-            if (i == downloads_.end())
-                return;
+    default: break;
+    }
+}
 
-            PackageDownload& download = i->second;
+void Connection::ProcessPackageData(int msgID, MemoryBuffer& msg)
+{
+    StringHash nameHash = msg.ReadStringHash();
 
-            // If no further data, this is an error reply
-            if (msg.IsEof())
-            {
-                OnPackageDownloadFailed(download.name_);
-                return;
-            }
+    auto i = downloads_.find(nameHash);
+    // In case of being unable to create the package file into the cache, we will still receive all data from the server.
+    // Simply disregard it
+    if (i == downloads_.end())
+        return;
 
-            // If file has not yet been opened, try to open now. Prepend the checksum to the filename to allow multiple versions
-            if (!download.file_)
-            {
-                download.file_ = new File(context_,
-                    GetSubsystem<Network>()->GetPackageCacheDir() + ToStringHex(download.checksum_) + "_" + download.name_,
-                    FILE_WRITE);
-                if (!download.file_->IsOpen())
-                {
-                    OnPackageDownloadFailed(download.name_);
-                    return;
-                }
-            }
+    PackageDownload& download = i->second;
 
-            // Write the fragment data to the proper index
-            unsigned char buffer[PACKAGE_FRAGMENT_SIZE];
-            unsigned index = msg.ReadUInt();
-            unsigned fragmentSize = msg.GetSize() - msg.GetPosition();
+    // If no further data, this is an error reply
+    if (msg.IsEof())
+    {
+        OnPackageDownloadFailed(download.name_);
+        return;
+    }
 
-            msg.Read(buffer, fragmentSize);
-            download.file_->Seek(index * PACKAGE_FRAGMENT_SIZE);
-            download.file_->Write(buffer, fragmentSize);
-            download.receivedFragments_.insert(index);
+    if (!download.file_ || !download.file_->IsOpen())
+    {
+        OnPackageDownloadFailed(download.name_);
+        return;
+    }
 
-            // Check if all fragments received
-            if (download.receivedFragments_.size() == download.totalFragments_)
-            {
-                URHO3D_LOGINFO("Package " + download.name_ + " downloaded successfully");
+    // Data is sent in order, so it is always appended to the end of the file
+    const unsigned offset = msg.ReadUInt();
+    if (offset != download.receivedBytes_)
+    {
+        URHO3D_LOGERROR("Received data of package {} at offset {}, expected offset {}", download.name_, offset,
+            download.receivedBytes_);
+        OnPackageDownloadFailed(download.name_);
+        return;
+    }
 
-                // Instantiate the package and add to the resource system, as we will need it to load the scene
-                download.file_->Close();
-                GetSubsystem<ResourceCache>()->AddPackageFile(download.file_->GetName(), 0);
+    if (msgID == MSG_PACKAGEDATA)
+    {
+        const unsigned size = msg.GetSize() - msg.GetPosition();
+        if (!download.AppendData(msg.GetData() + msg.GetPosition(), size))
+        {
+            URHO3D_LOGERROR("Failed to write data of package {}", download.name_);
+            OnPackageDownloadFailed(download.name_);
+            return;
+        }
+    }
+    else
+    {
+        const unsigned sourceOffset = msg.ReadUInt();
+        const unsigned size = msg.ReadUInt();
+        if (!download.AppendBlockCopy(sourceOffset, size))
+        {
+            URHO3D_LOGERROR("Failed to copy block of package {} from older version", download.name_);
+            OnPackageDownloadFailed(download.name_);
+            return;
+        }
+    }
 
-                // Then start the next download if there are more
-                downloads_.erase(i);
-                if (downloads_.empty())
-                    OnPackagesReady();
-                else
-                {
-                    PackageDownload& nextDownload = downloads_.begin()->second;
+    if (!download.IsComplete())
+        return;
 
-                    URHO3D_LOGINFO("Requesting package " + nextDownload.name_ + " from server");
-                    msg_.Clear();
-                    msg_.WriteString(nextDownload.name_);
-                    SendMessage(MSG_REQUESTPACKAGE, true, true, msg_);
-                    nextDownload.initiated_ = true;
-                }
-            }
+    // Instantiate the package and add to the resource system, as we will need it to load the scene
+    SharedPtr<PackageFile> package = download.Finalize(context_);
+    if (!package)
+    {
+        // Copied blocks may mismatch on hash collision and resumed data may be corrupted. Download once again from scratch
+        if (!download.restarted_)
+        {
+            URHO3D_LOGWARNING("Package {} is corrupted, downloading it again without older version", download.name_);
+            download.restarted_ = true;
+            SendPackageRequest(download);
         }
-        break;
-
-    default: break;
+        else
+            OnPackageDownloadFailed(download.name_);
+        return;
     }
+
+    URHO3D_LOGINFO("Package " + download.name_ + " downloaded successfully");
+    GetSubsystem<ResourceCache>()->AddPackageFile(package, 0);
+
+    // Then start the next download if there are more
+    downloads_.erase(i);
+    if (downloads_.empty())
+        OnPackagesReady();
+    else
+        SendPackageRequest(downloads_.begin()->second);
 }
 
 void Connection::ProcessIdentity(int msgID, MemoryBuffer& msg)
@@ -1160,7 +1321,7 @@ float Connection::GetDownloadProgress() const
         downloads_.end(); ++i)
     {
         if (i->second.initiated_)
-            return (float)i->second.receivedFragments_.size() / (float)i->second.totalFragments_;
+            return i->second.fileSize_ ? (float)i->second.receivedBytes_ / (float)i->second.fileSize_ : 0.0f;
     }
     return 1.0f;
 }
@@ -1568,25 +1729,91 @@ void Connection::RequestPackage(const ea::string& name, unsigned fileSize, unsig
 
     PackageDownload& download = downloads_[nameHash];
     download.name_ = name;
-    download.totalFragments_ = (fileSize + PACKAGE_FRAGMENT_SIZE - 1) / PACKAGE_FRAGMENT_SIZE;
+    download.fileSize_ = fileSize;
     download.checksum_ = checksum;
 
     // Start download now only if no existing downloads, else wait for the existing ones to finish
     if (downloads_.size() == 1)
+        SendPackageRequest(download);
+}
+
+void Connection::SendPackageRequest(PackageDownload& download)
+{
+    auto* network = GetSubsystem<Network>();
+    auto* fileSystem = GetSubsystem<FileSystem>();
+    const ea::string& packageCacheDir = network->GetPackageCacheDir();
+
+    // If the file can not be created, the download fails when the first data is received
+    download.OpenPartialFile(context_, packageCacheDir);
+
+    msg_.Clear();
+    msg_.WriteString(download.name_);
+    msg_.WriteUInt(download.receivedBytes_);
+
+    // Look for older version of the package in the resource cache and in the download cache
+    const unsigned blockSize = network->GetPackageDeltaBlockSize();
+    ea::string deltaSourceName;
+    if (blockSize && !download.restarted_ && !download.IsComplete())
     {
-        URHO3D_LOGINFO("Requesting package " + name + " from server");
-        msg_.Clear();
-        msg_.WriteString(name);
-        SendMessage(MSG_REQUESTPACKAGE, true, true, msg_);
-        download.initiated_ = true;
+        for (PackageFile* package : GetSubsystem<ResourceCache>()->GetPackageFiles())
+        {
+            if (!GetFileNameAndExtension(package->GetName()).comparei(download.name_))
+            {
+                deltaSourceName = package->GetName();
+                break;
+            }
+        }
+
+        if (deltaSourceName.empty() && !packageCacheDir.empty())
+        {
+            ea::vector<ea::string> downloadedPackages;
+            fileSystem->ScanDir(downloadedPackages, packageCacheDir, "*.*", SCAN_FILES, false);
+            for (const ea::string& fileName : downloadedPackages)
+            {
+                // In download cache, package file name format is checksum_packagename
+                if (fileName.length() == download.name_.length() + 9 && !fileName.substr(9).comparei(download.name_))
+                {
+                    deltaSourceName = packageCacheDir + fileName;
+                    break;
+                }
+            }
+        }
     }
+
+    download.deltaSource_ = nullptr;
+    if (!deltaSourceName.empty())
+    {
+        download.deltaSource_ = new File(context_, deltaSourceName);
+        const unsigned numBlocks = download.deltaSource_->IsOpen() ? download.deltaSource_->GetSize() / blockSize : 0;
+        if (numBlocks)
+        {
+            URHO3D_LOGINFO("Requesting package {} from server, patching {}", download.name_, deltaSourceName);
+            msg_.WriteVLE(blockSize);
+            msg_.WriteVLE(numBlocks);
+
+            ByteVector block(blockSize);
+            for (unsigned i = 0; i < numBlocks; ++i)
+            {
+                download.deltaSource_->Read(block.data(), blockSize);
+                msg_.WriteUInt64(HashPackageBlock(block.data(), blockSize));
+            }
+        }
+        else
+            download.deltaSource_ = nullptr;
+    }
+
+    if (!download.deltaSource_)
+        URHO3D_LOGINFO("Requesting package " + download.name_ + " from server");
+
+    SendMessage(MSG_REQUESTPACKAGE, true, true, msg_);
+    download.initiated_ = true;
 }
 
-void Connection::SendPackageError(const ea::string& name)
+void Connection::SendPackageError(StringHash nameHash)
 {
     msg_.Clear();
-    msg_.WriteStringHash(name);
-    SendMessage(MSG_PACKAGEDATA, true, false, msg_);
+    msg_.WriteStringHash(nameHash);
+    SendMessage(MSG_PACKAGEDATA, true, true, msg_);
 }
 
 void Connection::OnSceneLoadFailed()
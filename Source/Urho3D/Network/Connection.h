@@ -29,7 +29,9 @@
 #include "../Core/Object.h"
 #include "../Core/Timer.h"
 #include "../Input/Controls.h"
+#include "../IO/AsyncFileIO.h"
 #include "../IO/VectorBuffer.h"
+#include "../Network/PackageTransfer.h"
 #include "../Scene/ReplicationState.h"
 
 namespace SLNet
@@ -65,40 +67,6 @@ struct RemoteEvent
     bool inOrder_;
 };
 
-/// Package file receive transfer.
-struct PackageDownload
-{
-    /// Construct with defaults.
-    PackageDownload();
-
-    /// Destination file.
-    SharedPtr<File> file_;
-    /// Already received fragments.
-    ea::hash_set<unsigned> receivedFragments_;
-    /// Package name.
-    ea::string name_;
-    /// Total number of fragments.
-    unsigned totalFragments_;
-    /// Checksum.
-    unsigned checksum_;
-    /// Download initiated flag.
-    bool initiated_;
-};
-
-/// Package file send transfer.
-struct PackageUpload
-{
-    /// Construct with defaults.
-    PackageUpload();
-
-    /// Source file.
-    SharedPtr<File> file_;
-    /// Current fragment index.
-    unsigned fragment_;
-    /// Total number of fragments.
-    unsigned totalFragments_;
-};
-
 /// Send modes for observer position/rotation. Activated by the client setting either position or rotation.
 enum ObserverPositionSendMode
 {
@@ -315,8 +283,16 @@ private:
     bool RequestNeededPackages(unsigned numPackages, MemoryBuffer& msg);
     /// Initiate a package download.
     void RequestPackage(const ea::string& name, unsigned fileSize, unsigned checksum);
+    /// Send request for package download, resuming partial download and describing older version of the package if available.
+    void SendPackageRequest(PackageDownload& download);
+    /// Handle received package data or copied block.
+    void ProcessPackageData(int msgID, MemoryBuffer& msg);
+    /// Start reads of package file ahead of sending.
+    void ReadPackageChunks(PackageUpload& upload, unsigned chunkSize);
+    /// Send data of package upload within budget. Return false if budget is exhausted.
+    bool SendPackageChunks(StringHash nameHash, PackageUpload& upload);
     /// Send an error reply for a package download.
-    void SendPackageError(const ea::string& name);
+    void SendPackageError(StringHash nameHash);
     /// Handle scene load failure on the server or client.
     void OnSceneLoadFailed();
     /// Handle a package download failure on the client.
@@ -332,6 +308,12 @@ private:
     ea::unordered_map<StringHash, PackageDownload> downloads_;
     /// Ongoing package send transfers.
     ea::unordered_map<StringHash, PackageUpload> uploads_;
+    /// Reader of package files for uploads. Destroyed before uploads to complete reads into their chunks.
+    ea::unique_ptr<AsyncFileIO> packageReader_;
+    /// Completed package file reads.
+    ea::vector<AsyncReadResult> packageReadResults_;
+    /// Bytes that package uploads may send during current network update. Negative if previous updates overspent.
+    int packageUploadBudget_{};
     /// Pending latest data for not yet received nodes.
     ea::unordered_map<unsigned, ea::vector<unsigned char> > nodeLatestData_;
     /// Pending latest data for not yet received components.
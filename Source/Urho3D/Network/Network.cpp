@@ -200,6 +200,9 @@ Network::Network(Context* context) :
     simulatedPacketLoss_(0.0f),
     updateInterval_(1.0f / (float)DEFAULT_UPDATE_FPS),
     updateAcc_(0.0f),
+    packageFragmentSize_(PACKAGE_FRAGMENT_SIZE),
+    packageUploadBandwidth_(DEFAULT_PACKAGE_UPLOAD_BANDWIDTH),
+    packageDeltaBlockSize_(PACKAGE_DELTA_BLOCK_SIZE),
     isServer_(false),
     scene_(nullptr),
     natPunchServerAddress_(nullptr),
@@ -615,6 +618,11 @@ void Network::SetPackageCacheDir(const ea::string& path)
     packageCacheDir_ = AddTrailingSlash(path);
 }
 
+void Network::SetPackageFragmentSize(unsigned size)
+{
+    packageFragmentSize_ = Clamp(size, MIN_PACKAGE_FRAGMENT_SIZE, MAX_PACKAGE_FRAGMENT_SIZE);
+}
+
 void Network::SendPackageToClients(Scene* scene, PackageFile* package)
 {
     if (!scene)
@@ -104,6 +104,15 @@ public:
     /// Set the package download cache directory.
     /// @property
     void SetPackageCacheDir(const ea::string& path);
+    /// Set size of package file fragments sent to clients.
+    /// @property
+    void SetPackageFragmentSize(unsigned size);
+    /// Set bandwidth in bytes per second available to package uploads of each client connection. Zero is unlimited.
+    /// @property
+    void SetPackageUploadBandwidth(unsigned bytesPerSecond) { packageUploadBandwidth_ = bytesPerSecond; }
+    /// Set block size used to patch older versions of downloaded packages instead of downloading them completely. Zero disables patching.
+    /// @property
+    void SetPackageDeltaBlockSize(unsigned size) { packageDeltaBlockSize_ = size; }
     /// Trigger all client connections in the specified scene to download a package file from the server. Can be used to download additional resource packages when clients are already joined in the scene. The package must have been added as a requirement to the scene, or else the eventual download will fail.
     void SendPackageToClients(Scene* scene, PackageFile* package);
     /// Perform an HTTP request to the specified URL. Empty verb defaults to a GET request. Return a request object which can be used to read the response data.
@@ -139,6 +148,15 @@ public:
     /// Return the package download cache directory.
     /// @property
     const ea::string& GetPackageCacheDir() const { return packageCacheDir_; }
+    /// Return size of package file fragments sent to clients.
+    /// @property
+    unsigned GetPackageFragmentSize() const { return packageFragmentSize_; }
+    /// Return bandwidth in bytes per second available to package uploads of each client connection.
+    /// @property
+    unsigned GetPackageUploadBandwidth() const { return packageUploadBandwidth_; }
+    /// Return block size used to patch older versions of downloaded packages.
+    /// @property
+    unsigned GetPackageDeltaBlockSize() const { return packageDeltaBlockSize_; }
 
     /// Process incoming messages from connections. Called by HandleBeginFrame.
     void Update(float timeStep);
@@ -187,6 +205,12 @@ private:
     float updateAcc_;
     /// Package cache directory.
     ea::string packageCacheDir_;
+    /// Package file fragment size.
+    unsigned packageFragmentSize_;
+    /// Package upload bandwidth per client connection.
+    unsigned packageUploadBandwidth_;
+    /// Block size for package patching.
+    unsigned packageDeltaBlockSize_;
     /// Whether we started as server or not.
     bool isServer_;
     /// Server/Client password used for connecting.
@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2008-2020 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#include "../Precompiled.h"
+
+#include "../Core/Context.h"
+#include "../IO/File.h"
+#include "../IO/FileSystem.h"
+#include "../IO/Log.h"
+#include "../IO/PackageFile.h"
+#include "../Math/MathDefs.h"
+#include "../Network/PackageTransfer.h"
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+/// Suffix of package files that are not completely downloaded yet.
+static const char* PARTIAL_PACKAGE_SUFFIX = ".part";
+
+PackageDownload::PackageDownload() :
+    fileSize_(0),
+    receivedBytes_(0),
+    checksum_(0),
+    initiated_(false),
+    restarted_(false)
+{
+}
+
+bool PackageDownload::OpenPartialFile(Context* context, const ea::string& packageCacheDir)
+{
+    // Prepend the checksum to the filename to allow multiple versions. Continue partial download of the same version
+    const ea::string partialFileName =
+        packageCacheDir + ToStringHex(checksum_) + "_" + name_ + PARTIAL_PACKAGE_SUFFIX;
+
+    file_ = nullptr;
+    receivedBytes_ = 0;
+    if (context->GetSubsystem<FileSystem>()->FileExists(partialFileName))
+    {
+        file_ = MakeShared<File>(context, partialFileName, FILE_READWRITE);
+        if (file_->IsOpen() && file_->GetSize() <= fileSize_)
+            receivedBytes_ = file_->GetSize();
+        else
+            file_ = nullptr;
+    }
+    if (!file_)
+        file_ = MakeShared<File>(context, partialFileName, FILE_WRITE);
+
+    if (!file_->IsOpen())
+        return false;
+
+    file_->Seek(receivedBytes_);
+    return true;
+}
+
+bool PackageDownload::AppendData(const void* data, unsigned size)
+{
+    if (!file_ || !file_->IsOpen() || file_->Write(data, size) != size)
+        return false;
+
+    receivedBytes_ += size;
+    return true;
+}
+
+bool PackageDownload::AppendBlockCopy(unsigned sourceOffset, unsigned size)
+{
+    ByteVector buffer(size);
+    if (!deltaSource_ || deltaSource_->Seek(sourceOffset) != sourceOffset
+        || deltaSource_->Read(buffer.data(), size) != size)
+        return false;
+
+    return AppendData(buffer.data(), size);
+}
+
+SharedPtr<PackageFile> PackageDownload::Finalize(Context* context)
+{
+    if (!file_)
+        return nullptr;
+
+    // Replace temporary file with complete one
+    const ea::string partialFileName = file_->GetName();
+    file_->Close();
+    file_ = nullptr;
+    deltaSource_ = nullptr;
+
+    auto* fileSystem = context->GetSubsystem<FileSystem>();
+    const ea::string fileName = partialFileName.substr(0, partialFileName.length() - strlen(PARTIAL_PACKAGE_SUFFIX));
+    if (fileSystem->FileExists(fileName))
+        fileSystem->Delete(fileName);
+    if (!fileSystem->Rename(partialFileName, fileName))
+    {
+        URHO3D_LOGERROR("Failed to rename downloaded package {}", partialFileName);
+        fileSystem->Delete(partialFileName);
+        return nullptr;
+    }
+
+    auto package = MakeShared<PackageFile>(context, fileName);
+    if (package->GetTotalSize() != fileSize_ || package->GetChecksum() != checksum_)
+    {
+        URHO3D_LOGERROR("Downloaded package {} has unexpected size or checksum", fileName);
+        package = nullptr;
+        fileSystem->Delete(fileName);
+        return nullptr;
+    }
+
+    return package;
+}
+
+PackageUpload::PackageUpload() :
+    offset_(0),
+    readOffset_(0),
+    deltaBlockSize_(0),
+    failed_(false)
+{
+}
+
+unsigned long long HashPackageBlock(const unsigned char* data, unsigned size)
+{
+    // 64-bit FNV-1a
+    unsigned long long hash = 14695981039346656037ULL;
+    for (unsigned i = 0; i < size; ++i)
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    return hash;
+}
+
+unsigned GetPackageUploadUpdateBudget(unsigned bandwidth, int updateFps)
+{
+    if (!bandwidth)
+        return MAX_PACKAGE_CHUNK_SIZE;
+    return Max(bandwidth / static_cast<unsigned>(Max(updateFps, 1)), 1u);
+}
+
+int RefillPackageUploadBudget(int budget, unsigned bandwidth, int updateFps)
+{
+    if (!bandwidth)
+        return M_MAX_INT;
+
+    const auto updateBudget = static_cast<int>(Min(GetPackageUploadUpdateBudget(bandwidth, updateFps),
+        static_cast<unsigned>(M_MAX_INT / 2)));
+    // Unlimited budget from the previous update is not carried over
+    budget = Min(budget, updateBudget);
+    return Min(budget + updateBudget, updateBudget);
+}
+
+unsigned GetPackageChunkSize(unsigned updateBudget, unsigned alignment)
+{
+    const unsigned numBlocks = updateBudget / alignment + (updateBudget % alignment ? 1 : 0);
+    const unsigned maxNumBlocks = Max(MAX_PACKAGE_CHUNK_SIZE / alignment, 1u);
+    return Clamp(numBlocks, 1u, maxNumBlocks) * alignment;
+}
+
+unsigned GetPackageChunkEnd(unsigned offset, unsigned chunkSize, unsigned deltaBlockSize, unsigned fileSize)
+{
+    unsigned chunkEnd = offset + chunkSize;
+    // Chunk size is usually multiple of block size, so aligned end is past the start
+    if (deltaBlockSize && chunkEnd - chunkEnd % deltaBlockSize > offset)
+        chunkEnd -= chunkEnd % deltaBlockSize;
+    return Min(chunkEnd, fileSize);
+}
+
+unsigned GetPackageFragmentSize(unsigned offset, unsigned chunkEnd, unsigned fragmentSize, unsigned deltaBlockSize)
+{
+    unsigned size = Min(fragmentSize, chunkEnd - offset);
+    if (deltaBlockSize)
+        size = Min(size, deltaBlockSize - offset % deltaBlockSize);
+    return size;
+}
+
+}
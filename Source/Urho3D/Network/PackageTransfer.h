@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2008-2020 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+
+#pragma once
+
+#include "../Container/ByteVector.h"
+#include "../Container/Ptr.h"
+
+#include <EASTL/deque.h>
+#include <EASTL/unordered_map.h>
+
+namespace Urho3D
+{
+
+class Context;
+class File;
+class PackageFile;
+
+/// Max size of package file range read at once for uploading.
+static const unsigned MAX_PACKAGE_CHUNK_SIZE = 4 * 1024 * 1024;
+
+/// Package file receive transfer.
+struct URHO3D_API PackageDownload
+{
+    /// Construct with defaults.
+    PackageDownload();
+
+    /// Open temporary file in the download cache directory. Partial download of the same package version is continued.
+    /// Return false if the file cannot be opened.
+    bool OpenPartialFile(Context* context, const ea::string& packageCacheDir);
+    /// Append received data to the end of the file. Return false if write failed.
+    bool AppendData(const void* data, unsigned size);
+    /// Append block copied from the older version of the package. Return false if read or write failed.
+    bool AppendBlockCopy(unsigned sourceOffset, unsigned size);
+    /// Return whether the whole package is received.
+    bool IsComplete() const { return receivedBytes_ >= fileSize_; }
+    /// Rename complete temporary file and verify size and checksum of the package.
+    /// The file is deleted on failure, so the download may be restarted from scratch. Return null on failure.
+    SharedPtr<PackageFile> Finalize(Context* context);
+
+    /// Destination file. Data is received into temporary file which is renamed when download is complete.
+    SharedPtr<File> file_;
+    /// Older version of the package used as source of unchanged blocks.
+    SharedPtr<File> deltaSource_;
+    /// Package name.
+    ea::string name_;
+    /// Total size of package file.
+    unsigned fileSize_;
+    /// Number of bytes received, including bytes received before reconnect.
+    unsigned receivedBytes_;
+    /// Checksum.
+    unsigned checksum_;
+    /// Download initiated flag.
+    bool initiated_;
+    /// Whether download was restarted from scratch after failed verification. Older version of the package is not used then.
+    bool restarted_;
+};
+
+/// Range of package file that is read for sending.
+struct PackageUploadChunk
+{
+    /// Read data.
+    ByteVector data_;
+    /// Offset in file.
+    unsigned offset_{};
+    /// Asynchronous read request, or 0 if data is ready.
+    unsigned readId_{};
+};
+
+/// Package file send transfer.
+struct PackageUpload
+{
+    /// Construct with defaults.
+    PackageUpload();
+
+    /// Source file.
+    SharedPtr<File> file_;
+    /// Offset of next byte to send.
+    unsigned offset_;
+    /// Offset of next byte to read.
+    unsigned readOffset_;
+    /// Block size of client's older version of the package, or 0 if client has no older version.
+    unsigned deltaBlockSize_;
+    /// Hashes of blocks of client's older version of the package, mapped to block offsets.
+    ea::unordered_map<unsigned long long, unsigned> deltaBlocks_;
+    /// Chunks that are read or being read, in file order.
+    ea::deque<PackageUploadChunk> chunks_;
+    /// Whether read failed and transfer is cancelled once pending reads are completed.
+    bool failed_;
+};
+
+/// Return hash of package file block. Used to find blocks that are unchanged between package versions.
+URHO3D_API unsigned long long HashPackageBlock(const unsigned char* data, unsigned size);
+/// Return bytes that package uploads of one connection may send during one network update. Zero bandwidth is unlimited.
+URHO3D_API unsigned GetPackageUploadUpdateBudget(unsigned bandwidth, int updateFps);
+/// Return package upload budget refilled for the next network update. Overspent bytes are subtracted from the refill,
+/// unused bytes are not accumulated to avoid bursts.
+URHO3D_API int RefillPackageUploadBudget(int budget, unsigned bandwidth, int updateFps);
+/// Return size of package file range read at once: one update worth of data rounded up to alignment, limited by MAX_PACKAGE_CHUNK_SIZE.
+URHO3D_API unsigned GetPackageChunkSize(unsigned updateBudget, unsigned alignment);
+/// Return end of package file range read at offset. The end is aligned to delta blocks unless it's the end of file.
+URHO3D_API unsigned GetPackageChunkEnd(unsigned offset, unsigned chunkSize, unsigned deltaBlockSize, unsigned fileSize);
+/// Return size of package data fragment sent at offset. Fragments do not cross delta block boundaries.
+URHO3D_API unsigned GetPackageFragmentSize(unsigned offset, unsigned chunkEnd, unsigned fragmentSize, unsigned deltaBlockSize);
+
+}
@@ -63,6 +63,8 @@ static const int MSG_REMOTEEVENT = 0x96;
 static const int MSG_REMOTENODEEVENT = 0x97;
 /// Server->client: info about package.
 static const int MSG_PACKAGEINFO = 0x98;
+/// Server->client: copy unchanged block of package file from older version the client has.
+static const int MSG_PACKAGEBLOCKCOPY = 0x9A;
 
 /// Packet that includes all the above messages
 static const int MSG_PACKED_MESSAGE = 0x99;
@@ -72,7 +74,15 @@ static const int MSG_USER = 0x200;
 
 /// Fixed content ID for client controls update.
 static const unsigned CONTROLS_CONTENT_ID = 1;
-/// Package file fragment size.
-static const unsigned PACKAGE_FRAGMENT_SIZE = 1024;
+/// Default package file fragment size.
+static const unsigned PACKAGE_FRAGMENT_SIZE = 16 * 1024;
+/// Min package file fragment size.
+static const unsigned MIN_PACKAGE_FRAGMENT_SIZE = 1024;
+/// Max package file fragment size.
+static const unsigned MAX_PACKAGE_FRAGMENT_SIZE = 256 * 1024;
+/// Default package upload bandwidth per client connection, in bytes per second.
+static const unsigned DEFAULT_PACKAGE_UPLOAD_BANDWIDTH = 1024 * 1024;
+/// Default block size for patching older versions of packages.
+static const unsigned PACKAGE_DELTA_BLOCK_SIZE = 64 * 1024;
 
 }
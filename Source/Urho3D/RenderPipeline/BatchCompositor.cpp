@@ -241,9 +241,14 @@ void BatchCompositor::ComposeShadowBatches()
         const unsigned numSplits = lightProcessor->GetNumSplits();
         for (unsigned splitIndex = 0; splitIndex < numSplits; ++splitIndex)
         {
+            // Skip splits reused from previous frame
+            ShadowSplitProcessor* split = lightProcessor->GetMutableSplit(splitIndex);
+            if (split->IsShadowMapReused())
+                continue;
+
             workQueue_->AddWorkItem([=](unsigned threadIndex)
             {
-                BeginShadowBatchesComposition(lightIndex, lightProcessor->GetMutableSplit(splitIndex));
+                BeginShadowBatchesComposition(lightIndex, split);
             }, M_MAX_UNSIGNED);
         }
     }
@@ -323,6 +328,7 @@ void BatchCompositor::BeginShadowBatchesComposition(unsigned lightIndex, ShadowS
     const auto& shadowCasters = splitProcessor->GetShadowCasters();
     auto& shadowBatches = splitProcessor->GetMutableUnsortedShadowBatches();
     const unsigned lightMask = splitProcessor->GetLight()->GetLightMask();
+    const bool isShadowMapCached = lightProcessor->IsShadowMapCached();
 
     for (Drawable* drawable : shadowCasters)
     {
@@ -330,12 +336,12 @@ void BatchCompositor::BeginShadowBatchesComposition(unsigned lightIndex, ShadowS
         if ((drawable->GetShadowMaskInZone() & lightMask) == 0)
             continue;
 
-        // Check shadow distance
+        // Check shadow distance. Cached shadow maps should not depend on cull camera, so ignore distance for them.
         float maxShadowDistance = drawable->GetShadowDistance();
         const float drawDistance = drawable->GetDrawDistance();
         if (drawDistance > 0.0f && (maxShadowDistance <= 0.0f || drawDistance < maxShadowDistance))
             maxShadowDistance = drawDistance;
-        if (maxShadowDistance > 0.0f && drawable->GetDistance() > maxShadowDistance)
+        if (!isShadowMapCached && maxShadowDistance > 0.0f && drawable->GetDistance() > maxShadowDistance)
             continue;
 
         // Add batches
@@ -343,6 +349,9 @@ void BatchCompositor::BeginShadowBatchesComposition(unsigned lightIndex, ShadowS
         for (unsigned j = 0; j < sourceBatches.size(); ++j)
         {
             const SourceBatch& sourceBatch = sourceBatches[j];
+            if (!sourceBatch.geometry_)
+                continue;
+
             Material* material = sourceBatch.material_ ? sourceBatch.material_ : defaultMaterial_;
             Technique* tech = material->FindTechnique(drawable, shadowMaterialQuality_);
             Pass* pass = tech->GetSupportedPass(shadowPassIndex_);
@@ -23,6 +23,7 @@
 #include "../Precompiled.h"
 
 #include "../Core/Context.h"
+#include "../Core/WorkQueue.h"
 #include "../Graphics/Camera.h"
 #include "../Graphics/DrawCommandQueue.h"
 #include "../Graphics/Graphics.h"
@@ -819,6 +820,16 @@ BatchRenderingContext::BatchRenderingContext(DrawCommandQueue& drawQueue, const
 {
 }
 
+BatchRenderingContext::BatchRenderingContext(DrawCommandQueue& drawQueue, const BatchRenderingContext& other)
+    : drawQueue_(drawQueue)
+    , camera_(other.camera_)
+    , outputShadowSplit_(other.outputShadowSplit_)
+    , globalResources_(other.globalResources_)
+    , frameParameters_(other.frameParameters_)
+    , cameraParameters_(other.cameraParameters_)
+{
+}
+
 BatchRenderer::BatchRenderer(RenderPipelineInterface* renderPipeline, const DrawableProcessor* drawableProcessor,
     InstancingBuffer* instancingBuffer)
     : Object(renderPipeline->GetContext())
@@ -826,6 +837,7 @@ BatchRenderer::BatchRenderer(RenderPipelineInterface* renderPipeline, const Draw
     , debugger_(renderPipeline->GetDebugger())
     , drawableProcessor_(drawableProcessor)
     , instancingBuffer_(instancingBuffer)
+    , workQueue_(context_->GetSubsystem<WorkQueue>())
 {
 }
 
@@ -837,7 +849,18 @@ void BatchRenderer::SetSettings(const BatchRendererSettings& settings)
 void BatchRenderer::RenderBatches(const BatchRenderingContext& ctx, PipelineBatchGroup<PipelineBatchByState> batchGroup)
 {
     batchGroup.flags_ = AdjustRenderFlags(batchGroup.flags_);
+    RenderBatchesImpl(ctx, batchGroup);
+}
+
+void BatchRenderer::RenderBatches(const BatchRenderingContext& ctx, PipelineBatchGroup<PipelineBatchBackToFront> batchGroup)
+{
+    batchGroup.flags_ = AdjustRenderFlags(batchGroup.flags_);
+    RenderBatchesImpl(ctx, batchGroup);
+}
 
+template <class T>
+void BatchRenderer::RenderBatchesImpl(const BatchRenderingContext& ctx, const PipelineBatchGroup<T>& batchGroup)
+{
     if (RenderPipelineDebugger::IsSnapshotInProgress(debugger_))
     {
         DrawCommandCompositor<true> compositor(ctx, settings_, debugger_,
@@ -846,6 +869,11 @@ void BatchRenderer::RenderBatches(const BatchRenderingContext& ctx, PipelineBatc
             compositor.ProcessSceneBatch(*sortedBatch.pipelineBatch_);
         compositor.FlushDrawCommands(batchGroup.startInstance_ + batchGroup.numInstances_);
     }
+    else if (settings_.drawCommandChunkSize_ != 0 && batchGroup.batches_.size() > settings_.drawCommandChunkSize_
+        && workQueue_ && workQueue_->GetNumThreads() > 0)
+    {
+        RenderBatchesInThreads(ctx, batchGroup);
+    }
     else
     {
         DrawCommandCompositor<false> compositor(ctx, settings_, nullptr,
@@ -856,26 +884,68 @@ void BatchRenderer::RenderBatches(const BatchRenderingContext& ctx, PipelineBatc
     }
 }
 
-void BatchRenderer::RenderBatches(const BatchRenderingContext& ctx, PipelineBatchGroup<PipelineBatchBackToFront> batchGroup)
+template <class T>
+void BatchRenderer::RenderBatchesInThreads(const BatchRenderingContext& ctx, const PipelineBatchGroup<T>& batchGroup)
 {
-    batchGroup.flags_ = AdjustRenderFlags(batchGroup.flags_);
+    URHO3D_PROFILE("RenderBatchesInThreads");
 
-    if (RenderPipelineDebugger::IsSnapshotInProgress(debugger_))
+    const unsigned chunkSize = settings_.drawCommandChunkSize_;
+    const unsigned numBatches = batchGroup.batches_.size();
+    const unsigned numChunks = (numBatches + chunkSize - 1) / chunkSize;
+
+    // Chunks should know where their instancing data starts, it is laid out by PrepareInstancingBuffer
+    chunkStartInstances_.resize(numChunks + 1);
+    ObjectParameterBuilder objectParameterBuilder(settings_, batchGroup.flags_);
+    unsigned instanceIndex = batchGroup.startInstance_;
+    for (unsigned i = 0; i < numBatches; ++i)
     {
-        DrawCommandCompositor<true> compositor(ctx, settings_, debugger_,
-            *drawableProcessor_, *instancingBuffer_, batchGroup.flags_, batchGroup.startInstance_);
-        for (const auto& sortedBatch : batchGroup.batches_)
-            compositor.ProcessSceneBatch(*sortedBatch.pipelineBatch_);
-        compositor.FlushDrawCommands(batchGroup.startInstance_ + batchGroup.numInstances_);
+        if (i % chunkSize == 0)
+            chunkStartInstances_[i / chunkSize] = instanceIndex;
+
+        const PipelineBatch& pipelineBatch = *batchGroup.batches_[i].pipelineBatch_;
+        if (objectParameterBuilder.IsBatchInstanced(pipelineBatch))
+        {
+            instanceIndex += pipelineBatch.geometryType_ == GEOM_STATIC
+                ? pipelineBatch.GetSourceBatch().numWorldTransforms_ : 1u;
+        }
     }
-    else
+    chunkStartInstances_[numChunks] = instanceIndex;
+
+    // Allocate chunk queues, they keep their shader parameters and constant buffers between frames
+    auto graphics = context_->GetSubsystem<Graphics>();
+    while (chunkQueues_.size() < numChunks)
+        chunkQueues_.push_back(MakeShared<DrawCommandQueue>(graphics));
+
+    // Update lazily evaluated camera state in main thread
+    const Camera& camera = ctx.camera_;
+    camera.GetNode()->GetWorldTransform();
+    camera.GetEffectiveWorldTransform();
+    camera.GetView();
+    camera.GetProjection();
+
+    const bool useConstantBuffers = ctx.drawQueue_.GetUseConstantBuffers();
+    ForEachParallel(workQueue_, 1u, numChunks, [&](unsigned beginChunk, unsigned endChunk)
     {
-        DrawCommandCompositor<false> compositor(ctx, settings_, nullptr,
-            *drawableProcessor_, *instancingBuffer_, batchGroup.flags_, batchGroup.startInstance_);
-        for (const auto& sortedBatch : batchGroup.batches_)
-            compositor.ProcessSceneBatch(*sortedBatch.pipelineBatch_);
-        compositor.FlushDrawCommands(batchGroup.startInstance_ + batchGroup.numInstances_);
-    }
+        for (unsigned chunkIndex = beginChunk; chunkIndex < endChunk; ++chunkIndex)
+        {
+            DrawCommandQueue& chunkQueue = *chunkQueues_[chunkIndex];
+            chunkQueue.Reset(useConstantBuffers);
+
+            const BatchRenderingContext chunkCtx(chunkQueue, ctx);
+
+            const unsigned beginBatch = chunkIndex * chunkSize;
+            const unsigned endBatch = ea::min(beginBatch + chunkSize, numBatches);
+            DrawCommandCompositor<false> compositor(chunkCtx, settings_, nullptr,
+                *drawableProcessor_, *instancingBuffer_, batchGroup.flags_, chunkStartInstances_[chunkIndex]);
+            for (unsigned i = beginBatch; i < endBatch; ++i)
+                compositor.ProcessSceneBatch(*batchGroup.batches_[i].pipelineBatch_);
+            compositor.FlushDrawCommands(chunkStartInstances_[chunkIndex + 1]);
+        }
+    });
+
+    // Submit chunks in order
+    for (unsigned chunkIndex = 0; chunkIndex < numChunks; ++chunkIndex)
+        ctx.drawQueue_.Append(*chunkQueues_[chunkIndex]);
 }
 
 void BatchRenderer::RenderLightVolumeBatches(const BatchRenderingContext& ctx,
@@ -37,6 +37,7 @@ class Camera;
 class DrawableProcessor;
 class InstancingBuffer;
 class ShadowSplitProcessor;
+class WorkQueue;
 
 /// Common parameters of batch rendering
 struct BatchRenderingContext
@@ -51,6 +52,8 @@ struct BatchRenderingContext
 
     BatchRenderingContext(DrawCommandQueue& drawQueue, const Camera& camera);
     BatchRenderingContext(DrawCommandQueue& drawQueue, const ShadowSplitProcessor& outputShadowSplit);
+    /// Copy context with another draw queue.
+    BatchRenderingContext(DrawCommandQueue& drawQueue, const BatchRenderingContext& other);
 };
 
 /// Utility class to convert pipeline batches into sequence of draw commands.
@@ -78,6 +81,11 @@ public:
     /// @}
 
 private:
+    template <class T>
+    void RenderBatchesImpl(const BatchRenderingContext& ctx, const PipelineBatchGroup<T>& batchGroup);
+    /// Record batches into per-chunk draw queues in worker threads and append them to the context queue.
+    template <class T>
+    void RenderBatchesInThreads(const BatchRenderingContext& ctx, const PipelineBatchGroup<T>& batchGroup);
     template <class T>
     void PrepareInstancingBufferImpl(PipelineBatchGroup<T>& batches);
     BatchRenderFlags AdjustRenderFlags(BatchRenderFlags flags) const;
@@ -88,9 +96,16 @@ private:
     RenderPipelineDebugger* debugger_{};
     const DrawableProcessor* drawableProcessor_{};
     InstancingBuffer* instancingBuffer_{};
+    WorkQueue* workQueue_{};
     /// @}
 
     BatchRendererSettings settings_;
+
+    /// Draw queues and first instance indices of chunks recorded in worker threads.
+    /// @{
+    ea::vector<SharedPtr<DrawCommandQueue>> chunkQueues_;
+    ea::vector<unsigned> chunkStartInstances_;
+    /// @}
 };
 
 }
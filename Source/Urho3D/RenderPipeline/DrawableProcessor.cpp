@@ -33,10 +33,13 @@
 #include "../Graphics/Zone.h"
 #include "../IO/Log.h"
 #include "../RenderPipeline/DrawableProcessor.h"
+#include "../RenderPipeline/LightClusterProcessor.h"
 #include "../RenderPipeline/LightProcessor.h"
 #include "../RenderPipeline/RenderPipelineDefs.h"
+#include "../RenderPipeline/ShadowReceiverVolume.h"
 #include "../Scene/Scene.h"
 
+#include <EASTL/fixed_vector.h>
 #include <EASTL/sort.h>
 
 #include "../DebugNew.h"
@@ -156,6 +159,7 @@ DrawableProcessor::DrawableProcessor(RenderPipelineInterface* renderPipeline)
     , workQueue_(GetSubsystem<WorkQueue>())
     , defaultMaterial_(GetSubsystem<Renderer>()->GetDefaultMaterial())
     , lightProcessorCache_(ea::make_unique<LightProcessorCache>())
+    , lightClusterProcessor_(ea::make_unique<LightClusterProcessor>())
 {
     renderPipeline->OnCollectStatistics.Subscribe(this, &DrawableProcessor::OnCollectStatistics);
 }
@@ -223,6 +227,18 @@ void DrawableProcessor::OnCollectStatistics(RenderPipelineStats& stats)
     stats.numOccluders_ += sortedOccluders_.size();
     stats.numLights_ += lights_.size();
     stats.numShadowedLights_ += numShadowedLights_;
+
+    for (LightProcessor* lightProcessor : lightProcessors_)
+    {
+        for (const ShadowSplitProcessor& split : lightProcessor->GetSplits())
+        {
+            if (split.IsShadowMapReused())
+            {
+                ++stats.numReusedShadowSplits_;
+                stats.numSkippedShadowCasters_ += split.GetShadowCasters().size();
+            }
+        }
+    }
 }
 
 void DrawableProcessor::ProcessOccluders(const ea::vector<Drawable*>& occluders, float sizeThreshold)
@@ -498,9 +514,12 @@ void DrawableProcessor::ProcessLights(LightProcessorCallback* callback)
 {
     URHO3D_PROFILE("ProcessVisibleLights");
 
+    // Begin update from main thread, shadow splits may create scene objects
     for (LightProcessor* lightProcessor : lightProcessors_)
         lightProcessor->BeginUpdate(this, callback);
 
+    QueryLightGeometries();
+
     ForEachParallel(workQueue_, lightProcessors_,
         [&](unsigned /*index*/, LightProcessor* lightProcessor)
     {
@@ -522,6 +541,30 @@ void DrawableProcessor::ProcessLights(LightProcessorCallback* callback)
     ProcessShadowCasters();
 }
 
+void DrawableProcessor::QueryLightGeometries()
+{
+    URHO3D_PROFILE("QueryLightGeometries");
+
+    lightGeometryQueries_.clear();
+    for (LightProcessor* lightProcessor : lightProcessors_)
+    {
+        if (OctreeQuery* query = lightProcessor->GetGeometryQuery())
+            lightGeometryQueries_.push_back(query);
+    }
+
+    // Each thread traverses octree once for the batch of lights
+    const unsigned numQueries = lightGeometryQueries_.size();
+    const unsigned numThreads = workQueue_->GetNumThreads() + 1;
+    const unsigned lightsPerBatch = Clamp((numQueries + numThreads - 1) / numThreads, 1u, Octree::MaxBatchedQueries);
+
+    Octree* octree = frameInfo_.octree_;
+    ForEachParallel(workQueue_, lightsPerBatch, numQueries,
+        [&](unsigned beginIndex, unsigned endIndex)
+    {
+        octree->GetDrawables({ lightGeometryQueries_.data() + beginIndex, endIndex - beginIndex });
+    });
+}
+
 void DrawableProcessor::ProcessForwardLightingForLight(
     unsigned lightIndex, const ea::vector<Drawable*>& litGeometries)
 {
@@ -563,6 +606,72 @@ void DrawableProcessor::ProcessForwardLightingForLight(
     });
 }
 
+void DrawableProcessor::ProcessClusteredForwardLighting(const ea::vector<unsigned>& lightIndices)
+{
+    URHO3D_PROFILE("ProcessClusteredForwardLighting");
+
+    // Assign lights to clusters
+    lightClusterProcessor_->BeginUpdate(frameInfo_.camera_,
+        settings_.lightClusterGridSize_, settings_.maxLightsPerCluster_);
+    for (unsigned lightIndex : lightIndices)
+        lightClusterProcessor_->AddLight(lightIndex, lights_[lightIndex]);
+    lightClusterProcessor_->Build(workQueue_);
+
+    // Cook light parameters once per frame
+    clusteredLightParams_.resize(lights_.size());
+    for (unsigned lightIndex : lightIndices)
+    {
+        Light* light = lights_[lightIndex];
+        ClusteredLightParams& params = clusteredLightParams_[lightIndex];
+        params.lightType_ = light->GetLightType();
+        params.lightImportance_ = lightProcessors_[lightIndex]->HasShadow() ? LI_IMPORTANT : light->GetLightImportance();
+        params.isNegative_ = light->IsNegative();
+        params.intensityPenalty_ = 1.0f / light->GetIntensityDivisor();
+        params.lightMask_ = light->GetLightMaskEffective();
+        if (params.lightType_ == LIGHT_SPOT)
+            params.frustum_ = light->GetFrustum();
+        else
+            params.sphere_ = Sphere(light->GetNode()->GetWorldPosition(), light->GetRange());
+    }
+
+    LightAccumulatorContext ctx;
+    ctx.maxVertexLights_ = settings_.maxVertexLights_;
+    ctx.maxPixelLights_ = settings_.maxPixelLights_;
+    ctx.lights_ = &lightDataForAccumulator_;
+
+    // Accumulate lights from clusters overlapping each geometry
+    static const unsigned char litFlags = GeometryRenderFlag::Lit | GeometryRenderFlag::ForwardLit;
+    ForEachParallel(workQueue_, geometries_,
+        [&](unsigned /*index*/, Drawable* geometry)
+    {
+        const unsigned drawableIndex = geometry->GetDrawableIndex();
+        if ((geometryFlags_[drawableIndex] & litFlags) != litFlags)
+            return;
+
+        const BoundingBox& boundingBox = geometry->GetWorldBoundingBox();
+        const unsigned lightMask = geometry->GetLightMaskInZone();
+
+        ea::fixed_vector<unsigned, 32> candidateLights;
+        lightClusterProcessor_->CollectLights(boundingBox, candidateLights);
+        for (unsigned lightIndex : candidateLights)
+        {
+            const ClusteredLightParams& params = clusteredLightParams_[lightIndex];
+            if (!(lightMask & params.lightMask_))
+                continue;
+
+            const Intersection intersection = params.lightType_ == LIGHT_SPOT
+                ? params.frustum_.IsInsideFast(boundingBox) : params.sphere_.IsInsideFast(boundingBox);
+            if (intersection == OUTSIDE)
+                continue;
+
+            const float distance = ea::max(lights_[lightIndex]->GetDistanceTo(geometry), M_LARGE_EPSILON);
+            const float penalty = GetDrawableLightPenalty(distance * params.intensityPenalty_,
+                params.isNegative_, params.lightImportance_, params.lightType_);
+            geometryLighting_[drawableIndex].AccumulateLight(ctx, geometry, params.lightImportance_, lightIndex, penalty);
+        }
+    });
+}
+
 void DrawableProcessor::FinalizeForwardLighting()
 {
     ForEachParallel(workQueue_, geometries_,
@@ -583,21 +692,29 @@ void DrawableProcessor::ProcessForwardLighting()
     URHO3D_PROFILE("ProcessForwardLighting");
 
     bool hasForwardLights = false;
+    clusteredLightIndices_.clear();
     for (unsigned i = 0; i < lightProcessors_.size(); ++i)
     {
         const LightProcessor* lightProcessor = lightProcessors_[i];
         if (lightProcessor->HasForwardLitGeometries())
         {
-            ProcessForwardLightingForLight(i, lightProcessor->GetLitGeometries());
+            // Directional lights affect everything and are not clustered
+            if (settings_.clusteredLighting_ && lights_[i]->GetLightType() != LIGHT_DIRECTIONAL)
+                clusteredLightIndices_.push_back(i);
+            else
+                ProcessForwardLightingForLight(i, lightProcessor->GetLitGeometries());
             hasForwardLights = true;
         }
     }
+    if (!clusteredLightIndices_.empty())
+        ProcessClusteredForwardLighting(clusteredLightIndices_);
     if (hasForwardLights)
         FinalizeForwardLighting();
 }
 
 void DrawableProcessor::PreprocessShadowCasters(ea::vector<Drawable*>& shadowCasters,
-    const ea::vector<Drawable*>& candidates, const FloatRange& frustumSubRange, Light* light, Camera* shadowCamera)
+    const ea::vector<Drawable*>& candidates, const FloatRange& frustumSubRange, Light* light, Camera* shadowCamera,
+    const ShadowReceiverVolume* receiverVolume)
 {
     shadowCasters.clear();
 
@@ -621,8 +738,12 @@ void DrawableProcessor::PreprocessShadowCasters(ea::vector<Drawable*>& shadowCas
         if (lightType == LIGHT_POINT && shadowCameraFrustum.IsInsideFast(drawable->GetWorldBoundingBox()) == OUTSIDE)
             continue;
 
-        // Queue shadow caster if it's visible
+        // Skip if shadow doesn't reach any receiver
         const BoundingBox lightSpaceBoundingBox = drawable->GetWorldBoundingBox().Transformed(worldToLightSpace);
+        if (receiverVolume && !receiverVolume->IsShadowCasterVisible(lightSpaceBoundingBox))
+            continue;
+
+        // Queue shadow caster if it's visible
         const bool isDrawableVisible = !!(geometryFlags_[drawable->GetDrawableIndex()] & GeometryRenderFlag::VisibleInCullCamera);
         if (isDrawableVisible
             || IsShadowCasterVisible(lightSpaceBoundingBox, shadowCamera, lightSpaceFrustum, lightSpaceFrustumBoundingBox))
@@ -633,6 +754,32 @@ void DrawableProcessor::PreprocessShadowCasters(ea::vector<Drawable*>& shadowCas
     }
 }
 
+void DrawableProcessor::PreprocessCachedShadowCasters(ea::vector<Drawable*>& shadowCasters,
+    const ea::vector<Drawable*>& candidates, Light* light, Camera* shadowCamera) const
+{
+    shadowCasters.clear();
+
+    // Spot light candidates are already inside the frustum, point light candidates should be checked against the face
+    if (light->GetLightType() != LIGHT_POINT)
+    {
+        shadowCasters = candidates;
+        return;
+    }
+
+    const Frustum& shadowCameraFrustum = shadowCamera->GetFrustum();
+    for (Drawable* drawable : candidates)
+    {
+        if (shadowCameraFrustum.IsInsideFast(drawable->GetWorldBoundingBox()) != OUTSIDE)
+            shadowCasters.push_back(drawable);
+    }
+}
+
+void DrawableProcessor::QueueShadowCasterUpdates(const ea::vector<Drawable*>& shadowCasters)
+{
+    for (Drawable* drawable : shadowCasters)
+        QueueDrawableUpdate(drawable);
+}
+
 void DrawableProcessor::QueueDrawableUpdate(Drawable* drawable)
 {
     const unsigned drawableIndex = drawable->GetDrawableIndex();
@@ -25,6 +25,7 @@
 #include "../Core/Object.h"
 #include "../Core/WorkQueue.h"
 #include "../Graphics/GraphicsDefs.h"
+#include "../Math/Frustum.h"
 #include "../Math/NumericRange.h"
 #include "../RenderPipeline/RenderPipelineDefs.h"
 #include "../RenderPipeline/LightAccumulator.h"
@@ -36,12 +37,15 @@ namespace Urho3D
 
 class DrawableProcessor;
 class GlobalIllumination;
+class LightClusterProcessor;
 class LightProcessor;
 class LightProcessorCache;
 class LightProcessorCallback;
 class OcclusionBuffer;
+class OctreeQuery;
 class Pass;
 class RenderPipelineInterface;
+class ShadowReceiverVolume;
 class Technique;
 struct FrameInfo;
 
@@ -182,8 +186,16 @@ public:
     /// @}
 
     /// Internal. Pre-process shadow caster candidates. Safe to call from worker thread.
+    /// If receiver volume is specified, shadow casters that cannot cast shadow on any receiver are skipped.
     void PreprocessShadowCasters(ea::vector<Drawable*>& shadowCasters,
-        const ea::vector<Drawable*>& candidates, const FloatRange& frustumSubRange, Light* light, Camera* shadowCamera);
+        const ea::vector<Drawable*>& candidates, const FloatRange& frustumSubRange, Light* light, Camera* shadowCamera,
+        const ShadowReceiverVolume* receiverVolume = nullptr);
+    /// Internal. Pre-process shadow caster candidates for shadow map cached between frames.
+    /// Shadow casters are not culled by cull camera and are not queued for update. Safe to call from worker thread.
+    void PreprocessCachedShadowCasters(ea::vector<Drawable*>& shadowCasters,
+        const ea::vector<Drawable*>& candidates, Light* light, Camera* shadowCamera) const;
+    /// Internal. Queue update of shadow casters. Safe to call from worker thread.
+    void QueueShadowCasterUpdates(const ea::vector<Drawable*>& shadowCasters);
     /// Internal. Finalize shadow casters processing.
     void ProcessShadowCasters();
 
@@ -191,11 +203,20 @@ public:
     void ProcessLights(LightProcessorCallback* callback);
     /// Accumulate forward lighting for specified light source and geometries.
     void ProcessForwardLightingForLight(unsigned lightIndex, const ea::vector<Drawable*>& litGeometries);
+    /// Accumulate forward lighting for point and spot lights assigned to view-space clusters.
+    void ProcessClusteredForwardLighting(const ea::vector<unsigned>& lightIndices);
     /// Should be called after all forward lighting is processed.
     void FinalizeForwardLighting();
     /// Process forward lighting for all lights.
     void ProcessForwardLighting();
 
+    /// Return light clusters if clustered lighting is enabled and any light is clustered.
+    /// Valid after forward lighting is processed.
+    const LightClusterProcessor* GetLightClusters() const
+    {
+        return settings_.clusteredLighting_ && !clusteredLightIndices_.empty() ? lightClusterProcessor_.get() : nullptr;
+    }
+
     /// Update drawable geometries if needed.
     void UpdateGeometries();
 
@@ -209,10 +230,24 @@ protected:
 
     FloatRange CalculateBoundingBoxZRange(const BoundingBox& boundingBox) const;
 
+    /// Query lit geometries of all point and spot lights in batched octree traversals.
+    void QueryLightGeometries();
     void SortLightProcessorsByShadowMapSize();
     void SortLightProcessorsByShadowMapTexture();
 
 private:
+    /// Light parameters cooked for clustered forward lighting.
+    struct ClusteredLightParams
+    {
+        LightType lightType_{};
+        LightImportance lightImportance_{};
+        bool isNegative_{};
+        float intensityPenalty_{};
+        unsigned lightMask_{};
+        Sphere sphere_;
+        Frustum frustum_;
+    };
+
     /// Whether the drawable is already updated for this pipeline and frame.
     /// Technically copyable to allow storage in vector, but is invalidated on copying.
     struct UpdateFlag : public std::atomic_flag
@@ -233,6 +268,7 @@ private:
     ea::vector<SharedPtr<DrawableProcessorPass>> passes_;
     DrawableProcessorSettings settings_;
     ea::unique_ptr<LightProcessorCache> lightProcessorCache_;
+    ea::unique_ptr<LightClusterProcessor> lightClusterProcessor_;
     /// @}
 
     /// Constant within frame, changes between frames
@@ -271,6 +307,9 @@ private:
     ea::vector<LightProcessor*> lightProcessors_;
     ea::vector<LightProcessor*> lightProcessorsByShadowMapSize_;
     ea::vector<LightProcessor*> lightProcessorsByShadowMapTexture_;
+    ea::vector<OctreeQuery*> lightGeometryQueries_;
+    ea::vector<unsigned> clusteredLightIndices_;
+    ea::vector<ClusteredLightParams> clusteredLightParams_;
     unsigned numShadowedLights_{};
 
     WorkQueueVector<Drawable*> queuedDrawableUpdates_;
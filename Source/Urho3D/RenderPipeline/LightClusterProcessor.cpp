@@ -0,0 +1,463 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Core/WorkQueue.h"
+#include "../Graphics/Camera.h"
+#include "../Graphics/Light.h"
+#include "../RenderPipeline/LightClusterProcessor.h"
+#include "../Scene/Node.h"
+
+#ifdef URHO3D_SSE
+#include <emmintrin.h>
+#endif
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+namespace
+{
+
+/// Convert continuous cluster coordinate to cluster index, clamped to grid. NaN is mapped to zero.
+int ToClusterIndex(float coord, int size)
+{
+    if (!(coord > 0.0f))
+        return 0;
+    if (coord >= static_cast<float>(size))
+        return size - 1;
+    return static_cast<int>(coord);
+}
+
+/// Pointers to 4 consecutive clusters in SoA layout.
+struct ClusterBatch
+{
+    const float* minX_;
+    const float* minY_;
+    const float* minZ_;
+    const float* maxX_;
+    const float* maxY_;
+    const float* maxZ_;
+    const float* sphereX_;
+    const float* sphereY_;
+    const float* sphereZ_;
+    const float* sphereRadius_;
+};
+
+/// Test one cluster against light. Reference implementation used if SIMD is not available.
+bool IsLightInCluster(const LightClusterItem& light, const ClusterBatch& batch, unsigned i)
+{
+    const float dx = ea::max(0.0f, batch.minX_[i] - light.center_.x_) + ea::max(0.0f, light.center_.x_ - batch.maxX_[i]);
+    const float dy = ea::max(0.0f, batch.minY_[i] - light.center_.y_) + ea::max(0.0f, light.center_.y_ - batch.maxY_[i]);
+    const float dz = ea::max(0.0f, batch.minZ_[i] - light.center_.z_) + ea::max(0.0f, light.center_.z_ - batch.maxZ_[i]);
+    if (dx * dx + dy * dy + dz * dz > light.radius_ * light.radius_)
+        return false;
+
+    if (light.coneRange_ == 0.0f)
+        return true;
+
+    // Cone vs sphere, see "Cull that cone" by Bart Wronski
+    const Vector3 v{ batch.sphereX_[i] - light.coneApex_.x_,
+        batch.sphereY_[i] - light.coneApex_.y_, batch.sphereZ_[i] - light.coneApex_.z_ };
+    const float lengthSquared = v.LengthSquared();
+    const float v1Length = v.DotProduct(light.coneDirection_);
+    const float distanceToCone = light.coneCos_ * Sqrt(ea::max(0.0f, lengthSquared - v1Length * v1Length))
+        - v1Length * light.coneSin_;
+    const float radius = batch.sphereRadius_[i];
+    return distanceToCone <= radius && v1Length <= radius + light.coneRange_ && v1Length >= -radius;
+}
+
+/// Test 4 consecutive clusters against light. Return bit mask of intersecting clusters.
+unsigned TestLightInClusters(const LightClusterItem& light, const ClusterBatch& batch)
+{
+#ifdef URHO3D_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 cx = _mm_set1_ps(light.center_.x_);
+    const __m128 cy = _mm_set1_ps(light.center_.y_);
+    const __m128 cz = _mm_set1_ps(light.center_.z_);
+
+    const __m128 dx = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(batch.minX_), cx), zero),
+        _mm_max_ps(_mm_sub_ps(cx, _mm_loadu_ps(batch.maxX_)), zero));
+    const __m128 dy = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(batch.minY_), cy), zero),
+        _mm_max_ps(_mm_sub_ps(cy, _mm_loadu_ps(batch.maxY_)), zero));
+    const __m128 dz = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(batch.minZ_), cz), zero),
+        _mm_max_ps(_mm_sub_ps(cz, _mm_loadu_ps(batch.maxZ_)), zero));
+    const __m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+    __m128 mask = _mm_cmple_ps(distanceSquared, _mm_set1_ps(light.radius_ * light.radius_));
+
+    if (light.coneRange_ != 0.0f)
+    {
+        const __m128 vx = _mm_sub_ps(_mm_loadu_ps(batch.sphereX_), _mm_set1_ps(light.coneApex_.x_));
+        const __m128 vy = _mm_sub_ps(_mm_loadu_ps(batch.sphereY_), _mm_set1_ps(light.coneApex_.y_));
+        const __m128 vz = _mm_sub_ps(_mm_loadu_ps(batch.sphereZ_), _mm_set1_ps(light.coneApex_.z_));
+        const __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+        const __m128 v1Length = _mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(vx, _mm_set1_ps(light.coneDirection_.x_)),
+            _mm_mul_ps(vy, _mm_set1_ps(light.coneDirection_.y_))),
+            _mm_mul_ps(vz, _mm_set1_ps(light.coneDirection_.z_)));
+        const __m128 distanceToAxis = _mm_sqrt_ps(_mm_max_ps(zero, _mm_sub_ps(lengthSquared, _mm_mul_ps(v1Length, v1Length))));
+        const __m128 distanceToCone = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(light.coneCos_), distanceToAxis),
+            _mm_mul_ps(v1Length, _mm_set1_ps(light.coneSin_)));
+        const __m128 radius = _mm_loadu_ps(batch.sphereRadius_);
+
+        const __m128 isCulled = _mm_or_ps(_mm_or_ps(
+            _mm_cmpgt_ps(distanceToCone, radius),
+            _mm_cmpgt_ps(v1Length, _mm_add_ps(radius, _mm_set1_ps(light.coneRange_)))),
+            _mm_cmplt_ps(v1Length, _mm_sub_ps(zero, radius)));
+        mask = _mm_andnot_ps(isCulled, mask);
+    }
+
+    return static_cast<unsigned>(_mm_movemask_ps(mask));
+#else
+    unsigned mask = 0;
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        if (IsLightInCluster(light, batch, i))
+            mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+}
+
+LightClusterProcessor::LightClusterProcessor()
+{
+}
+
+LightClusterProcessor::~LightClusterProcessor()
+{
+}
+
+void LightClusterProcessor::BeginUpdate(Camera* camera, const IntVector3& gridSize, unsigned maxLightsPerCluster)
+{
+    lights_.clear();
+
+    gridSize_ = VectorMax(gridSize, IntVector3::ONE);
+    numClustersInSlice_ = static_cast<unsigned>(gridSize_.x_ * gridSize_.y_);
+    rowStride_ = (static_cast<unsigned>(gridSize_.x_) + 3u) & ~3u;
+    maxLightsPerCluster_ = ea::max(1u, maxLightsPerCluster);
+
+    view_ = camera->GetView();
+    orthographic_ = camera->IsOrthographic();
+    nearClip_ = orthographic_ ? camera->GetNearClip() : ea::max(camera->GetNearClip(), M_MIN_NEARCLIP);
+    farClip_ = ea::max(camera->GetFarClip(), nearClip_ + M_EPSILON);
+    logDepthRatio_ = orthographic_ ? 0.0f : Ln(farClip_ / nearClip_);
+
+    // Vertices 4 and 6 are positive and negative corners of far plane
+    const Frustum viewSpaceFrustum = camera->GetViewSpaceFrustum();
+    const Vector3& farMax = viewSpaceFrustum.vertices_[4];
+    const Vector3& farMin = viewSpaceFrustum.vertices_[6];
+    if (orthographic_)
+    {
+        screenMin_ = { farMin.x_, farMin.y_ };
+        screenSize_ = Vector2{ farMax.x_, farMax.y_ } - screenMin_;
+    }
+    else
+    {
+        screenMin_ = Vector2{ farMin.x_, farMin.y_ } / farMin.z_;
+        screenSize_ = Vector2{ farMax.x_, farMax.y_ } / farMax.z_ - screenMin_;
+    }
+
+    // Calculate cluster volumes
+    const unsigned numSoAElements = rowStride_ * gridSize_.y_ * gridSize_.z_;
+    for (ea::vector<float>* soaArray : { &boxMinX_, &boxMinY_, &boxMinZ_, &boxMaxX_, &boxMaxY_, &boxMaxZ_,
+        &sphereX_, &sphereY_, &sphereZ_, &sphereRadius_ })
+    {
+        soaArray->clear();
+        soaArray->resize(numSoAElements, 0.0f);
+    }
+
+    const Vector2 tileSize = screenSize_ / Vector2{ static_cast<float>(gridSize_.x_), static_cast<float>(gridSize_.y_) };
+    for (int z = 0; z < gridSize_.z_; ++z)
+    {
+        const float nearZ = GetSliceDepth(z);
+        const float farZ = GetSliceDepth(z + 1);
+        for (int y = 0; y < gridSize_.y_; ++y)
+        {
+            for (int x = 0; x < gridSize_.x_; ++x)
+            {
+                const Vector2 tileMin = screenMin_ + tileSize * Vector2{ static_cast<float>(x), static_cast<float>(y) };
+                const Vector2 tileMax = tileMin + tileSize;
+
+                BoundingBox box;
+                if (orthographic_)
+                    box.Define(Vector3{ tileMin, nearZ }, Vector3{ tileMax, farZ });
+                else
+                {
+                    box.Define(Vector3{ tileMin * nearZ, nearZ }, Vector3{ tileMax * nearZ, nearZ });
+                    box.Merge(Vector3{ tileMin * farZ, farZ });
+                    box.Merge(Vector3{ tileMax * farZ, farZ });
+                }
+
+                const unsigned index = (z * gridSize_.y_ + y) * rowStride_ + x;
+                boxMinX_[index] = box.min_.x_;
+                boxMinY_[index] = box.min_.y_;
+                boxMinZ_[index] = box.min_.z_;
+                boxMaxX_[index] = box.max_.x_;
+                boxMaxY_[index] = box.max_.y_;
+                boxMaxZ_[index] = box.max_.z_;
+
+                const Vector3 center = box.Center();
+                sphereX_[index] = center.x_;
+                sphereY_[index] = center.y_;
+                sphereZ_[index] = center.z_;
+                sphereRadius_[index] = box.HalfSize().Length();
+            }
+        }
+    }
+}
+
+void LightClusterProcessor::AddLight(unsigned lightIndex, Light* light)
+{
+    Node* lightNode = light->GetNode();
+    switch (light->GetLightType())
+    {
+    case LIGHT_POINT:
+        AddPointLight(lightIndex, lightNode->GetWorldPosition(), light->GetRange());
+        break;
+
+    case LIGHT_SPOT:
+    {
+        // Bounding cone of light frustum, which is rectangular
+        const float halfViewSize = Tan(light->GetFov() * 0.5f);
+        const float aspectRatio = light->GetAspectRatio();
+        const float halfAngle = Atan(halfViewSize * Sqrt(1.0f + aspectRatio * aspectRatio));
+        AddSpotLight(lightIndex, lightNode->GetWorldPosition(), lightNode->GetWorldDirection(), light->GetRange(), halfAngle);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void LightClusterProcessor::AddPointLight(unsigned lightIndex, const Vector3& position, float range)
+{
+    LightClusterItem item;
+    item.lightIndex_ = lightIndex;
+    item.center_ = view_ * position;
+    item.radius_ = range;
+    AddLightItem(item);
+}
+
+void LightClusterProcessor::AddSpotLight(unsigned lightIndex,
+    const Vector3& position, const Vector3& direction, float range, float halfAngle)
+{
+    halfAngle = Clamp(halfAngle, M_EPSILON, 89.0f);
+
+    LightClusterItem item;
+    item.lightIndex_ = lightIndex;
+    item.coneApex_ = view_ * position;
+    item.coneDirection_ = (view_ * Vector4{ direction, 0.0f }).Normalized();
+    item.coneRange_ = range;
+    item.coneCos_ = Cos(halfAngle);
+    item.coneSin_ = Sin(halfAngle);
+
+    // Bounding sphere of the cone with flat cap
+    const float tanHalfAngle = Tan(halfAngle);
+    if (tanHalfAngle >= 1.0f)
+    {
+        item.center_ = item.coneApex_ + item.coneDirection_ * range;
+        item.radius_ = range * tanHalfAngle;
+    }
+    else
+    {
+        const float distance = range * (1.0f + tanHalfAngle * tanHalfAngle) * 0.5f;
+        item.center_ = item.coneApex_ + item.coneDirection_ * distance;
+        item.radius_ = distance;
+    }
+
+    AddLightItem(item);
+}
+
+void LightClusterProcessor::AddLightItem(LightClusterItem& item)
+{
+    const Vector3 extent = Vector3::ONE * item.radius_;
+    const BoundingBox boundingBox{ item.center_ - extent, item.center_ + extent };
+    if (GetClusterRange(boundingBox, item.beginCluster_, item.endCluster_))
+        lights_.push_back(item);
+}
+
+void LightClusterProcessor::Build(WorkQueue* workQueue)
+{
+    const unsigned numClusters = numClustersInSlice_ * gridSize_.z_;
+
+    clusters_.clear();
+    clusters_.resize(numClusters);
+    clusterLightsTemp_.resize(numClusters * maxLightsPerCluster_);
+    numDroppedLightsPerSlice_.clear();
+    numDroppedLightsPerSlice_.resize(gridSize_.z_);
+
+    // Assign lights to clusters
+    const auto buildSlices = [this](unsigned beginIndex, unsigned endIndex)
+    {
+        for (unsigned slice = beginIndex; slice < endIndex; ++slice)
+            BuildSlice(static_cast<int>(slice));
+    };
+    if (workQueue && !lights_.empty())
+        ForEachParallel(workQueue, 1u, static_cast<unsigned>(gridSize_.z_), buildSlices);
+    else
+        buildSlices(0, gridSize_.z_);
+
+    // Compact light lists
+    unsigned offset = 0;
+    for (LightCluster& cluster : clusters_)
+    {
+        cluster.offset_ = offset;
+        offset += cluster.count_;
+    }
+
+    lightIndices_.resize(offset);
+    for (unsigned clusterIndex = 0; clusterIndex < numClusters; ++clusterIndex)
+    {
+        const LightCluster& cluster = clusters_[clusterIndex];
+        const unsigned* sourceLights = &clusterLightsTemp_[clusterIndex * maxLightsPerCluster_];
+        ea::copy(sourceLights, sourceLights + cluster.count_, lightIndices_.begin() + cluster.offset_);
+    }
+
+    numDroppedLights_ = 0;
+    for (unsigned numDropped : numDroppedLightsPerSlice_)
+        numDroppedLights_ += numDropped;
+}
+
+void LightClusterProcessor::BuildSlice(int slice)
+{
+    for (const LightClusterItem& light : lights_)
+    {
+        if (slice < light.beginCluster_.z_ || slice >= light.endCluster_.z_)
+            continue;
+
+        for (int y = light.beginCluster_.y_; y < light.endCluster_.y_; ++y)
+        {
+            const unsigned rowOffset = (slice * gridSize_.y_ + y) * rowStride_;
+            const unsigned clusterRowOffset = GetClusterIndex({ 0, y, slice });
+
+            for (int x = light.beginCluster_.x_ & ~3; x < light.endCluster_.x_; x += 4)
+            {
+                const unsigned index = rowOffset + x;
+                const ClusterBatch batch{
+                    &boxMinX_[index], &boxMinY_[index], &boxMinZ_[index],
+                    &boxMaxX_[index], &boxMaxY_[index], &boxMaxZ_[index],
+                    &sphereX_[index], &sphereY_[index], &sphereZ_[index], &sphereRadius_[index] };
+
+                const unsigned mask = TestLightInClusters(light, batch);
+                if (!mask)
+                    continue;
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    const int clusterX = x + i;
+                    if (!(mask & (1u << i)) || clusterX < light.beginCluster_.x_ || clusterX >= light.endCluster_.x_)
+                        continue;
+
+                    const unsigned clusterIndex = clusterRowOffset + clusterX;
+                    LightCluster& cluster = clusters_[clusterIndex];
+                    if (cluster.count_ < maxLightsPerCluster_)
+                        clusterLightsTemp_[clusterIndex * maxLightsPerCluster_ + cluster.count_++] = light.lightIndex_;
+                    else
+                        ++numDroppedLightsPerSlice_[slice];
+                }
+            }
+        }
+    }
+}
+
+BoundingBox LightClusterProcessor::GetClusterBoundingBox(const IntVector3& cluster) const
+{
+    const unsigned index = (cluster.z_ * gridSize_.y_ + cluster.y_) * rowStride_ + cluster.x_;
+    return BoundingBox{
+        Vector3{ boxMinX_[index], boxMinY_[index], boxMinZ_[index] },
+        Vector3{ boxMaxX_[index], boxMaxY_[index], boxMaxZ_[index] } };
+}
+
+bool LightClusterProcessor::GetClusterRange(const BoundingBox& viewSpaceBox,
+    IntVector3& beginCluster, IntVector3& endCluster) const
+{
+    if (!viewSpaceBox.Defined() || viewSpaceBox.max_.z_ < nearClip_ || viewSpaceBox.min_.z_ > farClip_)
+        return false;
+
+    const float minZ = ea::max(viewSpaceBox.min_.z_, nearClip_);
+    const float maxZ = ea::min(viewSpaceBox.max_.z_, farClip_);
+
+    // Evaluate screen-space extents of the box
+    Vector2 minTile;
+    Vector2 maxTile;
+    if (orthographic_)
+    {
+        minTile = GetTileCoordinate({ viewSpaceBox.min_.x_, viewSpaceBox.min_.y_ }, 1.0f);
+        maxTile = GetTileCoordinate({ viewSpaceBox.max_.x_, viewSpaceBox.max_.y_ }, 1.0f);
+    }
+    else
+    {
+        // Minimize and maximize x/z and y/z over the box
+        const Vector2 boxMin{ viewSpaceBox.min_.x_, viewSpaceBox.min_.y_ };
+        const Vector2 boxMax{ viewSpaceBox.max_.x_, viewSpaceBox.max_.y_ };
+        const Vector2 minSlope{
+            boxMin.x_ / (boxMin.x_ < 0.0f ? minZ : viewSpaceBox.max_.z_),
+            boxMin.y_ / (boxMin.y_ < 0.0f ? minZ : viewSpaceBox.max_.z_) };
+        const Vector2 maxSlope{
+            boxMax.x_ / (boxMax.x_ > 0.0f ? minZ : viewSpaceBox.max_.z_),
+            boxMax.y_ / (boxMax.y_ > 0.0f ? minZ : viewSpaceBox.max_.z_) };
+        minTile = GetTileCoordinate(minSlope, 1.0f);
+        maxTile = GetTileCoordinate(maxSlope, 1.0f);
+    }
+
+    if (maxTile.x_ < 0.0f || maxTile.y_ < 0.0f || minTile.x_ >= gridSize_.x_ || minTile.y_ >= gridSize_.y_)
+        return false;
+
+    beginCluster.x_ = ToClusterIndex(minTile.x_, gridSize_.x_);
+    beginCluster.y_ = ToClusterIndex(minTile.y_, gridSize_.y_);
+    beginCluster.z_ = ToClusterIndex(GetSliceCoordinate(minZ), gridSize_.z_);
+    endCluster.x_ = ToClusterIndex(maxTile.x_, gridSize_.x_) + 1;
+    endCluster.y_ = ToClusterIndex(maxTile.y_, gridSize_.y_) + 1;
+    endCluster.z_ = ToClusterIndex(GetSliceCoordinate(maxZ), gridSize_.z_) + 1;
+    return true;
+}
+
+float LightClusterProcessor::GetSliceCoordinate(float z) const
+{
+    if (orthographic_)
+        return (z - nearClip_) / (farClip_ - nearClip_) * gridSize_.z_;
+    else
+        return Ln(ea::max(z, M_EPSILON) / nearClip_) / logDepthRatio_ * gridSize_.z_;
+}
+
+float LightClusterProcessor::GetSliceDepth(int slice) const
+{
+    const float factor = static_cast<float>(slice) / gridSize_.z_;
+    if (orthographic_)
+        return Lerp(nearClip_, farClip_, factor);
+    else
+        return nearClip_ * expf(logDepthRatio_ * factor);
+}
+
+Vector2 LightClusterProcessor::GetTileCoordinate(const Vector2& xy, float z) const
+{
+    const Vector2 screenPosition = xy / z;
+    return (screenPosition - screenMin_) / screenSize_
+        * Vector2{ static_cast<float>(gridSize_.x_), static_cast<float>(gridSize_.y_) };
+}
+
+}
@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Core/NonCopyable.h"
+#include "../Math/BoundingBox.h"
+#include "../Math/Matrix3x4.h"
+#include "../Math/Vector3.h"
+
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+#include <EASTL/span.h>
+#include <EASTL/vector.h>
+
+namespace Urho3D
+{
+
+class Camera;
+class Light;
+class WorkQueue;
+
+/// Range of light indices assigned to one cluster.
+struct LightCluster
+{
+    unsigned offset_{};
+    unsigned count_{};
+};
+
+/// Point or spot light prepared for cluster assignment, in view space of cull camera.
+struct LightClusterItem
+{
+    /// Index of light in DrawableProcessor.
+    unsigned lightIndex_{};
+    /// Bounding sphere of light.
+    Vector3 center_;
+    float radius_{};
+    /// Spot light cone. Cone is ignored if range is zero.
+    Vector3 coneApex_;
+    Vector3 coneDirection_;
+    float coneRange_{};
+    float coneCos_{};
+    float coneSin_{};
+    /// Cluster range covered by the light, end exclusive.
+    IntVector3 beginCluster_;
+    IntVector3 endCluster_;
+};
+
+/// Utility to assign point and spot lights to view-space clusters ("froxels") of cull camera.
+/// Clusters are uniform in screen space and exponential in depth for perspective cameras.
+class URHO3D_API LightClusterProcessor : public NonCopyable
+{
+public:
+    LightClusterProcessor();
+    ~LightClusterProcessor();
+
+    /// Define cluster grid for the camera and reset lights.
+    void BeginUpdate(Camera* camera, const IntVector3& gridSize, unsigned maxLightsPerCluster);
+    /// Add point or spot light. Directional lights are ignored.
+    /// Lights should be added in order of increasing index, so cluster light lists are sorted.
+    void AddLight(unsigned lightIndex, Light* light);
+    /// Add point light with world-space position and range.
+    void AddPointLight(unsigned lightIndex, const Vector3& position, float range);
+    /// Add spot light with world-space position and direction, range and half angle of the bounding cone in degrees.
+    void AddSpotLight(unsigned lightIndex, const Vector3& position, const Vector3& direction, float range, float halfAngle);
+    /// Build light lists. Clusters are processed in worker threads, one depth slice per work item.
+    void Build(WorkQueue* workQueue);
+
+    /// Return cluster grid
+    /// @{
+    const IntVector3& GetGridSize() const { return gridSize_; }
+    unsigned GetNumClusters() const { return clusters_.size(); }
+    unsigned GetClusterIndex(const IntVector3& cluster) const
+    {
+        return static_cast<unsigned>((cluster.z_ * gridSize_.y_ + cluster.y_) * gridSize_.x_ + cluster.x_);
+    }
+    BoundingBox GetClusterBoundingBox(const IntVector3& cluster) const;
+    /// Return cluster range overlapping view space bounding box, end exclusive. Return false if there's no overlap.
+    bool GetClusterRange(const BoundingBox& viewSpaceBox, IntVector3& beginCluster, IntVector3& endCluster) const;
+    /// @}
+
+    /// Return build results
+    /// @{
+    const ea::vector<LightCluster>& GetClusters() const { return clusters_; }
+    const ea::vector<unsigned>& GetLightIndices() const { return lightIndices_; }
+    ea::span<const unsigned> GetClusterLights(unsigned clusterIndex) const
+    {
+        const LightCluster& cluster = clusters_[clusterIndex];
+        return { lightIndices_.data() + cluster.offset_, cluster.count_ };
+    }
+    unsigned GetNumLights() const { return lights_.size(); }
+    /// Return number of light-to-cluster assignments dropped due to cluster capacity.
+    unsigned GetNumDroppedLights() const { return numDroppedLights_; }
+    /// @}
+
+    /// Collect sorted unique indices of lights that may affect world space bounding box.
+    template <class Container>
+    void CollectLights(const BoundingBox& worldBoundingBox, Container& lightIndices) const
+    {
+        lightIndices.clear();
+
+        IntVector3 beginCluster;
+        IntVector3 endCluster;
+        if (!GetClusterRange(worldBoundingBox.Transformed(view_), beginCluster, endCluster))
+            return;
+
+        for (int z = beginCluster.z_; z < endCluster.z_; ++z)
+        {
+            for (int y = beginCluster.y_; y < endCluster.y_; ++y)
+            {
+                for (int x = beginCluster.x_; x < endCluster.x_; ++x)
+                {
+                    for (unsigned lightIndex : GetClusterLights(GetClusterIndex({ x, y, z })))
+                        lightIndices.push_back(lightIndex);
+                }
+            }
+        }
+
+        ea::sort(lightIndices.begin(), lightIndices.end());
+        lightIndices.erase(ea::unique(lightIndices.begin(), lightIndices.end()), lightIndices.end());
+    }
+
+private:
+    /// Add light with known view-space bounding sphere.
+    void AddLightItem(LightClusterItem& item);
+    /// Return depth slice for view-space depth. May be out of grid.
+    float GetSliceCoordinate(float z) const;
+    /// Return view-space depth of slice boundary.
+    float GetSliceDepth(int slice) const;
+    /// Return screen-space tile coordinates for view space point.
+    Vector2 GetTileCoordinate(const Vector2& xy, float z) const;
+    /// Fill light lists for one depth slice.
+    void BuildSlice(int slice);
+
+    /// Grid definition
+    /// @{
+    IntVector3 gridSize_;
+    unsigned numClustersInSlice_{};
+    unsigned rowStride_{};
+    unsigned maxLightsPerCluster_{};
+    Matrix3x4 view_;
+    bool orthographic_{};
+    float nearClip_{};
+    float farClip_{};
+    float logDepthRatio_{};
+    /// Screen rectangle at unit depth (perspective) or in view space (orthographic).
+    Vector2 screenMin_;
+    Vector2 screenSize_;
+    /// @}
+
+    /// Cluster bounding volumes in view space, SoA, each row is padded to multiple of 4.
+    /// @{
+    ea::vector<float> boxMinX_;
+    ea::vector<float> boxMinY_;
+    ea::vector<float> boxMinZ_;
+    ea::vector<float> boxMaxX_;
+    ea::vector<float> boxMaxY_;
+    ea::vector<float> boxMaxZ_;
+    ea::vector<float> sphereX_;
+    ea::vector<float> sphereY_;
+    ea::vector<float> sphereZ_;
+    ea::vector<float> sphereRadius_;
+    /// @}
+
+    ea::vector<LightClusterItem> lights_;
+
+    /// Temporary per-cluster light lists with fixed capacity.
+    ea::vector<unsigned> clusterLightsTemp_;
+    ea::vector<unsigned> numDroppedLightsPerSlice_;
+    unsigned numDroppedLights_{};
+
+    ea::vector<LightCluster> clusters_;
+    ea::vector<unsigned> lightIndices_;
+};
+
+}
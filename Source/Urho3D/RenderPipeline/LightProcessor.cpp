@@ -167,6 +167,23 @@ void LightProcessor::BeginUpdate(DrawableProcessor* drawableProcessor, LightProc
     isShadowRequested_ = callback->IsLightShadowed(light_);
     numSplitsRequested_ = isShadowRequested_ ? CalculateNumSplits(light_) : 0;
 
+    // Prepare query for lit geometries (and shadow casters for spot and point lights)
+    const unsigned viewMask = drawableProcessor->GetFrameInfo().camera_->GetViewMask();
+    ea::vector<Drawable*>* shadowCasters = isShadowRequested_ ? &shadowCasterCandidates_ : nullptr;
+    pointLightQuery_.reset();
+    spotLightQuery_.reset();
+    switch (light_->GetLightType())
+    {
+    case LIGHT_SPOT:
+        spotLightQuery_.emplace(litGeometries_, hasLitGeometries_, shadowCasters, drawableProcessor, light_, viewMask);
+        break;
+    case LIGHT_POINT:
+        pointLightQuery_.emplace(litGeometries_, hasLitGeometries_, shadowCasters, drawableProcessor, light_, viewMask);
+        break;
+    default:
+        break;
+    }
+
     // Update splits
     if (splits_.size() <= numSplitsRequested_)
     {
@@ -187,34 +204,30 @@ void LightProcessor::BeginUpdate(DrawableProcessor* drawableProcessor, LightProc
     }
 }
 
+OctreeQuery* LightProcessor::GetGeometryQuery()
+{
+    if (pointLightQuery_)
+        return &*pointLightQuery_;
+    if (spotLightQuery_)
+        return &*spotLightQuery_;
+    return nullptr;
+}
+
 void LightProcessor::Update(DrawableProcessor* drawableProcessor, const LightProcessorCallback* callback)
 {
     const FrameInfo& frameInfo = drawableProcessor->GetFrameInfo();
-    Octree* octree = frameInfo.octree_;
     Camera* cullCamera = frameInfo.camera_;
     const LightType lightType = light_->GetLightType();
 
     // Check if light volume contains camera
     cameraIsInsideLightVolume_ = EstimateDistanceToCamera(cullCamera, light_) <= cullCamera->GetNearClip() * 2.0f;
 
-    // Query lit geometries (and shadow casters for spot and point lights)
+    // Lit geometries of spot and point lights are already queried by DrawableProcessor
     switch (lightType)
     {
     case LIGHT_SPOT:
-    {
-        SpotLightGeometryQuery query(litGeometries_, hasLitGeometries_,
-            isShadowRequested_ ? &shadowCasterCandidates_ : nullptr,
-            drawableProcessor, light_, cullCamera->GetViewMask());
-        octree->GetDrawables(query);
-        hasForwardLitGeometries_ = !litGeometries_.empty();
-        break;
-    }
     case LIGHT_POINT:
     {
-        PointLightGeometryQuery query(litGeometries_, hasLitGeometries_,
-            isShadowRequested_ ? &shadowCasterCandidates_ : nullptr,
-            drawableProcessor, light_, cullCamera->GetViewMask());
-        octree->GetDrawables(query);
         hasForwardLitGeometries_ = !litGeometries_.empty();
         break;
     }
@@ -250,8 +263,17 @@ void LightProcessor::Update(DrawableProcessor* drawableProcessor, const LightPro
 
     InitializeShadowSplits(drawableProcessor);
 
+    // Shadow maps of directional lights depend on cull camera and cannot be cached
+    isShadowMapCached_ = drawableProcessor->GetSettings().cacheStaticShadowMaps_ && lightType != LIGHT_DIRECTIONAL;
+
     for (unsigned i = 0; i < numActiveSplits_; ++i)
     {
+        if (isShadowMapCached_)
+        {
+            splits_[i].ProcessCachedShadowCasters(drawableProcessor, shadowCasterCandidates_);
+            continue;
+        }
+
         switch (lightType)
         {
         case LIGHT_SPOT:
@@ -261,7 +283,7 @@ void LightProcessor::Update(DrawableProcessor* drawableProcessor, const LightPro
             splits_[i].ProcessPointShadowCasters(drawableProcessor, shadowCasterCandidates_);
             break;
         case LIGHT_DIRECTIONAL:
-            splits_[i].ProcessDirectionalShadowCasters(drawableProcessor, shadowCasterCandidates_);
+            splits_[i].ProcessDirectionalShadowCasters(drawableProcessor, litGeometries_, shadowCasterCandidates_);
             break;
         default:
             break;
@@ -284,9 +306,12 @@ void LightProcessor::EndUpdate(DrawableProcessor* drawableProcessor,
     LightProcessorCallback* callback, unsigned pcfKernelSize)
 {
     // Allocate shadow map
+    bool isShadowMapPreserved = false;
     if (numActiveSplits_ > 0)
     {
-        shadowMap_ = callback->AllocateTransientShadowMap(shadowMapSize_);
+        shadowMap_ = isShadowMapCached_
+            ? callback->AllocatePersistentShadowMap(shadowMapSize_, this, isShadowMapPreserved)
+            : callback->AllocateTransientShadowMap(shadowMapSize_);
         if (!shadowMap_)
             numActiveSplits_ = 0;
         else
@@ -299,6 +324,7 @@ void LightProcessor::EndUpdate(DrawableProcessor* drawableProcessor,
     Camera* cullCamera = drawableProcessor->GetFrameInfo().camera_;
     CookShaderParameters(cullCamera, drawableProcessor->GetSettings());
     UpdateHashes();
+    UpdateShadowMapCache(drawableProcessor, isShadowMapPreserved);
 }
 
 void LightProcessor::InitializeShadowSplits(DrawableProcessor* drawableProcessor)
@@ -539,6 +565,24 @@ void LightProcessor::UpdateHashes()
     }
 }
 
+void LightProcessor::UpdateShadowMapCache(DrawableProcessor* drawableProcessor, bool isShadowMapPreserved)
+{
+    if (!isShadowMapCached_ || numActiveSplits_ == 0)
+    {
+        for (ShadowSplitProcessor& split : splits_)
+            split.ResetCachedShadow();
+        return;
+    }
+
+    // Shadow map should be re-rendered if shadow batch pipeline state is changed, e.g. due to bias
+    const unsigned shadowHash = shadowBatchStateHashes_[0];
+    const bool isShadowHashPreserved = shadowHash == cachedShadowHash_;
+    cachedShadowHash_ = shadowHash;
+
+    for (unsigned i = 0; i < numActiveSplits_; ++i)
+        splits_[i].FinalizeCachedShadow(drawableProcessor, isShadowMapPreserved && isShadowHashPreserved);
+}
+
 IntVector2 LightProcessor::GetNumSplitsInGrid() const
 {
     if (numActiveSplits_ == 1)
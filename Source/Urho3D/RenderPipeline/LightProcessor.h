@@ -24,10 +24,12 @@
 
 #include "../Core/NonCopyable.h"
 #include "../Graphics/Light.h"
+#include "../RenderPipeline/LightProcessorQuery.h"
 #include "../RenderPipeline/RenderPipelineDefs.h"
 #include "../RenderPipeline/ShadowSplitProcessor.h"
 
 #include <EASTL/array.h>
+#include <EASTL/optional.h>
 #include <EASTL/vector.h>
 
 namespace Urho3D
@@ -95,8 +97,10 @@ public:
     explicit LightProcessor(Light* light);
     ~LightProcessor();
 
-    /// Begin update from main thread.
+    /// Begin update from main thread. Prepares geometry query for point and spot lights.
     void BeginUpdate(DrawableProcessor* drawableProcessor, LightProcessorCallback* callback);
+    /// Return geometry query that should be executed by caller between BeginUpdate and Update. May be null.
+    OctreeQuery* GetGeometryQuery();
     /// Update light in worker thread.
     void Update(DrawableProcessor* drawableProcessor, const LightProcessorCallback* callback);
     /// End update from main thread.
@@ -122,6 +126,7 @@ public:
 
     bool DoesOverlapCamera() const { return cameraIsInsideLightVolume_; }
     bool HasShadow() const { return numActiveSplits_ != 0; }
+    bool IsShadowMapCached() const { return isShadowMapCached_; }
     IntVector2 GetShadowMapSize() const { return numActiveSplits_ != 0 ? shadowMapSize_ : IntVector2::ZERO; }
     unsigned GetNumSplits() const { return numActiveSplits_; }
     /// @}
@@ -140,6 +145,7 @@ public:
 private:
     void InitializeShadowSplits(DrawableProcessor* drawableProcessor);
     void UpdateHashes();
+    void UpdateShadowMapCache(DrawableProcessor* drawableProcessor, bool isShadowMapPreserved);
     void CookShaderParameters(Camera* cullCamera, const DrawableProcessorSettings& settings);
     IntVector2 GetNumSplitsInGrid() const;
 
@@ -151,6 +157,8 @@ private:
     /// @{
     bool isShadowRequested_{};
     unsigned numSplitsRequested_{};
+    /// Whether the shadow map is kept between frames.
+    bool isShadowMapCached_{};
     /// @}
 
     /// Processing results
@@ -164,6 +172,11 @@ private:
     /// Point and spot lights: only forward lit geometries.
     /// Directional lights: all lit geometries, for shadow focusing.
     ea::vector<Drawable*> litGeometries_;
+    /// Point and spot lights: per-frame query for lit geometries and shadow casters.
+    /// @{
+    ea::optional<PointLightGeometryQuery> pointLightQuery_;
+    ea::optional<SpotLightGeometryQuery> spotLightQuery_;
+    /// @}
     /// Point and spot lights: all possible shadow casters.
     /// Directional lights: temporary buffer for split queries.
     ea::vector<Drawable*> shadowCasterCandidates_;
@@ -177,6 +190,8 @@ private:
     unsigned forwardLitBatchHash_{};
     unsigned lightVolumeBatchHash_{};
     ea::array<unsigned, MAX_LIGHT_SPLITS> shadowBatchStateHashes_{};
+    /// Shadow pipeline state hash of cached shadow map.
+    unsigned cachedShadowHash_{};
     /// @}
 };
 
@@ -147,14 +147,19 @@ void RenderPipeline::RegisterObject(Context* context)
     URHO3D_ATTRIBUTE_EX("Readable Depth", bool, settings_.renderBufferManager_.readableDepth_, MarkSettingsDirty, RenderBufferManagerSettings{}.readableDepth_, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("Max Vertex Lights", unsigned, settings_.sceneProcessor_.maxVertexLights_, MarkSettingsDirty, DrawableProcessorSettings{}.maxVertexLights_, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("Max Pixel Lights", unsigned, settings_.sceneProcessor_.maxPixelLights_, MarkSettingsDirty, DrawableProcessorSettings{}.maxPixelLights_, AM_DEFAULT);
+    URHO3D_ATTRIBUTE_EX("Clustered Lighting", bool, settings_.sceneProcessor_.clusteredLighting_, MarkSettingsDirty, DrawableProcessorSettings{}.clusteredLighting_, AM_DEFAULT);
+    URHO3D_ATTRIBUTE_EX("Light Cluster Grid Size", IntVector3, settings_.sceneProcessor_.lightClusterGridSize_, MarkSettingsDirty, DrawableProcessorSettings{}.lightClusterGridSize_, AM_DEFAULT);
+    URHO3D_ATTRIBUTE_EX("Max Lights Per Cluster", unsigned, settings_.sceneProcessor_.maxLightsPerCluster_, MarkSettingsDirty, DrawableProcessorSettings{}.maxLightsPerCluster_, AM_DEFAULT);
     URHO3D_ENUM_ATTRIBUTE_EX("Ambient Mode", settings_.sceneProcessor_.ambientMode_, MarkSettingsDirty, ambientModeNames, DrawableAmbientMode::Directional, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("Enable Instancing", bool, settings_.instancingBuffer_.enableInstancing_, MarkSettingsDirty, true, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("Depth Pre-Pass", bool, settings_.sceneProcessor_.depthPrePass_, MarkSettingsDirty, false, AM_DEFAULT);
     URHO3D_ENUM_ATTRIBUTE_EX("Lighting Mode", settings_.sceneProcessor_.lightingMode_, MarkSettingsDirty, directLightingModeNames, DirectLightingMode::Forward, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("Enable Shadows", bool, settings_.sceneProcessor_.enableShadows_, MarkSettingsDirty, true, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("PCF Kernel Size", unsigned, settings_.sceneProcessor_.pcfKernelSize_, MarkSettingsDirty, 1, AM_DEFAULT);
+    URHO3D_ATTRIBUTE_EX("Cache Static Shadow Maps", bool, settings_.sceneProcessor_.cacheStaticShadowMaps_, MarkSettingsDirty, DrawableProcessorSettings{}.cacheStaticShadowMaps_, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("Use Variance Shadow Maps", bool, settings_.shadowMapAllocator_.enableVarianceShadowMaps_, MarkSettingsDirty, false, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("VSM Shadow Settings", Vector2, settings_.sceneProcessor_.varianceShadowMapParams_, MarkSettingsDirty, BatchRendererSettings{}.varianceShadowMapParams_, AM_DEFAULT);
+    URHO3D_ATTRIBUTE_EX("Draw Command Chunk Size", unsigned, settings_.sceneProcessor_.drawCommandChunkSize_, MarkSettingsDirty, BatchRendererSettings{}.drawCommandChunkSize_, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("VSM Multi Sample", unsigned, settings_.shadowMapAllocator_.varianceShadowMapMultiSample_, MarkSettingsDirty, 1, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("16-bit Shadow Maps", bool, settings_.shadowMapAllocator_.use16bitShadowMaps_, MarkSettingsDirty, false, AM_DEFAULT);
     URHO3D_ATTRIBUTE_EX("Auto Exposure", bool, settings_.autoExposure_.autoExposure_, MarkSettingsDirty, false, AM_DEFAULT);
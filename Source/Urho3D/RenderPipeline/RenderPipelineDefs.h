@@ -28,6 +28,7 @@
 #include "../Graphics/GraphicsDefs.h"
 #include "../Graphics/Light.h"
 #include "../Math/Vector2.h"
+#include "../Math/Vector3.h"
 
 namespace Urho3D
 {
@@ -243,6 +244,10 @@ struct RenderPipelineStats
     unsigned numShadowedLights_{};
     /// Number of occluders rendered.
     unsigned numOccluders_{};
+    /// Number of shadow splits reused from previous frame without processing and rendering.
+    unsigned numReusedShadowSplits_{};
+    /// Number of shadow casters that were not composed and rendered due to reused shadow splits.
+    unsigned numSkippedShadowCasters_{};
 };
 
 /// Base interface of render pipeline required by Render Pipeline classes.
@@ -287,6 +292,8 @@ public:
     virtual unsigned GetShadowMapSize(Light* light, unsigned numActiveSplits) const = 0;
     /// Allocate shadow map for one frame.
     virtual ShadowMapRegion AllocateTransientShadowMap(const IntVector2& size) = 0;
+    /// Allocate shadow map that keeps content between frames. isPreserved is true if content of previous frame is kept.
+    virtual ShadowMapRegion AllocatePersistentShadowMap(const IntVector2& size, const void* owner, bool& isPreserved) = 0;
 };
 
 struct LightProcessorCacheSettings
@@ -317,6 +324,12 @@ struct DrawableProcessorSettings
     unsigned maxVertexLights_{ 4 };
     unsigned maxPixelLights_{ 4 };
     unsigned pcfKernelSize_{ 1 };
+    /// Whether to keep shadow maps of spot and point lights between frames while light and shadow casters are static.
+    bool cacheStaticShadowMaps_{};
+    /// Whether to assign point and spot lights to view-space clusters instead of per-light accumulation.
+    bool clusteredLighting_{};
+    IntVector3 lightClusterGridSize_{ 16, 8, 24 };
+    unsigned maxLightsPerCluster_{ 64 };
     LightProcessorCacheSettings lightProcessorCache_;
 
     /// Utility operators
@@ -334,6 +347,8 @@ struct DrawableProcessorSettings
         maxVertexLights_ = Clamp(maxVertexLights_, 0u, 4u);
         maxPixelLights_ = Clamp(maxPixelLights_, 0u, 256u);
         pcfKernelSize_ = Clamp(pcfKernelSize_, 1u, 5u);
+        lightClusterGridSize_ = VectorClamp(lightClusterGridSize_, IntVector3::ONE, IntVector3{ 64, 64, 64 });
+        maxLightsPerCluster_ = Clamp(maxLightsPerCluster_, 1u, 1024u);
 
         // Kernel size of 4 is not supported
         if (pcfKernelSize_ == 4)
@@ -346,6 +361,10 @@ struct DrawableProcessorSettings
             && maxVertexLights_ == rhs.maxVertexLights_
             && maxPixelLights_ == rhs.maxPixelLights_
             && pcfKernelSize_ == rhs.pcfKernelSize_
+            && cacheStaticShadowMaps_ == rhs.cacheStaticShadowMaps_
+            && clusteredLighting_ == rhs.clusteredLighting_
+            && lightClusterGridSize_ == rhs.lightClusterGridSize_
+            && maxLightsPerCluster_ == rhs.maxLightsPerCluster_
             && lightProcessorCache_ == rhs.lightProcessorCache_;
     }
 
@@ -397,6 +416,9 @@ struct BatchRendererSettings
     bool linearSpaceLighting_{};
     DrawableAmbientMode ambientMode_{ DrawableAmbientMode::Directional };
     Vector2 varianceShadowMapParams_{ 0.0000001f, 0.9f };
+    /// Number of batches recorded into draw command queue by one worker thread.
+    /// Batch groups of this size or smaller are recorded in the main thread. 0 to disable parallel recording.
+    unsigned drawCommandChunkSize_{ 1024 };
 
     /// Utility operators
     /// @{
@@ -416,7 +438,8 @@ struct BatchRendererSettings
     {
         return linearSpaceLighting_ == rhs.linearSpaceLighting_
             && ambientMode_ == rhs.ambientMode_
-            && varianceShadowMapParams_ == rhs.varianceShadowMapParams_;
+            && varianceShadowMapParams_ == rhs.varianceShadowMapParams_
+            && drawCommandChunkSize_ == rhs.drawCommandChunkSize_;
     }
 
     bool operator!=(const BatchRendererSettings& rhs) const { return !(*this == rhs); }
@@ -355,6 +355,10 @@ void SceneProcessor::RenderShadowMaps()
     {
         for (const ShadowSplitProcessor& split : sceneLight->GetSplits())
         {
+            // Shadow map is kept from previous frame
+            if (split.IsShadowMapReused())
+                continue;
+
             if (RenderPipelineDebugger::IsSnapshotInProgress(debugger_))
             {
                 const ea::string passName = Format("ShadowMap.[{}].{}",
@@ -501,6 +505,11 @@ ShadowMapRegion SceneProcessor::AllocateTransientShadowMap(const IntVector2& siz
     return shadowMapAllocator_->AllocateShadowMap(size);
 }
 
+ShadowMapRegion SceneProcessor::AllocatePersistentShadowMap(const IntVector2& size, const void* owner, bool& isPreserved)
+{
+    return shadowMapAllocator_->AllocatePersistentShadowMap(size, owner, isPreserved);
+}
+
 void SceneProcessor::DrawOccluders()
 {
     const auto& activeOccluders = drawableProcessor_->GetOccluders();
@@ -123,6 +123,7 @@ private:
     bool IsLightShadowed(Light* light) override;
     unsigned GetShadowMapSize(Light* light, unsigned numActiveSplits) const override;
     ShadowMapRegion AllocateTransientShadowMap(const IntVector2& size) override;
+    ShadowMapRegion AllocatePersistentShadowMap(const IntVector2& size, const void* owner, bool& isPreserved) override;
     /// @}
 
     void DrawOccluders();
@@ -27,6 +27,8 @@
 #include "../Graphics/Renderer.h"
 #include "../RenderPipeline/ShadowMapAllocator.h"
 
+#include <EASTL/algorithm.h>
+
 #include "../DebugNew.h"
 
 namespace Urho3D
@@ -63,6 +65,7 @@ void ShadowMapAllocator::SetSettings(const ShadowMapAllocatorSettings& settings)
 
         dummyColorTexture_ = nullptr;
         pages_.clear();
+        persistentShadowMaps_.clear();
     }
 }
 
@@ -84,9 +87,26 @@ void ShadowMapAllocator::ResetAllShadowMaps()
 {
     for (AtlasPage& element : pages_)
     {
+        if (element.IsPersistent())
+            continue;
         element.areaAllocator_.Reset(shadowAtlasPageSize_.x_, shadowAtlasPageSize_.y_, shadowAtlasPageSize_.x_, shadowAtlasPageSize_.y_);
         element.clearBeforeRendering_ = false;
     }
+
+    // Release persistent shadow maps that were not used since previous reset
+    for (auto iter = persistentShadowMaps_.begin(); iter != persistentShadowMaps_.end();)
+    {
+        if (!iter->second.isUsed_)
+        {
+            ReleasePersistentShadowMap(iter->second);
+            iter = persistentShadowMaps_.erase(iter);
+        }
+        else
+        {
+            iter->second.isUsed_ = false;
+            ++iter;
+        }
+    }
 }
 
 ShadowMapRegion ShadowMapAllocator::AllocateShadowMap(const IntVector2& size)
@@ -98,6 +118,9 @@ ShadowMapRegion ShadowMapAllocator::AllocateShadowMap(const IntVector2& size)
 
     for (AtlasPage& element : pages_)
     {
+        if (element.IsPersistent())
+            continue;
+
         const ShadowMapRegion shadowMap = element.AllocateRegion(clampedSize);
         if (shadowMap)
             return shadowMap;
@@ -107,6 +130,85 @@ ShadowMapRegion ShadowMapAllocator::AllocateShadowMap(const IntVector2& size)
     return pages_.back().AllocateRegion(clampedSize);
 }
 
+ShadowMapRegion ShadowMapAllocator::AllocatePersistentShadowMap(
+    const IntVector2& size, const void* owner, bool& isPreserved)
+{
+    isPreserved = false;
+    if (!settings_.shadowAtlasPageSize_ || !shadowMapFormat_)
+        return {};
+
+    const IntVector2 clampedSize = VectorMin(size, shadowAtlasPageSize_);
+
+    // Reuse region if possible
+    const auto iter = persistentShadowMaps_.find(owner);
+    if (iter != persistentShadowMaps_.end())
+    {
+        PersistentShadowMap& shadowMap = iter->second;
+        if (shadowMap.region_.rect_.Size() == clampedSize)
+        {
+            isPreserved = true;
+            shadowMap.isUsed_ = true;
+            return shadowMap.region_;
+        }
+
+        ReleasePersistentShadowMap(shadowMap);
+        persistentShadowMaps_.erase(iter);
+    }
+
+    // Allocate new region. Shadow maps of similar sizes share pages.
+    const IntVector2 regionSize = GetPersistentRegionSize(clampedSize);
+    PersistentShadowMap shadowMap;
+    for (AtlasPage& element : pages_)
+    {
+        if (element.persistentRegionSize_ != regionSize)
+            continue;
+
+        shadowMap.region_ = element.AllocatePersistentRegion(clampedSize, shadowMap.regionIndex_);
+        if (shadowMap.region_)
+            break;
+    }
+
+    if (!shadowMap.region_)
+    {
+        // Reuse page that was not used since previous reset, if any
+        const auto isEmpty = [](const AtlasPage& element) { return element.IsEmpty(); };
+        auto pageIter = ea::find_if(pages_.begin(), pages_.end(), isEmpty);
+        if (pageIter == pages_.end())
+        {
+            AllocatePage();
+            pageIter = pages_.end() - 1;
+        }
+
+        pageIter->InitializePersistentRegions(regionSize, shadowAtlasPageSize_);
+        shadowMap.region_ = pageIter->AllocatePersistentRegion(clampedSize, shadowMap.regionIndex_);
+    }
+
+    shadowMap.isUsed_ = true;
+    persistentShadowMaps_[owner] = shadowMap;
+    return shadowMap.region_;
+}
+
+void ShadowMapAllocator::ReleasePersistentShadowMap(const PersistentShadowMap& shadowMap)
+{
+    AtlasPage& element = pages_[shadowMap.region_.pageIndex_];
+    if (element.ReleasePersistentRegion(shadowMap.regionIndex_))
+        element.areaAllocator_.Reset(shadowAtlasPageSize_.x_, shadowAtlasPageSize_.y_, shadowAtlasPageSize_.x_, shadowAtlasPageSize_.y_);
+}
+
+IntVector2 ShadowMapAllocator::GetPersistentRegionSize(const IntVector2& size) const
+{
+    const IntVector2 bucketSize{ static_cast<int>(NextPowerOfTwo(size.x_)), static_cast<int>(NextPowerOfTwo(size.y_)) };
+    return VectorMin(bucketSize, shadowAtlasPageSize_);
+}
+
+ClearTargetFlags ShadowMapAllocator::GetClearFlags() const
+{
+    ClearTargetFlags clearFlags = CLEAR_DEPTH;
+    if (settings_.enableVarianceShadowMaps_ || dummyColorTexture_)
+        clearFlags |= CLEAR_COLOR;
+    return clearFlags;
+}
+
 bool ShadowMapAllocator::BeginShadowMapRendering(const ShadowMapRegion& shadowMap)
 {
     if (!shadowMap || shadowMap.pageIndex_ >= pages_.size())
@@ -141,14 +243,15 @@ bool ShadowMapAllocator::BeginShadowMapRendering(const ShadowMapRegion& shadowMa
         poolElement.clearBeforeRendering_ = false;
 
         graphics_->SetViewport(shadowMapTexture->GetRect());
-        ClearTargetFlags clearFlags = CLEAR_DEPTH;
-        if (settings_.enableVarianceShadowMaps_ || dummyColorTexture_)
-            clearFlags |= CLEAR_COLOR;
-        graphics_->Clear(clearFlags, Color::WHITE);
+        graphics_->Clear(GetClearFlags(), Color::WHITE);
     }
 
     graphics_->SetViewport(shadowMap.rect_);
 
+    // Persistent page is never cleared as a whole, clear only the region being rendered
+    if (poolElement.IsPersistent())
+        graphics_->Clear(GetClearFlags(), Color::WHITE);
+
     return true;
 }
 
@@ -170,6 +273,49 @@ ShadowMapRegion ShadowMapAllocator::AtlasPage::AllocateRegion(const IntVector2&
     return {};
 }
 
+void ShadowMapAllocator::AtlasPage::InitializePersistentRegions(const IntVector2& regionSize, const IntVector2& pageSize)
+{
+    const IntVector2 numRegions = pageSize / regionSize;
+    persistentRegionSize_ = regionSize;
+    persistentRegionsUsed_.clear();
+    persistentRegionsUsed_.resize(numRegions.x_ * numRegions.y_);
+    numPersistentRegionsUsed_ = 0;
+}
+
+ShadowMapRegion ShadowMapAllocator::AtlasPage::AllocatePersistentRegion(const IntVector2& size, unsigned& regionIndex)
+{
+    const auto iter = ea::find(persistentRegionsUsed_.begin(), persistentRegionsUsed_.end(), false);
+    if (iter == persistentRegionsUsed_.end())
+        return {};
+
+    *iter = true;
+    ++numPersistentRegionsUsed_;
+    regionIndex = static_cast<unsigned>(iter - persistentRegionsUsed_.begin());
+
+    const int numRegionsInRow = texture_->GetWidth() / persistentRegionSize_.x_;
+    const IntVector2 index{ static_cast<int>(regionIndex) % numRegionsInRow, static_cast<int>(regionIndex) / numRegionsInRow };
+    const IntVector2 offset = index * persistentRegionSize_;
+
+    ShadowMapRegion shadowMap;
+    shadowMap.pageIndex_ = index_;
+    shadowMap.texture_ = texture_;
+    shadowMap.rect_ = IntRect(offset, offset + size);
+    return shadowMap;
+}
+
+bool ShadowMapAllocator::AtlasPage::ReleasePersistentRegion(unsigned regionIndex)
+{
+    persistentRegionsUsed_[regionIndex] = false;
+    if (--numPersistentRegionsUsed_ != 0)
+        return false;
+
+    // Return page to the pool of regular pages
+    persistentRegionSize_ = IntVector2::ZERO;
+    persistentRegionsUsed_.clear();
+    clearBeforeRendering_ = false;
+    return true;
+}
+
 void ShadowMapAllocator::AllocatePage()
 {
     const bool isDepthTexture = !settings_.enableVarianceShadowMaps_;
@@ -29,6 +29,7 @@
 #include "../Graphics/Light.h"
 #include "../RenderPipeline/RenderPipelineDefs.h"
 
+#include <EASTL/unordered_map.h>
 #include <EASTL/vector.h>
 
 namespace Urho3D
@@ -49,6 +50,11 @@ public:
     void ResetAllShadowMaps();
     /// Allocate shadow map of given size. It is better to allocate from bigger to smaller sizes.
     ShadowMapRegion AllocateShadowMap(const IntVector2& size);
+    /// Allocate shadow map that keeps its region and content between frames.
+    /// The region is released on reset if it was not requested by the owner since previous reset.
+    /// isPreserved is set to true if the owner got the same region as in previous frame.
+    /// Persistent shadow maps share pages with shadow maps of the same size rounded up to power of two.
+    ShadowMapRegion AllocatePersistentShadowMap(const IntVector2& size, const void* owner, bool& isPreserved);
     /// Begin shadow map rendering. Clears shadow map if necessary.
     bool BeginShadowMapRendering(const ShadowMapRegion& shadowMap);
 
@@ -62,12 +68,41 @@ private:
         AreaAllocator areaAllocator_;
         bool clearBeforeRendering_{};
 
+        /// Persistent pages are split into equal regions which are not reset every frame.
+        /// Page becomes regular again when all its regions are released.
+        /// @{
+        IntVector2 persistentRegionSize_;
+        ea::vector<bool> persistentRegionsUsed_;
+        unsigned numPersistentRegionsUsed_{};
+        /// @}
+
         /// Allocate shadow map.
         ShadowMapRegion AllocateRegion(const IntVector2& size);
+        /// Reserve page for persistent shadow maps with given region size.
+        void InitializePersistentRegions(const IntVector2& regionSize, const IntVector2& pageSize);
+        /// Allocate persistent shadow map of given size that fits into region.
+        ShadowMapRegion AllocatePersistentRegion(const IntVector2& size, unsigned& regionIndex);
+        /// Release persistent shadow map. Return true if page has no persistent shadow maps anymore.
+        bool ReleasePersistentRegion(unsigned regionIndex);
+        /// Return whether the page is reserved for persistent shadow maps.
+        bool IsPersistent() const { return persistentRegionSize_ != IntVector2::ZERO; }
+        /// Return whether the page has no shadow maps allocated since previous reset.
+        bool IsEmpty() const { return !IsPersistent() && !clearBeforeRendering_; }
+    };
+
+    struct PersistentShadowMap
+    {
+        ShadowMapRegion region_;
+        unsigned regionIndex_{};
+        bool isUsed_{};
     };
 
     void CacheSettings();
     void AllocatePage();
+    /// Return size of persistent region used for shadow map of given size.
+    IntVector2 GetPersistentRegionSize(const IntVector2& size) const;
+    void ReleasePersistentShadowMap(const PersistentShadowMap& shadowMap);
+    ClearTargetFlags GetClearFlags() const;
 
     /// External dependencies
     /// @{
@@ -85,6 +120,7 @@ private:
     /// Dummy color map for workaround, if needed.
     SharedPtr<Texture2D> dummyColorTexture_;
     ea::vector<AtlasPage> pages_;
+    ea::unordered_map<const void*, PersistentShadowMap> persistentShadowMaps_;
 };
 
 }
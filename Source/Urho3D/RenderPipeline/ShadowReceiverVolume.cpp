@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../RenderPipeline/ShadowReceiverVolume.h"
+
+#ifdef URHO3D_SSE
+#include <emmintrin.h>
+#endif
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+namespace
+{
+
+/// Convert continuous cell coordinate to cell index, clamped to grid. NaN is mapped to zero.
+int ToCellIndex(float coord)
+{
+    if (!(coord > 0.0f))
+        return 0;
+    if (coord >= static_cast<float>(ShadowReceiverVolume::GridSize))
+        return ShadowReceiverVolume::GridSize - 1;
+    return static_cast<int>(coord);
+}
+
+}
+
+void ShadowReceiverVolume::Define(const Rect& lightSpaceRect)
+{
+    rectMin_ = lightSpaceRect.min_;
+    rectSize_ = lightSpaceRect.Size();
+    cellsPerUnit_ = static_cast<float>(GridSize) * Vector2::ONE / VectorMax(rectSize_, Vector2::ONE * M_EPSILON);
+    hasReceivers_ = false;
+    maxDepth_.fill(-M_INFINITY);
+}
+
+void ShadowReceiverVolume::AddReceiver(const BoundingBox& lightSpaceBoundingBox)
+{
+    IntVector2 beginCell;
+    IntVector2 endCell;
+    if (!GetCellRange(lightSpaceBoundingBox, beginCell, endCell))
+        return;
+
+    hasReceivers_ = true;
+    const float maxDepth = lightSpaceBoundingBox.max_.z_;
+    for (int y = beginCell.y_; y < endCell.y_; ++y)
+    {
+        float* row = &maxDepth_[y * GridSize];
+        for (int x = beginCell.x_; x < endCell.x_; ++x)
+            row[x] = ea::max(row[x], maxDepth);
+    }
+}
+
+bool ShadowReceiverVolume::IsShadowCasterVisible(const BoundingBox& lightSpaceBoundingBox) const
+{
+    IntVector2 beginCell;
+    IntVector2 endCell;
+    if (!hasReceivers_ || !GetCellRange(lightSpaceBoundingBox, beginCell, endCell))
+        return false;
+
+    const float minDepth = lightSpaceBoundingBox.min_.z_;
+
+#ifdef URHO3D_SSE
+    // Test 4 cells at once, mask out cells outside of the range
+    static_assert(GridSize % 4 == 0, "Grid rows should consist of whole SSE vectors");
+    const __m128 casterDepth = _mm_set1_ps(minDepth);
+    const int beginGroup = beginCell.x_ / 4;
+    const int endGroup = (endCell.x_ + 3) / 4;
+    for (int y = beginCell.y_; y < endCell.y_; ++y)
+    {
+        const float* row = &maxDepth_[y * GridSize];
+        for (int group = beginGroup; group < endGroup; ++group)
+        {
+            const int firstCell = group * 4;
+            const int laneBegin = ea::max(0, beginCell.x_ - firstCell);
+            const int laneEnd = ea::min(4, endCell.x_ - firstCell);
+            const int laneMask = (0xf << laneBegin) & (0xf >> (4 - laneEnd));
+
+            const __m128 receiverDepth = _mm_loadu_ps(row + firstCell);
+            if (_mm_movemask_ps(_mm_cmpge_ps(receiverDepth, casterDepth)) & laneMask)
+                return true;
+        }
+    }
+    return false;
+#else
+    for (int y = beginCell.y_; y < endCell.y_; ++y)
+    {
+        const float* row = &maxDepth_[y * GridSize];
+        for (int x = beginCell.x_; x < endCell.x_; ++x)
+        {
+            if (row[x] >= minDepth)
+                return true;
+        }
+    }
+    return false;
+#endif
+}
+
+bool ShadowReceiverVolume::GetCellRange(const BoundingBox& lightSpaceBoundingBox,
+    IntVector2& beginCell, IntVector2& endCell) const
+{
+    const Vector2 boxMin = lightSpaceBoundingBox.min_.ToVector2();
+    const Vector2 boxMax = lightSpaceBoundingBox.max_.ToVector2();
+    const Vector2 rectMax = rectMin_ + rectSize_;
+    if (boxMax.x_ < rectMin_.x_ || boxMax.y_ < rectMin_.y_ || boxMin.x_ > rectMax.x_ || boxMin.y_ > rectMax.y_)
+        return false;
+
+    const Vector2 beginCoord = (boxMin - rectMin_) * cellsPerUnit_;
+    const Vector2 endCoord = (boxMax - rectMin_) * cellsPerUnit_;
+    beginCell = { ToCellIndex(beginCoord.x_), ToCellIndex(beginCoord.y_) };
+    endCell = { ToCellIndex(endCoord.x_) + 1, ToCellIndex(endCoord.y_) + 1 };
+    return true;
+}
+
+}
@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Math/BoundingBox.h"
+#include "../Math/Rect.h"
+
+#include <EASTL/array.h>
+
+namespace Urho3D
+{
+
+/// Volume of visible shadow receivers in light space of directional light split, extruded towards the light.
+/// Stored as coarse grid over light-space XY rectangle of the split, each cell contains max depth of receivers.
+/// Shadow caster may cast shadow on receiver only if it's closer to the light than the farthest receiver in any
+/// grid cell covered by caster.
+class URHO3D_API ShadowReceiverVolume
+{
+public:
+    /// Size of the grid in each dimension.
+    static const int GridSize = 16;
+
+    /// Reset volume for given light-space rectangle.
+    void Define(const Rect& lightSpaceRect);
+    /// Add receiver with light-space bounding box.
+    void AddReceiver(const BoundingBox& lightSpaceBoundingBox);
+    /// Return whether shadow caster with light-space bounding box may cast shadow on any receiver.
+    bool IsShadowCasterVisible(const BoundingBox& lightSpaceBoundingBox) const;
+
+    /// Return whether there are any receivers.
+    bool HasReceivers() const { return hasReceivers_; }
+    /// Return max depth of receivers in the cell.
+    float GetMaxDepth(int x, int y) const { return maxDepth_[y * GridSize + x]; }
+
+private:
+    /// Convert light-space rectangle to cell range. Return false if there's no overlap.
+    bool GetCellRange(const BoundingBox& lightSpaceBoundingBox, IntVector2& beginCell, IntVector2& endCell) const;
+
+    /// Light-space rectangle covered by grid.
+    Vector2 rectMin_;
+    Vector2 rectSize_;
+    Vector2 cellsPerUnit_;
+    /// Whether any receiver is added.
+    bool hasReceivers_{};
+    /// Max depth of receivers per cell, row-major.
+    ea::array<float, GridSize * GridSize> maxDepth_{};
+};
+
+}
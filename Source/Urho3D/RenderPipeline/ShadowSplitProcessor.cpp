@@ -24,7 +24,9 @@
 
 #include "../Graphics/Camera.h"
 #include "../Graphics/Drawable.h"
+#include "../Graphics/Geometry.h"
 #include "../Graphics/Light.h"
+#include "../Graphics/Material.h"
 #include "../Graphics/Octree.h"
 #include "../Math/Polyhedron.h"
 #include "../RenderPipeline/BatchCompositor.h"
@@ -34,6 +36,7 @@
 #include "../RenderPipeline/ShadowMapAllocator.h"
 #include "../RenderPipeline/ShadowSplitProcessor.h"
 
+#include <EASTL/algorithm.h>
 #include <EASTL/sort.h>
 
 #include "../DebugNew.h"
@@ -138,8 +141,8 @@ void ShadowSplitProcessor::InitializePoint(CubeMapFace face)
     shadowCamera_->SetZoom(1.0f);
 }
 
-void ShadowSplitProcessor::ProcessDirectionalShadowCasters(
-    DrawableProcessor* drawableProcessor, ea::vector<Drawable*>& shadowCastersBuffer)
+void ShadowSplitProcessor::ProcessDirectionalShadowCasters(DrawableProcessor* drawableProcessor,
+    const ea::vector<Drawable*>& litGeometries, ea::vector<Drawable*>& shadowCastersBuffer)
 {
     shadowCasters_.clear();
     unsortedShadowBatches_.clear();
@@ -158,8 +161,14 @@ void ShadowSplitProcessor::ProcessDirectionalShadowCasters(
         shadowCastersBuffer, shadowCamera_->GetFrustum(), DRAWABLE_GEOMETRY, light_, cullCamera->GetViewMask());
     octree->GetDrawables(query);
 
+    // Skip casters that cannot cast shadow on any visible receiver in the split
+    UpdateReceiverVolume(drawableProcessor, litGeometries);
+    if (!receiverVolume_.HasReceivers())
+        return;
+
     // Preprocess shadow casters
-    drawableProcessor->PreprocessShadowCasters(shadowCasters_, shadowCastersBuffer, cascadeZRange_, light_, shadowCamera_);
+    drawableProcessor->PreprocessShadowCasters(shadowCasters_, shadowCastersBuffer,
+        cascadeZRange_, light_, shadowCamera_, &receiverVolume_);
 }
 
 void ShadowSplitProcessor::ProcessSpotShadowCasters(
@@ -192,6 +201,80 @@ void ShadowSplitProcessor::ProcessPointShadowCasters(
     drawableProcessor->PreprocessShadowCasters(shadowCasters_, shadowCasterCandidates, {}, light_, shadowCamera_);
 }
 
+void ShadowSplitProcessor::ProcessCachedShadowCasters(
+    DrawableProcessor* drawableProcessor, const ea::vector<Drawable*>& shadowCasterCandidates)
+{
+    shadowCasters_.clear();
+    unsortedShadowBatches_.clear();
+    sortedShadowBatches_.clear();
+
+    // Collect all shadow casters regardless of cull camera so the shadow map could be reused later
+    drawableProcessor->PreprocessCachedShadowCasters(shadowCasters_, shadowCasterCandidates, light_, shadowCamera_);
+    ea::sort(shadowCasters_.begin(), shadowCasters_.end());
+
+    // Shadow map may be reused if shadow casters are the same and were not updated since the shadow map was rendered.
+    // Shadow camera and shadow map region are checked later.
+    const auto isUpdated = [&](Drawable* drawable) { return drawable->GetUpdateFrameNumber() > cachedFrameNumber_; };
+    shadowCastersHash_ = CalculateShadowCastersHash(shadowCasters_);
+    isShadowMapReused_ = hasCachedShadowMap_ && shadowCasters_ == cachedShadowCasters_
+        && shadowCastersHash_ == cachedShadowCastersHash_
+        && !ea::any_of(shadowCasters_.begin(), shadowCasters_.end(), isUpdated);
+
+    if (!isShadowMapReused_)
+        drawableProcessor->QueueShadowCasterUpdates(shadowCasters_);
+}
+
+void ShadowSplitProcessor::FinalizeCachedShadow(DrawableProcessor* drawableProcessor, bool isShadowMapPreserved)
+{
+    const Matrix4& viewProj = shadowCamera_->GetViewProj();
+    if (isShadowMapReused_ && (!isShadowMapPreserved || viewProj != cachedViewProj_))
+    {
+        isShadowMapReused_ = false;
+        drawableProcessor->QueueShadowCasterUpdates(shadowCasters_);
+    }
+
+    if (!isShadowMapReused_)
+    {
+        hasCachedShadowMap_ = true;
+        cachedFrameNumber_ = drawableProcessor->GetFrameInfo().frameNumber_;
+        cachedViewProj_ = viewProj;
+        cachedShadowCasters_ = shadowCasters_;
+        cachedShadowCastersHash_ = shadowCastersHash_;
+    }
+}
+
+void ShadowSplitProcessor::ResetCachedShadow()
+{
+    isShadowMapReused_ = false;
+    hasCachedShadowMap_ = false;
+    cachedShadowCasters_.clear();
+}
+
+unsigned ShadowSplitProcessor::CalculateShadowCastersHash(const ea::vector<Drawable*>& shadowCasters)
+{
+    unsigned hash = 0;
+    for (Drawable* drawable : shadowCasters)
+    {
+        CombineHash(hash, drawable->GetCastShadows());
+        CombineHash(hash, MakeHash(drawable->GetLodBias()));
+        for (const SourceBatch& sourceBatch : drawable->GetBatches())
+        {
+            CombineHash(hash, MakeHash(sourceBatch.geometry_));
+            if (sourceBatch.geometry_)
+                CombineHash(hash, sourceBatch.geometry_->GetPipelineStateHash());
+
+            Material* material = sourceBatch.material_;
+            CombineHash(hash, MakeHash(material));
+            if (material)
+            {
+                CombineHash(hash, material->GetPipelineStateHash());
+                CombineHash(hash, material->GetShaderParameterHash());
+            }
+        }
+    }
+    return hash;
+}
+
 void ShadowSplitProcessor::FinalizeShadow(const ShadowMapRegion& shadowMap, unsigned pcfKernelSize)
 {
     shadowMap_ = shadowMap;
@@ -284,6 +367,21 @@ BoundingBox ShadowSplitProcessor::GetSplitShadowBoundingBoxInLightSpace(
     return shadowBox;
 }
 
+void ShadowSplitProcessor::UpdateReceiverVolume(
+    DrawableProcessor* drawableProcessor, const ea::vector<Drawable*>& litGeometries)
+{
+    const BoundingBox lightSpaceSplitBox{ shadowCamera_->GetViewSpaceFrustum() };
+    receiverVolume_.Define({ lightSpaceSplitBox.min_.ToVector2(), lightSpaceSplitBox.max_.ToVector2() });
+
+    const Matrix3x4& lightView = shadowCamera_->GetView();
+    for (Drawable* drawable : litGeometries)
+    {
+        const FloatRange& geometryZRange = drawableProcessor->GetGeometryZRange(drawable->GetDrawableIndex());
+        if (geometryZRange.Interset(cascadeZRange_))
+            receiverVolume_.AddReceiver(drawable->GetWorldBoundingBox().Transformed(lightView));
+    }
+}
+
 void ShadowSplitProcessor::AdjustDirectionalLightCamera(const BoundingBox& lightSpaceBoundingBox, float shadowMapSize)
 {
     const FocusParameters& focusParameters = light_->GetShadowFocus();
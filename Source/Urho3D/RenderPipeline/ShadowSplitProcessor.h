@@ -26,6 +26,7 @@
 #include "../Math/NumericRange.h"
 #include "../RenderPipeline/RenderPipelineDefs.h"
 #include "../RenderPipeline/PipelineBatchSortKey.h"
+#include "../RenderPipeline/ShadowReceiverVolume.h"
 #include "../Scene/Node.h"
 
 #include <EASTL/vector.h>
@@ -59,11 +60,23 @@ public:
 
     /// Process shadow casters
     /// @{
-    void ProcessDirectionalShadowCasters(DrawableProcessor* drawableProcessor, ea::vector<Drawable*>& shadowCastersBuffer);
+    void ProcessDirectionalShadowCasters(DrawableProcessor* drawableProcessor,
+        const ea::vector<Drawable*>& litGeometries, ea::vector<Drawable*>& shadowCastersBuffer);
     void ProcessSpotShadowCasters(DrawableProcessor* drawableProcessor, const ea::vector<Drawable*>& shadowCasterCandidates);
     void ProcessPointShadowCasters(DrawableProcessor* drawableProcessor, const ea::vector<Drawable*>& shadowCasterCandidates);
     /// @}
 
+    /// Shadow map caching for spot and point lights
+    /// @{
+    void ProcessCachedShadowCasters(DrawableProcessor* drawableProcessor, const ea::vector<Drawable*>& shadowCasterCandidates);
+    void FinalizeCachedShadow(DrawableProcessor* drawableProcessor, bool isShadowMapPreserved);
+    void ResetCachedShadow();
+    /// @}
+
+    /// Return hash of shadow caster state that doesn't cause octree update: geometries, materials, LOD bias and shadow flag.
+    /// Cached shadow map is rebuilt when it changes.
+    static unsigned CalculateShadowCastersHash(const ea::vector<Drawable*>& shadowCasters);
+
     void FinalizeShadow(const ShadowMapRegion& shadowMap, unsigned pcfKernelSize);
     void FinalizeShadowBatches();
 
@@ -80,6 +93,9 @@ public:
     bool HasShadowCasters() const { return !shadowCasters_.empty(); }
     /// @}
 
+    /// Return whether shadow map content is kept from previous frame. Valid after shadow map is finalized.
+    bool IsShadowMapReused() const { return isShadowMapReused_; }
+
     /// Return values are valid after shadow map is finalized
     /// @{
     Matrix4 GetWorldToShadowSpaceMatrix(float subPixelOffset) const;
@@ -100,6 +116,7 @@ private:
     BoundingBox GetSplitShadowBoundingBoxInLightSpace(
         DrawableProcessor* drawableProcessor, const ea::vector<Drawable*>& litGeometries) const;
     void AdjustDirectionalLightCamera(const BoundingBox& lightSpaceBoundingBox, float shadowMapSize);
+    void UpdateReceiverVolume(DrawableProcessor* drawableProcessor, const ea::vector<Drawable*>& litGeometries);
 
     /// Immutable
     /// @{
@@ -119,6 +136,8 @@ private:
     FloatRange cascadeZRange_{};
     FloatRange focusedCascadeZRange_{};
     ea::vector<Drawable*> shadowCasters_;
+    /// Visible receivers of directional light split.
+    ShadowReceiverVolume receiverVolume_;
 
     ShadowMapRegion shadowMap_;
     float shadowMapWorldSpaceTexelSize_{};
@@ -130,6 +149,17 @@ private:
     ea::vector<PipelineBatchByState> sortedShadowBatches_;
     PipelineBatchGroup<PipelineBatchByState> shadowBatches_;
     /// @}
+
+    /// Shadow map cache
+    /// @{
+    bool isShadowMapReused_{};
+    bool hasCachedShadowMap_{};
+    unsigned cachedFrameNumber_{};
+    Matrix4 cachedViewProj_;
+    ea::vector<Drawable*> cachedShadowCasters_;
+    unsigned shadowCastersHash_{};
+    unsigned cachedShadowCastersHash_{};
+    /// @}
 };
 
 }
@@ -26,7 +26,10 @@
 
 #include "../Core/Context.h"
 #include "../Core/Profiler.h"
+#include "../IO/AsyncFileIO.h"
+#include "../IO/File.h"
 #include "../IO/Log.h"
+#include "../IO/MemoryBuffer.h"
 #include "../Resource/BackgroundLoader.h"
 #include "../Resource/ResourceCache.h"
 #include "../Resource/ResourceEvents.h"
@@ -36,6 +39,25 @@
 namespace Urho3D
 {
 
+namespace
+{
+
+/// Max number of resource files read at the same time.
+const unsigned maxReadsInFlight = 16;
+
+/// Resource file that is being read asynchronously.
+struct PendingRead
+{
+    /// Queue item of the resource.
+    BackgroundLoadItem* item_{};
+    /// File being read.
+    SharedPtr<File> file_;
+    /// Contents of the file.
+    ByteVector data_;
+};
+
+}
+
 BackgroundLoader::BackgroundLoader(ResourceCache* owner) :
     owner_(owner)
 {
@@ -52,62 +74,82 @@ void BackgroundLoader::ThreadFunction()
 {
     URHO3D_PROFILE_THREAD("BackgroundLoader Thread");
 
-    while (shouldRun_)
-    {
-        backgroundLoadMutex_.Acquire();
+    // Read buffers must outlive the reads in flight, so the I/O service is destroyed first
+    ea::unordered_map<unsigned, PendingRead> pendingReads;
+    AsyncFileIO asyncIO(maxReadsInFlight);
+    ea::vector<AsyncReadResult> completedReads;
 
-        // Search for a queued resource that has not been loaded yet
-        auto i = backgroundLoadQueue_.begin();
-        while (i != backgroundLoadQueue_.end())
+    const auto processCompletedReads = [&]
+    {
+        for (const AsyncReadResult& result : completedReads)
         {
-            if (i->second.resource_->GetAsyncLoadState() == ASYNC_QUEUED)
-                break;
-            else
-                ++i;
-        }
+            auto i = pendingReads.find(result.id_);
+            PendingRead& read = i->second;
 
-        if (i == backgroundLoadQueue_.end())
-        {
-            // No resources to load found
-            backgroundLoadMutex_.Release();
-            Time::Sleep(5);
+            bool success = false;
+            if (result.success_)
+            {
+                MemoryBuffer source(read.data_);
+                source.SetName(read.file_->GetName());
+                success = read.item_->resource_->BeginLoad(source);
+            }
+
+            CompleteBeginLoad(*read.item_, success);
+            pendingReads.erase(i);
         }
-        else
+        completedReads.clear();
+    };
+
+    while (shouldRun_)
+    {
+        // Start reading queued resources while there is room for more reads
+        while (pendingReads.size() < maxReadsInFlight)
         {
-            BackgroundLoadItem& item = i->second;
-            Resource* resource = item.resource_;
-            // We can be sure that the item is not removed from the queue as long as it is in the
-            // "queued" or "loading" state
-            backgroundLoadMutex_.Release();
+            BackgroundLoadItem* item = StartNextQueuedItem();
+            if (!item)
+                break;
 
-            bool success = false;
-            SharedPtr<File> file = owner_->GetFile(resource->GetName(), item.sendEventOnFailure_);
-            if (file)
+            Resource* resource = item->resource_;
+            SharedPtr<File> file = owner_->GetFile(resource->GetName(), item->sendEventOnFailure_);
+            if (!file)
             {
-                resource->SetAsyncLoadState(ASYNC_LOADING);
-                success = resource->BeginLoad(*file);
+                CompleteBeginLoad(*item, false);
+                continue;
             }
 
-            // Process dependencies now
-            // Need to lock the queue again when manipulating other entries
-            ea::pair<StringHash, StringHash> key = ea::make_pair(resource->GetType(), resource->GetNameHash());
-            backgroundLoadMutex_.Acquire();
-            if (item.dependents_.size())
+            // Memory mapped files and files that can't be read asynchronously are loaded directly
+            if (file->IsMemoryMapped() || !AsyncFileIO::CanRead(*file))
             {
-                for (auto i = item.dependents_.begin(); i != item.dependents_.end(); ++i)
-                {
-                    auto j = backgroundLoadQueue_.find(*i);
-                    if (j != backgroundLoadQueue_.end())
-                        j->second.dependencies_.erase(key);
-                }
-
-                item.dependents_.clear();
+                CompleteBeginLoad(*item, resource->BeginLoad(*file));
+                continue;
             }
 
-            resource->SetAsyncLoadState(success ? ASYNC_SUCCESS : ASYNC_FAIL);
-            backgroundLoadMutex_.Release();
+            PendingRead read;
+            read.item_ = item;
+            read.file_ = file;
+            read.data_.resize(file->GetSize());
+            const unsigned id = asyncIO.Read(file, 0, read.data_.data(), read.data_.size());
+            pendingReads.emplace(id, ea::move(read));
         }
+
+        if (pendingReads.empty())
+        {
+            // No resources to load found
+            Time::Sleep(5);
+            continue;
+        }
+
+        // Block only if no more reads can be started, so that newly queued resources are not delayed
+        if (pendingReads.size() >= maxReadsInFlight)
+            asyncIO.WaitCompleted(completedReads);
+        else if (!asyncIO.PollCompleted(completedReads))
+            Time::Sleep(1);
+
+        processCompletedReads();
     }
+
+    while (!pendingReads.empty() && asyncIO.WaitCompleted(completedReads))
+        processCompletedReads();
 }
 
 bool BackgroundLoader::QueueResource(StringHash type, const ea::string& name, bool sendEventOnFailure, Resource* caller)
@@ -218,8 +260,9 @@ void BackgroundLoader::WaitForResource(StringHash type, StringHash nameHash)
         backgroundLoadMutex_.Release();
 }
 
-void BackgroundLoader::FinishResources(int maxMs)
+unsigned BackgroundLoader::FinishResources(int maxMs)
 {
+    unsigned numFinished = 0;
     if (IsStarted())
     {
         HiresTimer timer;
@@ -242,6 +285,7 @@ void BackgroundLoader::FinishResources(int maxMs)
                 FinishBackgroundLoading(i->second);
                 backgroundLoadMutex_.Acquire();
                 i = backgroundLoadQueue_.erase(i);
+                ++numFinished;
             }
 
             // Break when the time limit passed so that we keep sufficient FPS
@@ -251,6 +295,48 @@ void BackgroundLoader::FinishResources(int maxMs)
 
         backgroundLoadMutex_.Release();
     }
+    return numFinished;
+}
+
+BackgroundLoadItem* BackgroundLoader::StartNextQueuedItem()
+{
+    MutexLock lock(backgroundLoadMutex_);
+
+    for (auto& [key, item] : backgroundLoadQueue_)
+    {
+        // We can be sure that the item is not removed from the queue as long as it is in the
+        // "queued" or "loading" state
+        if (item.resource_->GetAsyncLoadState() == ASYNC_QUEUED)
+        {
+            item.resource_->SetAsyncLoadState(ASYNC_LOADING);
+            return &item;
+        }
+    }
+
+    return nullptr;
+}
+
+void BackgroundLoader::CompleteBeginLoad(BackgroundLoadItem& item, bool success)
+{
+    Resource* resource = item.resource_;
+
+    // Process dependencies now
+    // Need to lock the queue again when manipulating other entries
+    ea::pair<StringHash, StringHash> key = ea::make_pair(resource->GetType(), resource->GetNameHash());
+    MutexLock lock(backgroundLoadMutex_);
+    if (item.dependents_.size())
+    {
+        for (auto i = item.dependents_.begin(); i != item.dependents_.end(); ++i)
+        {
+            auto j = backgroundLoadQueue_.find(*i);
+            if (j != backgroundLoadQueue_.end())
+                j->second.dependencies_.erase(key);
+        }
+
+        item.dependents_.clear();
+    }
+
+    resource->SetAsyncLoadState(success ? ASYNC_SUCCESS : ASYNC_FAIL);
 }
 
 unsigned BackgroundLoader::GetNumQueuedResources() const
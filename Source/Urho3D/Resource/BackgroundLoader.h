@@ -50,6 +50,7 @@ struct URHO3D_API BackgroundLoadItem
 };
 
 /// Background loader of resources. Owned by the ResourceCache.
+/// Keeps multiple resource files read asynchronously at the same time.
 /// @nobind
 class URHO3D_API BackgroundLoader : public RefCounted, public Thread
 {
@@ -67,13 +68,17 @@ public:
     bool QueueResource(StringHash type, const ea::string& name, bool sendEventOnFailure, Resource* caller);
     /// Wait and finish possible loading of a resource when being requested from the cache.
     void WaitForResource(StringHash type, StringHash nameHash);
-    /// Process resources that are ready to finish.
-    void FinishResources(int maxMs);
+    /// Process resources that are ready to finish. Return number of finished resources.
+    unsigned FinishResources(int maxMs);
 
     /// Return amount of resources in the load queue.
     unsigned GetNumQueuedResources() const;
 
 private:
+    /// Find a queued resource and mark it as loading. Return null if none found.
+    BackgroundLoadItem* StartNextQueuedItem();
+    /// Store result of BeginLoad() and release the resources depending on it.
+    void CompleteBeginLoad(BackgroundLoadItem& item, bool success);
     /// Finish one background loaded resource.
     void FinishBackgroundLoading(BackgroundLoadItem& item);
 
@@ -31,6 +31,8 @@
 #include "../Resource/ResourceCache.h"
 
 #include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/prettywriter.h>
 
@@ -53,61 +55,85 @@ void JSONFile::RegisterObject(Context* context)
     context->RegisterFactory<JSONFile>();
 }
 
-// Convert rapidjson value to JSON value.
-static void ToJSONValue(JSONValue& jsonValue, const rapidjson::Value& rapidjsonValue)
+namespace
 {
-    switch (rapidjsonValue.GetType())
-    {
-    case kNullType:
-        // Reset to null type
-        jsonValue.SetType(JSON_NULL);
-        break;
 
-    case kFalseType:
-        jsonValue = false;
-        break;
-
-    case kTrueType:
-        jsonValue = true;
-        break;
+/// Handler of rapidjson reader that builds JSON value directly, without intermediate rapidjson document.
+class JSONValueBuilder : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, JSONValueBuilder>
+{
+public:
+    explicit JSONValueBuilder(JSONValue& root) : root_(root) {}
 
-    case kNumberType:
-        if (rapidjsonValue.IsInt())
-            jsonValue = rapidjsonValue.GetInt();
-        else if (rapidjsonValue.IsUint())
-            jsonValue = rapidjsonValue.GetUint();
+    bool Null() { CreateValue(); return true; }
+    bool Bool(bool value) { CreateValue() = value; return true; }
+    bool Int(int value) { CreateValue() = value; return true; }
+    bool Uint(unsigned value)
+    {
+        // Keep numbers that fit into int signed, same as rapidjson document does
+        if (value <= static_cast<unsigned>(M_MAX_INT))
+            CreateValue() = static_cast<int>(value);
         else
-            jsonValue = rapidjsonValue.GetDouble();
-        break;
-
-    case kStringType:
-        jsonValue = rapidjsonValue.GetString();
-        break;
-
-    case kArrayType:
-        {
-            jsonValue.Resize(rapidjsonValue.Size());
-            for (unsigned i = 0; i < rapidjsonValue.Size(); ++i)
-            {
-                ToJSONValue(jsonValue[i], rapidjsonValue[i]);
-            }
-        }
-        break;
+            CreateValue() = value;
+        return true;
+    }
+    bool Int64(int64_t value) { CreateValue() = static_cast<double>(value); return true; }
+    bool Uint64(uint64_t value) { CreateValue() = static_cast<double>(value); return true; }
+    bool Double(double value) { CreateValue() = value; return true; }
+    bool String(const char* value, rapidjson::SizeType length, bool)
+    {
+        tempString_.assign(value, length);
+        CreateValue() = tempString_;
+        return true;
+    }
+    bool Key(const char* value, rapidjson::SizeType length, bool)
+    {
+        key_.assign(value, length);
+        return true;
+    }
+    bool StartObject() { return StartBlock(JSON_OBJECT); }
+    bool EndObject(rapidjson::SizeType) { stack_.pop_back(); return true; }
+    bool StartArray() { return StartBlock(JSON_ARRAY); }
+    bool EndArray(rapidjson::SizeType) { stack_.pop_back(); return true; }
+
+private:
+    /// Create null value in current array or object.
+    JSONValue& CreateValue()
+    {
+        if (stack_.empty())
+            return root_;
 
-    case kObjectType:
+        // Array and object elements are stable until the nested value is finished
+        JSONValue& parent = *stack_.back();
+        if (parent.IsArray())
         {
-            jsonValue.SetType(JSON_OBJECT);
-            for (rapidjson::Value::ConstMemberIterator i = rapidjsonValue.MemberBegin(); i != rapidjsonValue.MemberEnd(); ++i)
-            {
-                JSONValue& value = jsonValue[ea::string(i->name.GetString())];
-                ToJSONValue(value, i->value);
-            }
+            parent.Push(JSONValue{});
+            return parent[parent.Size() - 1];
         }
-        break;
 
-    default:
-        break;
+        // Reset value in case of duplicate key
+        JSONValue& value = parent[key_];
+        value.SetType(JSON_NULL);
+        return value;
+    }
+    /// Create array or object and make it current.
+    bool StartBlock(JSONValueType type)
+    {
+        JSONValue& value = CreateValue();
+        value.SetType(type);
+        stack_.push_back(&value);
+        return true;
     }
+
+    /// Root value.
+    JSONValue& root_;
+    /// Stack of arrays and objects being filled.
+    ea::vector<JSONValue*> stack_;
+    /// Key of the next object element.
+    ea::string key_;
+    /// Temporary string.
+    ea::string tempString_;
+};
+
 }
 
 bool JSONFile::BeginLoad(Deserializer& source)
@@ -124,14 +150,18 @@ bool JSONFile::BeginLoad(Deserializer& source)
         return false;
     buffer[dataSize] = '\0';
 
-    rapidjson::Document document;
-    if (document.Parse<kParseCommentsFlag | kParseTrailingCommasFlag>(buffer.get()).HasParseError())
+    // Parse in place and build JSON values directly
+    JSONValue root;
+    JSONValueBuilder builder(root);
+    rapidjson::Reader reader;
+    InsituStringStream stream(buffer.get());
+    if (reader.Parse<kParseInsituFlag | kParseCommentsFlag | kParseTrailingCommasFlag>(stream, builder).IsError())
     {
         URHO3D_LOGERROR("Could not parse JSON data from " + source.GetName());
         return false;
     }
 
-    ToJSONValue(root_, document);
+    root_ = ea::move(root);
 
     SetMemoryUse(dataSize);
 
@@ -239,15 +269,18 @@ bool JSONFile::FromString(const ea::string & source)
 
 bool JSONFile::ParseJSON(const ea::string& json, JSONValue& value, bool reportError)
 {
-    rapidjson::Document document;
-    if (document.Parse<0>(json.c_str()).HasParseError())
+    JSONValue result;
+    JSONValueBuilder builder(result);
+    rapidjson::Reader reader;
+    StringStream stream(json.c_str());
+    if (reader.Parse<0>(stream, builder).IsError())
     {
         if (reportError)
-            URHO3D_LOGERRORF("Could not parse JSON data from string with error: %s", document.GetParseError());
+            URHO3D_LOGERRORF("Could not parse JSON data from string with error: %s", GetParseError_En(reader.GetParseErrorCode()));
 
         return false;
     }
-    ToJSONValue(value, document);
+    value = ea::move(result);
     return true;
 }
 
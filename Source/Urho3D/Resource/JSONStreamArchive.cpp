@@ -0,0 +1,582 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#include "../Precompiled.h"
+
+#include "../Core/StringUtils.h"
+#include "../IO/Deserializer.h"
+#include "../Resource/JSONStreamArchive.h"
+
+#include <EASTL/algorithm.h>
+
+#include <rapidjson/reader.h>
+
+#include <cstring>
+
+#include "../DebugNew.h"
+
+namespace Urho3D
+{
+
+namespace
+{
+
+/// Invalid text offset.
+const unsigned invalidOffset = M_MAX_UNSIGNED;
+
+/// Handler of rapidjson reader that stores single scalar value.
+struct JSONScalarHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, JSONScalarHandler>
+{
+    explicit JSONScalarHandler(JSONValue& value) : value_(value) {}
+
+    bool Default() { return false; }
+    bool Null() { value_.SetType(JSON_NULL); return true; }
+    bool Bool(bool value) { value_ = value; return true; }
+    bool Int(int value) { value_ = value; return true; }
+    bool Uint(unsigned value) { value_ = value; return true; }
+    bool Int64(int64_t value) { value_ = static_cast<double>(value); return true; }
+    bool Uint64(uint64_t value) { value_ = static_cast<double>(value); return true; }
+    bool Double(double value) { value_ = value; return true; }
+    bool String(const char* value, rapidjson::SizeType length, bool) { value_ = ea::string(value, length); return true; }
+
+    JSONValue& value_;
+};
+
+/// Return offset of the first character after whitespaces and comments.
+unsigned SkipSpace(const ea::string& text, unsigned offset)
+{
+    const char* data = text.c_str();
+    while (true)
+    {
+        const char ch = data[offset];
+        if (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r')
+            ++offset;
+        else if (ch == '/' && data[offset + 1] == '/')
+        {
+            offset += 2;
+            while (data[offset] && data[offset] != '\n')
+                ++offset;
+        }
+        else if (ch == '/' && data[offset + 1] == '*')
+        {
+            const char* commentEnd = strstr(data + offset + 2, "*/");
+            offset = commentEnd ? static_cast<unsigned>(commentEnd - data) + 2 : text.size();
+        }
+        else
+            return offset;
+    }
+}
+
+/// Return offset after string that starts at given offset.
+unsigned SkipString(const ea::string& text, unsigned offset)
+{
+    const char* data = text.c_str();
+    assert(data[offset] == '"');
+    ++offset;
+    while (true)
+    {
+        const char ch = data[offset];
+        if (!ch)
+            return invalidOffset;
+        else if (ch == '"')
+            return offset + 1;
+        else if (ch == '\\' && data[offset + 1])
+            offset += 2;
+        else
+            ++offset;
+    }
+}
+
+/// Return offset after string or scalar that starts at given offset.
+unsigned SkipScalar(const ea::string& text, unsigned offset)
+{
+    const char* data = text.c_str();
+    if (data[offset] == '"')
+        return SkipString(text, offset);
+
+    // Scan scalar till the delimiter, scalar is validated when parsed
+    const unsigned startOffset = offset;
+    while (data[offset] && !strchr(",:]}/ \t\r\n", data[offset]))
+        ++offset;
+    return offset != startOffset ? offset : invalidOffset;
+}
+
+}
+
+JSONStreamInputArchive::JSONStreamInputArchive(Context* context, ea::string text)
+    : Base(context, nullptr)
+    , text_(ea::move(text))
+{
+    cursor_ = SkipSpace(text_, 0);
+}
+
+JSONStreamInputArchive::JSONStreamInputArchive(Context* context, Deserializer& source)
+    : Base(context, nullptr)
+{
+    const unsigned size = source.GetSize() - source.GetPosition();
+    text_.resize(size);
+    text_.resize(source.Read(text_.data(), size));
+    cursor_ = SkipSpace(text_, 0);
+}
+
+bool JSONStreamInputArchive::BeginBlock(const char* name, unsigned& sizeHint, bool safe, ArchiveBlockType type)
+{
+    if (!CheckEOF(name, name))
+        return false;
+
+    if (!stack_.empty() && !FindElement(name, &type))
+        return false;
+
+    // Whole document is validated once, nested blocks only look up the index
+    if (stack_.empty() && containers_.empty() && !IndexContainers())
+    {
+        SetErrorFormatted(ArchiveBase::errorUnspecifiedFailure_elementName, name);
+        return false;
+    }
+
+    Block block{ name, type, 0, 0 };
+    if (!ScanBlock(block))
+        return false;
+
+    sizeHint = block.GetSizeHint();
+    stack_.push_back(ea::move(block));
+    return true;
+}
+
+bool JSONStreamInputArchive::EndBlock()
+{
+    if (stack_.empty())
+    {
+        SetErrorFormatted(ArchiveBase::fatalUnexpectedEndBlock);
+        return false;
+    }
+
+    // Skip elements that were not read
+    cursor_ = GetCurrentBlock().endOffset_;
+    stack_.pop_back();
+    if (stack_.empty())
+        CloseArchive();
+    else
+        FinishElement();
+    return true;
+}
+
+bool JSONStreamInputArchive::SerializeKey(ea::string& key)
+{
+    if (!CheckEOFAndRoot("", ArchiveBase::keyElementName_))
+        return false;
+
+    Block& block = GetCurrentBlock();
+    if (block.type_ != ArchiveBlockType::Map)
+    {
+        SetErrorFormatted(ArchiveBase::fatalUnexpectedKeySerialization);
+        assert(0);
+        return false;
+    }
+
+    if (block.keyRead_)
+    {
+        SetErrorFormatted(ArchiveBase::fatalDuplicateKeySerialization);
+        assert(0);
+        return false;
+    }
+
+    if (block.numElementsRead_ >= block.sizeHint_)
+    {
+        SetErrorFormatted(ArchiveBase::errorElementNotFound_elementName, ArchiveBase::keyElementName_);
+        return false;
+    }
+
+    // Key and separator are validated by IndexContainers
+    if (!ParseValue(ArchiveBase::keyElementName_, tempValue_))
+        return false;
+    cursor_ = SkipSpace(text_, SkipSpace(text_, cursor_) + 1);
+
+    key = tempValue_.GetString();
+    block.keyRead_ = true;
+    return true;
+}
+
+bool JSONStreamInputArchive::SerializeKey(unsigned& key)
+{
+    ea::string stringKey;
+    if (SerializeKey(stringKey))
+    {
+        key = ToUInt(stringKey);
+        return true;
+    }
+    return false;
+}
+
+bool JSONStreamInputArchive::Serialize(const char* name, long long& value)
+{
+    if (const JSONValue* jsonValue = ReadElement(name))
+    {
+        if (jsonValue->IsString())
+        {
+            sscanf(jsonValue->GetString().c_str(), "%lld", &value);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JSONStreamInputArchive::Serialize(const char* name, unsigned long long& value)
+{
+    if (const JSONValue* jsonValue = ReadElement(name))
+    {
+        if (jsonValue->IsString())
+        {
+            sscanf(jsonValue->GetString().c_str(), "%llu", &value);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JSONStreamInputArchive::SerializeBytes(const char* name, void* bytes, unsigned size)
+{
+    if (const JSONValue* jsonValue = ReadElement(name))
+    {
+        if (jsonValue->IsString())
+        {
+            if (!HexStringToBuffer(tempBuffer_, jsonValue->GetString()))
+                return false;
+            if (size != tempBuffer_.size())
+                return false;
+            ea::copy(tempBuffer_.begin(), tempBuffer_.end(), static_cast<unsigned char*>(bytes));
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JSONStreamInputArchive::SerializeVLE(const char* name, unsigned& value)
+{
+    if (const JSONValue* jsonValue = ReadElement(name))
+    {
+        if (jsonValue->IsNumber())
+        {
+            value = jsonValue->GetUInt();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JSONStreamInputArchive::CheckEOF(const char* elementName, const char* debugName)
+{
+    if (HasError())
+        return false;
+
+    if (!ValidateName(elementName))
+    {
+        SetErrorFormatted(ArchiveBase::fatalInvalidName, debugName);
+        return false;
+    }
+
+    if (IsEOF())
+    {
+        SetErrorFormatted(ArchiveBase::errorEOF_elementName, debugName);
+        return false;
+    }
+
+    return true;
+}
+
+bool JSONStreamInputArchive::CheckEOFAndRoot(const char* elementName, const char* debugName)
+{
+    if (!CheckEOF(elementName, debugName))
+        return false;
+
+    if (stack_.empty())
+    {
+        SetErrorFormatted(ArchiveBase::fatalRootBlockNotOpened_elementName, debugName);
+        assert(0);
+        return false;
+    }
+
+    return true;
+}
+
+bool JSONStreamInputArchive::FindElement(const char* elementName, const ArchiveBlockType* elementBlockType)
+{
+    Block& block = GetCurrentBlock();
+    if (block.type_ == ArchiveBlockType::Unordered)
+    {
+        if (!elementName)
+        {
+            SetErrorFormatted(ArchiveBase::fatalMissingElementName);
+            assert(0);
+            return false;
+        }
+
+        const ea::string_view name{ elementName };
+        const auto iter = ea::find_if(block.elements_.begin(), block.elements_.end(),
+            [&](const ea::pair<ea::string_view, unsigned>& element) { return element.first == name; });
+
+        // Not an error in Unordered block
+        if (iter == block.elements_.end())
+            return false;
+
+        cursor_ = iter->second;
+        return true;
+    }
+
+    if (block.type_ == ArchiveBlockType::Map && !block.keyRead_)
+    {
+        SetErrorFormatted(ArchiveBase::fatalMissingKeySerialization);
+        assert(0);
+        return false;
+    }
+
+    if (block.numElementsRead_ >= block.sizeHint_)
+    {
+        SetErrorFormatted(ArchiveBase::errorElementNotFound_elementName, elementName);
+        return false;
+    }
+
+    return true;
+}
+
+void JSONStreamInputArchive::FinishElement()
+{
+    Block& block = GetCurrentBlock();
+    if (block.type_ == ArchiveBlockType::Unordered)
+        return;
+
+    ++block.numElementsRead_;
+    block.keyRead_ = false;
+
+    // Separator is validated by IndexContainers
+    cursor_ = SkipSpace(text_, cursor_);
+    if (text_[cursor_] == ',')
+        cursor_ = SkipSpace(text_, cursor_ + 1);
+}
+
+bool JSONStreamInputArchive::IndexContainers()
+{
+    const char* data = text_.c_str();
+    const char rootCh = data[cursor_];
+    if (rootCh != '[' && rootCh != '{')
+        return true;
+
+    ea::vector<unsigned> openContainers;
+    unsigned offset = cursor_;
+    while (true)
+    {
+        // Read key of object element
+        if (!openContainers.empty() && data[containers_[openContainers.back()].offset_] == '{')
+        {
+            if (data[offset] != '"')
+                return false;
+
+            offset = SkipString(text_, offset);
+            if (offset == invalidOffset)
+                return false;
+
+            offset = SkipSpace(text_, offset);
+            if (data[offset] != ':')
+                return false;
+
+            offset = SkipSpace(text_, offset + 1);
+        }
+
+        // Read element value, nested array or object is read element by element
+        const char ch = data[offset];
+        if (ch == '[' || ch == '{')
+        {
+            openContainers.push_back(containers_.size());
+            containers_.push_back(Container{ offset, 0, 0 });
+
+            offset = SkipSpace(text_, offset + 1);
+            if (data[offset] != (ch == '[' ? ']' : '}'))
+                continue;
+
+            containers_.back().endOffset_ = ++offset;
+            openContainers.pop_back();
+        }
+        else
+        {
+            offset = SkipScalar(text_, offset);
+            if (offset == invalidOffset)
+                return false;
+        }
+
+        // Count element and close all containers that end after it
+        while (true)
+        {
+            if (openContainers.empty())
+                return true;
+
+            Container& container = containers_[openContainers.back()];
+            ++container.numElements_;
+
+            offset = SkipSpace(text_, offset);
+            if (data[offset] == ',')
+            {
+                offset = SkipSpace(text_, offset + 1);
+                break;
+            }
+
+            if (data[offset] != (data[container.offset_] == '[' ? ']' : '}'))
+                return false;
+
+            container.endOffset_ = ++offset;
+            openContainers.pop_back();
+        }
+    }
+}
+
+const JSONStreamInputArchive::Container* JSONStreamInputArchive::FindContainer(unsigned offset) const
+{
+    const auto iter = ea::lower_bound(containers_.begin(), containers_.end(), offset,
+        [](const Container& container, unsigned offset) { return container.offset_ < offset; });
+    return iter != containers_.end() && iter->offset_ == offset ? &*iter : nullptr;
+}
+
+unsigned JSONStreamInputArchive::SkipValue(unsigned offset) const
+{
+    const char ch = text_[offset];
+    if (ch == '[' || ch == '{')
+    {
+        const Container* container = FindContainer(offset);
+        return container ? container->endOffset_ : invalidOffset;
+    }
+    return SkipScalar(text_, offset);
+}
+
+bool JSONStreamInputArchive::ScanBlock(Block& block)
+{
+    const char* name = block.name_.data();
+    const char* data = text_.c_str();
+
+    // Null is treated as empty block of any type
+    if (strncmp(data + cursor_, "null", 4) == 0)
+    {
+        block.endOffset_ = cursor_ + 4;
+        return true;
+    }
+
+    const bool isObject = IsArchiveBlockJSONObject(block.type_);
+    if (data[cursor_] != (isObject ? '{' : '['))
+    {
+        SetErrorFormatted(ArchiveBase::errorUnexpectedBlockType_blockName, name);
+        return false;
+    }
+
+    const Container* container = FindContainer(cursor_);
+    if (!container)
+    {
+        SetErrorFormatted(ArchiveBase::errorUnspecifiedFailure_elementName, name);
+        return false;
+    }
+
+    block.sizeHint_ = container->numElements_;
+    block.endOffset_ = container->endOffset_;
+    cursor_ = SkipSpace(text_, cursor_ + 1);
+
+    // Index element names, structure is already validated and nested values are skipped via index
+    if (block.type_ == ArchiveBlockType::Unordered)
+    {
+        unsigned offset = cursor_;
+        block.elements_.reserve(block.sizeHint_);
+        for (unsigned i = 0; i < block.sizeHint_; ++i)
+        {
+            const unsigned keyEnd = SkipString(text_, offset);
+            const ea::string_view key{ data + offset + 1, keyEnd - offset - 2 };
+            offset = SkipSpace(text_, SkipSpace(text_, keyEnd) + 1);
+            block.elements_.emplace_back(key, offset);
+
+            offset = SkipSpace(text_, SkipValue(offset));
+            if (data[offset] == ',')
+                offset = SkipSpace(text_, offset + 1);
+        }
+    }
+    return true;
+}
+
+bool JSONStreamInputArchive::ParseValue(const char* name, JSONValue& value)
+{
+    // Nested arrays and objects are never parsed into values
+    const char ch = text_[cursor_];
+    if (ch == '[' || ch == '{')
+    {
+        cursor_ = SkipValue(cursor_);
+        value.SetType(JSON_NULL);
+        return cursor_ != invalidOffset;
+    }
+
+    rapidjson::StringStream stream{ text_.c_str() + cursor_ };
+    JSONScalarHandler handler{ value };
+    rapidjson::Reader reader;
+    if (reader.Parse<rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag>(stream, handler).IsError())
+    {
+        SetErrorFormatted(ArchiveBase::errorUnspecifiedFailure_elementName, name);
+        return false;
+    }
+
+    cursor_ += static_cast<unsigned>(stream.Tell());
+    return true;
+}
+
+const JSONValue* JSONStreamInputArchive::ReadElement(const char* name)
+{
+    if (!CheckEOFAndRoot(name, name))
+        return nullptr;
+
+    if (!FindElement(name, nullptr) || !ParseValue(name, tempValue_))
+        return nullptr;
+
+    FinishElement();
+    return &tempValue_;
+}
+
+// Generate serialization implementation (JSON stream input)
+#define URHO3D_JSON_STREAM_IN_IMPL(type, function, check) \
+    bool JSONStreamInputArchive::Serialize(const char* name, type& value) \
+    { \
+        if (const JSONValue* jsonValue = ReadElement(name)) \
+        { \
+            if (jsonValue->check()) \
+            { \
+                value = jsonValue->function(); \
+                return true; \
+            } \
+        } \
+        return false; \
+    }
+
+URHO3D_JSON_STREAM_IN_IMPL(bool, GetBool, IsBool);
+URHO3D_JSON_STREAM_IN_IMPL(signed char, GetInt, IsNumber);
+URHO3D_JSON_STREAM_IN_IMPL(short, GetInt, IsNumber);
+URHO3D_JSON_STREAM_IN_IMPL(int, GetInt, IsNumber);
+URHO3D_JSON_STREAM_IN_IMPL(unsigned char, GetUInt, IsNumber);
+URHO3D_JSON_STREAM_IN_IMPL(unsigned short, GetUInt, IsNumber);
+URHO3D_JSON_STREAM_IN_IMPL(unsigned int, GetUInt, IsNumber);
+URHO3D_JSON_STREAM_IN_IMPL(float, GetFloat, IsNumber);
+URHO3D_JSON_STREAM_IN_IMPL(double, GetDouble, IsNumber);
+URHO3D_JSON_STREAM_IN_IMPL(ea::string, GetString, IsString);
+
+#undef URHO3D_JSON_STREAM_IN_IMPL
+
+}
@@ -0,0 +1,171 @@
+//
+// Copyright (c) 2017-2021 the rbfx project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#pragma once
+
+#include "../Resource/JSONArchive.h"
+
+#include <EASTL/string_view.h>
+
+namespace Urho3D
+{
+
+class Deserializer;
+
+/// JSON stream input archive block. Internal.
+struct JSONStreamInputArchiveBlock
+{
+public:
+    /// Construct.
+    JSONStreamInputArchiveBlock(const char* name, ArchiveBlockType type, unsigned sizeHint, unsigned endOffset)
+        : name_(name ? name : "")
+        , type_(type)
+        , sizeHint_(sizeHint)
+        , endOffset_(endOffset)
+    {
+    }
+    /// Return name.
+    const ea::string_view GetName() const { return name_; }
+    /// Return block type.
+    ArchiveBlockType GetType() const { return type_; }
+    /// Return size hint.
+    unsigned GetSizeHint() const { return sizeHint_; }
+
+    /// Debug block name.
+    ea::string_view name_{};
+    /// Block type.
+    ArchiveBlockType type_{};
+    /// Number of elements in the block.
+    unsigned sizeHint_{};
+    /// Offset of the text after the block.
+    unsigned endOffset_{};
+    /// Number of elements read.
+    unsigned numElementsRead_{};
+    /// Whether the key was read (for Map blocks).
+    bool keyRead_{};
+    /// Element names and offsets of element values in the text (for Unordered blocks).
+    ea::vector<ea::pair<ea::string_view, unsigned>> elements_;
+};
+
+/// JSON input archive that parses text on demand instead of building JSONValue tree of the whole document.
+/// - Structure of the document is validated in single pass when root block is opened.
+///   End offsets and element counts of all arrays and objects are stored, so nested blocks are opened and skipped in O(1).
+/// - Sequential, Array and Map blocks are read in document order.
+/// - Unordered blocks are indexed by element names when opened, only offsets of element values are stored.
+/// - Only the text, the index of arrays and objects and the stack of open blocks is kept in memory.
+class URHO3D_API JSONStreamInputArchive : public JSONArchiveBase<JSONStreamInputArchiveBlock, true>
+{
+public:
+    /// Base type.
+    using Base = JSONArchiveBase<JSONStreamInputArchiveBlock, true>;
+
+    /// Construct from JSON text.
+    JSONStreamInputArchive(Context* context, ea::string text);
+    /// Construct from remaining data of the stream.
+    JSONStreamInputArchive(Context* context, Deserializer& source);
+
+    /// Begin archive block.
+    bool BeginBlock(const char* name, unsigned& sizeHint, bool safe, ArchiveBlockType type) final;
+    /// End archive block.
+    bool EndBlock() final;
+
+    /// Serialize string key. Used with Map block only.
+    bool SerializeKey(ea::string& key) final;
+    /// Serialize unsigned integer key. Used with Map block only.
+    bool SerializeKey(unsigned& key) final;
+
+    /// Serialize bool.
+    bool Serialize(const char* name, bool& value) final;
+    /// Serialize signed char.
+    bool Serialize(const char* name, signed char& value) final;
+    /// Serialize unsigned char.
+    bool Serialize(const char* name, unsigned char& value) final;
+    /// Serialize signed short.
+    bool Serialize(const char* name, short& value) final;
+    /// Serialize unsigned short.
+    bool Serialize(const char* name, unsigned short& value) final;
+    /// Serialize signed int.
+    bool Serialize(const char* name, int& value) final;
+    /// Serialize unsigned int.
+    bool Serialize(const char* name, unsigned int& value) final;
+    /// Serialize signed long.
+    bool Serialize(const char* name, long long& value) final;
+    /// Serialize unsigned long.
+    bool Serialize(const char* name, unsigned long long& value) final;
+    /// Serialize float.
+    bool Serialize(const char* name, float& value) final;
+    /// Serialize double.
+    bool Serialize(const char* name, double& value) final;
+    /// Serialize string.
+    bool Serialize(const char* name, ea::string& value) final;
+
+    /// Serialize bytes. Size is not encoded and should be provided externally!
+    bool SerializeBytes(const char* name, void* bytes, unsigned size) final;
+    /// Serialize Variable Length Encoded unsigned integer, up to 29 significant bits.
+    bool SerializeVLE(const char* name, unsigned& value) final;
+
+private:
+    /// Indexed array or object.
+    struct Container
+    {
+        /// Offset of the opening bracket.
+        unsigned offset_{};
+        /// Offset of the text after the closing bracket.
+        unsigned endOffset_{};
+        /// Number of elements.
+        unsigned numElements_{};
+    };
+
+    /// Check EOF.
+    bool CheckEOF(const char* elementName, const char* debugName);
+    /// Check EOF and root block.
+    bool CheckEOFAndRoot(const char* elementName, const char* debugName);
+    /// Move cursor to the value of the next element of current block. Return false if there's no such element.
+    bool FindElement(const char* elementName, const ArchiveBlockType* elementBlockType);
+    /// Move cursor after the element that was just read.
+    void FinishElement();
+    /// Validate structure of the document starting at cursor and index all arrays and objects. Return false on failure.
+    bool IndexContainers();
+    /// Return indexed array or object that starts at given offset.
+    const Container* FindContainer(unsigned offset) const;
+    /// Return offset after value that starts at given offset.
+    unsigned SkipValue(unsigned offset) const;
+    /// Open block value at cursor and move cursor to the first element. Return false on failure.
+    bool ScanBlock(Block& block);
+    /// Parse scalar value at cursor and move cursor after it.
+    bool ParseValue(const char* name, JSONValue& value);
+    /// Find and parse scalar element of current block.
+    const JSONValue* ReadElement(const char* name);
+
+    /// JSON text.
+    ea::string text_;
+    /// Offset of the next value in the text.
+    unsigned cursor_{};
+    /// Arrays and objects of the document in order of their offsets.
+    ea::vector<Container> containers_;
+    /// Temporary value.
+    JSONValue tempValue_;
+    /// Temporary buffer.
+    ea::vector<unsigned char> tempBuffer_;
+};
+
+}
@@ -168,32 +168,12 @@ JSONValue& JSONValue::operator=(JSONValue && rhs)
 {
     assert(this != &rhs);
 
-    SetType(rhs.GetValueType(), rhs.GetNumberType());
-
-    switch (GetValueType())
-    {
-    case JSON_BOOL:
-        boolValue_ = rhs.boolValue_;
-        break;
+    // Detach storage first, other value may be owned by this one
+    JSONValue value;
+    value.TakeStorage(rhs);
 
-    case JSON_NUMBER:
-        numberValue_ = rhs.numberValue_;
-        break;
-
-    case JSON_STRING:
-        *stringValue_ = std::move(*rhs.stringValue_);
-        break;
-
-    case JSON_ARRAY:
-        *arrayValue_ = std::move(*rhs.arrayValue_);
-        break;
-
-    case JSON_OBJECT:
-        *objectValue_ = std::move(*rhs.objectValue_);
-
-    default:
-        break;
-    }
+    SetType(JSON_NULL);
+    TakeStorage(value);
 
     return *this;
 }
@@ -392,6 +372,40 @@ void JSONValue::Clear()
         objectValue_->clear();
 }
 
+void JSONValue::TakeStorage(JSONValue& rhs)
+{
+    assert(GetValueType() == JSON_NULL);
+
+    type_ = rhs.type_;
+    switch (GetValueType())
+    {
+    case JSON_BOOL:
+        boolValue_ = rhs.boolValue_;
+        break;
+
+    case JSON_NUMBER:
+        numberValue_ = rhs.numberValue_;
+        break;
+
+    case JSON_STRING:
+        stringValue_ = rhs.stringValue_;
+        break;
+
+    case JSON_ARRAY:
+        arrayValue_ = rhs.arrayValue_;
+        break;
+
+    case JSON_OBJECT:
+        objectValue_ = rhs.objectValue_;
+        break;
+
+    default:
+        break;
+    }
+
+    rhs.type_ = 0;
+}
+
 void JSONValue::SetType(JSONValueType valueType, JSONNumberType numberType)
 {
     int type = valueType << 16u | numberType;
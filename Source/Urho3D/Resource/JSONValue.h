@@ -311,6 +311,9 @@ public:
     static JSONNumberType GetNumberTypeFromName(const char* typeName);
 
 protected:
+    /// Take ownership of the storage of another value without allocations. This value should be null. Other value is reset to null.
+    void TakeStorage(JSONValue& rhs);
+
     /// type.
     unsigned type_;
 
@@ -86,7 +86,8 @@ ResourceCache::ResourceCache(Context* context) :
     returnFailedResources_(false),
     searchPackagesFirst_(true),
     isRouting_(false),
-    finishBackgroundResourcesMs_(5)
+    finishBackgroundResourcesMs_(5),
+    memoryMapThreshold_(0)
 {
     // Register Resource library object factories
     RegisterResourceLibrary(context_);
@@ -565,7 +566,11 @@ SharedPtr<File> ResourceCache::GetFile(const ea::string& name, bool sendEventOnF
         }
 
         if (file)
+        {
+            if (memoryMapThreshold_ && file->GetSize() >= memoryMapThreshold_)
+                file->MemoryMap(FILE_ACCESS_SEQUENTIAL);
             return SharedPtr<File>(file);
+        }
     }
 
     if (sendEventOnFailure)
@@ -1126,10 +1131,12 @@ void ResourceCache::UpdateResourceGroup(StringHash type)
 
 void ResourceCache::HandleBeginFrame(StringHash eventType, VariantMap& eventData)
 {
+    ea::vector<FileChange> changes;
     for (unsigned i = 0; i < fileWatchers_.size(); ++i)
     {
-        FileChange change;
-        while (fileWatchers_[i]->GetNextChange(change))
+        changes.clear();
+        fileWatchers_[i]->GetNextChanges(changes);
+        for (const FileChange& change : changes)
         {
             auto it = ignoreResourceAutoReload_.find(change.fileName_);
             if (it != ignoreResourceAutoReload_.end())
@@ -1151,11 +1158,16 @@ void ResourceCache::HandleBeginFrame(StringHash eventType, VariantMap& eventData
     }
 
     // Check for background loaded resources that can be finished
+    FinishBackgroundResources(finishBackgroundResourcesMs_);
+}
+
+unsigned ResourceCache::FinishBackgroundResources(int maxMs)
+{
 #ifdef URHO3D_THREADING
-    {
-        URHO3D_PROFILE("FinishBackgroundResources");
-        backgroundLoader_->FinishResources(finishBackgroundResourcesMs_);
-    }
+    URHO3D_PROFILE("FinishBackgroundResources");
+    return backgroundLoader_->FinishResources(maxMs);
+#else
+    return 0;
 #endif
 }
 
@@ -142,6 +142,9 @@ public:
     /// Set how many milliseconds maximum per frame to spend on finishing background loaded resources.
     /// @property
     void SetFinishBackgroundResourcesMs(int ms) { finishBackgroundResourcesMs_ = Max(ms, 1); }
+    /// Set minimum size of file to be memory mapped when opened by GetFile(). Zero disables memory mapping (default).
+    /// Files must not be modified on disk while memory mapped.
+    void SetMemoryMapThreshold(unsigned size) { memoryMapThreshold_ = size; }
 
     /// Add a resource router object. By default there is none, so the routing process is skipped.
     void AddResourceRouter(ResourceRouter* router, bool addAsFirst = false);
@@ -156,6 +159,9 @@ public:
     SharedPtr<Resource> GetTempResource(StringHash type, const ea::string& name, bool sendEventOnFailure = true);
     /// Background load a resource. An event will be sent when complete. Return true if successfully stored to the load queue, false if eg. already exists. Can be called from outside the main thread.
     bool BackgroundLoadResource(StringHash type, const ea::string& name, bool sendEventOnFailure = true, Resource* caller = nullptr);
+    /// Finish background loaded resources that are ready, spending at most given time. Called automatically every frame.
+    /// Return number of finished resources.
+    unsigned FinishBackgroundResources(int maxMs);
     /// Return number of pending background-loaded resources.
     /// @property
     unsigned GetNumBackgroundLoadResources() const;
@@ -216,6 +222,8 @@ public:
     /// Return how many milliseconds maximum to spend on finishing background loaded resources.
     /// @property
     int GetFinishBackgroundResourcesMs() const { return finishBackgroundResourcesMs_; }
+    /// Return minimum size of file to be memory mapped when opened by GetFile().
+    unsigned GetMemoryMapThreshold() const { return memoryMapThreshold_; }
 
     /// Return a resource router by index.
     ResourceRouter* GetResourceRouter(unsigned index) const;
@@ -296,6 +304,8 @@ private:
     mutable bool isRouting_;
     /// How many milliseconds maximum per frame to spend on finishing background loaded resources.
     int finishBackgroundResourcesMs_;
+    /// Minimum size of file to be memory mapped.
+    unsigned memoryMapThreshold_;
     /// List of resources that will not be auto-reloaded if reloading event triggers.
     ea::vector<ea::string> ignoreResourceAutoReload_;
 };
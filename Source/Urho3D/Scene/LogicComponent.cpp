@@ -29,6 +29,9 @@
 #include "../Scene/LogicComponent.h"
 #include "../Scene/Scene.h"
 #include "../Scene/SceneEvents.h"
+#if URHO3D_CSHARP
+#include "../Script/Script.h"
+#endif
 
 namespace Urho3D
 {
@@ -73,6 +76,20 @@ void LogicComponent::SetUpdateEventMask(UpdateEventFlags mask)
     }
 }
 
+#if URHO3D_CSHARP
+void LogicComponent::SetBatchedUpdateType(void* type)
+{
+    if (batchedUpdateType_ != type)
+    {
+        // Entries in batches of previous type are removed by Script subsystem
+        ClearEventSubscription();
+        batchedUpdateType_ = type;
+        batchedEventMask_ = USE_NO_EVENT;
+        UpdateEventSubscription();
+    }
+}
+#endif
+
 void LogicComponent::OnNodeSet(Node* node)
 {
     if (node)
@@ -92,15 +109,7 @@ void LogicComponent::OnSceneSet(Scene* scene)
     if (scene)
         UpdateEventSubscription();
     else
-    {
-        UnsubscribeFromEvent(E_SCENEUPDATE);
-        UnsubscribeFromEvent(E_SCENEPOSTUPDATE);
-#if defined(URHO3D_PHYSICS) || defined(URHO3D_URHO2D)
-        UnsubscribeFromEvent(E_PHYSICSPRESTEP);
-        UnsubscribeFromEvent(E_PHYSICSPOSTSTEP);
-#endif
-        currentEventMask_ = USE_NO_EVENT;
-    }
+        ClearEventSubscription();
 }
 
 void LogicComponent::UpdateEventSubscription()
@@ -111,6 +120,24 @@ void LogicComponent::UpdateEventSubscription()
 
     bool enabled = IsEnabledEffective();
 
+#if URHO3D_CSHARP
+    if (batchedUpdateType_)
+    {
+        // Script subsystem skips and removes components from phases they no longer need
+        UpdateEventFlags mask = USE_NO_EVENT;
+        if (enabled)
+        {
+            mask = updateEventMask_;
+            if (!delayedStartCalled_)
+                mask |= USE_UPDATE;
+        }
+        currentEventMask_ = mask;
+        if (auto* script = GetSubsystem<Script>())
+            script->AddBatchedComponent(this);
+        return;
+    }
+#endif
+
     bool needUpdate = enabled && ((updateEventMask_ & USE_UPDATE) || !delayedStartCalled_);
     if (needUpdate && !(currentEventMask_ & USE_UPDATE))
     {
@@ -166,6 +193,17 @@ void LogicComponent::UpdateEventSubscription()
 #endif
 }
 
+void LogicComponent::ClearEventSubscription()
+{
+    UnsubscribeFromEvent(E_SCENEUPDATE);
+    UnsubscribeFromEvent(E_SCENEPOSTUPDATE);
+#if defined(URHO3D_PHYSICS) || defined(URHO3D_URHO2D)
+    UnsubscribeFromEvent(E_PHYSICSPRESTEP);
+    UnsubscribeFromEvent(E_PHYSICSPOSTSTEP);
+#endif
+    currentEventMask_ = USE_NO_EVENT;
+}
+
 void LogicComponent::HandleSceneUpdate(StringHash eventType, VariantMap& eventData)
 {
     using namespace SceneUpdate;
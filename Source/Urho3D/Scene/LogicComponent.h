@@ -85,6 +85,13 @@ class URHO3D_API LogicComponent : public Component
     /// Return whether the DelayedStart() function has been called.
     bool IsDelayedStartCalled() const { return delayedStartCalled_; }
 
+#if URHO3D_CSHARP
+    /// Set managed type of the component. Components with managed type are updated by Script subsystem in batches per type instead of receiving update events individually. Null disables batching.
+    void SetBatchedUpdateType(void* type);
+    /// Return managed type used for batched updates.
+    void* GetBatchedUpdateType() const { return batchedUpdateType_; }
+#endif
+
 protected:
     /// Handle scene node being assigned at creation.
     void OnNodeSet(Node* node) override;
@@ -94,6 +101,8 @@ protected:
 private:
     /// Subscribe/unsubscribe to update events based on current enabled state and update event mask.
     void UpdateEventSubscription();
+    /// Unsubscribe from all update events.
+    void ClearEventSubscription();
     /// Handle scene update event.
     void HandleSceneUpdate(StringHash eventType, VariantMap& eventData);
     /// Handle scene post-update event.
@@ -110,6 +119,14 @@ private:
     UpdateEventFlags currentEventMask_;
     /// Flag for delayed start.
     bool delayedStartCalled_;
+#if URHO3D_CSHARP
+    friend class Script;
+
+    /// Managed type for batched updates.
+    void* batchedUpdateType_{};
+    /// Update phases of Script subsystem batches the component is added to. Components are removed from batches lazily.
+    UpdateEventFlags batchedEventMask_{};
+#endif
 };
 
 }
@@ -61,6 +61,8 @@ class URHO3D_API SceneManager : public Object
     void SetActiveScene(const ea::string& name);
     /// Get current active scene. Returns null pointer if no scene is active.
     Scene* GetActiveScene() const { return activeScene_; }
+    /// Return all loaded scenes.
+    const ea::vector<SharedPtr<Scene>>& GetScenes() const { return scenes_; }
     /// Set surface to which active scene should render. If surface is null then scene will render to main window.
     void SetRenderSurface(RenderSurface* surface);
 
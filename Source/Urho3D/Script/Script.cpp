@@ -24,23 +24,185 @@
 #include "../Core/Profiler.h"
 #include "../Core/Thread.h"
 #include "../IO/Log.h"
+#if defined(URHO3D_PHYSICS) || defined(URHO3D_URHO2D)
+#include "../Physics/PhysicsEvents.h"
+#endif
+#include "../Scene/Scene.h"
+#include "../Scene/SceneEvents.h"
 #include "../Script/Script.h"
 
 
 namespace Urho3D
 {
 
+namespace
+{
+
+/// Return index of update phase.
+unsigned GetUpdatePhaseIndex(UpdateEvent phase)
+{
+    switch (phase)
+    {
+    case USE_UPDATE: return 0;
+    case USE_POSTUPDATE: return 1;
+    case USE_FIXEDUPDATE: return 2;
+    case USE_FIXEDPOSTUPDATE: return 3;
+    default: assert(0); return 0;
+    }
+}
+
+/// Perform update phase of single component. Used when managed entry point is not set.
+void UpdateComponent(LogicComponent* component, UpdateEvent phase, float timeStep)
+{
+    switch (phase)
+    {
+    case USE_UPDATE: component->Update(timeStep); break;
+    case USE_POSTUPDATE: component->PostUpdate(timeStep); break;
+    case USE_FIXEDUPDATE: component->FixedUpdate(timeStep); break;
+    case USE_FIXEDPOSTUPDATE: component->FixedPostUpdate(timeStep); break;
+    default: break;
+    }
+}
+
+}
+
 ScriptRuntimeApi* Script::api_{nullptr};
+ScriptUpdateBatchCallback Script::updateBatchCallback_{nullptr};
 
 Script::Script(Context* context)
     : Object(context)
 {
+    SubscribeToEvent(E_SCENEUPDATE, URHO3D_HANDLER(Script, HandleSceneUpdate));
+    SubscribeToEvent(E_SCENEPOSTUPDATE, URHO3D_HANDLER(Script, HandleScenePostUpdate));
+#if defined(URHO3D_PHYSICS) || defined(URHO3D_URHO2D)
+    SubscribeToEvent(E_PHYSICSPRESTEP, URHO3D_HANDLER(Script, HandlePhysicsPreStep));
+    SubscribeToEvent(E_PHYSICSPOSTSTEP, URHO3D_HANDLER(Script, HandlePhysicsPostStep));
+#endif
 }
 
 Script::~Script()
 {
 }
 
+void Script::AddBatchedComponent(LogicComponent* component)
+{
+    void* type = component->batchedUpdateType_;
+    auto iter = batchIndices_.find(type);
+    if (iter == batchIndices_.end())
+    {
+        iter = batchIndices_.emplace(type, batches_.size()).first;
+        batches_.emplace_back().type_ = type;
+    }
+
+    UpdateBatch& batch = batches_[iter->second];
+    for (UpdateEvent phase : { USE_UPDATE, USE_POSTUPDATE, USE_FIXEDUPDATE, USE_FIXEDPOSTUPDATE })
+    {
+        if ((component->currentEventMask_ & phase) && !(component->batchedEventMask_ & phase))
+        {
+            batch.components_[GetUpdatePhaseIndex(phase)].emplace_back(component);
+            component->batchedEventMask_ |= phase;
+        }
+    }
+}
+
+void Script::HandleSceneUpdate(StringHash eventType, VariantMap& eventData)
+{
+    using namespace SceneUpdate;
+    UpdateBatches(USE_UPDATE, static_cast<Scene*>(eventData[P_SCENE].GetPtr()), eventData[P_TIMESTEP].GetFloat());
+}
+
+void Script::HandleScenePostUpdate(StringHash eventType, VariantMap& eventData)
+{
+    using namespace ScenePostUpdate;
+    UpdateBatches(USE_POSTUPDATE, static_cast<Scene*>(eventData[P_SCENE].GetPtr()), eventData[P_TIMESTEP].GetFloat());
+}
+
+#if defined(URHO3D_PHYSICS) || defined(URHO3D_URHO2D)
+void Script::HandlePhysicsPreStep(StringHash eventType, VariantMap& eventData)
+{
+    using namespace PhysicsPreStep;
+    auto* world = static_cast<Component*>(eventData[P_WORLD].GetPtr());
+    UpdateBatches(USE_FIXEDUPDATE, world ? world->GetScene() : nullptr, eventData[P_TIMESTEP].GetFloat());
+}
+
+void Script::HandlePhysicsPostStep(StringHash eventType, VariantMap& eventData)
+{
+    using namespace PhysicsPostStep;
+    auto* world = static_cast<Component*>(eventData[P_WORLD].GetPtr());
+    UpdateBatches(USE_FIXEDPOSTUPDATE, world ? world->GetScene() : nullptr, eventData[P_TIMESTEP].GetFloat());
+}
+#endif
+
+void Script::UpdateBatches(UpdateEvent phase, Scene* scene, float timeStep)
+{
+    if (!scene)
+        return;
+
+    URHO3D_PROFILE("UpdateScriptBatches");
+
+    const unsigned phaseIndex = GetUpdatePhaseIndex(phase);
+    // Batches may be added while components are updated, so index is used for iteration
+    for (unsigned batchIndex = 0; batchIndex < batches_.size(); ++batchIndex)
+    {
+        // Remove components that are destroyed, disabled or switched to another type
+        batchComponents_.clear();
+        UpdateBatch& batch = batches_[batchIndex];
+        ea::vector<WeakPtr<LogicComponent>>& components = batch.components_[phaseIndex];
+        for (unsigned i = 0; i < components.size();)
+        {
+            LogicComponent* component = components[i];
+            const bool isStale = !component || component->batchedUpdateType_ != batch.type_;
+            if (isStale || !(component->currentEventMask_ & phase))
+            {
+                if (!isStale)
+                    component->batchedEventMask_ &= ~phase;
+                components[i] = ea::move(components.back());
+                components.pop_back();
+                continue;
+            }
+
+            if (component->GetScene() == scene)
+                batchComponents_.emplace_back(component);
+            ++i;
+        }
+
+        if (batchComponents_.empty())
+            continue;
+
+        // Execute delayed start before the first update, same as for individually updated components
+        if (phase == USE_UPDATE || phase == USE_FIXEDUPDATE)
+        {
+            for (LogicComponent* component : batchComponents_)
+            {
+                if (!component->delayedStartCalled_)
+                {
+                    component->DelayedStart();
+                    component->delayedStartCalled_ = true;
+                    // Drop update phase if it was needed only for delayed start
+                    component->UpdateEventSubscription();
+                }
+            }
+        }
+
+        batchHandles_.clear();
+        for (LogicComponent* component : batchComponents_)
+        {
+            if (!(component->currentEventMask_ & phase))
+                continue;
+
+            if (updateBatchCallback_ && component->HasScriptObject())
+                batchHandles_.push_back(component->GetScriptObject());
+            else
+                UpdateComponent(component, phase, timeStep);
+        }
+
+        // Components are kept alive by batchComponents_, so their gc handles are strong and valid during the call
+        if (!batchHandles_.empty())
+            updateBatchCallback_(phase, timeStep, batchHandles_.data(), batchHandles_.size());
+    }
+    batchComponents_.clear();
+}
+
 void ScriptRuntimeApi::DereferenceAndDispose(RefCounted* instance)
 {
     if (instance == nullptr || !instance->HasScriptObject())
@@ -31,6 +31,7 @@
 #include "../Core/Mutex.h"
 #include "../Core/Object.h"
 #include "../Engine/PluginApplication.h"
+#include "../Scene/LogicComponent.h"
 
 #ifndef SWIGSTDCALL
 #   if _WIN32
@@ -43,6 +44,11 @@
 namespace Urho3D
 {
 
+class Scene;
+
+/// Managed entry point that performs one update phase of script components of the same type. Receives gc handles of components.
+typedef void(SWIGSTDCALL* ScriptUpdateBatchCallback)(unsigned phase, float timeStep, void* const* components, unsigned count);
+
 /// Script API implemented in target scripting language.
 class URHO3D_API ScriptRuntimeApi
 {
@@ -85,10 +91,49 @@ public:
     static ScriptRuntimeApi* GetRuntimeApi() { return api_; }
     /// Should be called from managed code and provide implementation of ScriptRuntimeApi.
     static void SetRuntimeApi(ScriptRuntimeApi* impl) { api_ = impl; }
+    /// Set managed entry point that updates batches of script components.
+    static void SetUpdateBatchCallback(ScriptUpdateBatchCallback callback) { updateBatchCallback_ = callback; }
+
+    /// Add component with batched updates to batches of its type for update phases it currently needs.
+    void AddBatchedComponent(LogicComponent* component);
 
 protected:
     /// API implemented in scripting environment.
     static ScriptRuntimeApi* api_;
+    /// Managed entry point of batched updates.
+    static ScriptUpdateBatchCallback updateBatchCallback_;
+
+private:
+    /// Components of the same managed type, per update phase.
+    struct UpdateBatch
+    {
+        /// Managed type.
+        void* type_{};
+        /// Components per update phase.
+        ea::vector<WeakPtr<LogicComponent>> components_[4];
+    };
+
+    /// Handle scene update event.
+    void HandleSceneUpdate(StringHash eventType, VariantMap& eventData);
+    /// Handle scene post-update event.
+    void HandleScenePostUpdate(StringHash eventType, VariantMap& eventData);
+#if defined(URHO3D_PHYSICS) || defined(URHO3D_URHO2D)
+    /// Handle physics pre-step event.
+    void HandlePhysicsPreStep(StringHash eventType, VariantMap& eventData);
+    /// Handle physics post-step event.
+    void HandlePhysicsPostStep(StringHash eventType, VariantMap& eventData);
+#endif
+    /// Perform update phase of components in the scene, one call per managed type.
+    void UpdateBatches(UpdateEvent phase, Scene* scene, float timeStep);
+
+    /// Batches of components with batched updates.
+    ea::vector<UpdateBatch> batches_;
+    /// Batch indices per managed type.
+    ea::unordered_map<void*, unsigned> batchIndices_;
+    /// Components updated in current batch.
+    ea::vector<SharedPtr<LogicComponent>> batchComponents_;
+    /// Gc handles of components updated in current batch.
+    ea::vector<void*> batchHandles_;
 };
 
 /// Object that manages lifetime of gc handle.
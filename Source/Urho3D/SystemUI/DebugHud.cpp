@@ -138,6 +138,7 @@ void DebugHud::RenderUI(DebugHudModeFlags mode)
 
     Renderer* renderer = GetSubsystem<Renderer>();
     Graphics* graphics = GetSubsystem<Graphics>();
+    Engine* engine = GetSubsystem<Engine>();
     if (mode & DEBUGHUD_SHOW_STATS)
     {
         // Update stats regardless of them being shown.
@@ -168,6 +169,9 @@ void DebugHud::RenderUI(DebugHudModeFlags mode)
         ui::SetCursorPosX(left_offset);
         ui::Text("Batches %u", batches);
         ui::SetCursorPosX(left_offset);
+        ui::Text("Constant Buffers %u KB (%u blocks reused)", graphics->GetNumConstantBufferBytes() / 1024,
+            graphics->GetNumDeduplicatedConstantBufferBlocks());
+        ui::SetCursorPosX(left_offset);
         ui::Text("Views %u", renderer->GetNumViews());
         ui::SetCursorPosX(left_offset);
         ui::Text("Lights %u", renderer->GetNumLights(true));
@@ -176,6 +180,11 @@ void DebugHud::RenderUI(DebugHudModeFlags mode)
         ui::SetCursorPosX(left_offset);
         ui::Text("Occluders %u", renderer->GetNumOccluders(true));
         ui::SetCursorPosX(left_offset);
+        if (engine->GetMaxFps() > 0)
+        {
+            ui::Text("Frame Jitter %lld us (max %lld us)", engine->GetFramePacingJitter(), engine->GetMaxFramePacingJitter());
+            ui::SetCursorPosX(left_offset);
+        }
 
         for (auto i = appStats_.begin(); i != appStats_.end(); ++i)
         {
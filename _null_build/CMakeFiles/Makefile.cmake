@@ -0,0 +1,224 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Source/CMakeLists.txt"
+  "/root/repo/Source/Extras/CMakeLists.txt"
+  "/root/repo/Source/Player/CMakeLists.txt"
+  "/root/repo/Source/Samples/CMakeLists.txt"
+  "/root/repo/Source/Tests/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/Box2D/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/Bullet/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/CLI11/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/Civetweb/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/Detour/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/DetourCrowd/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/DetourTileCache/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/EASTL/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/EASTL/scripts/CMake/CommonCppFlags.cmake"
+  "/root/repo/Source/ThirdParty/ETCPACK/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/FreeType/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/IconFontCppHeaders/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/LZ4/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/PugiXml/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/Recast/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/SDL/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/SDL/cmake/macros.cmake"
+  "/root/repo/Source/ThirdParty/SDL/cmake/sdlchecks.cmake"
+  "/root/repo/Source/ThirdParty/SDL/include/SDL/SDL_config.h.cmake"
+  "/root/repo/Source/ThirdParty/SLikeNet/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/STB/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/StanHull/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/WebP/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/capstone/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/catch2/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/catch2/Catch.cmake"
+  "/root/repo/Source/ThirdParty/fmt/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/ik/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/ik/include/ik/config.h.in"
+  "/root/repo/Source/ThirdParty/ik/include/ik/export.h.in"
+  "/root/repo/Source/ThirdParty/rapidjson/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/spdlog/CMakeLists.txt"
+  "/root/repo/Source/ThirdParty/tracy/CMakeLists.txt"
+  "/root/repo/Source/Tools/CMakeLists.txt"
+  "/root/repo/Source/Urho3D/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/Modules/CCache.cmake"
+  "/root/repo/cmake/Modules/FindDRM.cmake"
+  "/root/repo/cmake/Modules/FindEsound.cmake"
+  "/root/repo/cmake/Modules/FindFusionSound.cmake"
+  "/root/repo/cmake/Modules/FindGBM.cmake"
+  "/root/repo/cmake/Modules/FindJack.cmake"
+  "/root/repo/cmake/Modules/FindNAS.cmake"
+  "/root/repo/cmake/Modules/FindOSS.cmake"
+  "/root/repo/cmake/Modules/FindPulseAudio.cmake"
+  "/root/repo/cmake/Modules/FindSNDIO.cmake"
+  "/root/repo/cmake/Modules/FindSecretRabbitCode.cmake"
+  "/root/repo/cmake/Modules/FindWayland.cmake"
+  "/root/repo/cmake/Modules/FindaRts.cmake"
+  "/root/repo/cmake/Modules/UrhoCommon.cmake"
+  "/root/repo/cmake/Modules/UrhoOptions.cmake"
+  "/root/repo/cmake/Modules/VSSolution.cmake"
+  "/root/repo/cmake/Modules/ucm.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/TBB/TBBTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckStructHasMember.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindALSA.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/EASTL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/LZ4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/PugiXml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/rapidjson/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/STB/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/IconFontCppHeaders/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/CLI11/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/fmt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/spdlog/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/SDL/include/SDL/generated/SDL_config.h"
+  "Source/ThirdParty/SDL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/ETCPACK/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/catch2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/FreeType/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/Civetweb/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/SLikeNet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/ik/include/generated/ik/export.h"
+  "Source/ThirdParty/ik/include/generated/ik/config.h"
+  "Source/ThirdParty/ik/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/Detour/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/DetourCrowd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/DetourTileCache/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/Recast/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/Box2D/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/WebP/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/Bullet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/StanHull/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/capstone/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/ThirdParty/tracy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Urho3D/Debug/Urho3D.h"
+  "Source/Urho3D/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Extras/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Samples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Source/Player/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "DartConfiguration.tcl"
+  "Source/Tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/DependInfo.cmake"
+  "Source/ThirdParty/LZ4/CMakeFiles/LZ4.dir/DependInfo.cmake"
+  "Source/ThirdParty/PugiXml/CMakeFiles/PugiXml.dir/DependInfo.cmake"
+  "Source/ThirdParty/STB/CMakeFiles/STB.dir/DependInfo.cmake"
+  "Source/ThirdParty/fmt/CMakeFiles/fmt.dir/DependInfo.cmake"
+  "Source/ThirdParty/SDL/CMakeFiles/SDL.dir/DependInfo.cmake"
+  "Source/ThirdParty/ETCPACK/CMakeFiles/ETCPACK.dir/DependInfo.cmake"
+  "Source/ThirdParty/catch2/CMakeFiles/catch2.dir/DependInfo.cmake"
+  "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/DependInfo.cmake"
+  "Source/ThirdParty/Civetweb/CMakeFiles/Civetweb.dir/DependInfo.cmake"
+  "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/DependInfo.cmake"
+  "Source/ThirdParty/ik/CMakeFiles/ik.dir/DependInfo.cmake"
+  "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/DependInfo.cmake"
+  "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/DependInfo.cmake"
+  "Source/ThirdParty/DetourTileCache/CMakeFiles/DetourTileCache.dir/DependInfo.cmake"
+  "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/DependInfo.cmake"
+  "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/DependInfo.cmake"
+  "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/DependInfo.cmake"
+  "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/DependInfo.cmake"
+  "Source/ThirdParty/StanHull/CMakeFiles/StanHull.dir/DependInfo.cmake"
+  "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/DependInfo.cmake"
+  "Source/ThirdParty/tracy/CMakeFiles/Tracy.dir/DependInfo.cmake"
+  "Source/Urho3D/CMakeFiles/Urho3D.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "Source/Tests/CMakeFiles/Tests.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,229 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "EASTL" for configuration "Debug"
+set_property(TARGET EASTL APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(EASTL PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libEASTL.a"
+  )
+
+list(APPEND _cmake_import_check_targets EASTL )
+list(APPEND _cmake_import_check_files_for_EASTL "${_IMPORT_PREFIX}/lib/libEASTL.a" )
+
+# Import target "LZ4" for configuration "Debug"
+set_property(TARGET LZ4 APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(LZ4 PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libLZ4.a"
+  )
+
+list(APPEND _cmake_import_check_targets LZ4 )
+list(APPEND _cmake_import_check_files_for_LZ4 "${_IMPORT_PREFIX}/lib/libLZ4.a" )
+
+# Import target "PugiXml" for configuration "Debug"
+set_property(TARGET PugiXml APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(PugiXml PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libPugiXml.a"
+  )
+
+list(APPEND _cmake_import_check_targets PugiXml )
+list(APPEND _cmake_import_check_files_for_PugiXml "${_IMPORT_PREFIX}/lib/libPugiXml.a" )
+
+# Import target "STB" for configuration "Debug"
+set_property(TARGET STB APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(STB PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libSTB.a"
+  )
+
+list(APPEND _cmake_import_check_targets STB )
+list(APPEND _cmake_import_check_files_for_STB "${_IMPORT_PREFIX}/lib/libSTB.a" )
+
+# Import target "fmt" for configuration "Debug"
+set_property(TARGET fmt APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(fmt PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libfmt.a"
+  )
+
+list(APPEND _cmake_import_check_targets fmt )
+list(APPEND _cmake_import_check_files_for_fmt "${_IMPORT_PREFIX}/lib/libfmt.a" )
+
+# Import target "SDL" for configuration "Debug"
+set_property(TARGET SDL APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(SDL PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libSDL.a"
+  )
+
+list(APPEND _cmake_import_check_targets SDL )
+list(APPEND _cmake_import_check_files_for_SDL "${_IMPORT_PREFIX}/lib/libSDL.a" )
+
+# Import target "ETCPACK" for configuration "Debug"
+set_property(TARGET ETCPACK APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ETCPACK PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libETCPACK.a"
+  )
+
+list(APPEND _cmake_import_check_targets ETCPACK )
+list(APPEND _cmake_import_check_files_for_ETCPACK "${_IMPORT_PREFIX}/lib/libETCPACK.a" )
+
+# Import target "catch2" for configuration "Debug"
+set_property(TARGET catch2 APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(catch2 PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libcatch2.a"
+  )
+
+list(APPEND _cmake_import_check_targets catch2 )
+list(APPEND _cmake_import_check_files_for_catch2 "${_IMPORT_PREFIX}/lib/libcatch2.a" )
+
+# Import target "FreeType" for configuration "Debug"
+set_property(TARGET FreeType APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(FreeType PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libFreeType.a"
+  )
+
+list(APPEND _cmake_import_check_targets FreeType )
+list(APPEND _cmake_import_check_files_for_FreeType "${_IMPORT_PREFIX}/lib/libFreeType.a" )
+
+# Import target "Civetweb" for configuration "Debug"
+set_property(TARGET Civetweb APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(Civetweb PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libCivetweb.a"
+  )
+
+list(APPEND _cmake_import_check_targets Civetweb )
+list(APPEND _cmake_import_check_files_for_Civetweb "${_IMPORT_PREFIX}/lib/libCivetweb.a" )
+
+# Import target "SLikeNet" for configuration "Debug"
+set_property(TARGET SLikeNet APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(SLikeNet PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libSLikeNet.a"
+  )
+
+list(APPEND _cmake_import_check_targets SLikeNet )
+list(APPEND _cmake_import_check_files_for_SLikeNet "${_IMPORT_PREFIX}/lib/libSLikeNet.a" )
+
+# Import target "ik" for configuration "Debug"
+set_property(TARGET ik APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(ik PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libik.a"
+  )
+
+list(APPEND _cmake_import_check_targets ik )
+list(APPEND _cmake_import_check_files_for_ik "${_IMPORT_PREFIX}/lib/libik.a" )
+
+# Import target "Detour" for configuration "Debug"
+set_property(TARGET Detour APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(Detour PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libDetour.a"
+  )
+
+list(APPEND _cmake_import_check_targets Detour )
+list(APPEND _cmake_import_check_files_for_Detour "${_IMPORT_PREFIX}/lib/libDetour.a" )
+
+# Import target "DetourCrowd" for configuration "Debug"
+set_property(TARGET DetourCrowd APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(DetourCrowd PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libDetourCrowd.a"
+  )
+
+list(APPEND _cmake_import_check_targets DetourCrowd )
+list(APPEND _cmake_import_check_files_for_DetourCrowd "${_IMPORT_PREFIX}/lib/libDetourCrowd.a" )
+
+# Import target "DetourTileCache" for configuration "Debug"
+set_property(TARGET DetourTileCache APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(DetourTileCache PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libDetourTileCache.a"
+  )
+
+list(APPEND _cmake_import_check_targets DetourTileCache )
+list(APPEND _cmake_import_check_files_for_DetourTileCache "${_IMPORT_PREFIX}/lib/libDetourTileCache.a" )
+
+# Import target "Recast" for configuration "Debug"
+set_property(TARGET Recast APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(Recast PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libRecast.a"
+  )
+
+list(APPEND _cmake_import_check_targets Recast )
+list(APPEND _cmake_import_check_files_for_Recast "${_IMPORT_PREFIX}/lib/libRecast.a" )
+
+# Import target "Box2D" for configuration "Debug"
+set_property(TARGET Box2D APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(Box2D PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libBox2D.a"
+  )
+
+list(APPEND _cmake_import_check_targets Box2D )
+list(APPEND _cmake_import_check_files_for_Box2D "${_IMPORT_PREFIX}/lib/libBox2D.a" )
+
+# Import target "WebP" for configuration "Debug"
+set_property(TARGET WebP APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(WebP PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libWebP.a"
+  )
+
+list(APPEND _cmake_import_check_targets WebP )
+list(APPEND _cmake_import_check_files_for_WebP "${_IMPORT_PREFIX}/lib/libWebP.a" )
+
+# Import target "Bullet" for configuration "Debug"
+set_property(TARGET Bullet APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(Bullet PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libBullet.a"
+  )
+
+list(APPEND _cmake_import_check_targets Bullet )
+list(APPEND _cmake_import_check_files_for_Bullet "${_IMPORT_PREFIX}/lib/libBullet.a" )
+
+# Import target "StanHull" for configuration "Debug"
+set_property(TARGET StanHull APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(StanHull PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libStanHull.a"
+  )
+
+list(APPEND _cmake_import_check_targets StanHull )
+list(APPEND _cmake_import_check_files_for_StanHull "${_IMPORT_PREFIX}/lib/libStanHull.a" )
+
+# Import target "Tracy" for configuration "Debug"
+set_property(TARGET Tracy APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(Tracy PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "CXX"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libTracy.a"
+  )
+
+list(APPEND _cmake_import_check_targets Tracy )
+list(APPEND _cmake_import_check_files_for_Tracy "${_IMPORT_PREFIX}/lib/libTracy.a" )
+
+# Import target "Urho3D" for configuration "Debug"
+set_property(TARGET Urho3D APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(Urho3D PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/bin/libUrho3D.so"
+  IMPORTED_SONAME_DEBUG "libUrho3D.so"
+  )
+
+list(APPEND _cmake_import_check_targets Urho3D )
+list(APPEND _cmake_import_check_files_for_Urho3D "${_IMPORT_PREFIX}/bin/libUrho3D.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,245 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS EASTL LZ4 PugiXml rapidjson STB IconFontCppHeaders CLI11 fmt spdlog SDL ETCPACK catch2 FreeType Civetweb SLikeNet ik Detour DetourCrowd DetourTileCache Recast Box2D WebP Bullet StanHull Tracy Urho3D)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Compute the installation prefix relative to this file.
+get_filename_component(_IMPORT_PREFIX "${CMAKE_CURRENT_LIST_FILE}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+if(_IMPORT_PREFIX STREQUAL "/")
+  set(_IMPORT_PREFIX "")
+endif()
+
+# Create imported target EASTL
+add_library(EASTL STATIC IMPORTED)
+
+set_target_properties(EASTL PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "EASTL_OPENSOURCE=1;EASTL_RTTI_ENABLED=0;EASTL_URHO3D_EXTENSIONS=1;EASTL_SIZE_T_32BIT=1;EASTDC_GLOBALPTR_SUPPORT_ENABLED=0;EASTDC_THREADING_SUPPORTED=0;EASTL_STD_ITERATOR_CATEGORY_ENABLED=1;EA_DLL"
+  INTERFACE_COMPILE_OPTIONS "\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-literal-suffix>"
+)
+
+# Create imported target LZ4
+add_library(LZ4 STATIC IMPORTED)
+
+set_target_properties(LZ4 PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "LZ4_DLL_IMPORT=1"
+)
+
+# Create imported target PugiXml
+add_library(PugiXml STATIC IMPORTED)
+
+set_target_properties(PugiXml PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "PUGIXML_IMPORTS"
+)
+
+# Create imported target rapidjson
+add_library(rapidjson INTERFACE IMPORTED)
+
+# Create imported target STB
+add_library(STB STATIC IMPORTED)
+
+set_target_properties(STB PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "STB_VORBIS_HEADER_ONLY=1"
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/Urho3D/ThirdParty/STB"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/Urho3D/ThirdParty/STB"
+)
+
+# Create imported target IconFontCppHeaders
+add_library(IconFontCppHeaders INTERFACE IMPORTED)
+
+# Create imported target CLI11
+add_library(CLI11 INTERFACE IMPORTED)
+
+# Create imported target fmt
+add_library(fmt STATIC IMPORTED)
+
+set_target_properties(fmt PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "FMT_USE_RVALUE_REFERENCES=1;FMT_USE_VARIADIC_TEMPLATES=1;FMT_SHARED"
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/Urho3D/ThirdParty"
+  INTERFACE_LINK_LIBRARIES "EASTL"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/Urho3D/ThirdParty"
+)
+
+# Create imported target spdlog
+add_library(spdlog INTERFACE IMPORTED)
+
+set_target_properties(spdlog PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "SPDLOG_FMT_EXTERNAL=1;SPDLOG_DISABLE_DEFAULT_LOGGER=1"
+  INTERFACE_LINK_LIBRARIES "fmt"
+)
+
+# Create imported target SDL
+add_library(SDL STATIC IMPORTED)
+
+# Create imported target ETCPACK
+add_library(ETCPACK STATIC IMPORTED)
+
+# Create imported target catch2
+add_library(catch2 STATIC IMPORTED)
+
+# Create imported target FreeType
+add_library(FreeType STATIC IMPORTED)
+
+# Create imported target Civetweb
+add_library(Civetweb STATIC IMPORTED)
+
+set_target_properties(Civetweb PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "CIVETWEB_DLL_IMPORTS"
+)
+
+# Create imported target SLikeNet
+add_library(SLikeNet STATIC IMPORTED)
+
+# Create imported target ik
+add_library(ik STATIC IMPORTED)
+
+set_target_properties(ik PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "IK_STATIC"
+)
+
+# Create imported target Detour
+add_library(Detour STATIC IMPORTED)
+
+# Create imported target DetourCrowd
+add_library(DetourCrowd STATIC IMPORTED)
+
+set_target_properties(DetourCrowd PROPERTIES
+  INTERFACE_LINK_LIBRARIES "Detour"
+)
+
+# Create imported target DetourTileCache
+add_library(DetourTileCache STATIC IMPORTED)
+
+set_target_properties(DetourTileCache PROPERTIES
+  INTERFACE_LINK_LIBRARIES "Detour"
+)
+
+# Create imported target Recast
+add_library(Recast STATIC IMPORTED)
+
+# Create imported target Box2D
+add_library(Box2D STATIC IMPORTED)
+
+set_target_properties(Box2D PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BOX2D_IMPORTS"
+)
+
+# Create imported target WebP
+add_library(WebP STATIC IMPORTED)
+
+# Create imported target Bullet
+add_library(Bullet STATIC IMPORTED)
+
+set_target_properties(Bullet PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "BT_USE_SSE=1"
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/Urho3D/ThirdParty/Bullet"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/Urho3D/ThirdParty/Bullet"
+)
+
+# Create imported target StanHull
+add_library(StanHull STATIC IMPORTED)
+
+# Create imported target Tracy
+add_library(Tracy STATIC IMPORTED)
+
+set_target_properties(Tracy PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "TRACY_ENABLE=1;TRACY_ON_DEMAND=1;TRACY_FILESELECTOR=1;TRACY_EXTENDED_FONT=1;TRACY_NO_SYSTEM_TRACING=1;TRACY_IMPORTS=1"
+  INTERFACE_LINK_LIBRARIES "Urho3D"
+)
+
+# Create imported target Urho3D
+add_library(Urho3D SHARED IMPORTED)
+
+set_target_properties(Urho3D PROPERTIES
+  INTERFACE_COMPILE_DEFINITIONS "URHO3D_64BIT;URHO3D_CSHARP_AVAILABLE;URHO3D_ENABLE_ALL;URHO3D_EXTRAS_AVAILABLE;URHO3D_FILEWATCHER;URHO3D_FILEWATCHER_AVAILABLE;URHO3D_GLOW_AVAILABLE;URHO3D_HASH_DEBUG;URHO3D_IK;URHO3D_LOGGING;URHO3D_NAVIGATION;URHO3D_NETWORK;URHO3D_NETWORK_AVAILABLE;URHO3D_NULL_GRAPHICS;URHO3D_PCH_AVAILABLE;URHO3D_PHYSICS;URHO3D_PLAYER_AVAILABLE;URHO3D_PLUGINS;URHO3D_PLUGINS_AVAILABLE;URHO3D_PROFILING;URHO3D_PROFILING_AVAILABLE;URHO3D_PROFILING_SYSTRACE_AVAILABLE;URHO3D_SPHERICAL_HARMONICS;URHO3D_TESTING;URHO3D_TESTING_AVAILABLE;URHO3D_THREADING;URHO3D_THREADING_AVAILABLE;URHO3D_TOOLS_AVAILABLE;URHO3D_URHO2D;URHO3D_WEBP;NOMINMAX;URHO3D_DEBUG=\$<OR:\$<CONFIG:Debug>,\$<CONFIG:RelWithDebInfo>>;LINUX=1;DESKTOP=1;LZ4_DLL_IMPORT=1;PUGIXML_IMPORTS;STB_VORBIS_HEADER_ONLY=1;CIVETWEB_DLL_IMPORTS;IK_STATIC;BOX2D_IMPORTS;FMT_USE_RVALUE_REFERENCES=1;FMT_USE_VARIADIC_TEMPLATES=1;FMT_SHARED;SPDLOG_FMT_EXTERNAL=1;SPDLOG_DISABLE_DEFAULT_LOGGER=1;EASTL_OPENSOURCE=1;EASTL_RTTI_ENABLED=0;EASTL_URHO3D_EXTENSIONS=1;EASTL_SIZE_T_32BIT=1;EASTDC_GLOBALPTR_SUPPORT_ENABLED=0;EASTDC_THREADING_SUPPORTED=0;EASTL_STD_ITERATOR_CATEGORY_ENABLED=1;EA_DLL;URHO3D_SSE"
+  INTERFACE_COMPILE_OPTIONS "\$<\$<COMPILE_LANGUAGE:CXX>:-Wno-literal-suffix>;-msse2"
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include;${_IMPORT_PREFIX}/include/Urho3D/ThirdParty;${_IMPORT_PREFIX}/include/Urho3D/ThirdParty/STB;${_IMPORT_PREFIX}/include/Urho3D/ThirdParty"
+  INTERFACE_LINK_LIBRARIES "Bullet;dl;m;pthread;rt;uuid;Tracy"
+)
+
+if(CMAKE_VERSION VERSION_LESS 3.0.0)
+  message(FATAL_ERROR "This file relies on consumers using CMake 3.0.0 or greater.")
+endif()
+
+# Load information for each installed configuration.
+file(GLOB _cmake_config_files "${CMAKE_CURRENT_LIST_DIR}/Urho3D-*.cmake")
+foreach(_cmake_config_file IN LISTS _cmake_config_files)
+  include("${_cmake_config_file}")
+endforeach()
+unset(_cmake_config_file)
+unset(_cmake_config_files)
+
+# Cleanup temporary variables.
+set(_IMPORT_PREFIX)
+
+# Loop over all imported files and verify that they actually exist
+foreach(_cmake_target IN LISTS _cmake_import_check_targets)
+  foreach(_cmake_file IN LISTS "_cmake_import_check_files_for_${_cmake_target}")
+    if(NOT EXISTS "${_cmake_file}")
+      message(FATAL_ERROR "The imported target \"${_cmake_target}\" references the file
+   \"${_cmake_file}\"
+but this file does not exist.  Possible reasons include:
+* The file was deleted, renamed, or moved to another location.
+* An install or uninstall procedure did not complete successfully.
+* The installation package was faulty and contained
+   \"${CMAKE_CURRENT_LIST_FILE}\"
+but not all the files it references.
+")
+    endif()
+  endforeach()
+  unset(_cmake_file)
+  unset("_cmake_import_check_files_for_${_cmake_target}")
+endforeach()
+unset(_cmake_target)
+unset(_cmake_import_check_targets)
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
@@ -0,0 +1,46 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/Tests/CommonUtils.cpp" "Source/Tests/CMakeFiles/Tests.dir/CommonUtils.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/CommonUtils.cpp.o.d"
+  "/root/repo/Source/Tests/Engine/Engine.cpp" "Source/Tests/CMakeFiles/Tests.dir/Engine/Engine.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Engine/Engine.cpp.o.d"
+  "/root/repo/Source/Tests/Engine/FixedTickScheduler.cpp" "Source/Tests/CMakeFiles/Tests.dir/Engine/FixedTickScheduler.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Engine/FixedTickScheduler.cpp.o.d"
+  "/root/repo/Source/Tests/Engine/PluginStateMigration.cpp" "Source/Tests/CMakeFiles/Tests.dir/Engine/PluginStateMigration.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Engine/PluginStateMigration.cpp.o.d"
+  "/root/repo/Source/Tests/Graphics/DepthRasterizer.cpp" "Source/Tests/CMakeFiles/Tests.dir/Graphics/DepthRasterizer.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Graphics/DepthRasterizer.cpp.o.d"
+  "/root/repo/Source/Tests/Graphics/DrawCommandQueue.cpp" "Source/Tests/CMakeFiles/Tests.dir/Graphics/DrawCommandQueue.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Graphics/DrawCommandQueue.cpp.o.d"
+  "/root/repo/Source/Tests/Graphics/HierarchicalLOD.cpp" "Source/Tests/CMakeFiles/Tests.dir/Graphics/HierarchicalLOD.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Graphics/HierarchicalLOD.cpp.o.d"
+  "/root/repo/Source/Tests/Graphics/Impostor.cpp" "Source/Tests/CMakeFiles/Tests.dir/Graphics/Impostor.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Graphics/Impostor.cpp.o.d"
+  "/root/repo/Source/Tests/Graphics/ModelView.cpp" "Source/Tests/CMakeFiles/Tests.dir/Graphics/ModelView.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Graphics/ModelView.cpp.o.d"
+  "/root/repo/Source/Tests/Graphics/Octree.cpp" "Source/Tests/CMakeFiles/Tests.dir/Graphics/Octree.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Graphics/Octree.cpp.o.d"
+  "/root/repo/Source/Tests/Graphics/ShaderParameterCollection.cpp" "Source/Tests/CMakeFiles/Tests.dir/Graphics/ShaderParameterCollection.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Graphics/ShaderParameterCollection.cpp.o.d"
+  "/root/repo/Source/Tests/IO/ArchiveSerialization.cpp" "Source/Tests/CMakeFiles/Tests.dir/IO/ArchiveSerialization.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/IO/ArchiveSerialization.cpp.o.d"
+  "/root/repo/Source/Tests/IO/AsyncFileIO.cpp" "Source/Tests/CMakeFiles/Tests.dir/IO/AsyncFileIO.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/IO/AsyncFileIO.cpp.o.d"
+  "/root/repo/Source/Tests/IO/Deserializer.cpp" "Source/Tests/CMakeFiles/Tests.dir/IO/Deserializer.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/IO/Deserializer.cpp.o.d"
+  "/root/repo/Source/Tests/IO/File.cpp" "Source/Tests/CMakeFiles/Tests.dir/IO/File.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/IO/File.cpp.o.d"
+  "/root/repo/Source/Tests/IO/FileWatcher.cpp" "Source/Tests/CMakeFiles/Tests.dir/IO/FileWatcher.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/IO/FileWatcher.cpp.o.d"
+  "/root/repo/Source/Tests/IO/PackageFile.cpp" "Source/Tests/CMakeFiles/Tests.dir/IO/PackageFile.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/IO/PackageFile.cpp.o.d"
+  "/root/repo/Source/Tests/Main.cpp" "Source/Tests/CMakeFiles/Tests.dir/Main.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Main.cpp.o.d"
+  "/root/repo/Source/Tests/Network/PackageTransfer.cpp" "Source/Tests/CMakeFiles/Tests.dir/Network/PackageTransfer.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Network/PackageTransfer.cpp.o.d"
+  "/root/repo/Source/Tests/RenderPipeline/LightClusterProcessor.cpp" "Source/Tests/CMakeFiles/Tests.dir/RenderPipeline/LightClusterProcessor.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/RenderPipeline/LightClusterProcessor.cpp.o.d"
+  "/root/repo/Source/Tests/RenderPipeline/ShadowReceiverVolume.cpp" "Source/Tests/CMakeFiles/Tests.dir/RenderPipeline/ShadowReceiverVolume.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/RenderPipeline/ShadowReceiverVolume.cpp.o.d"
+  "/root/repo/Source/Tests/RenderPipeline/ShadowSplitProcessor.cpp" "Source/Tests/CMakeFiles/Tests.dir/RenderPipeline/ShadowSplitProcessor.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/RenderPipeline/ShadowSplitProcessor.cpp.o.d"
+  "/root/repo/Source/Tests/Resource/JSONFile.cpp" "Source/Tests/CMakeFiles/Tests.dir/Resource/JSONFile.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/Resource/JSONFile.cpp.o.d"
+  "/root/repo/Source/Tests/TestSample.cpp" "Source/Tests/CMakeFiles/Tests.dir/TestSample.cpp.o" "gcc" "Source/Tests/CMakeFiles/Tests.dir/TestSample.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/Source/ThirdParty/catch2/CMakeFiles/catch2.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/tracy/CMakeFiles/Tracy.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/Urho3D/CMakeFiles/Urho3D.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
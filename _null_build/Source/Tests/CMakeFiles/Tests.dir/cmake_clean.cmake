@@ -0,0 +1,58 @@
+file(REMOVE_RECURSE
+  "../../bin/Tests"
+  "../../bin/Tests.pdb"
+  "CMakeFiles/Tests.dir/CommonUtils.cpp.o"
+  "CMakeFiles/Tests.dir/CommonUtils.cpp.o.d"
+  "CMakeFiles/Tests.dir/Engine/Engine.cpp.o"
+  "CMakeFiles/Tests.dir/Engine/Engine.cpp.o.d"
+  "CMakeFiles/Tests.dir/Engine/FixedTickScheduler.cpp.o"
+  "CMakeFiles/Tests.dir/Engine/FixedTickScheduler.cpp.o.d"
+  "CMakeFiles/Tests.dir/Engine/PluginStateMigration.cpp.o"
+  "CMakeFiles/Tests.dir/Engine/PluginStateMigration.cpp.o.d"
+  "CMakeFiles/Tests.dir/Graphics/DepthRasterizer.cpp.o"
+  "CMakeFiles/Tests.dir/Graphics/DepthRasterizer.cpp.o.d"
+  "CMakeFiles/Tests.dir/Graphics/DrawCommandQueue.cpp.o"
+  "CMakeFiles/Tests.dir/Graphics/DrawCommandQueue.cpp.o.d"
+  "CMakeFiles/Tests.dir/Graphics/HierarchicalLOD.cpp.o"
+  "CMakeFiles/Tests.dir/Graphics/HierarchicalLOD.cpp.o.d"
+  "CMakeFiles/Tests.dir/Graphics/Impostor.cpp.o"
+  "CMakeFiles/Tests.dir/Graphics/Impostor.cpp.o.d"
+  "CMakeFiles/Tests.dir/Graphics/ModelView.cpp.o"
+  "CMakeFiles/Tests.dir/Graphics/ModelView.cpp.o.d"
+  "CMakeFiles/Tests.dir/Graphics/Octree.cpp.o"
+  "CMakeFiles/Tests.dir/Graphics/Octree.cpp.o.d"
+  "CMakeFiles/Tests.dir/Graphics/ShaderParameterCollection.cpp.o"
+  "CMakeFiles/Tests.dir/Graphics/ShaderParameterCollection.cpp.o.d"
+  "CMakeFiles/Tests.dir/IO/ArchiveSerialization.cpp.o"
+  "CMakeFiles/Tests.dir/IO/ArchiveSerialization.cpp.o.d"
+  "CMakeFiles/Tests.dir/IO/AsyncFileIO.cpp.o"
+  "CMakeFiles/Tests.dir/IO/AsyncFileIO.cpp.o.d"
+  "CMakeFiles/Tests.dir/IO/Deserializer.cpp.o"
+  "CMakeFiles/Tests.dir/IO/Deserializer.cpp.o.d"
+  "CMakeFiles/Tests.dir/IO/File.cpp.o"
+  "CMakeFiles/Tests.dir/IO/File.cpp.o.d"
+  "CMakeFiles/Tests.dir/IO/FileWatcher.cpp.o"
+  "CMakeFiles/Tests.dir/IO/FileWatcher.cpp.o.d"
+  "CMakeFiles/Tests.dir/IO/PackageFile.cpp.o"
+  "CMakeFiles/Tests.dir/IO/PackageFile.cpp.o.d"
+  "CMakeFiles/Tests.dir/Main.cpp.o"
+  "CMakeFiles/Tests.dir/Main.cpp.o.d"
+  "CMakeFiles/Tests.dir/Network/PackageTransfer.cpp.o"
+  "CMakeFiles/Tests.dir/Network/PackageTransfer.cpp.o.d"
+  "CMakeFiles/Tests.dir/RenderPipeline/LightClusterProcessor.cpp.o"
+  "CMakeFiles/Tests.dir/RenderPipeline/LightClusterProcessor.cpp.o.d"
+  "CMakeFiles/Tests.dir/RenderPipeline/ShadowReceiverVolume.cpp.o"
+  "CMakeFiles/Tests.dir/RenderPipeline/ShadowReceiverVolume.cpp.o.d"
+  "CMakeFiles/Tests.dir/RenderPipeline/ShadowSplitProcessor.cpp.o"
+  "CMakeFiles/Tests.dir/RenderPipeline/ShadowSplitProcessor.cpp.o.d"
+  "CMakeFiles/Tests.dir/Resource/JSONFile.cpp.o"
+  "CMakeFiles/Tests.dir/Resource/JSONFile.cpp.o.d"
+  "CMakeFiles/Tests.dir/TestSample.cpp.o"
+  "CMakeFiles/Tests.dir/TestSample.cpp.o.d"
+  "Tests_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Source/Tests
+# Build directory: /root/repo/_null_build/Source/Tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_null_build/Source/Tests/Tests_include-b12d07c.cmake")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_null_build/Source/Tests/Tests_tests-b12d07c.cmake")
+  include("/root/repo/_null_build/Source/Tests/Tests_tests-b12d07c.cmake")
+else()
+  add_test(Tests_NOT_BUILT-b12d07c Tests_NOT_BUILT-b12d07c)
+endif()
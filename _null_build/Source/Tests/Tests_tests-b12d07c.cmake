@@ -0,0 +1,93 @@
+add_test( [==[All available test cases:]==] /root/repo/_null_build/bin/Tests [==[All available test cases:]==])
+set_tests_properties( [==[All available test cases:]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Engine started multiple times in same process]==] /root/repo/_null_build/bin/Tests [==[  Engine started multiple times in same process]==])
+set_tests_properties( [==[  Engine started multiple times in same process]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Pipelined work queued at extraction boundary is completed in the same frame]==] /root/repo/_null_build/bin/Tests [==[  Pipelined work queued at extraction boundary is completed in the same frame]==])
+set_tests_properties( [==[  Pipelined work queued at extraction boundary is completed in the same frame]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Pipelined work is completed in the next frame before the next extraction]==] /root/repo/_null_build/bin/Tests [==[  Pipelined work is completed in the next frame before the next extraction]==])
+set_tests_properties( [==[  Pipelined work is completed in the next frame before the next extraction]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Frame limiter executes queued work while waiting for frame deadline]==] /root/repo/_null_build/bin/Tests [==[  Frame limiter executes queued work while waiting for frame deadline]==])
+set_tests_properties( [==[  Frame limiter executes queued work while waiting for frame deadline]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Main thread executes only queued work items within priority limit]==] /root/repo/_null_build/bin/Tests [==[  Main thread executes only queued work items within priority limit]==])
+set_tests_properties( [==[  Main thread executes only queued work items within priority limit]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Fixed tick scheduler runs frames with constant timestep on tick grid]==] /root/repo/_null_build/bin/Tests [==[  Fixed tick scheduler runs frames with constant timestep on tick grid]==])
+set_tests_properties( [==[  Fixed tick scheduler runs frames with constant timestep on tick grid]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Fixed tick scheduler configures physics world to single step per tick]==] /root/repo/_null_build/bin/Tests [==[  Fixed tick scheduler configures physics world to single step per tick]==])
+set_tests_properties( [==[  Fixed tick scheduler configures physics world to single step per tick]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  PluginStateMigration restores plugin components in place]==] /root/repo/_null_build/bin/Tests [==[  PluginStateMigration restores plugin components in place]==])
+set_tests_properties( [==[  PluginStateMigration restores plugin components in place]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  DepthRasterizer writes depth of front-facing triangles]==] /root/repo/_null_build/bin/Tests [==[  DepthRasterizer writes depth of front-facing triangles]==])
+set_tests_properties( [==[  DepthRasterizer writes depth of front-facing triangles]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  DepthRasterizer clips triangles against near plane and scissor]==] /root/repo/_null_build/bin/Tests [==[  DepthRasterizer clips triangles against near plane and scissor]==])
+set_tests_properties( [==[  DepthRasterizer clips triangles against near plane and scissor]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  DrawCommandQueue deduplicates identical constant buffer blocks]==] /root/repo/_null_build/bin/Tests [==[  DrawCommandQueue deduplicates identical constant buffer blocks]==])
+set_tests_properties( [==[  DrawCommandQueue deduplicates identical constant buffer blocks]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Hierarchical LOD replaces distant static models with proxy]==] /root/repo/_null_build/bin/Tests [==[  Hierarchical LOD replaces distant static models with proxy]==])
+set_tests_properties( [==[  Hierarchical LOD replaces distant static models with proxy]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Hierarchical LOD simplification merges vertices in cell]==] /root/repo/_null_build/bin/Tests [==[  Hierarchical LOD simplification merges vertices in cell]==])
+set_tests_properties( [==[  Hierarchical LOD simplification merges vertices in cell]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Octahedral mapping of impostor frames is invertible]==] /root/repo/_null_build/bin/Tests [==[  Octahedral mapping of impostor frames is invertible]==])
+set_tests_properties( [==[  Octahedral mapping of impostor frames is invertible]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Impostor baker renders model views into atlas frames]==] /root/repo/_null_build/bin/Tests [==[  Impostor baker renders model views into atlas frames]==])
+set_tests_properties( [==[  Impostor baker renders model views into atlas frames]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Impostor batches stay valid for view updated before another view]==] /root/repo/_null_build/bin/Tests [==[  Impostor batches stay valid for view updated before another view]==])
+set_tests_properties( [==[  Impostor batches stay valid for view updated before another view]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Simple model constructed and desconstructed]==] /root/repo/_null_build/bin/Tests [==[  Simple model constructed and desconstructed]==])
+set_tests_properties( [==[  Simple model constructed and desconstructed]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Batched octree queries return same drawables as individual queries]==] /root/repo/_null_build/bin/Tests [==[  Batched octree queries return same drawables as individual queries]==])
+set_tests_properties( [==[  Batched octree queries return same drawables as individual queries]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Zone lookup grid returns zones of highest priority]==] /root/repo/_null_build/bin/Tests [==[  Zone lookup grid returns zones of highest priority]==])
+set_tests_properties( [==[  Zone lookup grid returns zones of highest priority]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  ShaderParameterCollection is appended in order]==] /root/repo/_null_build/bin/Tests [==[  ShaderParameterCollection is appended in order]==])
+set_tests_properties( [==[  ShaderParameterCollection is appended in order]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Test structure is serialized to archive]==] /root/repo/_null_build/bin/Tests [==[  Test structure is serialized to archive]==])
+set_tests_properties( [==[  Test structure is serialized to archive]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Test structure is serialized as part of the file]==] /root/repo/_null_build/bin/Tests [==[  Test structure is serialized as part of the file]==])
+set_tests_properties( [==[  Test structure is serialized as part of the file]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  JSON stream archive reads nested blocks and skips unread elements]==] /root/repo/_null_build/bin/Tests [==[  JSON stream archive reads nested blocks and skips unread elements]==])
+set_tests_properties( [==[  JSON stream archive reads nested blocks and skips unread elements]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  AsyncFileIO reads file ranges]==] /root/repo/_null_build/bin/Tests [==[  AsyncFileIO reads file ranges]==])
+set_tests_properties( [==[  AsyncFileIO reads file ranges]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Resources are loaded in background from asynchronously read files]==] /root/repo/_null_build/bin/Tests [==[  Resources are loaded in background from asynchronously read files]==])
+set_tests_properties( [==[  Resources are loaded in background from asynchronously read files]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Deserializer reads contiguous and non-contiguous streams identically]==] /root/repo/_null_build/bin/Tests [==[  Deserializer reads contiguous and non-contiguous streams identically]==])
+set_tests_properties( [==[  Deserializer reads contiguous and non-contiguous streams identically]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Copied VectorBuffer reads its own data]==] /root/repo/_null_build/bin/Tests [==[  Copied VectorBuffer reads its own data]==])
+set_tests_properties( [==[  Copied VectorBuffer reads its own data]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  VectorBuffer reads resized data after direct buffer access]==] /root/repo/_null_build/bin/Tests [==[  VectorBuffer reads resized data after direct buffer access]==])
+set_tests_properties( [==[  VectorBuffer reads resized data after direct buffer access]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Filesystem and package files are memory mapped]==] /root/repo/_null_build/bin/Tests [==[  Filesystem and package files are memory mapped]==])
+set_tests_properties( [==[  Filesystem and package files are memory mapped]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  FileWatcher coalesces changes of the same file]==] /root/repo/_null_build/bin/Tests [==[  FileWatcher coalesces changes of the same file]==])
+set_tests_properties( [==[  FileWatcher coalesces changes of the same file]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  FileWatcher watches subdirectories registered in background and created later]==] /root/repo/_null_build/bin/Tests [==[  FileWatcher watches subdirectories registered in background and created later]==])
+set_tests_properties( [==[  FileWatcher watches subdirectories registered in background and created later]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Compressed package file supports seeking across blocks]==] /root/repo/_null_build/bin/Tests [==[  Compressed package file supports seeking across blocks]==])
+set_tests_properties( [==[  Compressed package file supports seeking across blocks]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Package upload budget is refilled every network update without accumulation]==] /root/repo/_null_build/bin/Tests [==[  Package upload budget is refilled every network update without accumulation]==])
+set_tests_properties( [==[  Package upload budget is refilled every network update without accumulation]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Package upload chunks and fragments are aligned to delta blocks]==] /root/repo/_null_build/bin/Tests [==[  Package upload chunks and fragments are aligned to delta blocks]==])
+set_tests_properties( [==[  Package upload chunks and fragments are aligned to delta blocks]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Package download is resumed, renamed and verified]==] /root/repo/_null_build/bin/Tests [==[  Package download is resumed\, renamed and verified]==])
+set_tests_properties( [==[  Package download is resumed, renamed and verified]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Point lights are assigned to all clusters they touch]==] /root/repo/_null_build/bin/Tests [==[  Point lights are assigned to all clusters they touch]==])
+set_tests_properties( [==[  Point lights are assigned to all clusters they touch]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Spot lights are assigned only to clusters inside light cone]==] /root/repo/_null_build/bin/Tests [==[  Spot lights are assigned only to clusters inside light cone]==])
+set_tests_properties( [==[  Spot lights are assigned only to clusters inside light cone]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Cluster light lists are compact and respect capacity]==] /root/repo/_null_build/bin/Tests [==[  Cluster light lists are compact and respect capacity]==])
+set_tests_properties( [==[  Cluster light lists are compact and respect capacity]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Shadow casters are culled by receiver volume]==] /root/repo/_null_build/bin/Tests [==[  Shadow casters are culled by receiver volume]==])
+set_tests_properties( [==[  Shadow casters are culled by receiver volume]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Receiver volume keeps max depth of receivers per cell]==] /root/repo/_null_build/bin/Tests [==[  Receiver volume keeps max depth of receivers per cell]==])
+set_tests_properties( [==[  Receiver volume keeps max depth of receivers per cell]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Cached shadow map is rebuilt when shadow casters change without moving]==] /root/repo/_null_build/bin/Tests [==[  Cached shadow map is rebuilt when shadow casters change without moving]==])
+set_tests_properties( [==[  Cached shadow map is rebuilt when shadow casters change without moving]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Cached shadow map is reused until shadow casters change]==] /root/repo/_null_build/bin/Tests [==[  Cached shadow map is reused until shadow casters change]==])
+set_tests_properties( [==[  Cached shadow map is reused until shadow casters change]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  JSONFile parses all value types]==] /root/repo/_null_build/bin/Tests [==[  JSONFile parses all value types]==])
+set_tests_properties( [==[  JSONFile parses all value types]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[  Factorials are computed]==] /root/repo/_null_build/bin/Tests [==[  Factorials are computed]==])
+set_tests_properties( [==[  Factorials are computed]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+add_test( [==[44 test cases]==] /root/repo/_null_build/bin/Tests [==[44 test cases]==])
+set_tests_properties( [==[44 test cases]==] PROPERTIES WORKING_DIRECTORY /root/repo/_null_build/Source/Tests)
+set( Tests_TESTS [==[All available test cases:]==] [==[  Engine started multiple times in same process]==] [==[  Pipelined work queued at extraction boundary is completed in the same frame]==] [==[  Pipelined work is completed in the next frame before the next extraction]==] [==[  Frame limiter executes queued work while waiting for frame deadline]==] [==[  Main thread executes only queued work items within priority limit]==] [==[  Fixed tick scheduler runs frames with constant timestep on tick grid]==] [==[  Fixed tick scheduler configures physics world to single step per tick]==] [==[  PluginStateMigration restores plugin components in place]==] [==[  DepthRasterizer writes depth of front-facing triangles]==] [==[  DepthRasterizer clips triangles against near plane and scissor]==] [==[  DrawCommandQueue deduplicates identical constant buffer blocks]==] [==[  Hierarchical LOD replaces distant static models with proxy]==] [==[  Hierarchical LOD simplification merges vertices in cell]==] [==[  Octahedral mapping of impostor frames is invertible]==] [==[  Impostor baker renders model views into atlas frames]==] [==[  Impostor batches stay valid for view updated before another view]==] [==[  Simple model constructed and desconstructed]==] [==[  Batched octree queries return same drawables as individual queries]==] [==[  Zone lookup grid returns zones of highest priority]==] [==[  ShaderParameterCollection is appended in order]==] [==[  Test structure is serialized to archive]==] [==[  Test structure is serialized as part of the file]==] [==[  JSON stream archive reads nested blocks and skips unread elements]==] [==[  AsyncFileIO reads file ranges]==] [==[  Resources are loaded in background from asynchronously read files]==] [==[  Deserializer reads contiguous and non-contiguous streams identically]==] [==[  Copied VectorBuffer reads its own data]==] [==[  VectorBuffer reads resized data after direct buffer access]==] [==[  Filesystem and package files are memory mapped]==] [==[  FileWatcher coalesces changes of the same file]==] [==[  FileWatcher watches subdirectories registered in background and created later]==] [==[  Compressed package file supports seeking across blocks]==] [==[  Package upload budget is refilled every network update without accumulation]==] [==[  Package upload chunks and fragments are aligned to delta blocks]==] [==[  Package download is resumed, renamed and verified]==] [==[  Point lights are assigned to all clusters they touch]==] [==[  Spot lights are assigned only to clusters inside light cone]==] [==[  Cluster light lists are compact and respect capacity]==] [==[  Shadow casters are culled by receiver volume]==] [==[  Receiver volume keeps max depth of receivers per cell]==] [==[  Cached shadow map is rebuilt when shadow casters change without moving]==] [==[  Cached shadow map is reused until shadow casters change]==] [==[  JSONFile parses all value types]==] [==[  Factorials are computed]==] [==[44 test cases]==])
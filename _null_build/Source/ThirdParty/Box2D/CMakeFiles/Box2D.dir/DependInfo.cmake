@@ -0,0 +1,64 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/Shapes/b2ChainShape.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2ChainShape.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2ChainShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/Shapes/b2CircleShape.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2CircleShape.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2CircleShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/Shapes/b2EdgeShape.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2EdgeShape.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2EdgeShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/Shapes/b2PolygonShape.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2PolygonShape.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2PolygonShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/b2BroadPhase.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2BroadPhase.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2BroadPhase.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/b2CollideCircle.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2CollideCircle.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2CollideCircle.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/b2CollideEdge.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2CollideEdge.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2CollideEdge.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/b2CollidePolygon.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2CollidePolygon.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2CollidePolygon.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/b2Collision.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2Collision.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2Collision.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/b2Distance.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2Distance.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2Distance.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/b2DynamicTree.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2DynamicTree.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2DynamicTree.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Collision/b2TimeOfImpact.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2TimeOfImpact.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Collision/b2TimeOfImpact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Common/b2BlockAllocator.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2BlockAllocator.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2BlockAllocator.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Common/b2Draw.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2Draw.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2Draw.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Common/b2Math.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2Math.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2Math.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Common/b2Settings.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2Settings.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2Settings.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Common/b2StackAllocator.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2StackAllocator.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2StackAllocator.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Common/b2Timer.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2Timer.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Common/b2Timer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Contacts/b2ChainAndCircleContact.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ChainAndCircleContact.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ChainAndCircleContact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Contacts/b2ChainAndPolygonContact.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ChainAndPolygonContact.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ChainAndPolygonContact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Contacts/b2CircleContact.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2CircleContact.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2CircleContact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Contacts/b2Contact.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2Contact.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2Contact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Contacts/b2ContactSolver.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ContactSolver.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ContactSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Contacts/b2EdgeAndCircleContact.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2EdgeAndCircleContact.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2EdgeAndCircleContact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Contacts/b2EdgeAndPolygonContact.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2EdgeAndPolygonContact.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2EdgeAndPolygonContact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Contacts/b2PolygonAndCircleContact.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2PolygonAndCircleContact.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2PolygonAndCircleContact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Contacts/b2PolygonContact.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2PolygonContact.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2PolygonContact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2DistanceJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2DistanceJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2DistanceJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2FrictionJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2FrictionJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2FrictionJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2GearJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2GearJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2GearJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2Joint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2Joint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2Joint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2MotorJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2MotorJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2MotorJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2MouseJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2MouseJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2MouseJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2PrismaticJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2PrismaticJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2PrismaticJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2PulleyJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2PulleyJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2PulleyJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2RevoluteJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2RevoluteJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2RevoluteJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2RopeJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2RopeJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2RopeJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2WeldJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2WeldJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2WeldJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/Joints/b2WheelJoint.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2WheelJoint.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2WheelJoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/b2Body.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Body.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Body.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/b2ContactManager.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2ContactManager.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2ContactManager.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/b2Fixture.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Fixture.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Fixture.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/b2Island.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Island.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Island.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/b2World.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2World.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2World.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Dynamics/b2WorldCallbacks.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2WorldCallbacks.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Dynamics/b2WorldCallbacks.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Box2D/Box2D/Rope/b2Rope.cpp" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Rope/b2Rope.cpp.o" "gcc" "Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/Box2D/Rope/b2Rope.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
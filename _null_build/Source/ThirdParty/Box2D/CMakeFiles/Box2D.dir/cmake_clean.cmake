@@ -0,0 +1,101 @@
+file(REMOVE_RECURSE
+  "../../../lib/libBox2D.a"
+  "../../../lib/libBox2D.pdb"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2ChainShape.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2ChainShape.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2CircleShape.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2CircleShape.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2EdgeShape.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2EdgeShape.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2PolygonShape.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/Shapes/b2PolygonShape.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2BroadPhase.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2BroadPhase.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2CollideCircle.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2CollideCircle.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2CollideEdge.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2CollideEdge.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2CollidePolygon.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2CollidePolygon.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2Collision.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2Collision.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2Distance.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2Distance.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2DynamicTree.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2DynamicTree.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2TimeOfImpact.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Collision/b2TimeOfImpact.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2BlockAllocator.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2BlockAllocator.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2Draw.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2Draw.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2Math.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2Math.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2Settings.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2Settings.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2StackAllocator.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2StackAllocator.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2Timer.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Common/b2Timer.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ChainAndCircleContact.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ChainAndCircleContact.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ChainAndPolygonContact.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ChainAndPolygonContact.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2CircleContact.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2CircleContact.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2Contact.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2Contact.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ContactSolver.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2ContactSolver.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2EdgeAndCircleContact.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2EdgeAndCircleContact.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2EdgeAndPolygonContact.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2EdgeAndPolygonContact.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2PolygonAndCircleContact.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2PolygonAndCircleContact.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2PolygonContact.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Contacts/b2PolygonContact.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2DistanceJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2DistanceJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2FrictionJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2FrictionJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2GearJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2GearJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2Joint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2Joint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2MotorJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2MotorJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2MouseJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2MouseJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2PrismaticJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2PrismaticJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2PulleyJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2PulleyJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2RevoluteJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2RevoluteJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2RopeJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2RopeJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2WeldJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2WeldJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2WheelJoint.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/Joints/b2WheelJoint.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Body.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Body.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2ContactManager.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2ContactManager.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Fixture.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Fixture.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Island.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2Island.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2World.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2World.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2WorldCallbacks.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Dynamics/b2WorldCallbacks.cpp.o.d"
+  "CMakeFiles/Box2D.dir/Box2D/Rope/b2Rope.cpp.o"
+  "CMakeFiles/Box2D.dir/Box2D/Rope/b2Rope.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Box2D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
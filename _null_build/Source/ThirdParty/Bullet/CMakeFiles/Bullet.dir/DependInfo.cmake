@@ -0,0 +1,186 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/BroadphaseCollision/btAxisSweep3.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btAxisSweep3.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btAxisSweep3.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/BroadphaseCollision/btBroadphaseProxy.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btBroadphaseProxy.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btBroadphaseProxy.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/BroadphaseCollision/btCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/BroadphaseCollision/btDbvt.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDbvt.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDbvt.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/BroadphaseCollision/btDbvtBroadphase.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDbvtBroadphase.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDbvtBroadphase.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/BroadphaseCollision/btDispatcher.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDispatcher.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDispatcher.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/BroadphaseCollision/btOverlappingPairCache.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btOverlappingPairCache.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btOverlappingPairCache.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/BroadphaseCollision/btQuantizedBvh.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btQuantizedBvh.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btQuantizedBvh.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/BroadphaseCollision/btSimpleBroadphase.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btSimpleBroadphase.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btSimpleBroadphase.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/SphereTriangleDetector.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/SphereTriangleDetector.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/SphereTriangleDetector.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btBoxBoxCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBoxBoxCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBoxBoxCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btBoxBoxDetector.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBoxBoxDetector.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBoxBoxDetector.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcher.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcher.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcher.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcherMt.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcherMt.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcherMt.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btCollisionObject.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionObject.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionObject.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btCollisionWorld.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionWorld.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionWorld.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btCollisionWorldImporter.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionWorldImporter.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionWorldImporter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btCompoundCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCompoundCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCompoundCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btConvex2dConvex2dAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvex2dConvex2dAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvex2dConvex2dAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btConvexConcaveCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexConcaveCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexConcaveCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btConvexConvexAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexConvexAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexConvexAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btConvexPlaneCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexPlaneCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexPlaneCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btEmptyCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btEmptyCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btEmptyCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btGhostObject.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btGhostObject.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btGhostObject.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btHashedSimplePairCache.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btHashedSimplePairCache.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btHashedSimplePairCache.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btInternalEdgeUtility.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btInternalEdgeUtility.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btInternalEdgeUtility.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btManifoldResult.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btManifoldResult.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btManifoldResult.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btSimulationIslandManager.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSimulationIslandManager.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSimulationIslandManager.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btSphereBoxCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereBoxCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereBoxCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btSphereSphereCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereSphereCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereSphereCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btSphereTriangleCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereTriangleCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereTriangleCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionDispatch/btUnionFind.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btUnionFind.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btUnionFind.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btBox2dShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBox2dShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBox2dShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btBoxShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBoxShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBoxShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btBvhTriangleMeshShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBvhTriangleMeshShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBvhTriangleMeshShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btCapsuleShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCapsuleShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCapsuleShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btCollisionShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCollisionShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCollisionShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btCompoundShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCompoundShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCompoundShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btConcaveShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConcaveShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConcaveShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btConeShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConeShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConeShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btConvex2dShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvex2dShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvex2dShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btConvexHullShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexHullShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexHullShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btConvexInternalShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexInternalShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexInternalShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btConvexPointCloudShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexPointCloudShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexPointCloudShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btConvexPolyhedron.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexPolyhedron.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexPolyhedron.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btConvexShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btConvexTriangleMeshShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexTriangleMeshShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexTriangleMeshShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btCylinderShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCylinderShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCylinderShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btEmptyShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btEmptyShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btEmptyShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btHeightfieldTerrainShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btHeightfieldTerrainShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btHeightfieldTerrainShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btMiniSDF.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMiniSDF.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMiniSDF.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btMinkowskiSumShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMinkowskiSumShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMinkowskiSumShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btMultiSphereShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMultiSphereShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMultiSphereShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btMultimaterialTriangleMeshShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMultimaterialTriangleMeshShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMultimaterialTriangleMeshShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btOptimizedBvh.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btOptimizedBvh.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btOptimizedBvh.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btPolyhedralConvexShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btPolyhedralConvexShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btPolyhedralConvexShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btSdfCollisionShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btSdfCollisionShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btSdfCollisionShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btShapeHull.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btShapeHull.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btShapeHull.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btSphereShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btSphereShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btSphereShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btStaticPlaneShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btStaticPlaneShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btStaticPlaneShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btStridingMeshInterface.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btStridingMeshInterface.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btStridingMeshInterface.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btTetrahedronShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTetrahedronShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTetrahedronShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btTriangleBuffer.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleBuffer.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleBuffer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btTriangleCallback.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleCallback.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleCallback.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexArray.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexArray.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexArray.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexMaterialArray.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexMaterialArray.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexMaterialArray.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btTriangleMesh.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleMesh.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleMesh.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btTriangleMeshShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleMeshShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleMeshShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/CollisionShapes/btUniformScalingShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btUniformScalingShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btUniformScalingShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/btContactProcessing.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btContactProcessing.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btContactProcessing.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/btGImpactBvh.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactBvh.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactBvh.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/btGImpactCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/btGImpactQuantizedBvh.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactQuantizedBvh.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactQuantizedBvh.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/btGImpactShape.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactShape.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactShape.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/btGenericPoolAllocator.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGenericPoolAllocator.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGenericPoolAllocator.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/btTriangleShapeEx.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btTriangleShapeEx.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btTriangleShapeEx.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/gim_box_set.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_box_set.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_box_set.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/gim_contact.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_contact.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_contact.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/gim_memory.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_memory.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_memory.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/Gimpact/gim_tri_collision.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_tri_collision.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_tri_collision.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btContinuousConvexCollision.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btContinuousConvexCollision.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btContinuousConvexCollision.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btConvexCast.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btConvexCast.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btConvexCast.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btGjkConvexCast.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkConvexCast.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkConvexCast.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpa2.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpa2.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpa2.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btGjkPairDetector.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkPairDetector.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkPairDetector.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btPersistentManifold.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btPersistentManifold.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btPersistentManifold.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btRaycastCallback.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btRaycastCallback.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btRaycastCallback.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btSubSimplexConvexCast.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btSubSimplexConvexCast.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btSubSimplexConvexCast.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Character/btKinematicCharacterController.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Character/btKinematicCharacterController.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Character/btKinematicCharacterController.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btBatchedConstraints.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btBatchedConstraints.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btBatchedConstraints.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btConeTwistConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btConeTwistConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btConeTwistConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btContactConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btContactConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btContactConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btFixedConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btFixedConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btFixedConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btGearConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGearConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGearConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpring2Constraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpring2Constraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpring2Constraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpringConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpringConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpringConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btHinge2Constraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btHinge2Constraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btHinge2Constraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btHingeConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btHingeConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btHingeConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btNNCGConstraintSolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btNNCGConstraintSolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btNNCGConstraintSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btPoint2PointConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btPoint2PointConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btPoint2PointConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btSliderConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSliderConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSliderConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btSolve2LinearConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSolve2LinearConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSolve2LinearConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btTypedConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btTypedConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btTypedConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/ConstraintSolver/btUniversalConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btUniversalConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btUniversalConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorld.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorld.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorld.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Dynamics/btRigidBody.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btRigidBody.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btRigidBody.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Dynamics/btSimpleDynamicsWorld.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btSimpleDynamicsWorld.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btSimpleDynamicsWorld.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Dynamics/btSimulationIslandManagerMt.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btSimulationIslandManagerMt.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btSimulationIslandManagerMt.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBody.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBody.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBody.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraintSolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraintSolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraintSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodyDynamicsWorld.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyDynamicsWorld.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyDynamicsWorld.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodyFixedConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyFixedConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyFixedConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodyGearConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyGearConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyGearConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodyJointLimitConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyJointLimitConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyJointLimitConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodyJointMotor.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyJointMotor.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyJointMotor.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodyMLCPConstraintSolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyMLCPConstraintSolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyMLCPConstraintSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodyPoint2Point.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyPoint2Point.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyPoint2Point.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodySliderConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodySliderConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodySliderConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Featherstone/btMultiBodySphericalJointMotor.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodySphericalJointMotor.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodySphericalJointMotor.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/MLCPSolvers/btDantzigLCP.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btDantzigLCP.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btDantzigLCP.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/MLCPSolvers/btLemkeAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btLemkeAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btLemkeAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/MLCPSolvers/btMLCPSolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btMLCPSolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btMLCPSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Vehicle/btRaycastVehicle.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Vehicle/btRaycastVehicle.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Vehicle/btRaycastVehicle.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletDynamics/Vehicle/btWheelInfo.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Vehicle/btWheelInfo.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Vehicle/btWheelInfo.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btDefaultSoftBodySolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDefaultSoftBodySolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDefaultSoftBodySolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btDeformableBackwardEulerObjective.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableBackwardEulerObjective.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableBackwardEulerObjective.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btDeformableBodySolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableBodySolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableBodySolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btDeformableContactConstraint.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableContactConstraint.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableContactConstraint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btDeformableContactProjection.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableContactProjection.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableContactProjection.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btDeformableMultiBodyConstraintSolver.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableMultiBodyConstraintSolver.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableMultiBodyConstraintSolver.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btDeformableMultiBodyDynamicsWorld.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableMultiBodyDynamicsWorld.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableMultiBodyDynamicsWorld.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btSoftBody.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBody.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBody.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btSoftBodyConcaveCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyConcaveCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyConcaveCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btSoftBodyHelpers.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyHelpers.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyHelpers.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btSoftMultiBodyDynamicsWorld.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftMultiBodyDynamicsWorld.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftMultiBodyDynamicsWorld.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btSoftRigidCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftRigidCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftRigidCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btSoftRigidDynamicsWorld.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftRigidDynamicsWorld.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftRigidDynamicsWorld.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/btSoftSoftCollisionAlgorithm.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftSoftCollisionAlgorithm.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftSoftCollisionAlgorithm.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/BulletSoftBody/poly34.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/poly34.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/poly34.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/TaskScheduler/btTaskScheduler.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btTaskScheduler.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btTaskScheduler.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/TaskScheduler/btThreadSupportPosix.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btThreadSupportPosix.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btThreadSupportPosix.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/TaskScheduler/btThreadSupportWin32.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btThreadSupportWin32.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btThreadSupportWin32.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btAlignedAllocator.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btAlignedAllocator.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btAlignedAllocator.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btConvexHull.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btConvexHull.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btConvexHull.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btConvexHullComputer.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btConvexHullComputer.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btConvexHullComputer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btGeometryUtil.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btGeometryUtil.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btGeometryUtil.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btPolarDecomposition.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btPolarDecomposition.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btPolarDecomposition.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btQuickprof.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btQuickprof.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btQuickprof.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btReducedVector.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btReducedVector.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btReducedVector.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btSerializer.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btSerializer.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btSerializer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btSerializer64.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btSerializer64.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btSerializer64.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btThreads.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btThreads.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btThreads.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Bullet/Bullet/LinearMath/btVector3.cpp" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btVector3.cpp.o" "gcc" "Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/Bullet/LinearMath/btVector3.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,345 @@
+file(REMOVE_RECURSE
+  "../../../lib/libBullet.a"
+  "../../../lib/libBullet.pdb"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btAxisSweep3.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btAxisSweep3.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btBroadphaseProxy.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btBroadphaseProxy.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDbvt.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDbvt.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDbvtBroadphase.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDbvtBroadphase.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDispatcher.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btDispatcher.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btOverlappingPairCache.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btOverlappingPairCache.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btQuantizedBvh.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btQuantizedBvh.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btSimpleBroadphase.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/BroadphaseCollision/btSimpleBroadphase.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/SphereTriangleDetector.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/SphereTriangleDetector.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBox2dBox2dCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBoxBoxCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBoxBoxCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBoxBoxDetector.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btBoxBoxDetector.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcher.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcher.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcherMt.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionDispatcherMt.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionObject.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionObject.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionWorld.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionWorld.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionWorldImporter.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCollisionWorldImporter.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCompoundCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCompoundCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btCompoundCompoundCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvex2dConvex2dAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvex2dConvex2dAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexConcaveCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexConcaveCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexConvexAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexConvexAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexPlaneCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btConvexPlaneCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btEmptyCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btEmptyCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btGhostObject.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btGhostObject.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btHashedSimplePairCache.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btHashedSimplePairCache.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btInternalEdgeUtility.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btInternalEdgeUtility.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btManifoldResult.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btManifoldResult.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSimulationIslandManager.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSimulationIslandManager.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereBoxCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereBoxCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereSphereCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereSphereCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereTriangleCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btSphereTriangleCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btUnionFind.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionDispatch/btUnionFind.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBox2dShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBox2dShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBoxShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBoxShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBvhTriangleMeshShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btBvhTriangleMeshShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCapsuleShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCapsuleShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCollisionShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCollisionShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCompoundShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCompoundShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConcaveShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConcaveShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConeShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConeShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvex2dShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvex2dShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexHullShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexHullShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexInternalShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexInternalShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexPointCloudShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexPointCloudShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexPolyhedron.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexPolyhedron.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexTriangleMeshShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btConvexTriangleMeshShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCylinderShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btCylinderShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btEmptyShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btEmptyShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btHeightfieldTerrainShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btHeightfieldTerrainShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMiniSDF.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMiniSDF.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMinkowskiSumShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMinkowskiSumShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMultiSphereShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMultiSphereShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMultimaterialTriangleMeshShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btMultimaterialTriangleMeshShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btOptimizedBvh.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btOptimizedBvh.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btPolyhedralConvexShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btPolyhedralConvexShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btSdfCollisionShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btSdfCollisionShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btShapeHull.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btShapeHull.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btSphereShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btSphereShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btStaticPlaneShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btStaticPlaneShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btStridingMeshInterface.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btStridingMeshInterface.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTetrahedronShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTetrahedronShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleBuffer.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleBuffer.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleCallback.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleCallback.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexArray.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexArray.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexMaterialArray.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexMaterialArray.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleMesh.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleMesh.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleMeshShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btTriangleMeshShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btUniformScalingShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/CollisionShapes/btUniformScalingShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btContactProcessing.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btContactProcessing.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactBvh.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactBvh.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactQuantizedBvh.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactQuantizedBvh.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactShape.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGImpactShape.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGenericPoolAllocator.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btGenericPoolAllocator.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btTriangleShapeEx.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/btTriangleShapeEx.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_box_set.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_box_set.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_contact.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_contact.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_memory.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_memory.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_tri_collision.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/Gimpact/gim_tri_collision.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btContinuousConvexCollision.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btContinuousConvexCollision.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btConvexCast.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btConvexCast.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkConvexCast.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkConvexCast.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpa2.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpa2.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkEpaPenetrationDepthSolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkPairDetector.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btGjkPairDetector.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btMinkowskiPenetrationDepthSolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btPersistentManifold.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btPersistentManifold.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btPolyhedralContactClipping.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btRaycastCallback.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btRaycastCallback.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btSubSimplexConvexCast.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btSubSimplexConvexCast.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletCollision/NarrowPhaseCollision/btVoronoiSimplexSolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Character/btKinematicCharacterController.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Character/btKinematicCharacterController.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btBatchedConstraints.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btBatchedConstraints.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btConeTwistConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btConeTwistConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btContactConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btContactConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btFixedConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btFixedConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGearConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGearConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpring2Constraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpring2Constraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpringConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btGeneric6DofSpringConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btHinge2Constraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btHinge2Constraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btHingeConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btHingeConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btNNCGConstraintSolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btNNCGConstraintSolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btPoint2PointConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btPoint2PointConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSliderConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSliderConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSolve2LinearConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btSolve2LinearConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btTypedConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btTypedConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btUniversalConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/ConstraintSolver/btUniversalConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorld.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorld.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btRigidBody.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btRigidBody.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btSimpleDynamicsWorld.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btSimpleDynamicsWorld.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btSimulationIslandManagerMt.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Dynamics/btSimulationIslandManagerMt.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBody.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBody.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraintSolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyConstraintSolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyDynamicsWorld.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyDynamicsWorld.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyFixedConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyFixedConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyGearConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyGearConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyJointLimitConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyJointLimitConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyJointMotor.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyJointMotor.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyMLCPConstraintSolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyMLCPConstraintSolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyPoint2Point.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodyPoint2Point.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodySliderConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodySliderConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodySphericalJointMotor.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Featherstone/btMultiBodySphericalJointMotor.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btDantzigLCP.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btDantzigLCP.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btLemkeAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btLemkeAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btMLCPSolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/MLCPSolvers/btMLCPSolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Vehicle/btRaycastVehicle.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Vehicle/btRaycastVehicle.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Vehicle/btWheelInfo.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletDynamics/Vehicle/btWheelInfo.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDefaultSoftBodySolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDefaultSoftBodySolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableBackwardEulerObjective.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableBackwardEulerObjective.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableBodySolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableBodySolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableContactConstraint.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableContactConstraint.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableContactProjection.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableContactProjection.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableMultiBodyConstraintSolver.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableMultiBodyConstraintSolver.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableMultiBodyDynamicsWorld.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btDeformableMultiBodyDynamicsWorld.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBody.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBody.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyConcaveCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyConcaveCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyHelpers.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyHelpers.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftMultiBodyDynamicsWorld.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftMultiBodyDynamicsWorld.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftRigidCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftRigidCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftRigidDynamicsWorld.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftRigidDynamicsWorld.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftSoftCollisionAlgorithm.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/btSoftSoftCollisionAlgorithm.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/poly34.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/BulletSoftBody/poly34.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btTaskScheduler.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btTaskScheduler.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btThreadSupportPosix.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btThreadSupportPosix.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btThreadSupportWin32.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/TaskScheduler/btThreadSupportWin32.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btAlignedAllocator.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btAlignedAllocator.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btConvexHull.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btConvexHull.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btConvexHullComputer.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btConvexHullComputer.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btGeometryUtil.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btGeometryUtil.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btPolarDecomposition.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btPolarDecomposition.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btQuickprof.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btQuickprof.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btReducedVector.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btReducedVector.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btSerializer.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btSerializer.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btSerializer64.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btSerializer64.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btThreads.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btThreads.cpp.o.d"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btVector3.cpp.o"
+  "CMakeFiles/Bullet.dir/Bullet/LinearMath/btVector3.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Bullet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libCivetweb.a"
+  "../../../lib/libCivetweb.pdb"
+  "CMakeFiles/Civetweb.dir/src/civetweb.c.o"
+  "CMakeFiles/Civetweb.dir/src/civetweb.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/Civetweb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/Detour/Source/DetourAlloc.cpp" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourAlloc.cpp.o" "gcc" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourAlloc.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Detour/Source/DetourAssert.cpp" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourAssert.cpp.o" "gcc" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourAssert.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Detour/Source/DetourCommon.cpp" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourCommon.cpp.o" "gcc" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourCommon.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Detour/Source/DetourNavMesh.cpp" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourNavMesh.cpp.o" "gcc" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourNavMesh.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Detour/Source/DetourNavMeshBuilder.cpp" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourNavMeshBuilder.cpp.o" "gcc" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourNavMeshBuilder.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Detour/Source/DetourNavMeshQuery.cpp" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourNavMeshQuery.cpp.o" "gcc" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourNavMeshQuery.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Detour/Source/DetourNode.cpp" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourNode.cpp.o" "gcc" "Source/ThirdParty/Detour/CMakeFiles/Detour.dir/Source/DetourNode.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../../lib/libDetour.a"
+  "../../../lib/libDetour.pdb"
+  "CMakeFiles/Detour.dir/Source/DetourAlloc.cpp.o"
+  "CMakeFiles/Detour.dir/Source/DetourAlloc.cpp.o.d"
+  "CMakeFiles/Detour.dir/Source/DetourAssert.cpp.o"
+  "CMakeFiles/Detour.dir/Source/DetourAssert.cpp.o.d"
+  "CMakeFiles/Detour.dir/Source/DetourCommon.cpp.o"
+  "CMakeFiles/Detour.dir/Source/DetourCommon.cpp.o.d"
+  "CMakeFiles/Detour.dir/Source/DetourNavMesh.cpp.o"
+  "CMakeFiles/Detour.dir/Source/DetourNavMesh.cpp.o.d"
+  "CMakeFiles/Detour.dir/Source/DetourNavMeshBuilder.cpp.o"
+  "CMakeFiles/Detour.dir/Source/DetourNavMeshBuilder.cpp.o.d"
+  "CMakeFiles/Detour.dir/Source/DetourNavMeshQuery.cpp.o"
+  "CMakeFiles/Detour.dir/Source/DetourNavMeshQuery.cpp.o.d"
+  "CMakeFiles/Detour.dir/Source/DetourNode.cpp.o"
+  "CMakeFiles/Detour.dir/Source/DetourNode.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Detour.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/DetourCrowd/Source/DetourCrowd.cpp" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourCrowd.cpp.o" "gcc" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourCrowd.cpp.o.d"
+  "/root/repo/Source/ThirdParty/DetourCrowd/Source/DetourLocalBoundary.cpp" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourLocalBoundary.cpp.o" "gcc" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourLocalBoundary.cpp.o.d"
+  "/root/repo/Source/ThirdParty/DetourCrowd/Source/DetourObstacleAvoidance.cpp" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourObstacleAvoidance.cpp.o" "gcc" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourObstacleAvoidance.cpp.o.d"
+  "/root/repo/Source/ThirdParty/DetourCrowd/Source/DetourPathCorridor.cpp" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourPathCorridor.cpp.o" "gcc" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourPathCorridor.cpp.o.d"
+  "/root/repo/Source/ThirdParty/DetourCrowd/Source/DetourPathQueue.cpp" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourPathQueue.cpp.o" "gcc" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourPathQueue.cpp.o.d"
+  "/root/repo/Source/ThirdParty/DetourCrowd/Source/DetourProximityGrid.cpp" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourProximityGrid.cpp.o" "gcc" "Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/Source/DetourProximityGrid.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/Source/ThirdParty/Detour/CMakeFiles/Detour.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../lib/libDetourCrowd.a"
+  "../../../lib/libDetourCrowd.pdb"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourCrowd.cpp.o"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourCrowd.cpp.o.d"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourLocalBoundary.cpp.o"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourLocalBoundary.cpp.o.d"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourObstacleAvoidance.cpp.o"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourObstacleAvoidance.cpp.o.d"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourPathCorridor.cpp.o"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourPathCorridor.cpp.o.d"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourPathQueue.cpp.o"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourPathQueue.cpp.o.d"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourProximityGrid.cpp.o"
+  "CMakeFiles/DetourCrowd.dir/Source/DetourProximityGrid.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DetourCrowd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
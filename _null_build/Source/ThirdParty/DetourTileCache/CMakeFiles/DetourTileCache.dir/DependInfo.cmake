@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/DetourTileCache/Source/DetourTileCache.cpp" "Source/ThirdParty/DetourTileCache/CMakeFiles/DetourTileCache.dir/Source/DetourTileCache.cpp.o" "gcc" "Source/ThirdParty/DetourTileCache/CMakeFiles/DetourTileCache.dir/Source/DetourTileCache.cpp.o.d"
+  "/root/repo/Source/ThirdParty/DetourTileCache/Source/DetourTileCacheBuilder.cpp" "Source/ThirdParty/DetourTileCache/CMakeFiles/DetourTileCache.dir/Source/DetourTileCacheBuilder.cpp.o" "gcc" "Source/ThirdParty/DetourTileCache/CMakeFiles/DetourTileCache.dir/Source/DetourTileCacheBuilder.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/Source/ThirdParty/Detour/CMakeFiles/Detour.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
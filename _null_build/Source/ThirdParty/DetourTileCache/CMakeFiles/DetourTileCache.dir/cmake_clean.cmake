@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libDetourTileCache.a"
+  "../../../lib/libDetourTileCache.pdb"
+  "CMakeFiles/DetourTileCache.dir/Source/DetourTileCache.cpp.o"
+  "CMakeFiles/DetourTileCache.dir/Source/DetourTileCache.cpp.o.d"
+  "CMakeFiles/DetourTileCache.dir/Source/DetourTileCacheBuilder.cpp.o"
+  "CMakeFiles/DetourTileCache.dir/Source/DetourTileCacheBuilder.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DetourTileCache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/EASTL/source/allocator_eastl.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/allocator_eastl.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/allocator_eastl.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/source/assert.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/assert.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/assert.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/source/atomic.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/atomic.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/atomic.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/source/fixed_pool.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/fixed_pool.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/fixed_pool.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/source/hashtable.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/hashtable.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/hashtable.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/source/intrusive_list.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/intrusive_list.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/intrusive_list.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/source/numeric_limits.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/numeric_limits.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/numeric_limits.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/source/red_black_tree.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/red_black_tree.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/red_black_tree.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/source/string.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/string.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/string.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/source/thread_support.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/thread_support.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/source/thread_support.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EACType.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EACType.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EACType.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EADateTime.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EADateTime.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EADateTime.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAFixedPoint.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAFixedPoint.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAFixedPoint.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAGlobal.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAGlobal.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAGlobal.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAHashCRC.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAHashCRC.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAHashCRC.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAHashString.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAHashString.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAHashString.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAMemory.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAMemory.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAMemory.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAProcess.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAProcess.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAProcess.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EARandom.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EARandom.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EARandom.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAScanf.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAScanf.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAScanf.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAScanfCore.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAScanfCore.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAScanfCore.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EASprintf.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintf.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintf.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EASprintfCore.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintfCore.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintfCore.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EASprintfOrdered.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintfOrdered.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintfOrdered.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAStdC.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAStdC.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAStdC.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAStopwatch.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAStopwatch.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAStopwatch.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EAString.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAString.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAString.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/EATextUtil.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EATextUtil.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EATextUtil.cpp.o.d"
+  "/root/repo/Source/ThirdParty/EASTL/test/packages/EAStdC/source/Int128_t.cpp" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/Int128_t.cpp.o" "gcc" "Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/test/packages/EAStdC/source/Int128_t.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "../../../lib/libEASTL.a"
+  "../../../lib/libEASTL.pdb"
+  "CMakeFiles/EASTL.dir/source/allocator_eastl.cpp.o"
+  "CMakeFiles/EASTL.dir/source/allocator_eastl.cpp.o.d"
+  "CMakeFiles/EASTL.dir/source/assert.cpp.o"
+  "CMakeFiles/EASTL.dir/source/assert.cpp.o.d"
+  "CMakeFiles/EASTL.dir/source/atomic.cpp.o"
+  "CMakeFiles/EASTL.dir/source/atomic.cpp.o.d"
+  "CMakeFiles/EASTL.dir/source/fixed_pool.cpp.o"
+  "CMakeFiles/EASTL.dir/source/fixed_pool.cpp.o.d"
+  "CMakeFiles/EASTL.dir/source/hashtable.cpp.o"
+  "CMakeFiles/EASTL.dir/source/hashtable.cpp.o.d"
+  "CMakeFiles/EASTL.dir/source/intrusive_list.cpp.o"
+  "CMakeFiles/EASTL.dir/source/intrusive_list.cpp.o.d"
+  "CMakeFiles/EASTL.dir/source/numeric_limits.cpp.o"
+  "CMakeFiles/EASTL.dir/source/numeric_limits.cpp.o.d"
+  "CMakeFiles/EASTL.dir/source/red_black_tree.cpp.o"
+  "CMakeFiles/EASTL.dir/source/red_black_tree.cpp.o.d"
+  "CMakeFiles/EASTL.dir/source/string.cpp.o"
+  "CMakeFiles/EASTL.dir/source/string.cpp.o.d"
+  "CMakeFiles/EASTL.dir/source/thread_support.cpp.o"
+  "CMakeFiles/EASTL.dir/source/thread_support.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EACType.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EACType.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EADateTime.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EADateTime.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAFixedPoint.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAFixedPoint.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAGlobal.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAGlobal.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAHashCRC.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAHashCRC.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAHashString.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAHashString.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAMemory.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAMemory.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAProcess.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAProcess.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EARandom.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EARandom.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAScanf.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAScanf.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAScanfCore.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAScanfCore.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintf.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintf.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintfCore.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintfCore.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintfOrdered.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EASprintfOrdered.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAStdC.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAStdC.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAStopwatch.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAStopwatch.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAString.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EAString.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EATextUtil.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/EATextUtil.cpp.o.d"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/Int128_t.cpp.o"
+  "CMakeFiles/EASTL.dir/test/packages/EAStdC/source/Int128_t.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EASTL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libETCPACK.a"
+  "../../../lib/libETCPACK.pdb"
+  "CMakeFiles/ETCPACK.dir/source/etcdec.cxx.o"
+  "CMakeFiles/ETCPACK.dir/source/etcdec.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ETCPACK.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
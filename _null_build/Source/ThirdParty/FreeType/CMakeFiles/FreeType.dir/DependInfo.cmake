@@ -0,0 +1,59 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/FreeType/src/autofit/autofit.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/autofit/autofit.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/autofit/autofit.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftbase.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftbase.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftbase.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftbbox.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftbbox.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftbbox.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftbitmap.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftbitmap.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftbitmap.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftfntfmt.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftfntfmt.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftfntfmt.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftfstype.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftfstype.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftfstype.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftgasp.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftgasp.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftgasp.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftglyph.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftglyph.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftglyph.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftgxval.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftgxval.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftgxval.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftinit.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftinit.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftinit.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftlcdfil.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftlcdfil.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftlcdfil.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftmm.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftmm.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftmm.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftotval.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftotval.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftotval.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftpatent.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftpatent.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftpatent.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftpfr.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftpfr.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftpfr.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftstroke.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftstroke.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftstroke.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftsynth.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftsynth.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftsynth.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftsystem.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftsystem.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftsystem.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/fttype1.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/fttype1.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/fttype1.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/base/ftwinfnt.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftwinfnt.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/base/ftwinfnt.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/bdf/bdf.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/bdf/bdf.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/bdf/bdf.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/bzip2/ftbzip2.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/bzip2/ftbzip2.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/bzip2/ftbzip2.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/cache/ftcache.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/cache/ftcache.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/cache/ftcache.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/cff/cff.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/cff/cff.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/cff/cff.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/cid/type1cid.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/cid/type1cid.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/cid/type1cid.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/gxvalid/gxvalid.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/gxvalid/gxvalid.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/gxvalid/gxvalid.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/gzip/ftgzip.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/gzip/ftgzip.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/gzip/ftgzip.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/lzw/ftlzw.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/lzw/ftlzw.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/lzw/ftlzw.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/otvalid/otvalid.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/otvalid/otvalid.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/otvalid/otvalid.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/pcf/pcf.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/pcf/pcf.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/pcf/pcf.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/pfr/pfr.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/pfr/pfr.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/pfr/pfr.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/psaux/psaux.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/psaux/psaux.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/psaux/psaux.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/pshinter/pshinter.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/pshinter/pshinter.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/pshinter/pshinter.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/psnames/psmodule.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/psnames/psmodule.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/psnames/psmodule.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/raster/raster.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/raster/raster.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/raster/raster.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/sfnt/sfnt.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/sfnt/sfnt.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/sfnt/sfnt.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/smooth/smooth.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/smooth/smooth.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/smooth/smooth.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/truetype/truetype.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/truetype/truetype.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/truetype/truetype.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/type1/type1.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/type1/type1.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/type1/type1.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/type42/type42.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/type42/type42.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/type42/type42.c.o.d"
+  "/root/repo/Source/ThirdParty/FreeType/src/winfonts/winfnt.c" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/winfonts/winfnt.c.o" "gcc" "Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/src/winfonts/winfnt.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
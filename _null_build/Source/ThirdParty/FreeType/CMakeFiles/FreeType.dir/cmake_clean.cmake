@@ -0,0 +1,91 @@
+file(REMOVE_RECURSE
+  "../../../lib/libFreeType.a"
+  "../../../lib/libFreeType.pdb"
+  "CMakeFiles/FreeType.dir/src/autofit/autofit.c.o"
+  "CMakeFiles/FreeType.dir/src/autofit/autofit.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftbase.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftbase.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftbbox.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftbbox.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftbitmap.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftbitmap.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftfntfmt.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftfntfmt.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftfstype.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftfstype.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftgasp.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftgasp.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftglyph.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftglyph.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftgxval.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftgxval.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftinit.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftinit.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftlcdfil.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftlcdfil.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftmm.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftmm.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftotval.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftotval.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftpatent.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftpatent.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftpfr.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftpfr.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftstroke.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftstroke.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftsynth.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftsynth.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftsystem.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftsystem.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/fttype1.c.o"
+  "CMakeFiles/FreeType.dir/src/base/fttype1.c.o.d"
+  "CMakeFiles/FreeType.dir/src/base/ftwinfnt.c.o"
+  "CMakeFiles/FreeType.dir/src/base/ftwinfnt.c.o.d"
+  "CMakeFiles/FreeType.dir/src/bdf/bdf.c.o"
+  "CMakeFiles/FreeType.dir/src/bdf/bdf.c.o.d"
+  "CMakeFiles/FreeType.dir/src/bzip2/ftbzip2.c.o"
+  "CMakeFiles/FreeType.dir/src/bzip2/ftbzip2.c.o.d"
+  "CMakeFiles/FreeType.dir/src/cache/ftcache.c.o"
+  "CMakeFiles/FreeType.dir/src/cache/ftcache.c.o.d"
+  "CMakeFiles/FreeType.dir/src/cff/cff.c.o"
+  "CMakeFiles/FreeType.dir/src/cff/cff.c.o.d"
+  "CMakeFiles/FreeType.dir/src/cid/type1cid.c.o"
+  "CMakeFiles/FreeType.dir/src/cid/type1cid.c.o.d"
+  "CMakeFiles/FreeType.dir/src/gxvalid/gxvalid.c.o"
+  "CMakeFiles/FreeType.dir/src/gxvalid/gxvalid.c.o.d"
+  "CMakeFiles/FreeType.dir/src/gzip/ftgzip.c.o"
+  "CMakeFiles/FreeType.dir/src/gzip/ftgzip.c.o.d"
+  "CMakeFiles/FreeType.dir/src/lzw/ftlzw.c.o"
+  "CMakeFiles/FreeType.dir/src/lzw/ftlzw.c.o.d"
+  "CMakeFiles/FreeType.dir/src/otvalid/otvalid.c.o"
+  "CMakeFiles/FreeType.dir/src/otvalid/otvalid.c.o.d"
+  "CMakeFiles/FreeType.dir/src/pcf/pcf.c.o"
+  "CMakeFiles/FreeType.dir/src/pcf/pcf.c.o.d"
+  "CMakeFiles/FreeType.dir/src/pfr/pfr.c.o"
+  "CMakeFiles/FreeType.dir/src/pfr/pfr.c.o.d"
+  "CMakeFiles/FreeType.dir/src/psaux/psaux.c.o"
+  "CMakeFiles/FreeType.dir/src/psaux/psaux.c.o.d"
+  "CMakeFiles/FreeType.dir/src/pshinter/pshinter.c.o"
+  "CMakeFiles/FreeType.dir/src/pshinter/pshinter.c.o.d"
+  "CMakeFiles/FreeType.dir/src/psnames/psmodule.c.o"
+  "CMakeFiles/FreeType.dir/src/psnames/psmodule.c.o.d"
+  "CMakeFiles/FreeType.dir/src/raster/raster.c.o"
+  "CMakeFiles/FreeType.dir/src/raster/raster.c.o.d"
+  "CMakeFiles/FreeType.dir/src/sfnt/sfnt.c.o"
+  "CMakeFiles/FreeType.dir/src/sfnt/sfnt.c.o.d"
+  "CMakeFiles/FreeType.dir/src/smooth/smooth.c.o"
+  "CMakeFiles/FreeType.dir/src/smooth/smooth.c.o.d"
+  "CMakeFiles/FreeType.dir/src/truetype/truetype.c.o"
+  "CMakeFiles/FreeType.dir/src/truetype/truetype.c.o.d"
+  "CMakeFiles/FreeType.dir/src/type1/type1.c.o"
+  "CMakeFiles/FreeType.dir/src/type1/type1.c.o.d"
+  "CMakeFiles/FreeType.dir/src/type42/type42.c.o"
+  "CMakeFiles/FreeType.dir/src/type42/type42.c.o.d"
+  "CMakeFiles/FreeType.dir/src/winfonts/winfnt.c.o"
+  "CMakeFiles/FreeType.dir/src/winfonts/winfnt.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/FreeType.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/LZ4/lz4.c" "Source/ThirdParty/LZ4/CMakeFiles/LZ4.dir/lz4.c.o" "gcc" "Source/ThirdParty/LZ4/CMakeFiles/LZ4.dir/lz4.c.o.d"
+  "/root/repo/Source/ThirdParty/LZ4/lz4hc.c" "Source/ThirdParty/LZ4/CMakeFiles/LZ4.dir/lz4hc.c.o" "gcc" "Source/ThirdParty/LZ4/CMakeFiles/LZ4.dir/lz4hc.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
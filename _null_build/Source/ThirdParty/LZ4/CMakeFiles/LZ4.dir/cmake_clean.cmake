@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libLZ4.a"
+  "../../../lib/libLZ4.pdb"
+  "CMakeFiles/LZ4.dir/lz4.c.o"
+  "CMakeFiles/LZ4.dir/lz4.c.o.d"
+  "CMakeFiles/LZ4.dir/lz4hc.c.o"
+  "CMakeFiles/LZ4.dir/lz4hc.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/LZ4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libPugiXml.a"
+  "../../../lib/libPugiXml.pdb"
+  "CMakeFiles/PugiXml.dir/src/pugixml.cpp.o"
+  "CMakeFiles/PugiXml.dir/src/pugixml.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PugiXml.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
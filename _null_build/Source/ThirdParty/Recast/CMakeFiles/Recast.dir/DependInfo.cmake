@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/Recast/Source/Recast.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/Recast.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/Recast.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastAlloc.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastAlloc.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastAlloc.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastArea.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastArea.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastArea.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastAssert.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastAssert.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastAssert.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastContour.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastContour.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastContour.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastFilter.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastFilter.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastFilter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastLayers.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastLayers.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastLayers.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastMesh.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastMesh.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastMesh.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastMeshDetail.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastMeshDetail.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastMeshDetail.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastRasterization.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastRasterization.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastRasterization.cpp.o.d"
+  "/root/repo/Source/ThirdParty/Recast/Source/RecastRegion.cpp" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastRegion.cpp.o" "gcc" "Source/ThirdParty/Recast/CMakeFiles/Recast.dir/Source/RecastRegion.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
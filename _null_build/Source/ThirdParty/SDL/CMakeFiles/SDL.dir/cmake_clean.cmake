@@ -0,0 +1,261 @@
+file(REMOVE_RECURSE
+  "../../../lib/libSDL.a"
+  "../../../lib/libSDL.pdb"
+  "CMakeFiles/SDL.dir/src/SDL.c.o"
+  "CMakeFiles/SDL.dir/src/SDL.c.o.d"
+  "CMakeFiles/SDL.dir/src/SDL_assert.c.o"
+  "CMakeFiles/SDL.dir/src/SDL_assert.c.o.d"
+  "CMakeFiles/SDL.dir/src/SDL_dataqueue.c.o"
+  "CMakeFiles/SDL.dir/src/SDL_dataqueue.c.o.d"
+  "CMakeFiles/SDL.dir/src/SDL_error.c.o"
+  "CMakeFiles/SDL.dir/src/SDL_error.c.o.d"
+  "CMakeFiles/SDL.dir/src/SDL_hints.c.o"
+  "CMakeFiles/SDL.dir/src/SDL_hints.c.o.d"
+  "CMakeFiles/SDL.dir/src/SDL_log.c.o"
+  "CMakeFiles/SDL.dir/src/SDL_log.c.o.d"
+  "CMakeFiles/SDL.dir/src/atomic/SDL_atomic.c.o"
+  "CMakeFiles/SDL.dir/src/atomic/SDL_atomic.c.o.d"
+  "CMakeFiles/SDL.dir/src/atomic/SDL_spinlock.c.o"
+  "CMakeFiles/SDL.dir/src/atomic/SDL_spinlock.c.o.d"
+  "CMakeFiles/SDL.dir/src/audio/SDL_audio.c.o"
+  "CMakeFiles/SDL.dir/src/audio/SDL_audio.c.o.d"
+  "CMakeFiles/SDL.dir/src/audio/SDL_audiocvt.c.o"
+  "CMakeFiles/SDL.dir/src/audio/SDL_audiocvt.c.o.d"
+  "CMakeFiles/SDL.dir/src/audio/SDL_audiodev.c.o"
+  "CMakeFiles/SDL.dir/src/audio/SDL_audiodev.c.o.d"
+  "CMakeFiles/SDL.dir/src/audio/SDL_audiotypecvt.c.o"
+  "CMakeFiles/SDL.dir/src/audio/SDL_audiotypecvt.c.o.d"
+  "CMakeFiles/SDL.dir/src/audio/SDL_mixer.c.o"
+  "CMakeFiles/SDL.dir/src/audio/SDL_mixer.c.o.d"
+  "CMakeFiles/SDL.dir/src/audio/SDL_wave.c.o"
+  "CMakeFiles/SDL.dir/src/audio/SDL_wave.c.o.d"
+  "CMakeFiles/SDL.dir/src/audio/disk/SDL_diskaudio.c.o"
+  "CMakeFiles/SDL.dir/src/audio/disk/SDL_diskaudio.c.o.d"
+  "CMakeFiles/SDL.dir/src/audio/dummy/SDL_dummyaudio.c.o"
+  "CMakeFiles/SDL.dir/src/audio/dummy/SDL_dummyaudio.c.o.d"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_dbus.c.o"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_dbus.c.o.d"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_evdev.c.o"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_evdev.c.o.d"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_evdev_kbd.c.o"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_evdev_kbd.c.o.d"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_fcitx.c.o"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_fcitx.c.o.d"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_ibus.c.o"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_ibus.c.o.d"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_ime.c.o"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_ime.c.o.d"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_threadprio.c.o"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_threadprio.c.o.d"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_udev.c.o"
+  "CMakeFiles/SDL.dir/src/core/linux/SDL_udev.c.o.d"
+  "CMakeFiles/SDL.dir/src/core/unix/SDL_poll.c.o"
+  "CMakeFiles/SDL.dir/src/core/unix/SDL_poll.c.o.d"
+  "CMakeFiles/SDL.dir/src/cpuinfo/SDL_cpuinfo.c.o"
+  "CMakeFiles/SDL.dir/src/cpuinfo/SDL_cpuinfo.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_clipboardevents.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_clipboardevents.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_displayevents.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_displayevents.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_dropevents.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_dropevents.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_events.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_events.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_gesture.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_gesture.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_keyboard.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_keyboard.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_mouse.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_mouse.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_quit.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_quit.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_touch.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_touch.c.o.d"
+  "CMakeFiles/SDL.dir/src/events/SDL_windowevents.c.o"
+  "CMakeFiles/SDL.dir/src/events/SDL_windowevents.c.o.d"
+  "CMakeFiles/SDL.dir/src/file/SDL_rwops.c.o"
+  "CMakeFiles/SDL.dir/src/file/SDL_rwops.c.o.d"
+  "CMakeFiles/SDL.dir/src/filesystem/unix/SDL_sysfilesystem.c.o"
+  "CMakeFiles/SDL.dir/src/filesystem/unix/SDL_sysfilesystem.c.o.d"
+  "CMakeFiles/SDL.dir/src/haptic/SDL_haptic.c.o"
+  "CMakeFiles/SDL.dir/src/haptic/SDL_haptic.c.o.d"
+  "CMakeFiles/SDL.dir/src/haptic/linux/SDL_syshaptic.c.o"
+  "CMakeFiles/SDL.dir/src/haptic/linux/SDL_syshaptic.c.o.d"
+  "CMakeFiles/SDL.dir/src/joystick/SDL_gamecontroller.c.o"
+  "CMakeFiles/SDL.dir/src/joystick/SDL_gamecontroller.c.o.d"
+  "CMakeFiles/SDL.dir/src/joystick/SDL_joystick.c.o"
+  "CMakeFiles/SDL.dir/src/joystick/SDL_joystick.c.o.d"
+  "CMakeFiles/SDL.dir/src/joystick/linux/SDL_sysjoystick.c.o"
+  "CMakeFiles/SDL.dir/src/joystick/linux/SDL_sysjoystick.c.o.d"
+  "CMakeFiles/SDL.dir/src/joystick/steam/SDL_steamcontroller.c.o"
+  "CMakeFiles/SDL.dir/src/joystick/steam/SDL_steamcontroller.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/e_atan2.c.o"
+  "CMakeFiles/SDL.dir/src/libm/e_atan2.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/e_exp.c.o"
+  "CMakeFiles/SDL.dir/src/libm/e_exp.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/e_fmod.c.o"
+  "CMakeFiles/SDL.dir/src/libm/e_fmod.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/e_log.c.o"
+  "CMakeFiles/SDL.dir/src/libm/e_log.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/e_log10.c.o"
+  "CMakeFiles/SDL.dir/src/libm/e_log10.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/e_pow.c.o"
+  "CMakeFiles/SDL.dir/src/libm/e_pow.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/e_rem_pio2.c.o"
+  "CMakeFiles/SDL.dir/src/libm/e_rem_pio2.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/e_sqrt.c.o"
+  "CMakeFiles/SDL.dir/src/libm/e_sqrt.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/k_cos.c.o"
+  "CMakeFiles/SDL.dir/src/libm/k_cos.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/k_rem_pio2.c.o"
+  "CMakeFiles/SDL.dir/src/libm/k_rem_pio2.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/k_sin.c.o"
+  "CMakeFiles/SDL.dir/src/libm/k_sin.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/k_tan.c.o"
+  "CMakeFiles/SDL.dir/src/libm/k_tan.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/s_atan.c.o"
+  "CMakeFiles/SDL.dir/src/libm/s_atan.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/s_copysign.c.o"
+  "CMakeFiles/SDL.dir/src/libm/s_copysign.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/s_cos.c.o"
+  "CMakeFiles/SDL.dir/src/libm/s_cos.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/s_fabs.c.o"
+  "CMakeFiles/SDL.dir/src/libm/s_fabs.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/s_floor.c.o"
+  "CMakeFiles/SDL.dir/src/libm/s_floor.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/s_scalbn.c.o"
+  "CMakeFiles/SDL.dir/src/libm/s_scalbn.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/s_sin.c.o"
+  "CMakeFiles/SDL.dir/src/libm/s_sin.c.o.d"
+  "CMakeFiles/SDL.dir/src/libm/s_tan.c.o"
+  "CMakeFiles/SDL.dir/src/libm/s_tan.c.o.d"
+  "CMakeFiles/SDL.dir/src/loadso/dlopen/SDL_sysloadso.c.o"
+  "CMakeFiles/SDL.dir/src/loadso/dlopen/SDL_sysloadso.c.o.d"
+  "CMakeFiles/SDL.dir/src/power/SDL_power.c.o"
+  "CMakeFiles/SDL.dir/src/power/SDL_power.c.o.d"
+  "CMakeFiles/SDL.dir/src/power/linux/SDL_syspower.c.o"
+  "CMakeFiles/SDL.dir/src/power/linux/SDL_syspower.c.o.d"
+  "CMakeFiles/SDL.dir/src/sensor/SDL_sensor.c.o"
+  "CMakeFiles/SDL.dir/src/sensor/SDL_sensor.c.o.d"
+  "CMakeFiles/SDL.dir/src/sensor/dummy/SDL_dummysensor.c.o"
+  "CMakeFiles/SDL.dir/src/sensor/dummy/SDL_dummysensor.c.o.d"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_getenv.c.o"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_getenv.c.o.d"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_iconv.c.o"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_iconv.c.o.d"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_malloc.c.o"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_malloc.c.o.d"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_qsort.c.o"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_qsort.c.o.d"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_stdlib.c.o"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_stdlib.c.o.d"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_string.c.o"
+  "CMakeFiles/SDL.dir/src/stdlib/SDL_string.c.o.d"
+  "CMakeFiles/SDL.dir/src/thread/SDL_thread.c.o"
+  "CMakeFiles/SDL.dir/src/thread/SDL_thread.c.o.d"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_syscond.c.o"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_syscond.c.o.d"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_sysmutex.c.o"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_sysmutex.c.o.d"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_syssem.c.o"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_syssem.c.o.d"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_systhread.c.o"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_systhread.c.o.d"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_systls.c.o"
+  "CMakeFiles/SDL.dir/src/thread/pthread/SDL_systls.c.o.d"
+  "CMakeFiles/SDL.dir/src/timer/SDL_timer.c.o"
+  "CMakeFiles/SDL.dir/src/timer/SDL_timer.c.o.d"
+  "CMakeFiles/SDL.dir/src/timer/unix/SDL_systimer.c.o"
+  "CMakeFiles/SDL.dir/src/timer/unix/SDL_systimer.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_RLEaccel.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_RLEaccel.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_0.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_0.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_1.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_1.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_A.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_A.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_N.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_N.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_auto.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_auto.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_copy.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_copy.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_slow.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_blit_slow.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_bmp.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_bmp.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_clipboard.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_clipboard.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_egl.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_egl.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_fillrect.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_fillrect.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_pixels.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_pixels.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_rect.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_rect.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_shape.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_shape.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_stretch.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_stretch.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_surface.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_surface.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_video.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_video.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_vulkan_utils.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_vulkan_utils.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/SDL_yuv.c.o"
+  "CMakeFiles/SDL.dir/src/video/SDL_yuv.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/dummy/SDL_nullevents.c.o"
+  "CMakeFiles/SDL.dir/src/video/dummy/SDL_nullevents.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/dummy/SDL_nullframebuffer.c.o"
+  "CMakeFiles/SDL.dir/src/video/dummy/SDL_nullframebuffer.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/dummy/SDL_nullvideo.c.o"
+  "CMakeFiles/SDL.dir/src/video/dummy/SDL_nullvideo.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11clipboard.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11clipboard.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11dyn.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11dyn.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11events.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11events.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11framebuffer.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11framebuffer.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11keyboard.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11keyboard.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11messagebox.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11messagebox.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11modes.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11modes.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11mouse.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11mouse.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11opengl.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11opengl.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11opengles.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11opengles.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11shape.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11shape.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11touch.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11touch.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11video.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11video.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11vulkan.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11vulkan.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11window.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11window.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11xinput2.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/SDL_x11xinput2.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/edid-parse.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/edid-parse.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/x11/imKStoUCS.c.o"
+  "CMakeFiles/SDL.dir/src/video/x11/imKStoUCS.c.o.d"
+  "CMakeFiles/SDL.dir/src/video/yuv2rgb/yuv_rgb.c.o"
+  "CMakeFiles/SDL.dir/src/video/yuv2rgb/yuv_rgb.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/SDL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
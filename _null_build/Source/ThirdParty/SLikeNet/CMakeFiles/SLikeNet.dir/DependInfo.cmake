@@ -0,0 +1,130 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/Base64Encoder.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Base64Encoder.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Base64Encoder.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/BitStream.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/BitStream.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/BitStream.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/CCRakNetSlidingWindow.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CCRakNetSlidingWindow.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CCRakNetSlidingWindow.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/CCRakNetUDT.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CCRakNetUDT.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CCRakNetUDT.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/CheckSum.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CheckSum.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CheckSum.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/CloudClient.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CloudClient.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CloudClient.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/CloudCommon.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CloudCommon.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CloudCommon.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/CloudServer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CloudServer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CloudServer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/CommandParserInterface.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CommandParserInterface.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/CommandParserInterface.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/ConnectionGraph2.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ConnectionGraph2.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ConnectionGraph2.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/ConsoleServer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ConsoleServer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ConsoleServer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/DR_SHA1.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DR_SHA1.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DR_SHA1.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/DS_BytePool.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DS_BytePool.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DS_BytePool.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/DS_ByteQueue.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DS_ByteQueue.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DS_ByteQueue.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/DS_HuffmanEncodingTree.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DS_HuffmanEncodingTree.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DS_HuffmanEncodingTree.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/DS_Table.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DS_Table.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DS_Table.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/DataCompressor.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DataCompressor.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DataCompressor.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/DirectoryDeltaTransfer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DirectoryDeltaTransfer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DirectoryDeltaTransfer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/DynDNS.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DynDNS.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/DynDNS.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/EmailSender.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/EmailSender.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/EmailSender.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/EpochTimeToString.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/EpochTimeToString.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/EpochTimeToString.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/FileList.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FileList.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FileList.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/FileListTransfer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FileListTransfer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FileListTransfer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/FileOperations.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FileOperations.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FileOperations.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/FormatString.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FormatString.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FormatString.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/FullyConnectedMesh2.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FullyConnectedMesh2.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/FullyConnectedMesh2.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/GetTime.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/GetTime.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/GetTime.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/Getche.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Getche.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Getche.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/Gets.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Gets.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Gets.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/GridSectorizer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/GridSectorizer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/GridSectorizer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/HTTPConnection.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/HTTPConnection.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/HTTPConnection.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/HTTPConnection2.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/HTTPConnection2.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/HTTPConnection2.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/IncrementalReadInterface.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/IncrementalReadInterface.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/IncrementalReadInterface.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/Itoa.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Itoa.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Itoa.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/LinuxStrings.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/LinuxStrings.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/LinuxStrings.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/LocklessTypes.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/LocklessTypes.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/LocklessTypes.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/LogCommandParser.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/LogCommandParser.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/LogCommandParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/MessageFilter.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/MessageFilter.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/MessageFilter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/NatPunchthroughClient.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatPunchthroughClient.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatPunchthroughClient.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/NatPunchthroughServer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatPunchthroughServer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatPunchthroughServer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/NatTypeDetectionClient.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionClient.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionClient.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/NatTypeDetectionCommon.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionCommon.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionCommon.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/NatTypeDetectionServer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionServer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionServer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/NetworkIDManager.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NetworkIDManager.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NetworkIDManager.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/NetworkIDObject.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NetworkIDObject.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/NetworkIDObject.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/PS4Includes.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PS4Includes.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PS4Includes.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/PacketConsoleLogger.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketConsoleLogger.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketConsoleLogger.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/PacketFileLogger.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketFileLogger.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketFileLogger.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/PacketLogger.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketLogger.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketLogger.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/PacketOutputWindowLogger.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketOutputWindowLogger.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketOutputWindowLogger.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/PacketizedTCP.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketizedTCP.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PacketizedTCP.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/PluginInterface2.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PluginInterface2.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/PluginInterface2.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RPC4Plugin.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RPC4Plugin.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RPC4Plugin.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/Rackspace.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Rackspace.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Rackspace.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakMemoryOverride.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakMemoryOverride.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakMemoryOverride.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetCommandParser.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetCommandParser.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetCommandParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_360_720.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_360_720.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_360_720.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_Berkley.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Berkley.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Berkley.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_Berkley_NativeClient.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Berkley_NativeClient.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Berkley_NativeClient.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_NativeClient.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_NativeClient.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_NativeClient.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_PS3_PS4.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_PS3_PS4.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_PS3_PS4.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_PS4.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_PS4.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_PS4.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_Vita.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Vita.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Vita.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_WindowsStore8.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_WindowsStore8.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_WindowsStore8.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_Windows_Linux.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Windows_Linux.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Windows_Linux.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetSocket2_Windows_Linux_360.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Windows_Linux_360.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Windows_Linux_360.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetStatistics.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetStatistics.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetStatistics.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetTransport2.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetTransport2.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetTransport2.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakNetTypes.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetTypes.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakNetTypes.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakPeer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakPeer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakPeer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakSleep.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakSleep.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakSleep.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakString.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakString.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakString.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakThread.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakThread.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakThread.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RakWString.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakWString.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RakWString.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/Rand.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Rand.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Rand.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RandSync.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RandSync.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RandSync.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/ReadyEvent.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ReadyEvent.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ReadyEvent.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/RelayPlugin.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RelayPlugin.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/RelayPlugin.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/ReliabilityLayer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ReliabilityLayer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ReliabilityLayer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/ReplicaManager3.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ReplicaManager3.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ReplicaManager3.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/Router2.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Router2.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/Router2.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/SecureHandshake.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SecureHandshake.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SecureHandshake.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/SendToThread.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SendToThread.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SendToThread.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/SignaledEvent.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SignaledEvent.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SignaledEvent.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/SimpleMutex.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SimpleMutex.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SimpleMutex.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/SocketLayer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SocketLayer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SocketLayer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/StatisticsHistory.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/StatisticsHistory.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/StatisticsHistory.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/StringCompressor.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/StringCompressor.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/StringCompressor.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/StringTable.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/StringTable.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/StringTable.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/SuperFastHash.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SuperFastHash.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/SuperFastHash.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/TCPInterface.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TCPInterface.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TCPInterface.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/TableSerializer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TableSerializer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TableSerializer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/TeamBalancer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TeamBalancer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TeamBalancer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/TeamManager.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TeamManager.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TeamManager.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/TelnetTransport.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TelnetTransport.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TelnetTransport.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/ThreadsafePacketLogger.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ThreadsafePacketLogger.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/ThreadsafePacketLogger.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/TwoWayAuthentication.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TwoWayAuthentication.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/TwoWayAuthentication.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/UDPForwarder.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/UDPForwarder.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/UDPForwarder.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/UDPProxyClient.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/UDPProxyClient.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/UDPProxyClient.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/UDPProxyCoordinator.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/UDPProxyCoordinator.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/UDPProxyCoordinator.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/UDPProxyServer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/UDPProxyServer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/UDPProxyServer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/VariableDeltaSerializer.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/VariableDeltaSerializer.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/VariableDeltaSerializer.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/VariableListDeltaTracker.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/VariableListDeltaTracker.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/VariableListDeltaTracker.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/VariadicSQLParser.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/VariadicSQLParser.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/VariadicSQLParser.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/VitaIncludes.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/VitaIncludes.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/VitaIncludes.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/WSAStartupSingleton.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/WSAStartupSingleton.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/WSAStartupSingleton.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/_FindFirst.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/_FindFirst.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/_FindFirst.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/gettimeofday.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/gettimeofday.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/gettimeofday.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/linux_adapter.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/linux_adapter.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/linux_adapter.cpp.o.d"
+  "/root/repo/Source/ThirdParty/SLikeNet/Source/src/osx_adapter.cpp" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/osx_adapter.cpp.o" "gcc" "Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/Source/src/osx_adapter.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,233 @@
+file(REMOVE_RECURSE
+  "../../../lib/libSLikeNet.a"
+  "../../../lib/libSLikeNet.pdb"
+  "CMakeFiles/SLikeNet.dir/Source/src/Base64Encoder.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/Base64Encoder.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/BitStream.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/BitStream.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/CCRakNetSlidingWindow.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/CCRakNetSlidingWindow.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/CCRakNetUDT.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/CCRakNetUDT.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/CheckSum.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/CheckSum.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/CloudClient.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/CloudClient.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/CloudCommon.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/CloudCommon.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/CloudServer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/CloudServer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/CommandParserInterface.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/CommandParserInterface.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/ConnectionGraph2.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/ConnectionGraph2.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/ConsoleServer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/ConsoleServer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/DR_SHA1.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/DR_SHA1.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/DS_BytePool.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/DS_BytePool.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/DS_ByteQueue.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/DS_ByteQueue.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/DS_HuffmanEncodingTree.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/DS_HuffmanEncodingTree.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/DS_Table.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/DS_Table.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/DataCompressor.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/DataCompressor.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/DirectoryDeltaTransfer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/DirectoryDeltaTransfer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/DynDNS.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/DynDNS.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/EmailSender.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/EmailSender.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/EpochTimeToString.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/EpochTimeToString.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/FileList.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/FileList.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/FileListTransfer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/FileListTransfer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/FileOperations.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/FileOperations.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/FormatString.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/FormatString.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/FullyConnectedMesh2.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/FullyConnectedMesh2.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/GetTime.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/GetTime.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/Getche.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/Getche.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/Gets.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/Gets.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/GridSectorizer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/GridSectorizer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/HTTPConnection.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/HTTPConnection.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/HTTPConnection2.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/HTTPConnection2.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/IncrementalReadInterface.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/IncrementalReadInterface.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/Itoa.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/Itoa.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/LinuxStrings.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/LinuxStrings.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/LocklessTypes.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/LocklessTypes.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/LogCommandParser.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/LogCommandParser.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/MessageFilter.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/MessageFilter.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatPunchthroughClient.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatPunchthroughClient.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatPunchthroughServer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatPunchthroughServer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionClient.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionClient.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionCommon.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionCommon.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionServer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/NatTypeDetectionServer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/NetworkIDManager.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/NetworkIDManager.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/NetworkIDObject.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/NetworkIDObject.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/PS4Includes.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/PS4Includes.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketConsoleLogger.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketConsoleLogger.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketFileLogger.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketFileLogger.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketLogger.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketLogger.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketOutputWindowLogger.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketOutputWindowLogger.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketizedTCP.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/PacketizedTCP.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/PluginInterface2.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/PluginInterface2.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RPC4Plugin.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RPC4Plugin.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/Rackspace.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/Rackspace.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakMemoryOverride.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakMemoryOverride.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetCommandParser.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetCommandParser.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_360_720.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_360_720.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Berkley.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Berkley.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Berkley_NativeClient.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Berkley_NativeClient.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_NativeClient.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_NativeClient.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_PS3_PS4.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_PS3_PS4.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_PS4.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_PS4.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Vita.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Vita.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_WindowsStore8.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_WindowsStore8.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Windows_Linux.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Windows_Linux.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Windows_Linux_360.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetSocket2_Windows_Linux_360.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetStatistics.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetStatistics.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetTransport2.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetTransport2.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetTypes.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakNetTypes.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakPeer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakPeer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakSleep.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakSleep.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakString.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakString.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakThread.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakThread.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakWString.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RakWString.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/Rand.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/Rand.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RandSync.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RandSync.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/ReadyEvent.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/ReadyEvent.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/RelayPlugin.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/RelayPlugin.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/ReliabilityLayer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/ReliabilityLayer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/ReplicaManager3.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/ReplicaManager3.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/Router2.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/Router2.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/SecureHandshake.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/SecureHandshake.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/SendToThread.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/SendToThread.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/SignaledEvent.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/SignaledEvent.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/SimpleMutex.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/SimpleMutex.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/SocketLayer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/SocketLayer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/StatisticsHistory.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/StatisticsHistory.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/StringCompressor.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/StringCompressor.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/StringTable.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/StringTable.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/SuperFastHash.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/SuperFastHash.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/TCPInterface.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/TCPInterface.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/TableSerializer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/TableSerializer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/TeamBalancer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/TeamBalancer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/TeamManager.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/TeamManager.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/TelnetTransport.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/TelnetTransport.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/ThreadsafePacketLogger.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/ThreadsafePacketLogger.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/TwoWayAuthentication.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/TwoWayAuthentication.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/UDPForwarder.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/UDPForwarder.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/UDPProxyClient.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/UDPProxyClient.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/UDPProxyCoordinator.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/UDPProxyCoordinator.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/UDPProxyServer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/UDPProxyServer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/VariableDeltaSerializer.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/VariableDeltaSerializer.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/VariableListDeltaTracker.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/VariableListDeltaTracker.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/VariadicSQLParser.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/VariadicSQLParser.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/VitaIncludes.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/VitaIncludes.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/WSAStartupSingleton.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/WSAStartupSingleton.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/_FindFirst.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/_FindFirst.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/gettimeofday.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/gettimeofday.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/linux_adapter.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/linux_adapter.cpp.o.d"
+  "CMakeFiles/SLikeNet.dir/Source/src/osx_adapter.cpp.o"
+  "CMakeFiles/SLikeNet.dir/Source/src/osx_adapter.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SLikeNet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
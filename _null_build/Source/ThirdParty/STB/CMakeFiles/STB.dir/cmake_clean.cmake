@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libSTB.a"
+  "../../../lib/libSTB.pdb"
+  "CMakeFiles/STB.dir/stb_impl.cpp.o"
+  "CMakeFiles/STB.dir/stb_impl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/STB.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libStanHull.a"
+  "../../../lib/libStanHull.pdb"
+  "CMakeFiles/StanHull.dir/hull.cpp.o"
+  "CMakeFiles/StanHull.dir/hull.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StanHull.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,131 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/WebP/src/dec/alpha_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/alpha_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/alpha_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dec/buffer_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/buffer_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/buffer_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dec/frame_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/frame_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/frame_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dec/idec_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/idec_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/idec_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dec/io_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/io_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/io_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dec/quant_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/quant_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/quant_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dec/tree_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/tree_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/tree_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dec/vp8_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/vp8_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/vp8_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dec/vp8l_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/vp8l_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/vp8l_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dec/webp_dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/webp_dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dec/webp_dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/demux/anim_decode.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/demux/anim_decode.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/demux/anim_decode.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/demux/demux.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/demux/demux.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/demux/demux.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/alpha_processing.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/alpha_processing_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/alpha_processing_neon.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing_neon.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing_neon.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/alpha_processing_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/alpha_processing_sse41.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing_sse41.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/alpha_processing_sse41.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/cost.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cost.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cost.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/cost_mips32.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cost_mips32.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cost_mips32.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/cost_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cost_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cost_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/cost_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cost_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cost_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/cpu.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cpu.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/cpu.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/dec.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/dec_clip_tables.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_clip_tables.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_clip_tables.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/dec_mips32.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_mips32.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_mips32.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/dec_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/dec_msa.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_msa.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_msa.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/dec_neon.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_neon.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_neon.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/dec_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/dec_sse41.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_sse41.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/dec_sse41.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/enc_avx2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_avx2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_avx2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/enc_mips32.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_mips32.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_mips32.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/enc_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/enc_msa.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_msa.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_msa.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/enc_neon.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_neon.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_neon.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/enc_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/enc_sse41.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_sse41.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/enc_sse41.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/filters.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/filters_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/filters_msa.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters_msa.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters_msa.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/filters_neon.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters_neon.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters_neon.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/filters_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/filters_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_enc_mips32.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_mips32.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_mips32.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_enc_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_enc_msa.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_msa.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_msa.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_enc_neon.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_neon.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_neon.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_enc_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_enc_sse41.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_sse41.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_enc_sse41.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_msa.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_msa.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_msa.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_neon.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_neon.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_neon.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/lossless_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/lossless_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/rescaler.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/rescaler_mips32.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_mips32.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_mips32.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/rescaler_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/rescaler_msa.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_msa.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_msa.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/rescaler_neon.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_neon.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_neon.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/rescaler_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/rescaler_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/ssim.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/ssim.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/ssim.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/ssim_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/ssim_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/ssim_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/upsampling.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/upsampling_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/upsampling_msa.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling_msa.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling_msa.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/upsampling_neon.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling_neon.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling_neon.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/upsampling_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/upsampling_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/yuv.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/yuv_mips32.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv_mips32.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv_mips32.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/yuv_mips_dsp_r2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv_mips_dsp_r2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv_mips_dsp_r2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/yuv_neon.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv_neon.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv_neon.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/dsp/yuv_sse2.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv_sse2.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/dsp/yuv_sse2.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/alpha_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/alpha_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/alpha_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/analysis_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/analysis_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/analysis_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/backward_references_cost_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/backward_references_cost_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/backward_references_cost_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/backward_references_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/backward_references_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/backward_references_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/config_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/config_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/config_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/cost_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/cost_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/cost_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/delta_palettization_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/delta_palettization_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/delta_palettization_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/filter_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/filter_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/filter_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/frame_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/frame_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/frame_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/histogram_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/histogram_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/histogram_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/iterator_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/iterator_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/iterator_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/near_lossless_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/near_lossless_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/near_lossless_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/picture_csp_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_csp_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_csp_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/picture_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/picture_psnr_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_psnr_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_psnr_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/picture_rescale_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_rescale_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_rescale_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/picture_tools_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_tools_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/picture_tools_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/predictor_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/predictor_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/predictor_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/quant_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/quant_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/quant_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/syntax_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/syntax_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/syntax_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/token_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/token_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/token_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/tree_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/tree_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/tree_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/vp8l_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/vp8l_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/vp8l_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/enc/webp_enc.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/webp_enc.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/enc/webp_enc.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/mux/anim_encode.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/mux/anim_encode.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/mux/anim_encode.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/mux/muxedit.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/mux/muxedit.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/mux/muxedit.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/mux/muxinternal.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/mux/muxinternal.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/mux/muxinternal.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/mux/muxread.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/mux/muxread.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/mux/muxread.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/bit_reader_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/bit_reader_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/bit_reader_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/bit_writer_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/bit_writer_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/bit_writer_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/color_cache_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/color_cache_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/color_cache_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/filters_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/filters_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/filters_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/huffman_encode_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/huffman_encode_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/huffman_encode_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/huffman_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/huffman_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/huffman_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/quant_levels_dec_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/quant_levels_dec_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/quant_levels_dec_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/quant_levels_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/quant_levels_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/quant_levels_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/random_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/random_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/random_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/rescaler_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/rescaler_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/rescaler_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/thread_utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/thread_utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/thread_utils.c.o.d"
+  "/root/repo/Source/ThirdParty/WebP/src/utils/utils.c" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/utils.c.o" "gcc" "Source/ThirdParty/WebP/CMakeFiles/WebP.dir/src/utils/utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/capstone/MCInst.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/MCInst.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/MCInst.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/MCInstrDesc.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/MCInstrDesc.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/MCInstrDesc.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/MCRegisterInfo.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/MCRegisterInfo.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/MCRegisterInfo.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/SStream.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/SStream.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/SStream.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/AArch64/AArch64BaseInfo.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64BaseInfo.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64BaseInfo.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/AArch64/AArch64Disassembler.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Disassembler.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Disassembler.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/AArch64/AArch64InstPrinter.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64InstPrinter.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64InstPrinter.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/AArch64/AArch64Mapping.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Mapping.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Mapping.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/AArch64/AArch64Module.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Module.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Module.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/ARM/ARMDisassembler.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/ARM/ARMDisassembler.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/ARM/ARMDisassembler.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/ARM/ARMInstPrinter.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/ARM/ARMInstPrinter.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/ARM/ARMInstPrinter.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/ARM/ARMMapping.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/ARM/ARMMapping.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/ARM/ARMMapping.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/ARM/ARMModule.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/ARM/ARMModule.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/ARM/ARMModule.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/X86/X86ATTInstPrinter.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86ATTInstPrinter.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86ATTInstPrinter.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/X86/X86Disassembler.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86Disassembler.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86Disassembler.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/X86/X86DisassemblerDecoder.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86DisassemblerDecoder.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86DisassemblerDecoder.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/X86/X86IntelInstPrinter.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86IntelInstPrinter.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86IntelInstPrinter.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/X86/X86Mapping.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86Mapping.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86Mapping.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/arch/X86/X86Module.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86Module.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/arch/X86/X86Module.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/cs.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/cs.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/cs.c.o.d"
+  "/root/repo/Source/ThirdParty/capstone/utils.c" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/utils.c.o" "gcc" "Source/ThirdParty/capstone/CMakeFiles/capstone-static.dir/utils.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "../../../lib/libcapstone.a"
+  "../../../lib/libcapstone.pdb"
+  "CMakeFiles/capstone-static.dir/MCInst.c.o"
+  "CMakeFiles/capstone-static.dir/MCInst.c.o.d"
+  "CMakeFiles/capstone-static.dir/MCInstrDesc.c.o"
+  "CMakeFiles/capstone-static.dir/MCInstrDesc.c.o.d"
+  "CMakeFiles/capstone-static.dir/MCRegisterInfo.c.o"
+  "CMakeFiles/capstone-static.dir/MCRegisterInfo.c.o.d"
+  "CMakeFiles/capstone-static.dir/SStream.c.o"
+  "CMakeFiles/capstone-static.dir/SStream.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64BaseInfo.c.o"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64BaseInfo.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Disassembler.c.o"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Disassembler.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64InstPrinter.c.o"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64InstPrinter.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Mapping.c.o"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Mapping.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Module.c.o"
+  "CMakeFiles/capstone-static.dir/arch/AArch64/AArch64Module.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/ARM/ARMDisassembler.c.o"
+  "CMakeFiles/capstone-static.dir/arch/ARM/ARMDisassembler.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/ARM/ARMInstPrinter.c.o"
+  "CMakeFiles/capstone-static.dir/arch/ARM/ARMInstPrinter.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/ARM/ARMMapping.c.o"
+  "CMakeFiles/capstone-static.dir/arch/ARM/ARMMapping.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/ARM/ARMModule.c.o"
+  "CMakeFiles/capstone-static.dir/arch/ARM/ARMModule.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86ATTInstPrinter.c.o"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86ATTInstPrinter.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86Disassembler.c.o"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86Disassembler.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86DisassemblerDecoder.c.o"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86DisassemblerDecoder.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86IntelInstPrinter.c.o"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86IntelInstPrinter.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86Mapping.c.o"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86Mapping.c.o.d"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86Module.c.o"
+  "CMakeFiles/capstone-static.dir/arch/X86/X86Module.c.o.d"
+  "CMakeFiles/capstone-static.dir/cs.c.o"
+  "CMakeFiles/capstone-static.dir/cs.c.o.d"
+  "CMakeFiles/capstone-static.dir/utils.c.o"
+  "CMakeFiles/capstone-static.dir/utils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/capstone-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
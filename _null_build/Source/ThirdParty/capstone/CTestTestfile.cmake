@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/Source/ThirdParty/capstone
+# Build directory: /root/repo/_null_build/Source/ThirdParty/capstone
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libcatch2.a"
+  "../../../lib/libcatch2.pdb"
+  "CMakeFiles/catch2.dir/catch2/catch_amalgamated.cpp.o"
+  "CMakeFiles/catch2.dir/catch2/catch_amalgamated.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/catch2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
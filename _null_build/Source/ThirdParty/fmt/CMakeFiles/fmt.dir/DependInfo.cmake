@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/fmt/fmt/format.cc" "Source/ThirdParty/fmt/CMakeFiles/fmt.dir/fmt/format.cc.o" "gcc" "Source/ThirdParty/fmt/CMakeFiles/fmt.dir/fmt/format.cc.o.d"
+  "/root/repo/Source/ThirdParty/fmt/fmt/posix.cc" "Source/ThirdParty/fmt/CMakeFiles/fmt.dir/fmt/posix.cc.o" "gcc" "Source/ThirdParty/fmt/CMakeFiles/fmt.dir/fmt/posix.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libfmt.a"
+  "../../../lib/libfmt.pdb"
+  "CMakeFiles/fmt.dir/fmt/format.cc.o"
+  "CMakeFiles/fmt.dir/fmt/format.cc.o.d"
+  "CMakeFiles/fmt.dir/fmt/posix.cc.o"
+  "CMakeFiles/fmt.dir/fmt/posix.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fmt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/ThirdParty/ik/src/bst_vector.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/bst_vector.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/bst_vector.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/chain_tree.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/chain_tree.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/chain_tree.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/constraint.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/constraint.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/constraint.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/effector.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/effector.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/effector.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/log.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/log.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/log.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/memory.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/memory.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/memory.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/node.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/node.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/node.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/ordered_vector.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/ordered_vector.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/ordered_vector.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/platform/linux/backtrace_linux.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/platform/linux/backtrace_linux.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/platform/linux/backtrace_linux.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/quat.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/quat.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/quat.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/solver.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/solver_1bone.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver_1bone.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver_1bone.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/solver_2bone.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver_2bone.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver_2bone.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/solver_FABRIK.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver_FABRIK.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver_FABRIK.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/solver_MSD.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver_MSD.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/solver_MSD.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/util.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/util.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/util.c.o.d"
+  "/root/repo/Source/ThirdParty/ik/src/vec3.c" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/vec3.c.o" "gcc" "Source/ThirdParty/ik/CMakeFiles/ik.dir/src/vec3.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
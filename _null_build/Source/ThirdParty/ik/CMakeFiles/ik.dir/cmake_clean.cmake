@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "../../../lib/libik.a"
+  "../../../lib/libik.pdb"
+  "CMakeFiles/ik.dir/src/bst_vector.c.o"
+  "CMakeFiles/ik.dir/src/bst_vector.c.o.d"
+  "CMakeFiles/ik.dir/src/chain_tree.c.o"
+  "CMakeFiles/ik.dir/src/chain_tree.c.o.d"
+  "CMakeFiles/ik.dir/src/constraint.c.o"
+  "CMakeFiles/ik.dir/src/constraint.c.o.d"
+  "CMakeFiles/ik.dir/src/effector.c.o"
+  "CMakeFiles/ik.dir/src/effector.c.o.d"
+  "CMakeFiles/ik.dir/src/log.c.o"
+  "CMakeFiles/ik.dir/src/log.c.o.d"
+  "CMakeFiles/ik.dir/src/memory.c.o"
+  "CMakeFiles/ik.dir/src/memory.c.o.d"
+  "CMakeFiles/ik.dir/src/node.c.o"
+  "CMakeFiles/ik.dir/src/node.c.o.d"
+  "CMakeFiles/ik.dir/src/ordered_vector.c.o"
+  "CMakeFiles/ik.dir/src/ordered_vector.c.o.d"
+  "CMakeFiles/ik.dir/src/platform/linux/backtrace_linux.c.o"
+  "CMakeFiles/ik.dir/src/platform/linux/backtrace_linux.c.o.d"
+  "CMakeFiles/ik.dir/src/quat.c.o"
+  "CMakeFiles/ik.dir/src/quat.c.o.d"
+  "CMakeFiles/ik.dir/src/solver.c.o"
+  "CMakeFiles/ik.dir/src/solver.c.o.d"
+  "CMakeFiles/ik.dir/src/solver_1bone.c.o"
+  "CMakeFiles/ik.dir/src/solver_1bone.c.o.d"
+  "CMakeFiles/ik.dir/src/solver_2bone.c.o"
+  "CMakeFiles/ik.dir/src/solver_2bone.c.o.d"
+  "CMakeFiles/ik.dir/src/solver_FABRIK.c.o"
+  "CMakeFiles/ik.dir/src/solver_FABRIK.c.o.d"
+  "CMakeFiles/ik.dir/src/solver_MSD.c.o"
+  "CMakeFiles/ik.dir/src/solver_MSD.c.o.d"
+  "CMakeFiles/ik.dir/src/util.c.o"
+  "CMakeFiles/ik.dir/src/util.c.o.d"
+  "CMakeFiles/ik.dir/src/vec3.c.o"
+  "CMakeFiles/ik.dir/src/vec3.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ik.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
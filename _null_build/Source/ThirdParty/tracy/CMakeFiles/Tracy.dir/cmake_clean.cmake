@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libTracy.a"
+  "../../../lib/libTracy.pdb"
+  "CMakeFiles/Tracy.dir/TracyClientDLL.cpp.o"
+  "CMakeFiles/Tracy.dir/TracyClientDLL.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tracy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,337 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Source/Urho3D/Audio/Audio.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/Audio.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/Audio.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/BufferedSoundStream.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/BufferedSoundStream.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/BufferedSoundStream.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/OggVorbisSoundStream.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/OggVorbisSoundStream.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/OggVorbisSoundStream.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/Sound.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/Sound.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/Sound.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/SoundListener.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundListener.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundListener.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/SoundSource.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundSource.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundSource.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/SoundSource3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundSource3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundSource3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Audio/SoundStream.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundStream.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Audio/SoundStream.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/Allocator.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Allocator.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Allocator.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/RefCounted.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/RefCounted.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/RefCounted.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/Str.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Str.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/Str.cpp.o.d"
+  "/root/repo/Source/Urho3D/Container/ValueCache.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/ValueCache.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Container/ValueCache.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Context.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Context.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Context.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/MiniDump.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/MiniDump.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/MiniDump.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Object.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Object.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Object.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/PluginModule.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/PluginModule.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/PluginModule.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/ProcessUtils.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/ProcessUtils.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/ProcessUtils.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Profiler.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Profiler.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Profiler.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Spline.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Spline.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Spline.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/StringHashRegister.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/StringHashRegister.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/StringHashRegister.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/StringUtils.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/StringUtils.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/StringUtils.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/SubsystemCache.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/SubsystemCache.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/SubsystemCache.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Thread.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Thread.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Thread.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Timer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Timer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Timer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/Variant.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Variant.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/Variant.cpp.o.d"
+  "/root/repo/Source/Urho3D/Core/WorkQueue.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/WorkQueue.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Core/WorkQueue.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/Application.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Application.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Application.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/ApplicationSettings.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/ApplicationSettings.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/ApplicationSettings.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/Engine.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Engine.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/Engine.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/FixedTickScheduler.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/FixedTickScheduler.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/FixedTickScheduler.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/PluginApplication.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/PluginApplication.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/PluginApplication.cpp.o.d"
+  "/root/repo/Source/Urho3D/Engine/PluginStateMigration.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/PluginStateMigration.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Engine/PluginStateMigration.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/AnimatedModel.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimatedModel.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimatedModel.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Animation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Animation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Animation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/AnimationController.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimationController.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimationController.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/AnimationState.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimationState.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/AnimationState.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Batch.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Batch.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Batch.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/BillboardSet.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/BillboardSet.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/BillboardSet.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Camera.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Camera.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Camera.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ConstantBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ConstantBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ConstantBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/CustomGeometry.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/CustomGeometry.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/CustomGeometry.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/DebugRenderer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DebugRenderer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DebugRenderer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/DecalSet.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DecalSet.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DecalSet.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/DepthRasterizer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DepthRasterizer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DepthRasterizer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/DrawCommandQueue.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DrawCommandQueue.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/DrawCommandQueue.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Drawable.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Drawable.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Drawable.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/GPUObject.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GPUObject.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GPUObject.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Geometry.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Geometry.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Geometry.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/GlobalIllumination.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GlobalIllumination.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GlobalIllumination.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Graphics.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Graphics.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Graphics.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/GraphicsDefs.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GraphicsDefs.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/GraphicsDefs.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/HierarchicalLOD.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/HierarchicalLOD.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/HierarchicalLOD.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Impostor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Impostor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Impostor.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/IndexBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/IndexBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/IndexBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Light.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Light.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Light.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/LightBaker.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/LightBaker.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/LightBaker.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/LightProbeGroup.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/LightProbeGroup.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/LightProbeGroup.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Material.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Material.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Material.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Model.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Model.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Model.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ModelView.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ModelView.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ModelView.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullConstantBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullConstantBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullConstantBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullGraphics.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphics.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphics.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullGraphicsImpl.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphicsImpl.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphicsImpl.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullIndexBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullIndexBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullIndexBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullRenderSurface.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullRenderSurface.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullRenderSurface.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullShaderVariation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullShaderVariation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullShaderVariation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTexture.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTexture2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTexture2DArray.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2DArray.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2DArray.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTexture3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullTextureCube.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTextureCube.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullTextureCube.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Null/NullVertexBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullVertexBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Null/NullVertexBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/OcclusionBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/OcclusionBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/OcclusionBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Octree.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Octree.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Octree.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/OctreeQuery.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/OctreeQuery.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/OctreeQuery.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ParticleEffect.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ParticleEffect.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ParticleEffect.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ParticleEmitter.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ParticleEmitter.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ParticleEmitter.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/PipelineState.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/PipelineState.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/PipelineState.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/PipelineStateTracker.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/PipelineStateTracker.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/PipelineStateTracker.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ReflectionProbe.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ReflectionProbe.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ReflectionProbe.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/RenderPath.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RenderPath.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RenderPath.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/RenderSurface.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RenderSurface.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RenderSurface.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Renderer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Renderer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Renderer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/RibbonTrail.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RibbonTrail.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/RibbonTrail.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Shader.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Shader.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Shader.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ShaderConverter.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderConverter.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderConverter.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ShaderPrecache.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderPrecache.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderPrecache.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ShaderProgramLayout.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderProgramLayout.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderProgramLayout.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/ShaderVariation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderVariation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/ShaderVariation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Skeleton.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Skeleton.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Skeleton.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Skybox.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Skybox.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Skybox.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/SoftwareModelAnimator.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/SoftwareModelAnimator.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/SoftwareModelAnimator.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/StaticModel.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/StaticModel.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/StaticModel.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/StaticModelGroup.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/StaticModelGroup.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/StaticModelGroup.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Tangent.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Tangent.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Tangent.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Technique.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Technique.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Technique.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Terrain.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Terrain.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Terrain.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/TerrainPatch.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/TerrainPatch.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/TerrainPatch.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Texture.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Texture2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Texture2DArray.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture2DArray.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture2DArray.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Texture3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Texture3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/TextureCube.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/TextureCube.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/TextureCube.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/VertexBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/VertexBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/VertexBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/View.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/View.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/View.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Viewport.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Viewport.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Viewport.cpp.o.d"
+  "/root/repo/Source/Urho3D/Graphics/Zone.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Zone.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Graphics/Zone.cpp.o.d"
+  "/root/repo/Source/Urho3D/IK/IK.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IK.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IK.cpp.o.d"
+  "/root/repo/Source/Urho3D/IK/IKConstraint.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IKConstraint.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IKConstraint.cpp.o.d"
+  "/root/repo/Source/Urho3D/IK/IKConverters.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IKConverters.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IKConverters.cpp.o.d"
+  "/root/repo/Source/Urho3D/IK/IKEffector.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IKEffector.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IKEffector.cpp.o.d"
+  "/root/repo/Source/Urho3D/IK/IKSolver.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IKSolver.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IK/IKSolver.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/Archive.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Archive.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Archive.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/ArchiveSerialization.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/ArchiveSerialization.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/ArchiveSerialization.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/AsyncFileIO.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/AsyncFileIO.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/AsyncFileIO.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/BinaryArchive.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/BinaryArchive.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/BinaryArchive.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/Compression.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Compression.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Compression.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/Deserializer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Deserializer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Deserializer.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/File.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/File.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/File.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/FileSystem.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/FileSystem.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/FileSystem.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/FileWatcher.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/FileWatcher.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/FileWatcher.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/Log.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Log.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Log.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/MemoryBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/MemoryBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/MemoryBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/MultiFileWatcher.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/MultiFileWatcher.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/MultiFileWatcher.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/NamedPipe.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/NamedPipe.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/NamedPipe.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/PackageFile.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/PackageFile.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/PackageFile.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/Serializer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Serializer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/Serializer.cpp.o.d"
+  "/root/repo/Source/Urho3D/IO/VectorBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/VectorBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/IO/VectorBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Input/Controls.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Input/Controls.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Input/Controls.cpp.o.d"
+  "/root/repo/Source/Urho3D/Input/Input.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Input/Input.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Input/Input.cpp.o.d"
+  "/root/repo/Source/Urho3D/LibraryInfo.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/LibraryInfo.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/LibraryInfo.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/AreaAllocator.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/AreaAllocator.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/AreaAllocator.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/BoundingBox.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/BoundingBox.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/BoundingBox.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Color.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Color.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Color.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Frustum.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Frustum.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Frustum.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/MathDefs.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/MathDefs.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/MathDefs.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Matrix2.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix2.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix2.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Matrix3.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix3.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix3.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Matrix3x4.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix3x4.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix3x4.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Matrix4.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix4.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Matrix4.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/PerlinNoise.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/PerlinNoise.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/PerlinNoise.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Plane.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Plane.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Plane.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Polyhedron.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Polyhedron.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Polyhedron.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Quaternion.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Quaternion.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Quaternion.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Random.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Random.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Random.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/RandomEngine.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/RandomEngine.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/RandomEngine.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Ray.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Ray.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Ray.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Rect.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Rect.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Rect.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Sphere.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Sphere.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Sphere.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/SphericalHarmonics.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/SphericalHarmonics.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/SphericalHarmonics.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/StringHash.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/StringHash.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/StringHash.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/TetrahedralMesh.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/TetrahedralMesh.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/TetrahedralMesh.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Vector2.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector2.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector2.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Vector3.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector3.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector3.cpp.o.d"
+  "/root/repo/Source/Urho3D/Math/Vector4.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector4.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Math/Vector4.cpp.o.d"
+  "/root/repo/Source/Urho3D/Navigation/CrowdAgent.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/CrowdAgent.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/CrowdAgent.cpp.o.d"
+  "/root/repo/Source/Urho3D/Navigation/CrowdManager.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/CrowdManager.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/CrowdManager.cpp.o.d"
+  "/root/repo/Source/Urho3D/Navigation/DynamicNavigationMesh.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/DynamicNavigationMesh.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/DynamicNavigationMesh.cpp.o.d"
+  "/root/repo/Source/Urho3D/Navigation/NavArea.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/NavArea.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/NavArea.cpp.o.d"
+  "/root/repo/Source/Urho3D/Navigation/NavBuildData.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/NavBuildData.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/NavBuildData.cpp.o.d"
+  "/root/repo/Source/Urho3D/Navigation/Navigable.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/Navigable.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/Navigable.cpp.o.d"
+  "/root/repo/Source/Urho3D/Navigation/NavigationMesh.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/NavigationMesh.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/NavigationMesh.cpp.o.d"
+  "/root/repo/Source/Urho3D/Navigation/Obstacle.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/Obstacle.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/Obstacle.cpp.o.d"
+  "/root/repo/Source/Urho3D/Navigation/OffMeshConnection.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/OffMeshConnection.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Navigation/OffMeshConnection.cpp.o.d"
+  "/root/repo/Source/Urho3D/Network/Connection.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/Connection.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/Connection.cpp.o.d"
+  "/root/repo/Source/Urho3D/Network/HttpRequest.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/HttpRequest.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/HttpRequest.cpp.o.d"
+  "/root/repo/Source/Urho3D/Network/Network.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/Network.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/Network.cpp.o.d"
+  "/root/repo/Source/Urho3D/Network/NetworkPriority.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/NetworkPriority.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/NetworkPriority.cpp.o.d"
+  "/root/repo/Source/Urho3D/Network/PackageTransfer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/PackageTransfer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Network/PackageTransfer.cpp.o.d"
+  "/root/repo/Source/Urho3D/Physics/CollisionShape.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/CollisionShape.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/CollisionShape.cpp.o.d"
+  "/root/repo/Source/Urho3D/Physics/Constraint.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/Constraint.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/Constraint.cpp.o.d"
+  "/root/repo/Source/Urho3D/Physics/PhysicsWorld.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/PhysicsWorld.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/PhysicsWorld.cpp.o.d"
+  "/root/repo/Source/Urho3D/Physics/RaycastVehicle.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/RaycastVehicle.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/RaycastVehicle.cpp.o.d"
+  "/root/repo/Source/Urho3D/Physics/RigidBody.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/RigidBody.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Physics/RigidBody.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/AutoExposurePass.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/AutoExposurePass.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/AutoExposurePass.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/BatchCompositor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/BatchCompositor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/BatchCompositor.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/BatchRenderer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/BatchRenderer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/BatchRenderer.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/BatchStateCache.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/BatchStateCache.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/BatchStateCache.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/BloomPass.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/BloomPass.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/BloomPass.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/CameraProcessor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/CameraProcessor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/CameraProcessor.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/DefaultRenderPipeline.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/DefaultRenderPipeline.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/DefaultRenderPipeline.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/DrawableProcessor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/DrawableProcessor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/DrawableProcessor.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/InstancingBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/InstancingBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/InstancingBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/LightClusterProcessor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/LightClusterProcessor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/LightClusterProcessor.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/LightProcessor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/LightProcessor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/LightProcessor.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/LightProcessorQuery.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/LightProcessorQuery.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/LightProcessorQuery.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/LightmapRenderPipeline.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/LightmapRenderPipeline.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/LightmapRenderPipeline.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/PipelineStateBuilder.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/PipelineStateBuilder.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/PipelineStateBuilder.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/PostProcessPass.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/PostProcessPass.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/PostProcessPass.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/RenderBuffer.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderBuffer.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderBuffer.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/RenderBufferManager.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderBufferManager.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderBufferManager.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/RenderPipeline.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipeline.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipeline.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/RenderPipelineDebugger.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipelineDebugger.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipelineDebugger.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/RenderPipelineDefs.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipelineDefs.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipelineDefs.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/ScenePass.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ScenePass.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ScenePass.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/SceneProcessor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/SceneProcessor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/SceneProcessor.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/ShaderProgramCompositor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ShaderProgramCompositor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ShaderProgramCompositor.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/ShadowMapAllocator.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ShadowMapAllocator.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ShadowMapAllocator.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/ShadowReceiverVolume.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ShadowReceiverVolume.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ShadowReceiverVolume.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/ShadowSplitProcessor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ShadowSplitProcessor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ShadowSplitProcessor.cpp.o.d"
+  "/root/repo/Source/Urho3D/RenderPipeline/ToneMappingPass.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ToneMappingPass.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/RenderPipeline/ToneMappingPass.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/BackgroundLoader.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/BackgroundLoader.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/BackgroundLoader.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/BinaryFile.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/BinaryFile.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/BinaryFile.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/Decompress.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Decompress.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Decompress.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/Image.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Image.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Image.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/ImageCube.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/ImageCube.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/ImageCube.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/JSONArchive.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONArchive.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONArchive.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/JSONFile.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONFile.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONFile.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/JSONStreamArchive.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONStreamArchive.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONStreamArchive.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/JSONValue.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONValue.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/JSONValue.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/Localization.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Localization.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Localization.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/PListFile.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/PListFile.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/PListFile.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/Resource.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Resource.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/Resource.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/ResourceCache.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/ResourceCache.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/ResourceCache.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/XMLArchive.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLArchive.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLArchive.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/XMLElement.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLElement.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLElement.cpp.o.d"
+  "/root/repo/Source/Urho3D/Resource/XMLFile.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLFile.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Resource/XMLFile.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Animatable.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Animatable.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Animatable.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/CameraViewport.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/CameraViewport.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/CameraViewport.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Component.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Component.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Component.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/LogicComponent.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/LogicComponent.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/LogicComponent.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Node.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Node.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Node.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/ObjectAnimation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ObjectAnimation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ObjectAnimation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Scene.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Scene.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Scene.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/SceneManager.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SceneManager.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SceneManager.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/SceneResolver.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SceneResolver.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SceneResolver.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/Serializable.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Serializable.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/Serializable.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/SmoothedTransform.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SmoothedTransform.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SmoothedTransform.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/SplinePath.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SplinePath.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/SplinePath.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/UnknownComponent.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/UnknownComponent.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/UnknownComponent.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/ValueAnimation.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ValueAnimation.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ValueAnimation.cpp.o.d"
+  "/root/repo/Source/Urho3D/Scene/ValueAnimationInfo.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ValueAnimationInfo.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Scene/ValueAnimationInfo.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/BorderImage.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/BorderImage.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/BorderImage.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Button.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Button.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Button.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/CheckBox.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/CheckBox.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/CheckBox.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Cursor.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Cursor.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Cursor.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/DropDownList.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/DropDownList.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/DropDownList.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/FileSelector.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FileSelector.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FileSelector.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Font.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Font.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Font.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/FontFace.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFace.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFace.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/FontFaceBitmap.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFaceBitmap.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFaceBitmap.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/FontFaceFreeType.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFaceFreeType.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/FontFaceFreeType.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/LineEdit.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/LineEdit.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/LineEdit.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/ListView.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ListView.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ListView.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Menu.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Menu.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Menu.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/MessageBox.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/MessageBox.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/MessageBox.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/ProgressBar.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ProgressBar.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ProgressBar.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/ScrollBar.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ScrollBar.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ScrollBar.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/ScrollView.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ScrollView.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ScrollView.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Slider.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Slider.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Slider.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Sprite.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Sprite.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Sprite.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Text.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Text.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Text.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Text3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Text3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Text3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/TextRenderer3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/TextRenderer3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/TextRenderer3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/ToolTip.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ToolTip.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/ToolTip.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/UI.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UI.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UI.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/UIBatch.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIBatch.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIBatch.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/UIComponent.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIComponent.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIComponent.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/UIElement.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIElement.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UIElement.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/UISelectable.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UISelectable.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/UISelectable.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/View3D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/View3D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/View3D.cpp.o.d"
+  "/root/repo/Source/Urho3D/UI/Window.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Window.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/UI/Window.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/AnimatedSprite2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/AnimatedSprite2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/AnimatedSprite2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/AnimationSet2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/AnimationSet2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/AnimationSet2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/CollisionBox2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionBox2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionBox2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/CollisionChain2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionChain2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionChain2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/CollisionCircle2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionCircle2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionCircle2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/CollisionEdge2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionEdge2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionEdge2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/CollisionPolygon2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionPolygon2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionPolygon2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/CollisionShape2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionShape2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/CollisionShape2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/Constraint2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Constraint2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Constraint2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintDistance2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintDistance2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintDistance2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintFriction2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintFriction2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintFriction2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintGear2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintGear2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintGear2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintMotor2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintMotor2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintMotor2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintMouse2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintMouse2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintMouse2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintPrismatic2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintPrismatic2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintPrismatic2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintPulley2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintPulley2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintPulley2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintRevolute2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintRevolute2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintRevolute2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintRope2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintRope2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintRope2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintWeld2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintWeld2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintWeld2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ConstraintWheel2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintWheel2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ConstraintWheel2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/Drawable2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Drawable2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Drawable2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ParticleEffect2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ParticleEffect2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ParticleEffect2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/ParticleEmitter2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ParticleEmitter2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/ParticleEmitter2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/PhysicsWorld2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/PhysicsWorld2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/PhysicsWorld2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/Renderer2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Renderer2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Renderer2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/RigidBody2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/RigidBody2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/RigidBody2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/Sprite2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Sprite2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Sprite2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/SpriteSheet2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/SpriteSheet2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/SpriteSheet2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/SpriterData2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/SpriterData2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/SpriterData2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/SpriterInstance2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/SpriterInstance2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/SpriterInstance2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/StaticSprite2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/StaticSprite2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/StaticSprite2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/StretchableSprite2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/StretchableSprite2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/StretchableSprite2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/TileMap2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/TileMap2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/TileMap2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/TileMapDefs2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/TileMapDefs2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/TileMapDefs2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/TileMapLayer2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/TileMapLayer2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/TileMapLayer2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/TmxFile2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/TmxFile2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/TmxFile2D.cpp.o.d"
+  "/root/repo/Source/Urho3D/Urho2D/Urho2D.cpp" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Urho2D.cpp.o" "gcc" "Source/Urho3D/CMakeFiles/Urho3D.dir/Urho2D/Urho2D.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_null_build/Source/ThirdParty/Bullet/CMakeFiles/Bullet.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/FreeType/CMakeFiles/FreeType.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/LZ4/CMakeFiles/LZ4.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/PugiXml/CMakeFiles/PugiXml.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/SDL/CMakeFiles/SDL.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/StanHull/CMakeFiles/StanHull.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/STB/CMakeFiles/STB.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/Civetweb/CMakeFiles/Civetweb.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/SLikeNet/CMakeFiles/SLikeNet.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/ik/CMakeFiles/ik.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/Detour/CMakeFiles/Detour.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/DetourCrowd/CMakeFiles/DetourCrowd.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/DetourTileCache/CMakeFiles/DetourTileCache.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/Recast/CMakeFiles/Recast.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/Box2D/CMakeFiles/Box2D.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/WebP/CMakeFiles/WebP.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/fmt/CMakeFiles/fmt.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/EASTL/CMakeFiles/EASTL.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/ETCPACK/CMakeFiles/ETCPACK.dir/DependInfo.cmake"
+  "/root/repo/_null_build/Source/ThirdParty/tracy/CMakeFiles/Tracy.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,607 @@
+file(REMOVE_RECURSE
+  "../../bin/libUrho3D.pdb"
+  "../../bin/libUrho3D.so"
+  "CMakeFiles/Urho3D.dir/Audio/Audio.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/Audio.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/BufferedSoundStream.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/BufferedSoundStream.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/OggVorbisSoundStream.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/OggVorbisSoundStream.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/Sound.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/Sound.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/SoundListener.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/SoundListener.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/SoundSource.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/SoundSource.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/SoundSource3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/SoundSource3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Audio/SoundStream.cpp.o"
+  "CMakeFiles/Urho3D.dir/Audio/SoundStream.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/Allocator.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/Allocator.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/RefCounted.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/RefCounted.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/Str.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/Str.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Container/ValueCache.cpp.o"
+  "CMakeFiles/Urho3D.dir/Container/ValueCache.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Context.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Context.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/MiniDump.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/MiniDump.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Object.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Object.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/PluginModule.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/PluginModule.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/ProcessUtils.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/ProcessUtils.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Profiler.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Profiler.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Spline.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Spline.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/StringHashRegister.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/StringHashRegister.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/StringUtils.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/StringUtils.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/SubsystemCache.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/SubsystemCache.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Thread.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Thread.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Timer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Timer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/Variant.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/Variant.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Core/WorkQueue.cpp.o"
+  "CMakeFiles/Urho3D.dir/Core/WorkQueue.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/Application.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/Application.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/ApplicationSettings.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/ApplicationSettings.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/Engine.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/Engine.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/FixedTickScheduler.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/FixedTickScheduler.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/PluginApplication.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/PluginApplication.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Engine/PluginStateMigration.cpp.o"
+  "CMakeFiles/Urho3D.dir/Engine/PluginStateMigration.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimatedModel.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimatedModel.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Animation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Animation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimationController.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimationController.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimationState.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/AnimationState.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Batch.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Batch.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/BillboardSet.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/BillboardSet.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Camera.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Camera.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ConstantBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ConstantBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/CustomGeometry.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/CustomGeometry.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/DebugRenderer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/DebugRenderer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/DecalSet.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/DecalSet.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/DepthRasterizer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/DepthRasterizer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/DrawCommandQueue.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/DrawCommandQueue.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Drawable.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Drawable.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/GPUObject.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/GPUObject.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Geometry.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Geometry.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/GlobalIllumination.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/GlobalIllumination.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Graphics.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Graphics.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/GraphicsDefs.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/GraphicsDefs.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/HierarchicalLOD.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/HierarchicalLOD.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Impostor.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Impostor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/IndexBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/IndexBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Light.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Light.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/LightBaker.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/LightBaker.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/LightProbeGroup.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/LightProbeGroup.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Material.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Material.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Model.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Model.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ModelView.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ModelView.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullConstantBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullConstantBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphics.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphics.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphicsImpl.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullGraphicsImpl.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullIndexBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullIndexBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullRenderSurface.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullRenderSurface.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullShaderVariation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullShaderVariation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2DArray.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture2DArray.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTexture3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTextureCube.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullTextureCube.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullVertexBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Null/NullVertexBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/OcclusionBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/OcclusionBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Octree.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Octree.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/OctreeQuery.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/OctreeQuery.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ParticleEffect.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ParticleEffect.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ParticleEmitter.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ParticleEmitter.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/PipelineState.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/PipelineState.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/PipelineStateTracker.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/PipelineStateTracker.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ReflectionProbe.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ReflectionProbe.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/RenderPath.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/RenderPath.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/RenderSurface.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/RenderSurface.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Renderer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Renderer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/RibbonTrail.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/RibbonTrail.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Shader.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Shader.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderConverter.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderConverter.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderPrecache.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderPrecache.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderProgramLayout.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderProgramLayout.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderVariation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/ShaderVariation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Skeleton.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Skeleton.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Skybox.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Skybox.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/SoftwareModelAnimator.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/SoftwareModelAnimator.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/StaticModel.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/StaticModel.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/StaticModelGroup.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/StaticModelGroup.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Tangent.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Tangent.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Technique.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Technique.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Terrain.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Terrain.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/TerrainPatch.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/TerrainPatch.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture2DArray.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture2DArray.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Texture3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/TextureCube.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/TextureCube.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/VertexBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/VertexBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/View.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/View.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Viewport.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Viewport.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Graphics/Zone.cpp.o"
+  "CMakeFiles/Urho3D.dir/Graphics/Zone.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IK/IK.cpp.o"
+  "CMakeFiles/Urho3D.dir/IK/IK.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IK/IKConstraint.cpp.o"
+  "CMakeFiles/Urho3D.dir/IK/IKConstraint.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IK/IKConverters.cpp.o"
+  "CMakeFiles/Urho3D.dir/IK/IKConverters.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IK/IKEffector.cpp.o"
+  "CMakeFiles/Urho3D.dir/IK/IKEffector.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IK/IKSolver.cpp.o"
+  "CMakeFiles/Urho3D.dir/IK/IKSolver.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/Archive.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/Archive.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/ArchiveSerialization.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/ArchiveSerialization.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/AsyncFileIO.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/AsyncFileIO.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/BinaryArchive.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/BinaryArchive.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/Compression.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/Compression.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/Deserializer.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/Deserializer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/File.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/File.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/FileSystem.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/FileSystem.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/FileWatcher.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/FileWatcher.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/Log.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/Log.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/MemoryBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/MemoryBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/MultiFileWatcher.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/MultiFileWatcher.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/NamedPipe.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/NamedPipe.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/PackageFile.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/PackageFile.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/Serializer.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/Serializer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/IO/VectorBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/IO/VectorBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Input/Controls.cpp.o"
+  "CMakeFiles/Urho3D.dir/Input/Controls.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Input/Input.cpp.o"
+  "CMakeFiles/Urho3D.dir/Input/Input.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/LibraryInfo.cpp.o"
+  "CMakeFiles/Urho3D.dir/LibraryInfo.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/AreaAllocator.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/AreaAllocator.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/BoundingBox.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/BoundingBox.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Color.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Color.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Frustum.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Frustum.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/MathDefs.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/MathDefs.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Matrix2.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Matrix2.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Matrix3.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Matrix3.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Matrix3x4.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Matrix3x4.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Matrix4.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Matrix4.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/PerlinNoise.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/PerlinNoise.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Plane.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Plane.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Polyhedron.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Polyhedron.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Quaternion.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Quaternion.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Random.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Random.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/RandomEngine.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/RandomEngine.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Ray.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Ray.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Rect.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Rect.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Sphere.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Sphere.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/SphericalHarmonics.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/SphericalHarmonics.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/StringHash.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/StringHash.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/TetrahedralMesh.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/TetrahedralMesh.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Vector2.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Vector2.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Vector3.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Vector3.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Math/Vector4.cpp.o"
+  "CMakeFiles/Urho3D.dir/Math/Vector4.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Navigation/CrowdAgent.cpp.o"
+  "CMakeFiles/Urho3D.dir/Navigation/CrowdAgent.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Navigation/CrowdManager.cpp.o"
+  "CMakeFiles/Urho3D.dir/Navigation/CrowdManager.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Navigation/DynamicNavigationMesh.cpp.o"
+  "CMakeFiles/Urho3D.dir/Navigation/DynamicNavigationMesh.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Navigation/NavArea.cpp.o"
+  "CMakeFiles/Urho3D.dir/Navigation/NavArea.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Navigation/NavBuildData.cpp.o"
+  "CMakeFiles/Urho3D.dir/Navigation/NavBuildData.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Navigation/Navigable.cpp.o"
+  "CMakeFiles/Urho3D.dir/Navigation/Navigable.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Navigation/NavigationMesh.cpp.o"
+  "CMakeFiles/Urho3D.dir/Navigation/NavigationMesh.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Navigation/Obstacle.cpp.o"
+  "CMakeFiles/Urho3D.dir/Navigation/Obstacle.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Navigation/OffMeshConnection.cpp.o"
+  "CMakeFiles/Urho3D.dir/Navigation/OffMeshConnection.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Network/Connection.cpp.o"
+  "CMakeFiles/Urho3D.dir/Network/Connection.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Network/HttpRequest.cpp.o"
+  "CMakeFiles/Urho3D.dir/Network/HttpRequest.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Network/Network.cpp.o"
+  "CMakeFiles/Urho3D.dir/Network/Network.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Network/NetworkPriority.cpp.o"
+  "CMakeFiles/Urho3D.dir/Network/NetworkPriority.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Network/PackageTransfer.cpp.o"
+  "CMakeFiles/Urho3D.dir/Network/PackageTransfer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Physics/CollisionShape.cpp.o"
+  "CMakeFiles/Urho3D.dir/Physics/CollisionShape.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Physics/Constraint.cpp.o"
+  "CMakeFiles/Urho3D.dir/Physics/Constraint.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Physics/PhysicsWorld.cpp.o"
+  "CMakeFiles/Urho3D.dir/Physics/PhysicsWorld.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Physics/RaycastVehicle.cpp.o"
+  "CMakeFiles/Urho3D.dir/Physics/RaycastVehicle.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Physics/RigidBody.cpp.o"
+  "CMakeFiles/Urho3D.dir/Physics/RigidBody.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/AutoExposurePass.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/AutoExposurePass.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/BatchCompositor.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/BatchCompositor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/BatchRenderer.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/BatchRenderer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/BatchStateCache.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/BatchStateCache.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/BloomPass.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/BloomPass.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/CameraProcessor.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/CameraProcessor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/DefaultRenderPipeline.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/DefaultRenderPipeline.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/DrawableProcessor.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/DrawableProcessor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/InstancingBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/InstancingBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/LightClusterProcessor.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/LightClusterProcessor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/LightProcessor.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/LightProcessor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/LightProcessorQuery.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/LightProcessorQuery.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/LightmapRenderPipeline.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/LightmapRenderPipeline.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/PipelineStateBuilder.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/PipelineStateBuilder.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/PostProcessPass.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/PostProcessPass.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderBuffer.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderBuffer.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderBufferManager.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderBufferManager.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipeline.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipeline.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipelineDebugger.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipelineDebugger.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipelineDefs.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/RenderPipelineDefs.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ScenePass.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ScenePass.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/SceneProcessor.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/SceneProcessor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ShaderProgramCompositor.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ShaderProgramCompositor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ShadowMapAllocator.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ShadowMapAllocator.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ShadowReceiverVolume.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ShadowReceiverVolume.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ShadowSplitProcessor.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ShadowSplitProcessor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ToneMappingPass.cpp.o"
+  "CMakeFiles/Urho3D.dir/RenderPipeline/ToneMappingPass.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/BackgroundLoader.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/BackgroundLoader.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/BinaryFile.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/BinaryFile.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/Decompress.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/Decompress.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/Image.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/Image.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/ImageCube.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/ImageCube.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/JSONArchive.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/JSONArchive.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/JSONFile.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/JSONFile.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/JSONStreamArchive.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/JSONStreamArchive.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/JSONValue.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/JSONValue.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/Localization.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/Localization.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/PListFile.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/PListFile.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/Resource.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/Resource.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/ResourceCache.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/ResourceCache.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/XMLArchive.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/XMLArchive.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/XMLElement.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/XMLElement.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Resource/XMLFile.cpp.o"
+  "CMakeFiles/Urho3D.dir/Resource/XMLFile.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Animatable.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Animatable.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/CameraViewport.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/CameraViewport.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Component.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Component.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/LogicComponent.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/LogicComponent.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Node.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Node.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/ObjectAnimation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/ObjectAnimation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Scene.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Scene.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/SceneManager.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/SceneManager.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/SceneResolver.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/SceneResolver.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/Serializable.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/Serializable.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/SmoothedTransform.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/SmoothedTransform.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/SplinePath.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/SplinePath.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/UnknownComponent.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/UnknownComponent.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/ValueAnimation.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/ValueAnimation.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Scene/ValueAnimationInfo.cpp.o"
+  "CMakeFiles/Urho3D.dir/Scene/ValueAnimationInfo.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/BorderImage.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/BorderImage.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Button.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Button.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/CheckBox.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/CheckBox.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Cursor.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Cursor.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/DropDownList.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/DropDownList.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/FileSelector.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/FileSelector.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Font.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Font.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/FontFace.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/FontFace.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/FontFaceBitmap.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/FontFaceBitmap.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/FontFaceFreeType.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/FontFaceFreeType.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/LineEdit.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/LineEdit.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/ListView.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/ListView.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Menu.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Menu.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/MessageBox.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/MessageBox.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/ProgressBar.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/ProgressBar.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/ScrollBar.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/ScrollBar.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/ScrollView.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/ScrollView.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Slider.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Slider.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Sprite.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Sprite.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Text.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Text.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Text3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Text3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/TextRenderer3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/TextRenderer3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/ToolTip.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/ToolTip.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/UI.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/UI.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/UIBatch.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/UIBatch.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/UIComponent.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/UIComponent.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/UIElement.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/UIElement.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/UISelectable.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/UISelectable.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/View3D.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/View3D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/UI/Window.cpp.o"
+  "CMakeFiles/Urho3D.dir/UI/Window.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/AnimatedSprite2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/AnimatedSprite2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/AnimationSet2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/AnimationSet2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionBox2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionBox2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionChain2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionChain2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionCircle2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionCircle2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionEdge2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionEdge2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionPolygon2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionPolygon2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionShape2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/CollisionShape2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/Constraint2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/Constraint2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintDistance2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintDistance2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintFriction2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintFriction2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintGear2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintGear2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintMotor2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintMotor2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintMouse2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintMouse2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintPrismatic2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintPrismatic2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintPulley2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintPulley2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintRevolute2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintRevolute2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintRope2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintRope2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintWeld2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintWeld2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintWheel2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ConstraintWheel2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/Drawable2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/Drawable2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ParticleEffect2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ParticleEffect2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/ParticleEmitter2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/ParticleEmitter2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/PhysicsWorld2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/PhysicsWorld2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/Renderer2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/Renderer2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/RigidBody2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/RigidBody2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/Sprite2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/Sprite2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/SpriteSheet2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/SpriteSheet2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/SpriterData2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/SpriterData2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/SpriterInstance2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/SpriterInstance2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/StaticSprite2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/StaticSprite2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/StretchableSprite2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/StretchableSprite2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/TileMap2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/TileMap2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/TileMapDefs2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/TileMapDefs2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/TileMapLayer2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/TileMapLayer2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/TmxFile2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/TmxFile2D.cpp.o.d"
+  "CMakeFiles/Urho3D.dir/Urho2D/Urho2D.cpp.o"
+  "CMakeFiles/Urho3D.dir/Urho2D/Urho2D.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Urho3D.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,285 @@
+//
+// Copyright (c) 2008-2017 the Urho3D project.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef URHO3D_API_H
+#define URHO3D_API_H
+
+#ifdef _WIN32
+
+#ifdef _MSC_VER
+#pragma warning(disable: 4251)
+#pragma warning(disable: 4275)
+#endif
+
+#define URHO3D_EXPORT_API __declspec(dllexport)
+
+#ifdef URHO3D_STATIC
+#  define URHO3D_API
+#  define URHO3D_NO_EXPORT
+#else
+#  ifndef URHO3D_API
+#    ifdef URHO3D_EXPORTS
+        /* We are building this library */
+#      define URHO3D_API URHO3D_EXPORT_API
+#    else
+        /* We are using this library */
+#      define URHO3D_API __declspec(dllimport)
+#    endif
+#  endif
+
+#  ifndef URHO3D_NO_EXPORT
+#    define URHO3D_NO_EXPORT
+#  endif
+#endif
+
+#ifndef URHO3D_DEPRECATED
+#  define URHO3D_DEPRECATED __declspec(deprecated)
+#endif
+
+#ifndef URHO3D_DEPRECATED_EXPORT
+#  define URHO3D_DEPRECATED_EXPORT URHO3D_API URHO3D_DEPRECATED
+#endif
+
+#ifndef URHO3D_DEPRECATED_NO_EXPORT
+#  define URHO3D_DEPRECATED_NO_EXPORT URHO3D_NO_EXPORT URHO3D_DEPRECATED
+#endif
+
+#define DEFINE_NO_DEPRECATED 0
+#if DEFINE_NO_DEPRECATED
+# define URHO3D_NO_DEPRECATED
+#endif
+
+#else
+
+#define URHO3D_EXPORT_API __attribute__((visibility("default")))
+
+#ifdef URHO3D_STATIC
+#ifndef URHO3D_API
+#  define URHO3D_API
+#endif
+#  define URHO3D_NO_EXPORT
+#else
+#  define URHO3D_API URHO3D_EXPORT_API
+#  ifndef URHO3D_NO_EXPORT
+#    define URHO3D_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef URHO3D_DEPRECATED
+#  define URHO3D_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef URHO3D_DEPRECATED_EXPORT
+#  define URHO3D_DEPRECATED_EXPORT URHO3D_API URHO3D_DEPRECATED
+#endif
+
+#ifndef URHO3D_DEPRECATED_NO_EXPORT
+#  define URHO3D_DEPRECATED_NO_EXPORT URHO3D_NO_EXPORT URHO3D_DEPRECATED
+#endif
+
+#define DEFINE_NO_DEPRECATED 0
+#if DEFINE_NO_DEPRECATED
+# define URHO3D_NO_DEPRECATED
+#endif
+
+#endif
+
+// Engine configuration
+#ifndef URHO3D_CSHARP_AVAILABLE
+#   define URHO3D_CSHARP_AVAILABLE 1
+#endif
+#ifndef URHO3D_ENABLE_ALL
+#   define URHO3D_ENABLE_ALL 1
+#endif
+#ifndef URHO3D_EXTRAS_AVAILABLE
+#   define URHO3D_EXTRAS_AVAILABLE 1
+#endif
+#ifndef URHO3D_FILEWATCHER
+#   define URHO3D_FILEWATCHER 1
+#endif
+#ifndef URHO3D_FILEWATCHER_AVAILABLE
+#   define URHO3D_FILEWATCHER_AVAILABLE 1
+#endif
+#ifndef URHO3D_GLOW_AVAILABLE
+#   define URHO3D_GLOW_AVAILABLE 1
+#endif
+#ifndef URHO3D_HASH_DEBUG
+#   define URHO3D_HASH_DEBUG 1
+#endif
+#ifndef URHO3D_IK
+#   define URHO3D_IK 1
+#endif
+#ifndef URHO3D_LOGGING
+#   define URHO3D_LOGGING 1
+#endif
+#ifndef URHO3D_NAVIGATION
+#   define URHO3D_NAVIGATION 1
+#endif
+#ifndef URHO3D_NETWORK
+#   define URHO3D_NETWORK 1
+#endif
+#ifndef URHO3D_NETWORK_AVAILABLE
+#   define URHO3D_NETWORK_AVAILABLE 1
+#endif
+#ifndef URHO3D_NULL_GRAPHICS
+#   define URHO3D_NULL_GRAPHICS 1
+#endif
+#ifndef URHO3D_PCH_AVAILABLE
+#   define URHO3D_PCH_AVAILABLE 1
+#endif
+#ifndef URHO3D_PHYSICS
+#   define URHO3D_PHYSICS 1
+#endif
+#ifndef URHO3D_PLAYER_AVAILABLE
+#   define URHO3D_PLAYER_AVAILABLE 1
+#endif
+#ifndef URHO3D_PLUGINS
+#   define URHO3D_PLUGINS 1
+#endif
+#ifndef URHO3D_PLUGINS_AVAILABLE
+#   define URHO3D_PLUGINS_AVAILABLE 1
+#endif
+#ifndef URHO3D_PROFILING
+#   define URHO3D_PROFILING 1
+#endif
+#ifndef URHO3D_PROFILING_AVAILABLE
+#   define URHO3D_PROFILING_AVAILABLE 1
+#endif
+#ifndef URHO3D_PROFILING_SYSTRACE_AVAILABLE
+#   define URHO3D_PROFILING_SYSTRACE_AVAILABLE 1
+#endif
+#ifndef URHO3D_SPHERICAL_HARMONICS
+#   define URHO3D_SPHERICAL_HARMONICS 1
+#endif
+#ifndef URHO3D_TESTING
+#   define URHO3D_TESTING 1
+#endif
+#ifndef URHO3D_TESTING_AVAILABLE
+#   define URHO3D_TESTING_AVAILABLE 1
+#endif
+#ifndef URHO3D_THREADING
+#   define URHO3D_THREADING 1
+#endif
+#ifndef URHO3D_THREADING_AVAILABLE
+#   define URHO3D_THREADING_AVAILABLE 1
+#endif
+#ifndef URHO3D_TOOLS_AVAILABLE
+#   define URHO3D_TOOLS_AVAILABLE 1
+#endif
+#ifndef URHO3D_URHO2D
+#   define URHO3D_URHO2D 1
+#endif
+#ifndef URHO3D_WEBP
+#   define URHO3D_WEBP 1
+#endif
+#ifndef NOMINMAX
+#   define NOMINMAX 1
+#endif
+#ifndef URHO3D_DEBUG
+#   define URHO3D_DEBUG 1
+#endif
+#ifndef LINUX
+#   define LINUX 1
+#endif
+#ifndef DESKTOP
+#   define DESKTOP 1
+#endif
+#ifndef LZ4_DLL_IMPORT
+#   define LZ4_DLL_IMPORT 1
+#endif
+#ifndef PUGIXML_IMPORTS
+#   define PUGIXML_IMPORTS 1
+#endif
+#ifndef STB_VORBIS_HEADER_ONLY
+#   define STB_VORBIS_HEADER_ONLY 1
+#endif
+#ifndef CIVETWEB_DLL_IMPORTS
+#   define CIVETWEB_DLL_IMPORTS 1
+#endif
+#ifndef IK_STATIC
+#   define IK_STATIC 1
+#endif
+#ifndef BOX2D_IMPORTS
+#   define BOX2D_IMPORTS 1
+#endif
+#ifndef FMT_USE_RVALUE_REFERENCES
+#   define FMT_USE_RVALUE_REFERENCES 1
+#endif
+#ifndef FMT_USE_VARIADIC_TEMPLATES
+#   define FMT_USE_VARIADIC_TEMPLATES 1
+#endif
+#ifndef FMT_SHARED
+#   define FMT_SHARED 1
+#endif
+#ifndef SPDLOG_FMT_EXTERNAL
+#   define SPDLOG_FMT_EXTERNAL 1
+#endif
+#ifndef SPDLOG_DISABLE_DEFAULT_LOGGER
+#   define SPDLOG_DISABLE_DEFAULT_LOGGER 1
+#endif
+#ifndef EASTL_OPENSOURCE
+#   define EASTL_OPENSOURCE 1
+#endif
+#ifndef EASTL_RTTI_ENABLED
+#   define EASTL_RTTI_ENABLED 0
+#endif
+#ifndef EASTL_URHO3D_EXTENSIONS
+#   define EASTL_URHO3D_EXTENSIONS 1
+#endif
+#ifndef EASTL_SIZE_T_32BIT
+#   define EASTL_SIZE_T_32BIT 1
+#endif
+#ifndef EASTDC_GLOBALPTR_SUPPORT_ENABLED
+#   define EASTDC_GLOBALPTR_SUPPORT_ENABLED 0
+#endif
+#ifndef EASTDC_THREADING_SUPPORTED
+#   define EASTDC_THREADING_SUPPORTED 0
+#endif
+#ifndef EASTL_STD_ITERATOR_CATEGORY_ENABLED
+#   define EASTL_STD_ITERATOR_CATEGORY_ENABLED 1
+#endif
+#ifndef EA_DLL
+#   define EA_DLL 1
+#endif
+#ifndef URHO3D_SSE
+#   define URHO3D_SSE 1
+#endif
+#ifndef HAVE_MALLOC_USABLE_SIZE
+#   define HAVE_MALLOC_USABLE_SIZE 1
+#endif
+#ifndef HAVE_STDINT_H
+#   define HAVE_STDINT_H 1
+#endif
+#ifndef HAVE_INTTYPES_H
+#   define HAVE_INTTYPES_H 1
+#endif
+#ifndef HAVE_MALLOC_H
+#   define HAVE_MALLOC_H 1
+#endif
+
+
+// Disable SSE if compiler does not support it.
+#if defined(URHO3D_SSE) && !defined(__SSE2__) && (!defined(_M_IX86_FP) || _M_IX86_FP < 2)
+#   undef URHO3D_SSE
+#endif
+
+#endif
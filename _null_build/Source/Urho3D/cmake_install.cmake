@@ -0,0 +1,515 @@
+# Install script for directory: /root/repo/Source/Urho3D
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Container" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Container/Allocator.h"
+    "/root/repo/Source/Urho3D/Container/Array2D.h"
+    "/root/repo/Source/Urho3D/Container/ByteVector.h"
+    "/root/repo/Source/Urho3D/Container/ConstString.h"
+    "/root/repo/Source/Urho3D/Container/FlagSet.h"
+    "/root/repo/Source/Urho3D/Container/Hash.h"
+    "/root/repo/Source/Urho3D/Container/IndexAllocator.h"
+    "/root/repo/Source/Urho3D/Container/LegacyAdapters.h"
+    "/root/repo/Source/Urho3D/Container/MultiVector.h"
+    "/root/repo/Source/Urho3D/Container/Ptr.h"
+    "/root/repo/Source/Urho3D/Container/RefCounted.h"
+    "/root/repo/Source/Urho3D/Container/Str.h"
+    "/root/repo/Source/Urho3D/Container/ValueCache.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Core" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Core/Attribute.h"
+    "/root/repo/Source/Urho3D/Core/CommandLine.h"
+    "/root/repo/Source/Urho3D/Core/Condition.h"
+    "/root/repo/Source/Urho3D/Core/Context.h"
+    "/root/repo/Source/Urho3D/Core/CoreEvents.h"
+    "/root/repo/Source/Urho3D/Core/IteratorRange.h"
+    "/root/repo/Source/Urho3D/Core/Macros.h"
+    "/root/repo/Source/Urho3D/Core/Main.h"
+    "/root/repo/Source/Urho3D/Core/MiniDump.h"
+    "/root/repo/Source/Urho3D/Core/Mutex.h"
+    "/root/repo/Source/Urho3D/Core/NonCopyable.h"
+    "/root/repo/Source/Urho3D/Core/Object.h"
+    "/root/repo/Source/Urho3D/Core/PE.h"
+    "/root/repo/Source/Urho3D/Core/PluginModule.h"
+    "/root/repo/Source/Urho3D/Core/ProcessUtils.h"
+    "/root/repo/Source/Urho3D/Core/Profiler.h"
+    "/root/repo/Source/Urho3D/Core/Signal.h"
+    "/root/repo/Source/Urho3D/Core/Spline.h"
+    "/root/repo/Source/Urho3D/Core/StopToken.h"
+    "/root/repo/Source/Urho3D/Core/StringHashRegister.h"
+    "/root/repo/Source/Urho3D/Core/StringUtils.h"
+    "/root/repo/Source/Urho3D/Core/SubsystemCache.h"
+    "/root/repo/Source/Urho3D/Core/Thread.h"
+    "/root/repo/Source/Urho3D/Core/ThreadSafeCache.h"
+    "/root/repo/Source/Urho3D/Core/Timer.h"
+    "/root/repo/Source/Urho3D/Core/TupleUtils.h"
+    "/root/repo/Source/Urho3D/Core/TypeTrait.h"
+    "/root/repo/Source/Urho3D/Core/Variant.h"
+    "/root/repo/Source/Urho3D/Core/WorkQueue.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/IO" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/IO/AbstractFile.h"
+    "/root/repo/Source/Urho3D/IO/Archive.h"
+    "/root/repo/Source/Urho3D/IO/ArchiveSerialization.h"
+    "/root/repo/Source/Urho3D/IO/AsyncFileIO.h"
+    "/root/repo/Source/Urho3D/IO/BinaryArchive.h"
+    "/root/repo/Source/Urho3D/IO/Compression.h"
+    "/root/repo/Source/Urho3D/IO/Deserializer.h"
+    "/root/repo/Source/Urho3D/IO/File.h"
+    "/root/repo/Source/Urho3D/IO/FileSystem.h"
+    "/root/repo/Source/Urho3D/IO/FileWatcher.h"
+    "/root/repo/Source/Urho3D/IO/IOEvents.h"
+    "/root/repo/Source/Urho3D/IO/Log.h"
+    "/root/repo/Source/Urho3D/IO/MacFileWatcher.h"
+    "/root/repo/Source/Urho3D/IO/MemoryBuffer.h"
+    "/root/repo/Source/Urho3D/IO/MultiFileWatcher.h"
+    "/root/repo/Source/Urho3D/IO/NamedPipe.h"
+    "/root/repo/Source/Urho3D/IO/PackageFile.h"
+    "/root/repo/Source/Urho3D/IO/RWOpsWrapper.h"
+    "/root/repo/Source/Urho3D/IO/Serializer.h"
+    "/root/repo/Source/Urho3D/IO/VectorBuffer.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Math" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Math/AreaAllocator.h"
+    "/root/repo/Source/Urho3D/Math/BoundingBox.h"
+    "/root/repo/Source/Urho3D/Math/Color.h"
+    "/root/repo/Source/Urho3D/Math/Frustum.h"
+    "/root/repo/Source/Urho3D/Math/MathDefs.h"
+    "/root/repo/Source/Urho3D/Math/Matrix2.h"
+    "/root/repo/Source/Urho3D/Math/Matrix3.h"
+    "/root/repo/Source/Urho3D/Math/Matrix3x4.h"
+    "/root/repo/Source/Urho3D/Math/Matrix4.h"
+    "/root/repo/Source/Urho3D/Math/NumericRange.h"
+    "/root/repo/Source/Urho3D/Math/PerlinNoise.h"
+    "/root/repo/Source/Urho3D/Math/Plane.h"
+    "/root/repo/Source/Urho3D/Math/Polyhedron.h"
+    "/root/repo/Source/Urho3D/Math/Quaternion.h"
+    "/root/repo/Source/Urho3D/Math/Random.h"
+    "/root/repo/Source/Urho3D/Math/RandomEngine.h"
+    "/root/repo/Source/Urho3D/Math/Ray.h"
+    "/root/repo/Source/Urho3D/Math/Rect.h"
+    "/root/repo/Source/Urho3D/Math/Sphere.h"
+    "/root/repo/Source/Urho3D/Math/SphericalHarmonics.h"
+    "/root/repo/Source/Urho3D/Math/StringHash.h"
+    "/root/repo/Source/Urho3D/Math/TetrahedralMesh.h"
+    "/root/repo/Source/Urho3D/Math/Vector2.h"
+    "/root/repo/Source/Urho3D/Math/Vector3.h"
+    "/root/repo/Source/Urho3D/Math/Vector4.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Audio" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Audio/Audio.h"
+    "/root/repo/Source/Urho3D/Audio/AudioDefs.h"
+    "/root/repo/Source/Urho3D/Audio/AudioEvents.h"
+    "/root/repo/Source/Urho3D/Audio/BufferedSoundStream.h"
+    "/root/repo/Source/Urho3D/Audio/OggVorbisSoundStream.h"
+    "/root/repo/Source/Urho3D/Audio/Sound.h"
+    "/root/repo/Source/Urho3D/Audio/SoundListener.h"
+    "/root/repo/Source/Urho3D/Audio/SoundSource.h"
+    "/root/repo/Source/Urho3D/Audio/SoundSource3D.h"
+    "/root/repo/Source/Urho3D/Audio/SoundStream.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Engine" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Engine/Application.h"
+    "/root/repo/Source/Urho3D/Engine/ApplicationSettings.h"
+    "/root/repo/Source/Urho3D/Engine/Engine.h"
+    "/root/repo/Source/Urho3D/Engine/EngineDefs.h"
+    "/root/repo/Source/Urho3D/Engine/EngineEvents.h"
+    "/root/repo/Source/Urho3D/Engine/FixedTickScheduler.h"
+    "/root/repo/Source/Urho3D/Engine/PluginApplication.h"
+    "/root/repo/Source/Urho3D/Engine/PluginStateMigration.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Input" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Input/Controls.h"
+    "/root/repo/Source/Urho3D/Input/Input.h"
+    "/root/repo/Source/Urho3D/Input/InputConstants.h"
+    "/root/repo/Source/Urho3D/Input/InputEvents.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/RenderPipeline" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/RenderPipeline/AutoExposurePass.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/BatchCompositor.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/BatchRenderer.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/BatchStateCache.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/BloomPass.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/CameraProcessor.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/DefaultRenderPipeline.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/DrawableProcessor.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/InstancingBuffer.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/LightAccumulator.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/LightClusterProcessor.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/LightProcessor.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/LightProcessorQuery.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/LightmapRenderPipeline.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/PipelineBatchSortKey.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/PipelineStateBuilder.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/PostProcessPass.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/RenderBuffer.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/RenderBufferManager.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/RenderPipeline.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/RenderPipelineDebugger.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/RenderPipelineDefs.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/ScenePass.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/SceneProcessor.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/ShaderConsts.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/ShaderProgramCompositor.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/ShadowMapAllocator.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/ShadowReceiverVolume.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/ShadowSplitProcessor.h"
+    "/root/repo/Source/Urho3D/RenderPipeline/ToneMappingPass.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Resource" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Resource/BackgroundLoader.h"
+    "/root/repo/Source/Urho3D/Resource/BinaryFile.h"
+    "/root/repo/Source/Urho3D/Resource/Decompress.h"
+    "/root/repo/Source/Urho3D/Resource/Image.h"
+    "/root/repo/Source/Urho3D/Resource/ImageCube.h"
+    "/root/repo/Source/Urho3D/Resource/JSONArchive.h"
+    "/root/repo/Source/Urho3D/Resource/JSONFile.h"
+    "/root/repo/Source/Urho3D/Resource/JSONStreamArchive.h"
+    "/root/repo/Source/Urho3D/Resource/JSONValue.h"
+    "/root/repo/Source/Urho3D/Resource/Localization.h"
+    "/root/repo/Source/Urho3D/Resource/PListFile.h"
+    "/root/repo/Source/Urho3D/Resource/Resource.h"
+    "/root/repo/Source/Urho3D/Resource/ResourceCache.h"
+    "/root/repo/Source/Urho3D/Resource/ResourceEvents.h"
+    "/root/repo/Source/Urho3D/Resource/XMLArchive.h"
+    "/root/repo/Source/Urho3D/Resource/XMLElement.h"
+    "/root/repo/Source/Urho3D/Resource/XMLFile.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Scene" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Scene/Animatable.h"
+    "/root/repo/Source/Urho3D/Scene/AnimationDefs.h"
+    "/root/repo/Source/Urho3D/Scene/CameraViewport.h"
+    "/root/repo/Source/Urho3D/Scene/Component.h"
+    "/root/repo/Source/Urho3D/Scene/LogicComponent.h"
+    "/root/repo/Source/Urho3D/Scene/Node.h"
+    "/root/repo/Source/Urho3D/Scene/ObjectAnimation.h"
+    "/root/repo/Source/Urho3D/Scene/ReplicationState.h"
+    "/root/repo/Source/Urho3D/Scene/Scene.h"
+    "/root/repo/Source/Urho3D/Scene/SceneEvents.h"
+    "/root/repo/Source/Urho3D/Scene/SceneManager.h"
+    "/root/repo/Source/Urho3D/Scene/SceneResolver.h"
+    "/root/repo/Source/Urho3D/Scene/Serializable.h"
+    "/root/repo/Source/Urho3D/Scene/SmoothedTransform.h"
+    "/root/repo/Source/Urho3D/Scene/SplinePath.h"
+    "/root/repo/Source/Urho3D/Scene/UnknownComponent.h"
+    "/root/repo/Source/Urho3D/Scene/ValueAnimation.h"
+    "/root/repo/Source/Urho3D/Scene/ValueAnimationInfo.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/UI" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/UI/BorderImage.h"
+    "/root/repo/Source/Urho3D/UI/Button.h"
+    "/root/repo/Source/Urho3D/UI/CheckBox.h"
+    "/root/repo/Source/Urho3D/UI/Cursor.h"
+    "/root/repo/Source/Urho3D/UI/DropDownList.h"
+    "/root/repo/Source/Urho3D/UI/FileSelector.h"
+    "/root/repo/Source/Urho3D/UI/Font.h"
+    "/root/repo/Source/Urho3D/UI/FontFace.h"
+    "/root/repo/Source/Urho3D/UI/FontFaceBitmap.h"
+    "/root/repo/Source/Urho3D/UI/FontFaceFreeType.h"
+    "/root/repo/Source/Urho3D/UI/LineEdit.h"
+    "/root/repo/Source/Urho3D/UI/ListView.h"
+    "/root/repo/Source/Urho3D/UI/Menu.h"
+    "/root/repo/Source/Urho3D/UI/MessageBox.h"
+    "/root/repo/Source/Urho3D/UI/ProgressBar.h"
+    "/root/repo/Source/Urho3D/UI/ScrollBar.h"
+    "/root/repo/Source/Urho3D/UI/ScrollView.h"
+    "/root/repo/Source/Urho3D/UI/Slider.h"
+    "/root/repo/Source/Urho3D/UI/Sprite.h"
+    "/root/repo/Source/Urho3D/UI/Text.h"
+    "/root/repo/Source/Urho3D/UI/Text3D.h"
+    "/root/repo/Source/Urho3D/UI/TextRenderer3D.h"
+    "/root/repo/Source/Urho3D/UI/ToolTip.h"
+    "/root/repo/Source/Urho3D/UI/UI.h"
+    "/root/repo/Source/Urho3D/UI/UIBatch.h"
+    "/root/repo/Source/Urho3D/UI/UIComponent.h"
+    "/root/repo/Source/Urho3D/UI/UIElement.h"
+    "/root/repo/Source/Urho3D/UI/UIEvents.h"
+    "/root/repo/Source/Urho3D/UI/UISelectable.h"
+    "/root/repo/Source/Urho3D/UI/View3D.h"
+    "/root/repo/Source/Urho3D/UI/Window.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/." TYPE FILE FILES
+    "/root/repo/Source/Urho3D/DebugNew.h"
+    "/root/repo/Source/Urho3D/LibraryInfo.h"
+    "/root/repo/Source/Urho3D/Precompiled.h"
+    "/root/repo/Source/Urho3D/Urho3DConfig.h"
+    "/root/repo/Source/Urho3D/WindowsSupport.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Graphics" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Graphics/AnimatedModel.h"
+    "/root/repo/Source/Urho3D/Graphics/Animation.h"
+    "/root/repo/Source/Urho3D/Graphics/AnimationController.h"
+    "/root/repo/Source/Urho3D/Graphics/AnimationState.h"
+    "/root/repo/Source/Urho3D/Graphics/Batch.h"
+    "/root/repo/Source/Urho3D/Graphics/BillboardSet.h"
+    "/root/repo/Source/Urho3D/Graphics/Camera.h"
+    "/root/repo/Source/Urho3D/Graphics/ConstantBuffer.h"
+    "/root/repo/Source/Urho3D/Graphics/ConstantBufferCollection.h"
+    "/root/repo/Source/Urho3D/Graphics/CustomGeometry.h"
+    "/root/repo/Source/Urho3D/Graphics/DebugRenderer.h"
+    "/root/repo/Source/Urho3D/Graphics/DecalSet.h"
+    "/root/repo/Source/Urho3D/Graphics/DepthRasterizer.h"
+    "/root/repo/Source/Urho3D/Graphics/DrawCommandQueue.h"
+    "/root/repo/Source/Urho3D/Graphics/Drawable.h"
+    "/root/repo/Source/Urho3D/Graphics/DrawableEvents.h"
+    "/root/repo/Source/Urho3D/Graphics/GPUObject.h"
+    "/root/repo/Source/Urho3D/Graphics/Geometry.h"
+    "/root/repo/Source/Urho3D/Graphics/GlobalIllumination.h"
+    "/root/repo/Source/Urho3D/Graphics/Graphics.h"
+    "/root/repo/Source/Urho3D/Graphics/GraphicsDefs.h"
+    "/root/repo/Source/Urho3D/Graphics/GraphicsEvents.h"
+    "/root/repo/Source/Urho3D/Graphics/HierarchicalLOD.h"
+    "/root/repo/Source/Urho3D/Graphics/Impostor.h"
+    "/root/repo/Source/Urho3D/Graphics/IndexBuffer.h"
+    "/root/repo/Source/Urho3D/Graphics/Light.h"
+    "/root/repo/Source/Urho3D/Graphics/LightBaker.h"
+    "/root/repo/Source/Urho3D/Graphics/LightBakingSettings.h"
+    "/root/repo/Source/Urho3D/Graphics/LightProbeGroup.h"
+    "/root/repo/Source/Urho3D/Graphics/Material.h"
+    "/root/repo/Source/Urho3D/Graphics/Model.h"
+    "/root/repo/Source/Urho3D/Graphics/ModelView.h"
+    "/root/repo/Source/Urho3D/Graphics/OcclusionBuffer.h"
+    "/root/repo/Source/Urho3D/Graphics/Octree.h"
+    "/root/repo/Source/Urho3D/Graphics/OctreeQuery.h"
+    "/root/repo/Source/Urho3D/Graphics/ParticleEffect.h"
+    "/root/repo/Source/Urho3D/Graphics/ParticleEmitter.h"
+    "/root/repo/Source/Urho3D/Graphics/PipelineState.h"
+    "/root/repo/Source/Urho3D/Graphics/PipelineStateTracker.h"
+    "/root/repo/Source/Urho3D/Graphics/ReflectionProbe.h"
+    "/root/repo/Source/Urho3D/Graphics/RenderPath.h"
+    "/root/repo/Source/Urho3D/Graphics/RenderSurface.h"
+    "/root/repo/Source/Urho3D/Graphics/Renderer.h"
+    "/root/repo/Source/Urho3D/Graphics/RibbonTrail.h"
+    "/root/repo/Source/Urho3D/Graphics/Shader.h"
+    "/root/repo/Source/Urho3D/Graphics/ShaderConverter.h"
+    "/root/repo/Source/Urho3D/Graphics/ShaderDefineArray.h"
+    "/root/repo/Source/Urho3D/Graphics/ShaderParameterCollection.h"
+    "/root/repo/Source/Urho3D/Graphics/ShaderPrecache.h"
+    "/root/repo/Source/Urho3D/Graphics/ShaderProgram.h"
+    "/root/repo/Source/Urho3D/Graphics/ShaderProgramLayout.h"
+    "/root/repo/Source/Urho3D/Graphics/ShaderVariation.h"
+    "/root/repo/Source/Urho3D/Graphics/Skeleton.h"
+    "/root/repo/Source/Urho3D/Graphics/Skybox.h"
+    "/root/repo/Source/Urho3D/Graphics/SoftwareModelAnimator.h"
+    "/root/repo/Source/Urho3D/Graphics/StaticModel.h"
+    "/root/repo/Source/Urho3D/Graphics/StaticModelGroup.h"
+    "/root/repo/Source/Urho3D/Graphics/Tangent.h"
+    "/root/repo/Source/Urho3D/Graphics/Technique.h"
+    "/root/repo/Source/Urho3D/Graphics/Terrain.h"
+    "/root/repo/Source/Urho3D/Graphics/TerrainPatch.h"
+    "/root/repo/Source/Urho3D/Graphics/Texture.h"
+    "/root/repo/Source/Urho3D/Graphics/Texture2D.h"
+    "/root/repo/Source/Urho3D/Graphics/Texture2DArray.h"
+    "/root/repo/Source/Urho3D/Graphics/Texture3D.h"
+    "/root/repo/Source/Urho3D/Graphics/TextureCube.h"
+    "/root/repo/Source/Urho3D/Graphics/VertexBuffer.h"
+    "/root/repo/Source/Urho3D/Graphics/VertexDeclaration.h"
+    "/root/repo/Source/Urho3D/Graphics/View.h"
+    "/root/repo/Source/Urho3D/Graphics/Viewport.h"
+    "/root/repo/Source/Urho3D/Graphics/Zone.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Graphics/Null" TYPE FILE FILES "/root/repo/Source/Urho3D/Graphics/Null/NullShaderProgram.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/IK" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/IK/IK.h"
+    "/root/repo/Source/Urho3D/IK/IKConstraint.h"
+    "/root/repo/Source/Urho3D/IK/IKEffector.h"
+    "/root/repo/Source/Urho3D/IK/IKEvents.h"
+    "/root/repo/Source/Urho3D/IK/IKSolver.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Navigation" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Navigation/CrowdAgent.h"
+    "/root/repo/Source/Urho3D/Navigation/CrowdManager.h"
+    "/root/repo/Source/Urho3D/Navigation/DynamicNavigationMesh.h"
+    "/root/repo/Source/Urho3D/Navigation/NavArea.h"
+    "/root/repo/Source/Urho3D/Navigation/NavBuildData.h"
+    "/root/repo/Source/Urho3D/Navigation/Navigable.h"
+    "/root/repo/Source/Urho3D/Navigation/NavigationEvents.h"
+    "/root/repo/Source/Urho3D/Navigation/NavigationMesh.h"
+    "/root/repo/Source/Urho3D/Navigation/Obstacle.h"
+    "/root/repo/Source/Urho3D/Navigation/OffMeshConnection.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Network" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Network/Connection.h"
+    "/root/repo/Source/Urho3D/Network/HttpRequest.h"
+    "/root/repo/Source/Urho3D/Network/Network.h"
+    "/root/repo/Source/Urho3D/Network/NetworkEvents.h"
+    "/root/repo/Source/Urho3D/Network/NetworkPriority.h"
+    "/root/repo/Source/Urho3D/Network/PackageTransfer.h"
+    "/root/repo/Source/Urho3D/Network/Protocol.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Physics" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Physics/CollisionShape.h"
+    "/root/repo/Source/Urho3D/Physics/Constraint.h"
+    "/root/repo/Source/Urho3D/Physics/PhysicsEvents.h"
+    "/root/repo/Source/Urho3D/Physics/PhysicsUtils.h"
+    "/root/repo/Source/Urho3D/Physics/PhysicsWorld.h"
+    "/root/repo/Source/Urho3D/Physics/RaycastVehicle.h"
+    "/root/repo/Source/Urho3D/Physics/RigidBody.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D/Urho2D" TYPE FILE FILES
+    "/root/repo/Source/Urho3D/Urho2D/AnimatedSprite2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/AnimationSet2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/CollisionBox2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/CollisionChain2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/CollisionCircle2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/CollisionEdge2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/CollisionPolygon2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/CollisionShape2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/Constraint2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintDistance2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintFriction2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintGear2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintMotor2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintMouse2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintPrismatic2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintPulley2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintRevolute2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintRope2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintWeld2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ConstraintWheel2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/Drawable2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ParticleEffect2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/ParticleEmitter2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/PhysicsEvents2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/PhysicsUtils2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/PhysicsWorld2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/Renderer2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/RigidBody2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/Sprite2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/SpriteSheet2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/SpriterData2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/SpriterInstance2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/StaticSprite2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/StretchableSprite2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/TileMap2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/TileMapDefs2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/TileMapLayer2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/TmxFile2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/Urho2D.h"
+    "/root/repo/Source/Urho3D/Urho2D/Urho2DEvents.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/libUrho3D.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/libUrho3D.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/libUrho3D.so"
+         RPATH "$ORIGIN")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE SHARED_LIBRARY FILES "/root/repo/_null_build/bin/libUrho3D.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/libUrho3D.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/libUrho3D.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/libUrho3D.so"
+         OLD_RPATH ":::::::"
+         NEW_RPATH "$ORIGIN")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/libUrho3D.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Urho3D" TYPE FILE FILES "/root/repo/_null_build/Source/Urho3D/Debug/Urho3D.h")
+endif()
+
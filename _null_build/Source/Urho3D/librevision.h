@@ -0,0 +1 @@
+namespace Urho3D { static const char* revision = "Unversioned"; };
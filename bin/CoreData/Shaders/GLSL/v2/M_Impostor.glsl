@@ -0,0 +1,122 @@
+/// M_Impostor.glsl
+/// Octahedral impostor rendered as camera-facing quad.
+/// Expects quad with positions in range [-1, 1] in XY plane and atlas baked by ImpostorBaker.
+/// IMPOSTOR_BLEND: Blend three nearest frames instead of picking the nearest one.
+#define URHO3D_CUSTOM_MATERIAL_UNIFORMS
+
+#include "_Config.glsl"
+#include "_GammaCorrection.glsl"
+
+#include "_Uniforms.glsl"
+
+/// cImpostorCenter.xyz: Impostor center in model space.
+/// cImpostorCenter.w: Impostor radius in model space.
+/// cImpostorFrames.x: Number of frames along each side of the atlas.
+/// cImpostorFrames.y: 1 if the atlas covers upper hemisphere only, 0 otherwise.
+UNIFORM_BUFFER_BEGIN(4, Material)
+    DEFAULT_MATERIAL_UNIFORMS
+    UNIFORM(vec4 cImpostorCenter)
+    UNIFORM(vec2 cImpostorFrames)
+UNIFORM_BUFFER_END(4, Material)
+
+#include "_Samplers.glsl"
+#include "_VertexLayout.glsl"
+
+#include "_VertexTransform.glsl"
+
+VERTEX_OUTPUT_HIGHP(vec2 vTexCoord)
+#ifdef IMPOSTOR_BLEND
+    VERTEX_OUTPUT_HIGHP(vec4 vTexCoord2)
+    VERTEX_OUTPUT(half3 vFrameWeights)
+#endif
+
+#ifdef URHO3D_VERTEX_SHADER
+/// Return sign of value, zero is considered positive.
+vec2 SignNotZero(vec2 value)
+{
+    return vec2(value.x >= 0.0 ? 1.0 : -1.0, value.y >= 0.0 ? 1.0 : -1.0);
+}
+
+/// Convert normalized direction to octahedral coordinates in range [0, 1].
+/// Should match ImpostorBaker::DirectionToOctahedral.
+vec2 DirectionToOctahedral(vec3 dir)
+{
+    vec2 coords;
+    if (cImpostorFrames.y > 0.5)
+    {
+        dir.y = max(dir.y, 0.0);
+        dir /= max(abs(dir.x) + abs(dir.y) + abs(dir.z), 0.0001);
+        coords = vec2(dir.x + dir.z, dir.x - dir.z);
+    }
+    else
+    {
+        dir /= abs(dir.x) + abs(dir.y) + abs(dir.z);
+        coords = dir.y >= 0.0 ? dir.xz : (1.0 - abs(dir.zx)) * SignNotZero(dir.xz);
+    }
+    return coords * 0.5 + 0.5;
+}
+
+/// Return atlas UV of given frame and UV inside frame.
+vec2 GetFrameTexCoord(vec2 frame, vec2 frameUV)
+{
+    frame = clamp(frame, vec2(0.0), vec2(cImpostorFrames.x - 1.0));
+    return (frame + frameUV) / cImpostorFrames.x;
+}
+
+void main()
+{
+    mat4 modelMatrix = GetModelMatrix();
+    mediump mat3 normalMatrix = GetNormalMatrix(modelMatrix);
+
+    // Direction from impostor center to camera in model space
+    vec3 worldCenter = (vec4(cImpostorCenter.xyz, 1.0) * modelMatrix).xyz;
+    vec3 viewDir = normalize(normalMatrix * (cCameraPos - worldCenter));
+
+    // Build quad facing the camera, basis should match ImpostorBaker
+    vec3 upHint = abs(viewDir.y) > 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(0.0, 1.0, 0.0);
+    vec3 right = normalize(cross(viewDir, upHint));
+    vec3 up = cross(right, viewDir);
+    vec3 position = cImpostorCenter.xyz + (iPos.x * right + iPos.y * up) * cImpostorCenter.w;
+
+    gl_Position = WorldToClipSpace((vec4(position, 1.0) * modelMatrix).xyz);
+    ApplyClipPlane(gl_Position);
+
+    vec2 frameUV = vec2(iPos.x * 0.5 + 0.5, 0.5 - iPos.y * 0.5);
+    vec2 gridPos = DirectionToOctahedral(viewDir) * (cImpostorFrames.x - 1.0);
+
+#ifdef IMPOSTOR_BLEND
+    // Blend frames at vertices of grid cell triangle that contains view direction
+    vec2 frame = floor(gridPos);
+    vec2 fraction = gridPos - frame;
+    vec2 secondOffset = fraction.x > fraction.y ? vec2(1.0, 0.0) : vec2(0.0, 1.0);
+    float maxFraction = max(fraction.x, fraction.y);
+    float minFraction = min(fraction.x, fraction.y);
+
+    vTexCoord = GetFrameTexCoord(frame, frameUV);
+    vTexCoord2.xy = GetFrameTexCoord(frame + secondOffset, frameUV);
+    vTexCoord2.zw = GetFrameTexCoord(frame + vec2(1.0), frameUV);
+    vFrameWeights = vec3(1.0 - maxFraction, maxFraction - minFraction, minFraction);
+#else
+    vTexCoord = GetFrameTexCoord(floor(gridPos + 0.5), frameUV);
+#endif
+}
+#endif
+
+#ifdef URHO3D_PIXEL_SHADER
+void main()
+{
+#ifdef IMPOSTOR_BLEND
+    half4 diffInput = texture2D(sDiffMap, vTexCoord) * vFrameWeights.x
+        + texture2D(sDiffMap, vTexCoord2.xy) * vFrameWeights.y
+        + texture2D(sDiffMap, vTexCoord2.zw) * vFrameWeights.z;
+#else
+    half4 diffInput = texture2D(sDiffMap, vTexCoord);
+#endif
+
+    if (diffInput.a < 0.5)
+        discard;
+
+    half4 diffColor = cMatDiffColor * vec4(diffInput.rgb, 1.0);
+    gl_FragColor = GammaToLightSpaceAlpha(diffColor);
+}
+#endif
@@ -146,19 +146,25 @@ option(URHO3D_SSL                               "Enable OpenSSL support"
 
 if (WIN32)
     set(URHO3D_GRAPHICS_API D3D11 CACHE STRING "Graphics API")
-    set_property(CACHE URHO3D_GRAPHICS_API PROPERTY STRINGS D3D9 D3D11 OpenGL)
+    set_property(CACHE URHO3D_GRAPHICS_API PROPERTY STRINGS D3D9 D3D11 OpenGL Null)
     option(URHO3D_WIN32_CONSOLE "Show log messages in win32 console"                     OFF)
 elseif (IOS OR ANDROID)
     set(URHO3D_GRAPHICS_API GLES2 CACHE STRING "Graphics API")
     set_property(CACHE URHO3D_GRAPHICS_API PROPERTY STRINGS GLES2 GLES3)
 else ()
-    set(URHO3D_GRAPHICS_API OpenGL)
+    set(URHO3D_GRAPHICS_API OpenGL CACHE STRING "Graphics API")
+    set_property(CACHE URHO3D_GRAPHICS_API PROPERTY STRINGS OpenGL Null)
 endif ()
 string(TOUPPER "${URHO3D_GRAPHICS_API}" URHO3D_GRAPHICS_API)
 set (URHO3D_${URHO3D_GRAPHICS_API} ON)
 if (URHO3D_GLES2 OR URHO3D_GLES3)
     set (URHO3D_OPENGL ON)
 endif ()
+# Null graphics backend records draw calls on CPU only. Used for headless profiling and testing of rendering code.
+if (URHO3D_NULL)
+    unset (URHO3D_NULL)
+    set (URHO3D_NULL_GRAPHICS ON)
+endif ()
 
 cmake_dependent_option(URHO3D_SPIRV "Enable universal GLSL shaders for other GAPIs via glslang and SpirV" ON "URHO3D_D3D11" OFF)
 # Whether to use legacy renderer. DX11 doesn't support legacy renderer. DX9 supports only legacy renderer.
@@ -183,6 +189,10 @@ elseif (URHO3D_TOOLS AND NOT MINI_URHO)
     set (URHO3D_LOGGING ON)
     set (URHO3D_HASH_DEBUG ON)
 endif ()
+if (URHO3D_NULL_GRAPHICS)
+    # SystemUI requires real rendering backend
+    set (URHO3D_SYSTEMUI OFF)
+endif ()
 
 if (WEB)
     if (URHO3D_CSHARP)